@@ -9,13 +9,28 @@
 //////////////////////////////////////////////////////////////////////
 
 BPLModel::BPLModel(double Mtot, double rb, double beta, double gamma, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, rb, beta, gamma);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void BPLModel::set_parameters(double Mtot, double rb, double beta, double gamma)
 {
     _Mtot = Mtot;
     _rb = rb;
     _beta = beta;
     _gamma = gamma;
     _rhoff = (_beta-3.0)*(3.0-_gamma)/(_beta-_gamma)/(4.0*M_PI);
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> BPLModel::parameters() const
+{
+    return {_Mtot, _rb, _beta, _gamma};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -27,6 +42,35 @@ double BPLModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+std::vector<double> BPLModel::breakpoints() const
+{
+    return std::vector<double>{_rb};
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool BPLModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = 1.0;
+    p = _beta;
+    alpha = 1.0;
+    av = std::vector<double>{_Mtot/pow(_rb,3)*_rhoff};
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool BPLModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = 1.0;
+    p = _gamma;
+    alpha = 1.0;
+    av = std::vector<double>{_Mtot/pow(_rb,3)*_rhoff};
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double BPLModel::density(double r) const
 {
     double dimf = _Mtot/pow(_rb,3);
@@ -37,6 +81,13 @@ double BPLModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void BPLModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = BPLModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double BPLModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_rb,4);
@@ -19,12 +19,30 @@ public:
     
     /** Constructor of the BPLModel class. */
     BPLModel(double Mtot, double rb, double beta, double gamma, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the BPLModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double rb, double beta, double gamma);
+
+    /** This function returns the parameters of the BPLModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the break radius \f$r_{\text{b}}\f$ of the BPL model. */
     double scale_radius() const;
+
+    /** This function returns the break radius \f$r_{\text{b}}\f$ of the BPL model, at which the density slope changes discontinuously. */
+    std::vector<double> breakpoints() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the BPL model, which is the exact power law \f$\rho(r) \propto x^{-\beta}\f$ beyond the break radius. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the BPL model, which is the exact power law \f$\rho(r) \propto x^{-\gamma}\f$ within the break radius. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
     
     /** This function returns the density \f$\rho(r)\f$ of the BPL model at radius \f$r\f$. */
     double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the BPL model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
     
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the BPL model at radius \f$r\f$. */
     double derivative_density(double r) const;
@@ -9,10 +9,25 @@
 //////////////////////////////////////////////////////////////////////
 
 BurkertModel::BurkertModel(double rhos, double rs, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(rhos, rs);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void BurkertModel::set_parameters(double rhos, double rs)
 {
     _rhos = rhos;
     _rs = rs;
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> BurkertModel::parameters() const
+{
+    return {_rhos, _rs};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -35,6 +50,13 @@ double BurkertModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void BurkertModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = BurkertModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double BurkertModel::derivative_density(double r) const
 {
     double dimf = _rhos/_rs;
@@ -20,12 +20,21 @@ public:
     /** Constructor of the BurkertModel class. */
     BurkertModel(double rhos, double rs, const GaussLegendre* gl);
 
+    /** This function changes the parameters of the BurkertModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double rhos, double rs);
+
+    /** This function returns the parameters of the BurkertModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
+
     /** This function returns the scale radius \f$r_{\text{s}}\f$ of the Burkert model. */
     double scale_radius() const;
 
     /** This function returns the density \f$\rho(r)\f$ of the Burkert model at radius \f$r\f$. */
     double density(double r) const;
 
+    /** This function stores the density \f$\rho(r_i)\f$ of the Burkert model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the Burkert model at radius \f$r\f$. */
     double derivative_density(double r) const;
 
@@ -0,0 +1,336 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "CachedModel.hpp"
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The number of shards of the hash table
+    const size_t numshards = 64;
+
+    // The number of entries in each set of the hash table
+    const size_t numways = 4;
+
+    // This function returns the bit pattern of a double
+    uint64_t bits(double x)
+    {
+        uint64_t b;
+        memcpy(&b, &x, sizeof(b));
+        return b;
+    }
+
+    // This function returns the finalizer of the SplitMix64 generator, which mixes all bits of its argument
+    uint64_t mix(uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+CachedModel::CachedModel(const Model* model, const GaussLegendre* gl, size_t capacity)
+    : _shards(numshards), _hits(0), _misses(0)
+{
+    _model = model;
+    _gl = gl;
+    _reltol = model->relative_tolerance();
+    _Mtot = model->total_mass();
+    _Psi0 = model->central_potential();
+
+    // The number of sets per shard is rounded up to a power of two
+
+    _numsets = 1;
+    while (_numsets*numways*numshards<capacity) _numsets *= 2;
+    for (Shard& shard : _shards) shard.entries.assign(_numsets*numways, Entry{0, 0, 0.0, -1});
+}
+
+//////////////////////////////////////////////////////////////////////
+
+uint64_t CachedModel::hash(int k, uint64_t r, uint64_t ra)
+{
+    return mix(r ^ mix(ra + static_cast<uint64_t>(k)));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool CachedModel::find(int k, double r, double ra, double& value) const
+{
+    uint64_t rb = bits(r), rab = bits(ra);
+    uint64_t h = hash(k,rb,rab);
+    Shard& shard = _shards[h%numshards];
+    const Entry* set = shard.entries.data() + ((h/numshards)&(_numsets-1))*numways;
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (size_t w=0; w<numways; w++)
+        if (set[w].profile==k && set[w].r==rb && set[w].ra==rab)
+        {
+            value = set[w].value;
+            return true;
+        }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::insert(int k, double r, double ra, double value) const
+{
+    uint64_t rb = bits(r), rab = bits(ra);
+    uint64_t h = hash(k,rb,rab);
+    Shard& shard = _shards[h%numshards];
+    Entry* set = shard.entries.data() + ((h/numshards)&(_numsets-1))*numways;
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Use an empty entry or the entry that already holds the key, and otherwise replace an entry chosen by the upper
+    // bits of the hash
+
+    size_t victim = (h>>60)%numways;
+    for (size_t w=0; w<numways; w++)
+        if (set[w].profile<0 || (set[w].profile==k && set[w].r==rb && set[w].ra==rab))
+        {
+            victim = w;
+            break;
+        }
+    set[victim] = Entry{rb, rab, value, k};
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Compute> double CachedModel::lookup(int k, double r, double ra, Compute compute) const
+{
+    double value;
+    if (find(k,r,ra,value))
+    {
+        _hits++;
+        return value;
+    }
+    _misses++;
+    value = compute();
+    insert(k,r,ra,value);
+    return value;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Compute> void CachedModel::lookup(int k, const double* r, double* out, size_t n, Compute compute) const
+{
+    std::vector<size_t> iv;
+    for (size_t i=0; i<n; i++)
+        if (!find(k,r[i],0.0,out[i])) iv.push_back(i);
+    _hits += n-iv.size();
+    if (iv.empty()) return;
+    _misses += iv.size();
+    size_t m = iv.size();
+    std::vector<double> rm(m), fm(m);
+    for (size_t j=0; j<m; j++) rm[j] = r[iv[j]];
+    compute(rm.data(),fm.data(),m);
+    for (size_t j=0; j<m; j++)
+    {
+        out[iv[j]] = fm[j];
+        insert(k,rm[j],0.0,fm[j]);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::scale_radius() const
+{
+    return _model->scale_radius();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> CachedModel::parameters() const
+{
+    return _model->parameters();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool CachedModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    return _model->exponential_tail(b,r0,m);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> CachedModel::breakpoints() const
+{
+    return _model->breakpoints();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool CachedModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->outer_expansion(xt,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool CachedModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->inner_expansion(xs,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::total_mass() const
+{
+    return _Mtot;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::central_potential() const
+{
+    return _Psi0;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::density(double r) const
+{
+    return lookup(Rho, r, 0.0, [&]() { return _model->density(r); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::density(const double* r, double* out, size_t n) const
+{
+    lookup(Rho, r, out, n, [&](const double* u, double* f, size_t m) { _model->density(u,f,m); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::derivative_density(double r) const
+{
+    return lookup(DRho, r, 0.0, [&]() { return _model->derivative_density(r); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::derivative_density(const double* r, double* out, size_t n) const
+{
+    lookup(DRho, r, out, n, [&](const double* u, double* f, size_t m) { _model->derivative_density(u,f,m); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::second_derivative_density(double r) const
+{
+    return lookup(D2Rho, r, 0.0, [&]() { return _model->second_derivative_density(r); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::second_derivative_density(const double* r, double* out, size_t n) const
+{
+    lookup(D2Rho, r, out, n, [&](const double* u, double* f, size_t m) { _model->second_derivative_density(u,f,m); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::mass(double r) const
+{
+    return lookup(Mass, r, 0.0, [&]() { return _model->mass(r); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::mass(const double* r, double* out, size_t n) const
+{
+    lookup(Mass, r, out, n, [&](const double* u, double* f, size_t m) { _model->mass(u,f,m); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::potential(double r) const
+{
+    return lookup(Psi, r, 0.0, [&]() { return _model->potential(r); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::potential(const double* r, double* out, size_t n) const
+{
+    lookup(Psi, r, out, n, [&](const double* u, double* f, size_t m) { _model->potential(u,f,m); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    _model->mass_and_potential_profiles(rv,Mv,Psiv);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::surface_density(double R) const
+{
+    return lookup(Sigma, R, 0.0, [&]() { return _model->surface_density(R); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::surface_density(const double* R, double* out, size_t n) const
+{
+    lookup(Sigma, R, out, n, [&](const double* u, double* f, size_t m) { _model->surface_density(u,f,m); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::derivative_surface_density(double R) const
+{
+    return lookup(DSigma, R, 0.0, [&]() { return _model->derivative_surface_density(R); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void CachedModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    lookup(DSigma, R, out, n, [&](const double* u, double* f, size_t m) { _model->derivative_surface_density(u,f,m); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::surface_density_slope(double R) const
+{
+    return lookup(SigmaSlope, R, 0.0, [&]() { return _model->surface_density_slope(R); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::isotropic_distribution_function(double r) const
+{
+    return lookup(DFIso, r, 0.0, [&]() { return _model->isotropic_distribution_function(r); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double CachedModel::osipkov_merritt_distribution_function(double r, double ra) const
+{
+    return lookup(DFOM, r, ra, [&]() { return _model->osipkov_merritt_distribution_function(r,ra); });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+size_t CachedModel::num_hits() const
+{
+    return _hits;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+size_t CachedModel::num_misses() const
+{
+    return _misses;
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,172 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef CACHEDMODEL_HPP
+#define CACHEDMODEL_HPP
+
+#include "Model.hpp"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////
+
+/** CachedModel is a subclass of the Model class that wraps any other model and memoizes the results of its radial profiles, i.e. the density and its derivatives, the mass, the potential, the surface density, its derivative and slope, and the isotropic and Osipkov-Merritt distribution functions. Every profile is forwarded to the wrapped model the first time it is requested at a given radius, and served from a hash table afterwards. Unlike the TabulatedModel and ChebyshevModel classes, the cached model hence returns exactly the same values as the wrapped model. All other properties of the model, such as the dispersions, the moments of the distribution function and the global properties, are calculated by the Model base class from the cached profiles, such that the many integrals that evaluate the profiles at the same radii, for example at the nodes of the outer integrals of the moments of the distribution function or for the different columns of the routine run_model(), share these evaluations.
+
+    The hash table has a fixed capacity, such that its memory use is bounded. It is split into shards that are each protected by their own mutex, such that several threads that share the cached model rarely contend for the same lock. Each shard consists of sets of four entries; an entry is looked up in the set selected by the hash of the profile and the radius, and a new entry replaces an arbitrary entry of its set when the set is full. The wrapped model is called outside of the locks, such that threads never wait for each other's profile evaluations. */
+
+class CachedModel : public Model
+{
+public:
+
+    /** Constructor of the CachedModel class. It reads in the wrapped model, which should remain alive and unchanged as long as the cached model is used, the Gauss-Legendre integrator for the integrals of the cached model, and the capacity of the hash table, i.e. the maximum number of cached values. The relative tolerance of the wrapped model is adopted. The total mass and central potential are copied at construction, and neither they nor the cached values are invalidated when the parameters or integrators of the wrapped model change. */
+    CachedModel(const Model* model, const GaussLegendre* gl, size_t capacity = 1<<20);
+
+    /** This function returns the scale radius of the wrapped model. */
+    double scale_radius() const;
+
+    /** This function returns the parameters of the wrapped model. */
+    std::vector<double> parameters() const;
+
+    /** This function returns the stretched exponential tail of the wrapped model, if it has one. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+
+    /** This function returns the breakpoints of the wrapped model. */
+    std::vector<double> breakpoints() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the wrapped model, if it has one. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the wrapped model, if it has one. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the total mass \f$M_{\text{tot}}\f$ of the wrapped model, which is calculated once at construction. */
+    double total_mass() const;
+
+    /** This function returns the central potential \f$\Psi_0\f$ of the wrapped model, which is calculated once at construction. */
+    double central_potential() const;
+
+    /** This function returns the density \f$\rho(r)\f$ of the wrapped model at radius \f$r\f$. */
+    double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the wrapped model at the \f$n\f$ radii \f$r_i\f$ in the array out. The radii that are not yet in the hash table are passed to the wrapped model in a single batch. */
+    void density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the derivative of the density \f$\rho'(r)\f$ of the wrapped model at radius \f$r\f$. */
+    double derivative_density(double r) const;
+
+    /** This function stores the derivative of the density \f$\rho'(r_i)\f$ of the wrapped model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the second derivative of the density \f$\rho''(r)\f$ of the wrapped model at radius \f$r\f$. */
+    double second_derivative_density(double r) const;
+
+    /** This function stores the second derivative of the density \f$\rho''(r_i)\f$ of the wrapped model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void second_derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the mass \f$M(r)\f$ of the wrapped model at radius \f$r\f$. */
+    double mass(double r) const;
+
+    /** This function stores the mass \f$M(r_i)\f$ of the wrapped model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void mass(const double* r, double* out, size_t n) const;
+
+    /** This function returns the potential \f$\Psi(r)\f$ of the wrapped model at radius \f$r\f$. */
+    double potential(double r) const;
+
+    /** This function stores the potential \f$\Psi(r_i)\f$ of the wrapped model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void potential(const double* r, double* out, size_t n) const;
+
+    /** This function calculates the mass and the potential of the wrapped model at the radii in the vector rv with the function mass_and_potential_profiles() of the wrapped model. */
+    void mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
+
+    /** This function returns the surface density \f$\Sigma(R)\f$ of the wrapped model at projected radius \f$R\f$. */
+    double surface_density(double R) const;
+
+    /** This function stores the surface density \f$\Sigma(R_i)\f$ of the wrapped model at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ of the wrapped model at projected radius \f$R\f$. */
+    double derivative_surface_density(double R) const;
+
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ of the wrapped model at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the surface density slope \f$\gamma_{\text{p}}(R)\f$ of the wrapped model at projected radius \f$R\f$. */
+    double surface_density_slope(double R) const;
+
+    /** This function returns the isotropic distribution function \f$f_{\text{iso}}({\cal{E}})\f$ of the wrapped model at binding energy \f${\cal{E}}=\Psi(r)\f$. */
+    double isotropic_distribution_function(double r) const;
+
+    /** This function returns the Osipkov-Merritt distribution function \f$f_{\text{om}}(Q)\f$ of the wrapped model at \f$Q=\Psi(r)\f$ for anisotropy radius \f$r_{\text{a}}\f$. */
+    double osipkov_merritt_distribution_function(double r, double ra) const;
+
+    /** This function returns the number of profile evaluations that were served from the hash table. */
+    size_t num_hits() const;
+
+    /** This function returns the number of profile evaluations that were forwarded to the wrapped model. */
+    size_t num_misses() const;
+
+private:
+
+    /** The cached profiles. */
+    enum Profile { Rho, DRho, D2Rho, Mass, Psi, Sigma, DSigma, SigmaSlope, DFIso, DFOM };
+
+    /** Entry is a structure that holds a cached value, with the profile, the radius and the anisotropy radius as key. The radii are stored as their bit patterns, such that the cache returns a value only for exactly the same arguments. An entry with a negative profile is empty. */
+    struct Entry
+    {
+        uint64_t r;
+        uint64_t ra;
+        double value;
+        int profile;
+    };
+
+    /** Shard is a structure that holds a part of the hash table, protected by its own mutex. */
+    struct Shard
+    {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+    };
+
+    /** This function returns the hash of the profile \f$k\f$ at radius \f$r\f$ and anisotropy radius \f$r_{\text{a}}\f$. */
+    static uint64_t hash(int k, uint64_t r, uint64_t ra);
+
+    /** This function looks up profile \f$k\f$ at radius \f$r\f$ and anisotropy radius \f$r_{\text{a}}\f$ in the hash table and stores it in value. It returns true if the value was found. */
+    bool find(int k, double r, double ra, double& value) const;
+
+    /** This function stores profile \f$k\f$ at radius \f$r\f$ and anisotropy radius \f$r_{\text{a}}\f$ in the hash table. */
+    void insert(int k, double r, double ra, double value) const;
+
+    /** This function returns profile \f$k\f$ at radius \f$r\f$ and anisotropy radius \f$r_{\text{a}}\f$ from the hash table or, if it is not found, from the function compute, whose result is then stored in the hash table. */
+    template<typename Compute> double lookup(int k, double r, double ra, Compute compute) const;
+
+    /** This function stores profile \f$k\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out, from the hash table where possible and from a single call of the batched function compute for the remaining radii. */
+    template<typename Compute> void lookup(int k, const double* r, double* out, size_t n, Compute compute) const;
+
+    /** The wrapped model. */
+    const Model* _model;
+
+    /** The total mass of the wrapped model. */
+    double _Mtot;
+
+    /** The central potential of the wrapped model. */
+    double _Psi0;
+
+    /** The number of sets of four entries in each shard. */
+    size_t _numsets;
+
+    /** The shards of the hash table. */
+    mutable std::vector<Shard> _shards;
+
+    /** The number of profile evaluations served from the hash table. */
+    mutable std::atomic<size_t> _hits;
+
+    /** The number of profile evaluations forwarded to the wrapped model. */
+    mutable std::atomic<size_t> _misses;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
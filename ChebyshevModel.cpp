@@ -0,0 +1,377 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "ChebyshevModel.hpp"
+#include <array>
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The degree of the Chebyshev expansions on each panel
+    const int N = 16;
+
+    // The width in ln r of the initial panels
+    const double hinit = 2.0;
+
+    // The width in ln r below which panels are no longer bisected
+    const double hmin = 1e-3;
+
+    // The factor by which a bisection should at least reduce the last coefficients of an expansion
+    const double minreduction = 2.0;
+
+    // The number of sampled profiles, i.e. the series LogRho, LogMass, LogPsi and LogSigma
+    const int numsampled = 4;
+
+    // This function stores the coefficients of the derivative of the Chebyshev series c with respect to x in d,
+    // for a panel of width h in x
+    void differentiate(const double* c, double* d, double h)
+    {
+        d[N] = 0.0;
+        double dk1 = 0.0, dk2 = 0.0;
+        for (int k=N; k>=1; k--)
+        {
+            double dk = dk2 + 2.0*k*c[k];
+            d[k-1] = dk;
+            dk2 = dk1;
+            dk1 = dk;
+        }
+        d[0] *= 0.5;
+        for (int k=0; k<=N; k++) d[k] *= 2.0/h;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ChebyshevModel::ChebyshevModel(const Model* model, const GaussLegendre* gl, double tol, double xmin, double xmax)
+{
+    _model = model;
+    _gl = gl;
+    _Mtot = model->total_mass();
+    _Psi0 = model->central_potential();
+
+    // Set up the initial panels, with the breakpoints of the model as additional boundaries
+
+    double rs = model->scale_radius();
+    std::vector<double> bv = {log(xmin*rs), log(xmax*rs)};
+    for (double rbp : model->breakpoints())
+        if (rbp>xmin*rs && rbp<xmax*rs) bv.push_back(log(rbp));
+    std::sort(bv.begin(),bv.end());
+    bv.erase(std::unique(bv.begin(),bv.end()),bv.end());
+
+    typedef std::array<double,numsampled> Tails;
+    Tails unknown;
+    unknown.fill(std::numeric_limits<double>::infinity());
+    struct Pending
+    {
+        double a;
+        double b;
+        Tails parent;
+    };
+    std::vector<Pending> pending;
+    for (size_t i=0; i+1<bv.size(); i++)
+    {
+        int num = static_cast<int>(ceil((bv[i+1]-bv[i])/hinit));
+        for (int j=0; j<num; j++)
+            pending.push_back({bv[i]+(bv[i+1]-bv[i])*j/num, bv[i]+(bv[i+1]-bv[i])*(j+1)/num, unknown});
+    }
+
+    // Sample the profiles at the Chebyshev-Lobatto points of all pending panels at once, and bisect the panels whose
+    // expansions have not converged
+
+    while (!pending.empty())
+    {
+        size_t m = pending.size();
+        size_t n = m*(N+1);
+        std::vector<double> rv(n), fv(numsampled*n);
+        for (size_t p=0; p<m; p++)
+            for (int j=0; j<=N; j++)
+                rv[p*(N+1)+j] = exp(0.5*(pending[p].a+pending[p].b) + 0.5*(pending[p].b-pending[p].a)*cos(j*M_PI/N));
+        _model->density(rv.data(), fv.data()+LogRho*n, n);
+        _model->mass(rv.data(), fv.data()+LogMass*n, n);
+        _model->potential(rv.data(), fv.data()+LogPsi*n, n);
+        _model->surface_density(rv.data(), fv.data()+LogSigma*n, n);
+
+        std::vector<Pending> next;
+        for (size_t p=0; p<m; p++)
+        {
+            const Pending& P = pending[p];
+            double h = P.b-P.a;
+            bool positive = true;
+            for (int s=0; s<numsampled; s++)
+                for (int j=0; j<=N; j++)
+                {
+                    double f = fv[s*n+p*(N+1)+j];
+                    if (!(f>0.0 && f<std::numeric_limits<double>::infinity())) positive = false;
+                }
+            if (!positive)
+            {
+                if (h>hmin)
+                {
+                    next.push_back({P.a, 0.5*(P.a+P.b), unknown});
+                    next.push_back({0.5*(P.a+P.b), P.b, unknown});
+                }
+                else _panels.push_back({P.a, P.b, true, std::vector<double>()});
+                continue;
+            }
+
+            // The coefficients c_k = (2/N) sum_j'' f_j cos(jk pi/N), with the first and last terms halved
+
+            std::vector<double> c(NumSeries*(N+1));
+            Tails tails;
+            bool split = false;
+            for (int s=0; s<numsampled; s++)
+            {
+                double* cs = c.data()+s*(N+1);
+                for (int k=0; k<=N; k++)
+                {
+                    double sum = 0.0;
+                    for (int j=0; j<=N; j++)
+                    {
+                        double w = (j==0 || j==N) ? 0.5 : 1.0;
+                        sum += w * log(fv[s*n+p*(N+1)+j]) * cos(j*k*M_PI/N);
+                    }
+                    cs[k] = 2.0/N * sum;
+                }
+                cs[0] *= 0.5;
+                cs[N] *= 0.5;
+                tails[s] = fabs(cs[N-1]) + fabs(cs[N]);
+                if (tails[s]>tol && tails[s]*minreduction<P.parent[s] && h>hmin) split = true;
+            }
+            if (split)
+            {
+                next.push_back({P.a, 0.5*(P.a+P.b), tails});
+                next.push_back({0.5*(P.a+P.b), P.b, tails});
+                continue;
+            }
+            differentiate(c.data()+LogRho*(N+1), c.data()+DLogRho*(N+1), h);
+            differentiate(c.data()+DLogRho*(N+1), c.data()+D2LogRho*(N+1), h);
+            differentiate(c.data()+LogSigma*(N+1), c.data()+DLogSigma*(N+1), h);
+            _panels.push_back({P.a, P.b, false, c});
+        }
+        pending.swap(next);
+    }
+
+    std::sort(_panels.begin(), _panels.end(), [](const Panel& P1, const Panel& P2) { return P1.a<P2.a; });
+    for (const Panel& P : _panels) _av.push_back(P.a);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int ChebyshevModel::locate(double r, double& t) const
+{
+    double x = log(r);
+    if (!(x>=_av.front() && x<=_panels.back().b)) return -1;
+    int p = static_cast<int>(std::upper_bound(_av.begin(),_av.end(),x) - _av.begin()) - 1;
+    const Panel& P = _panels[max(p,0)];
+    if (P.direct) return -1;
+    t = (2.0*x-P.a-P.b)/(P.b-P.a);
+    return max(p,0);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::evaluate(int p, int s, double t) const
+{
+    const double* c = _panels[p].c.data()+s*(N+1);
+    double b1 = 0.0, b2 = 0.0;
+    for (int k=N; k>=1; k--)
+    {
+        double b0 = 2.0*t*b1 - b2 + c[k];
+        b2 = b1;
+        b1 = b0;
+    }
+    return c[0] + t*b1 - b2;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::scale_radius() const
+{
+    return _model->scale_radius();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> ChebyshevModel::parameters() const
+{
+    return _model->parameters();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool ChebyshevModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    return _model->exponential_tail(b,r0,m);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> ChebyshevModel::breakpoints() const
+{
+    return _model->breakpoints();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool ChebyshevModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->outer_expansion(xt,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool ChebyshevModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->inner_expansion(xs,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::total_mass() const
+{
+    return _Mtot;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::central_potential() const
+{
+    return _Psi0;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::density(double r) const
+{
+    double t;
+    int p = locate(r,t);
+    if (p<0) return _model->density(r);
+    return exp(evaluate(p,LogRho,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ChebyshevModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ChebyshevModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::derivative_density(double r) const
+{
+    double t;
+    int p = locate(r,t);
+    if (p<0) return _model->derivative_density(r);
+    double rho = exp(evaluate(p,LogRho,t));
+    return rho/r * evaluate(p,DLogRho,t);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ChebyshevModel::derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ChebyshevModel::derivative_density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::second_derivative_density(double r) const
+{
+    double t;
+    int p = locate(r,t);
+    if (p<0) return _model->second_derivative_density(r);
+    double rho = exp(evaluate(p,LogRho,t));
+    double L1 = evaluate(p,DLogRho,t);
+    double L2 = evaluate(p,D2LogRho,t);
+    return rho/(r*r) * (L2 + L1*L1 - L1);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ChebyshevModel::second_derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ChebyshevModel::second_derivative_density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::mass(double r) const
+{
+    double t;
+    int p = locate(r,t);
+    if (p<0) return _model->mass(r);
+    return exp(evaluate(p,LogMass,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ChebyshevModel::mass(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ChebyshevModel::mass(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::potential(double r) const
+{
+    double t;
+    int p = locate(r,t);
+    if (p<0) return _model->potential(r);
+    return exp(evaluate(p,LogPsi,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ChebyshevModel::potential(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ChebyshevModel::potential(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::surface_density(double R) const
+{
+    double t;
+    int p = locate(R,t);
+    if (p<0) return _model->surface_density(R);
+    return exp(evaluate(p,LogSigma,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ChebyshevModel::surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ChebyshevModel::surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ChebyshevModel::derivative_surface_density(double R) const
+{
+    double t;
+    int p = locate(R,t);
+    if (p<0) return _model->derivative_surface_density(R);
+    double Sigma = exp(evaluate(p,LogSigma,t));
+    return Sigma/R * evaluate(p,DLogSigma,t);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ChebyshevModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ChebyshevModel::derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+size_t ChebyshevModel::num_panels() const
+{
+    return _panels.size();
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,132 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef CHEBYSHEVMODEL_HPP
+#define CHEBYSHEVMODEL_HPP
+
+#include "Model.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** ChebyshevModel is a subclass of the Model class that wraps any other model and replaces its radial profiles by piecewise Chebyshev expansions in \f$x = \ln r\f$. At construction, the logarithms of the density \f$\rho(r)\f$, the mass \f$M(r)\f$, the potential \f$\Psi(r)\f$ and the surface density \f$\Sigma(R)\f$ are sampled at the Chebyshev-Lobatto points of a set of panels, \f[ \ln f(r) \approx \sum_{k=0}^N c_k\, T_k(t), \qquad t = \frac{2x-a-b}{b-a}, \f] with \f$[a,b]\f$ the panel in \f$x\f$ and \f$N=16\f$. Panels are bisected until the last two coefficients of every expansion are smaller than the tolerance, which is then an estimate of the relative error of the profiles. Since the logarithm of most profiles is a smooth and slowly varying function of \f$\ln r\f$, a few dozen panels usually suffice to reach close to machine precision. Panels where bisection no longer reduces the coefficients, because the profiles of the wrapped model are themselves only accurate to a lower precision, are not bisected further.
+
+    The derivatives of the density and the surface density are not sampled, but follow from the derivatives of the expansions, \f[ \rho'(r) = \frac{\rho}{r}\,\frac{{\text{d}}\ln\rho}{{\text{d}}x}, \qquad \rho''(r) = \frac{\rho}{r^2} \left[ \frac{{\text{d}}^2\ln\rho}{{\text{d}}x^2} + \left(\frac{{\text{d}}\ln\rho}{{\text{d}}x}\right)^2 - \frac{{\text{d}}\ln\rho}{{\text{d}}x} \right], \f] such that the density and its derivatives are exactly consistent with each other. This matters for the distribution function, whose integrand combines \f$\rho\f$, \f$\rho'\f$ and \f$\rho''\f$. Each profile costs a single Chebyshev sum of \f$N+1\f$ terms, rather than the nested quadratures of, for example, the subclasses of the SurfaceDensityModel class. Outside the expanded range, and on panels where a profile is not strictly positive, all profiles are obtained from the wrapped model directly. */
+
+class ChebyshevModel : public Model
+{
+public:
+
+    /** Constructor of the ChebyshevModel class. It reads in the wrapped model, which should remain alive and unchanged as long as the Chebyshev model is used, the Gauss-Legendre integrator for the integrals of the Chebyshev model, the tolerance of the expansions, and the range of the expansions in units of the scale radius of the wrapped model. The expansions, the total mass and the central potential are calculated at construction, and are not invalidated when the parameters or integrators of the wrapped model change. */
+    ChebyshevModel(const Model* model, const GaussLegendre* gl, double tol = 1e-13, double xmin = 1e-4, double xmax = 1e4);
+
+    /** This function returns the scale radius of the wrapped model. */
+    double scale_radius() const;
+
+    /** This function returns the parameters of the wrapped model. */
+    std::vector<double> parameters() const;
+
+    /** This function returns the stretched exponential tail of the wrapped model, if it has one. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+
+    /** This function returns the breakpoints of the wrapped model. These radii are also panel boundaries, such that no panel straddles them. */
+    std::vector<double> breakpoints() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the wrapped model, if it has one. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the wrapped model, if it has one. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the total mass \f$M_{\text{tot}}\f$ of the wrapped model, which is calculated once at construction. */
+    double total_mass() const;
+
+    /** This function returns the central potential \f$\Psi_0\f$ of the wrapped model, which is calculated once at construction. */
+    double central_potential() const;
+
+    /** This function returns the density \f$\rho(r)\f$ at radius \f$r\f$ from its Chebyshev expansion. */
+    double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the derivative of the density \f$\rho'(r)\f$ at radius \f$r\f$ from the derivative of the Chebyshev expansion. */
+    double derivative_density(double r) const;
+
+    /** This function stores the derivative of the density \f$\rho'(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the second derivative of the density \f$\rho''(r)\f$ at radius \f$r\f$ from the first and second derivatives of the Chebyshev expansion. */
+    double second_derivative_density(double r) const;
+
+    /** This function stores the second derivative of the density \f$\rho''(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void second_derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the mass \f$M(r)\f$ at radius \f$r\f$ from its Chebyshev expansion. */
+    double mass(double r) const;
+
+    /** This function stores the mass \f$M(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void mass(const double* r, double* out, size_t n) const;
+
+    /** This function returns the potential \f$\Psi(r)\f$ at radius \f$r\f$ from its Chebyshev expansion. */
+    double potential(double r) const;
+
+    /** This function stores the potential \f$\Psi(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void potential(const double* r, double* out, size_t n) const;
+
+    /** This function returns the surface density \f$\Sigma(R)\f$ at projected radius \f$R\f$ from its Chebyshev expansion. */
+    double surface_density(double R) const;
+
+    /** This function stores the surface density \f$\Sigma(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ at projected radius \f$R\f$ from the derivative of the Chebyshev expansion. */
+    double derivative_surface_density(double R) const;
+
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the number of panels of the expansions. */
+    size_t num_panels() const;
+
+private:
+
+    /** The Chebyshev series of each panel: the logarithms of the sampled profiles, and the derivatives with respect to \f$x\f$ of the logarithms of the density and the surface density. */
+    enum Series { LogRho, LogMass, LogPsi, LogSigma, DLogRho, D2LogRho, DLogSigma, NumSeries };
+
+    /** Panel is a structure that describes a panel \f$[a,b]\f$ in \f$x = \ln r\f$ with the coefficients of all series, stored in c[s*(N+1)+k]. If direct is true, the profiles on the panel are obtained from the wrapped model. */
+    struct Panel
+    {
+        double a;
+        double b;
+        bool direct;
+        std::vector<double> c;
+    };
+
+    /** This function returns the index of the panel that contains radius \f$r\f$ and stores the corresponding value of \f$t\f$, or returns -1 if the profiles at that radius should be obtained from the wrapped model. */
+    int locate(double r, double& t) const;
+
+    /** This function returns the value of series \f$s\f$ of panel \f$p\f$ at \f$t\f$, using Clenshaw's recurrence. */
+    double evaluate(int p, int s, double t) const;
+
+    /** The wrapped model. */
+    const Model* _model;
+
+    /** The total mass of the wrapped model. */
+    double _Mtot;
+
+    /** The central potential of the wrapped model. */
+    double _Psi0;
+
+    /** The panels, sorted in \f$x\f$. */
+    std::vector<Panel> _panels;
+
+    /** The lower boundaries of the panels, for the lookup. */
+    std::vector<double> _av;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
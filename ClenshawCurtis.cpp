@@ -0,0 +1,128 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "ClenshawCurtis.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The lowest level at which the refinement may stop; coarser levels can agree by accident
+    const int minlevel = 3;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ClenshawCurtis::ClenshawCurtis(double reltol, int maxlevel)
+{
+    _reltol = reltol;
+    _maxlevel = max(maxlevel, minlevel);
+    _wv.resize(_maxlevel+1);
+    for (int level=1; level<=_maxlevel; level++)
+    {
+        int N = 1 << level;
+        _wv[level].resize(N-1);
+
+        // The weights are symmetric, w_j = w_(N-j)
+
+        for (int j=1; j<=N/2; j++)
+        {
+            double theta = j*M_PI/N;
+            double sum = 0.0;
+            for (int m=1; m<=N/2; m++) sum += sin((2*m-1)*theta)/(2*m-1);
+            double w = 4.0*sin(theta)/N * sum;
+            _wv[level][j-1] = w;
+            _wv[level][N-j-1] = w;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ClenshawCurtis::integrate_0_infty(std::function<void(const double*, double*, size_t)> X, double rb, double* abserr) const
+{
+    return integrate_segments(X, {{0.0,rb,false}, {0.0,rb,true}}, abserr);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ClenshawCurtis::integrate_0_r(std::function<void(const double*, double*, size_t)> X, double r, double rb, double* abserr) const
+{
+    if (r<=rb)
+        return integrate_segments(X, {{0.0,r,false}}, abserr);
+    else
+        return integrate_segments(X, {{0.0,rb,false}, {asin(rb/r),r,false}}, abserr);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ClenshawCurtis::integrate_r_infty(std::function<void(const double*, double*, size_t)> X, double r, double rb, double* abserr) const
+{
+    double eps = 1e-4;
+    if (r/rb >= 1.0-eps)
+        return integrate_segments(X, {{0.0,r,true}}, abserr);
+    else
+        return integrate_segments(X, {{asin(r/rb),r,true}, {0.0,rb,true}}, abserr);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ClenshawCurtis::integrate_segments(const std::function<void(const double*, double*, size_t)>& X, const std::vector<Segment>& segments, double* abserr) const
+{
+    // The weighted integrand values of the current level, per segment, at the nodes j = 1,...,N-1
+    std::vector<std::vector<double>> fv(segments.size());
+
+    double result = 0.0;
+    double error = 0.0;
+    for (int level=1; level<=_maxlevel; level++)
+    {
+        int N = 1 << level;
+
+        // Map the new nodes, i.e. those with odd j, of all segments. Writing theta = pi/2 - d, the distance to the
+        // upper end point is d = h (1-x)/2 = h sin^2(j pi/2N), with h = pi/2 - a, such that sin(theta) = cos(d) and
+        // cos(theta) = sin(d) are accurate close to the end point.
+
+        std::vector<double> uv, jv;
+        for (const Segment& S : segments)
+        {
+            double h = 0.5*M_PI - S.a;
+            for (int j=1; j<N; j+=2)
+            {
+                double t = sin(0.5*j*M_PI/N);
+                double d = h*t*t;
+                double s = cos(d);
+                double c = sin(d);
+                uv.push_back(S.csc ? S.R/s : S.R*s);
+                jv.push_back(0.5*h * (S.csc ? S.R*c/(s*s) : S.R*c));
+            }
+        }
+        std::vector<double> Xv(uv.size());
+        X(uv.data(), Xv.data(), uv.size());
+
+        // Merge the new values with those of the previous level, whose node j is node 2j at this level
+
+        double sum = 0.0;
+        size_t n = 0;
+        for (size_t k=0; k<segments.size(); k++)
+        {
+            std::vector<double> gv(N-1);
+            for (int j=1; j<N; j++)
+            {
+                if (j%2) { gv[j-1] = Xv[n]*jv[n]; n++; }
+                else gv[j-1] = fv[k][j/2-1];
+                sum += _wv[level][j-1] * gv[j-1];
+            }
+            fv[k].swap(gv);
+        }
+        error = fabs(sum-result);
+        result = sum;
+        if (level>=minlevel && error<=_reltol*fabs(result)) break;
+    }
+    if (abserr) *abserr = error;
+    return result;
+}
+
+//////////////////////////////////////////////////////////////////////
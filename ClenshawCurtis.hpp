@@ -0,0 +1,60 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef CLENSHAWCURTIS_HPP
+#define CLENSHAWCURTIS_HPP
+
+#include "Basics.hpp"
+#include <functional>
+
+//////////////////////////////////////////////////////////////////////
+
+/** ClenshawCurtis is the class that represents nested Clenshaw-Curtis integrators with progressive refinement. At level \f$k\f$, an integral over the interval \f$[-1,1]\f$ is approximated by the interpolatory rule with the \f$2^k-1\f$ nodes \f$x_j = \cos(j\pi/2^k)\f$, \f$j=1,\dots,2^k-1\f$, \f[ \int_{-1}^1 f(x)\,{\text{d}}x \approx \sum_{j=1}^{2^k-1} w_j\,f(x_j), \qquad w_j = \frac{4\sin\vartheta_j}{2^k} \sum_{m=1}^{2^{k-1}} \frac{\sin[(2m-1)\,\vartheta_j]}{2m-1}, \qquad \vartheta_j = \frac{j\pi}{2^k}. \f] This is the open variant of the Clenshaw-Curtis rule, also known as Fejér's second rule, which does not evaluate the integrand at the end points. The rules are nested: all nodes of level \f$k\f$ are also nodes of level \f$k+1\f$, such that each refinement only evaluates the integrand at the \f$2^k\f$ new nodes, and the difference between two successive levels is a free estimate of the error. For more background information, see <a href="https://doi.org/10.1137/060659831">Trefethen (2008)</a>.
+
+    The integration routines use the same substitutions \f$u = r\sin\theta\f$ and \f$u = r\csc\theta\f$ as the GaussLegendre class, and the same batched integrands as its batch routines: at each level, the integrand is called once with the array of all new nodes. This makes a ClenshawCurtis integrator suited for convergence studies of integrals with an expensive integrand, such as the global properties of a model that involve the distribution function: a run at the highest level costs no more than the single most accurate run with a fixed rule, and provides its own error estimate. */
+
+class ClenshawCurtis
+{
+public:
+
+    /** Constructor for the ClenshawCurtis class. It reads in the relative tolerance that determines when the refinement stops, and the maximum number of refinement levels, and precomputes the weights of all levels. The refinement always proceeds to at least level 3, i.e. 7 nodes per segment. */
+    ClenshawCurtis(double reltol = 1e-10, int maxlevel = 10);
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, using the same substitutions as the function GaussLegendre::integrate_0_infty(). If abserr is not a null pointer, the absolute difference between the last two levels is stored as an error estimate. */
+    double integrate_0_infty(std::function<void(const double* u, double* X, size_t n)> X, double rb, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[0,r]\f$, using the same substitutions as the function GaussLegendre::integrate_0_r(), and an error estimate as in the function integrate_0_infty(). */
+    double integrate_0_r(std::function<void(const double* u, double* X, size_t n)> X, double r, double rb, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, using the same substitutions as the function GaussLegendre::integrate_r_infty(), and an error estimate as in the function integrate_0_infty(). */
+    double integrate_r_infty(std::function<void(const double* u, double* X, size_t n)> X, double r, double rb, double* abserr = nullptr) const;
+
+private:
+
+    /** Segment is a structure that describes a segment \f$[a,\pi/2]\f$ in \f$\theta\f$, with the substitution \f$u = R\csc\theta\f$ if csc is true, or \f$u = R\sin\theta\f$ otherwise. */
+    struct Segment
+    {
+        double a;
+        double R;
+        bool csc;
+    };
+
+    /** This function returns the estimate of the sum of the integrals of the batched function \f$X(u)\f$ over the given segments. All segments are refined together, and the refinement stops as soon as two successive levels agree to within the relative tolerance. */
+    double integrate_segments(const std::function<void(const double*, double*, size_t)>& X, const std::vector<Segment>& segments, double* abserr) const;
+
+    /** The relative tolerance. */
+    double _reltol;
+
+    /** The maximum number of refinement levels. */
+    int _maxlevel;
+
+    /** The weights \f$w_j\f$ of all levels \f$k\f$, stored in _wv[k]. */
+    std::vector<std::vector<double>> _wv;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
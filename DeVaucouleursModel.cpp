@@ -9,12 +9,27 @@
 //////////////////////////////////////////////////////////////////////
 
 DeVaucouleursModel::DeVaucouleursModel(double Mtot, double Reff, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, Reff);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void DeVaucouleursModel::set_parameters(double Mtot, double Reff)
 {
     _Mtot = Mtot;
     _Reff = Reff;
     _b = 7.669249442500804;
     _Sigmaff = pow(_b,8.0) / (40320.0*M_PI);
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> DeVaucouleursModel::parameters() const
+{
+    return {_Mtot, _Reff};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -26,6 +41,16 @@ double DeVaucouleursModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool DeVaucouleursModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    b = _b;
+    r0 = _Reff;
+    m = 4.0;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double DeVaucouleursModel::surface_density(double R) const
 {
     double dimf = _Mtot/pow(_Reff,2);
@@ -48,6 +73,13 @@ double DeVaucouleursModel::derivative_surface_density(double R) const
 
 //////////////////////////////////////////////////////////////////////
 
+void DeVaucouleursModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = DeVaucouleursModel::derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double DeVaucouleursModel::second_derivative_surface_density(double R) const
 {
     double dimf = _Mtot/pow(_Reff,4);
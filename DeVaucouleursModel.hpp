@@ -19,15 +19,27 @@ public:
     
     /** Constructor of the DeVaucouleursModel class. */
     DeVaucouleursModel(double Mtot, double Reff, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the DeVaucouleursModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double Reff);
+
+    /** This function returns the parameters of the DeVaucouleursModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the effective radius \f$R_{\text{eff}}\f$ of the de Vaucouleurs model. */
     double scale_radius() const;
     
+    /** This function returns true, since the density of the de Vaucouleurs model decays as \f$\exp[-b\,(r/R_{\text{eff}})^{1/4}]\f$ at large radii, and stores the corresponding parameters. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+    
     /** This function returns the surface density \f$\Sigma(R)\f$ of the de Vaucouleurs model at projected radius \f$R\f$. */
     double surface_density(double R) const;
 
     /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ of the de Vaucouleurs model at projected radius \f$R\f$. */
     double derivative_surface_density(double R) const;
+
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ of the de Vaucouleurs model at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
     
     /** This function returns the second derivative of the surface density \f$\Sigma''(R)\f$ of the de Vaucouleurs model at projected radius \f$R\f$. */
     double second_derivative_surface_density(double R) const;
@@ -10,68 +10,204 @@
 
 //////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // The number of nodes of the Gauss-Legendre rule on each panel of the cumulative sweep
+    const int numsweep = 16;
+
+    // The maximum width in ln u of the panels of the cumulative sweep
+    const double hsweep = 0.5;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double DensityModel::mass(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    double I;
+    if (inner_integral(r,2.0,I)) return 4.0*M_PI*I;
+    if (outer_integral(r,2.0,0,0.0,I)) return total_mass() - 4.0*M_PI*I;
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return density(u) * (u*u);
+        density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i]*u[i];
     };
-    return 4.0*M_PI * _gl->integrate_0_r(integrand,r,scale_radius());
+    return 4.0*M_PI * integrate_0_r_batch(integrand,r);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double DensityModel::total_mass() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    return _Mtotmemo.get([&]()
     {
-        return density(u) * (u*u);
-    };
-    return 4.0*M_PI*_gl->integrate_0_infty(integrand,scale_radius());
+        std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+        {
+            density(u,X,n);
+            for (size_t i=0; i<n; i++) X[i] *= u[i]*u[i];
+        };
+        return 4.0*M_PI*integrate_0_infty_batch(integrand);
+    });
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double DensityModel::potential(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    double I1, I2;
+    if (outer_integral(r,1.0,0,0.0,I1)) return mass(r)/r + 4.0*M_PI*I1;
+    if (inner_integral(r,1.0,I1) && inner_integral(r,2.0,I2)) return central_potential() - 4.0*M_PI*(I1-I2/r);
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return density(u) * u;
+        density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i];
     };
-    return mass(r)/r + 4.0*M_PI*_gl->integrate_r_infty(integrand,r,scale_radius());
+    return mass(r)/r + 4.0*M_PI*integrate_r_infty_batch(integrand,r);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double DensityModel::central_potential() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    return _Psi0memo.get([&]()
     {
-        return density(u) * u;
-    };
-    return 4.0*M_PI*_gl->integrate_0_infty(integrand,scale_radius());
+        std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+        {
+            density(u,X,n);
+            for (size_t i=0; i<n; i++) X[i] *= u[i];
+        };
+        return 4.0*M_PI*integrate_0_infty_batch(integrand);
+    });
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double DensityModel::surface_density(double R) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    double I;
+    if (outer_integral(R,1.0,0,-0.5,I)) return 2.0*I;
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return density(u) * u / sqrt((u-R)*(u+R));
+        density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i];
     };
-    return 2.0 * _gl->integrate_r_infty(integrand,R,scale_radius());
+    return 2.0 * integrate_abel_batch(integrand,R);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double DensityModel::derivative_surface_density(double R) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+    {
+        std::vector<double> drho(n);
+        density(u,X,n);
+        derivative_density(u,drho.data(),n);
+        for (size_t i=0; i<n; i++) X[i] = (X[i]+drho[i]*u[i]) * u[i];
+    };
+    return 2.0/R * integrate_abel_batch(integrand,R);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double DensityModel::surface_density_slope(double R) const
+{
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+    {
+        density(u,X,n);
+        derivative_density(u,X+n,n);
+        for (size_t i=0; i<n; i++)
+        {
+            X[n+i] = (X[i]+X[n+i]*u[i]) * u[i];
+            X[i] *= u[i];
+        }
+    };
+    double I[2];
+    integrate_abel_batch(integrand,R,2,I);
+    return -I[1]/I[0];
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void DensityModel::cumulative_mass_and_potential(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    if (_reltol>0.0 || !std::is_sorted(rv.begin(),rv.end()))
     {
-        return (density(u)+derivative_density(u)*u) * u / sqrt((u-R)*(u+R));
+        Model::mass_and_potential_profiles(rv,Mv,Psiv);
+        return;
+    }
+    size_t N = rv.size();
+    Mv.resize(N);
+    Psiv.resize(N);
+
+    // Radii within the cutoff of the inner or beyond the cutoff of the outer expansion are treated separately
+
+    size_t a = 0, b = N;
+    double I;
+    while (a<N && (!(rv[a]>0.0) || inner_integral(rv[a],2.0,I))) a++;
+    while (b>a && outer_integral(rv[b-1],2.0,0,0.0,I)) b--;
+    for (size_t i=0; i<N; i++)
+        if (i<a || i>=b)
+        {
+            Mv[i] = mass(rv[i]);
+            Psiv[i] = potential(rv[i]);
+        }
+    if (a==b) return;
+
+    // Collect the nodes and weights in ln u on the panels between successive radii, with the breakpoints as
+    // additional panel boundaries, and evaluate the density at all nodes at once
+
+    const GaussLegendreRule* rule = GaussLegendreRule::get(numsweep);
+    std::vector<double> bv = breakpoints();
+    std::vector<double> uv, wv;
+    std::vector<size_t> endv(b-a);
+    for (size_t i=a; i+1<b; i++)
+    {
+        std::vector<double> xv = {log(rv[i])};
+        for (double rbp : bv)
+            if (rbp>rv[i] && rbp<rv[i+1]) xv.push_back(log(rbp));
+        std::sort(xv.begin()+1,xv.end());
+        xv.push_back(log(rv[i+1]));
+        for (size_t j=0; j+1<xv.size(); j++)
+        {
+            int num = static_cast<int>(ceil((xv[j+1]-xv[j])/hsweep));
+            double h = (xv[j+1]-xv[j])/num;
+            for (int p=0; p<num; p++)
+                for (int k=0; k<numsweep; k++)
+                {
+                    double u = exp(xv[j] + h*(p+rule->nodes()[k]));
+                    uv.push_back(u);
+                    wv.push_back(h*rule->weights()[k]*u*u);
+                }
+        }
+        endv[i-a+1] = uv.size();
+    }
+    std::vector<double> rhov(uv.size());
+    if (!uv.empty()) density(uv.data(),rhov.data(),uv.size());
+
+    // Accumulate the mass outward from the innermost radius
+
+    Mv[a] = mass(rv[a]);
+    for (size_t i=a; i+1<b; i++)
+    {
+        double sum = 0.0;
+        for (size_t k=endv[i-a]; k<endv[i-a+1]; k++) sum += wv[k]*rhov[k]*uv[k];
+        Mv[i+1] = Mv[i] + 4.0*M_PI*sum;
+    }
+
+    // Accumulate the integral of rho(u) u inward from the outermost radius
+
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+    {
+        density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i];
     };
-    return 2.0/R * _gl->integrate_r_infty(integrand,R,scale_radius());
+    double J = integrate_r_infty_batch(integrand,rv[b-1]);
+    Psiv[b-1] = Mv[b-1]/rv[b-1] + 4.0*M_PI*J;
+    for (size_t i=b-1; i>a; i--)
+    {
+        for (size_t k=endv[i-a-1]; k<endv[i-a]; k++) J += wv[k]*rhov[k];
+        Psiv[i-1] = Mv[i-1]/rv[i-1] + 4.0*M_PI*J;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -20,23 +20,31 @@ public:
     /** Virtual destructor of the DensityModel class. */
     virtual ~DensityModel() {};
     
-    /** This function returns the mass \f$M(r)\f$ at radius \f$r\f$. It is calculated as \f[ M(r) = 4\pi \int_0^r \rho(u)\, u^2\, {\text{d}}u. \f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    /** This function returns the mass \f$M(r)\f$ at radius \f$r\f$. It is calculated as \f[ M(r) = 4\pi \int_0^r \rho(u)\, u^2\, {\text{d}}u. \f] The integration is performed using Gauss-Legendre quadrature, or analytically within the cutoff of the inner or beyond the cutoff of the outer asymptotic expansion of the density, if the model declares one. This function is a virtual function that can be reimplemented by derived classes. */
     virtual double mass(double r) const;
 
-    /** This function returns the total mass \f$M_{\text{tot}}\f$ . It is calculated as \f[ M_{\text{tot}} = 4\pi \int_0^\infty \rho(u)\, u^2\, {\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    /** This function returns the total mass \f$M_{\text{tot}}\f$ . It is calculated as \f[ M_{\text{tot}} = 4\pi \int_0^\infty \rho(u)\, u^2\, {\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature, once until the parameters or the integrators of the model change. This function is a virtual function that can be reimplemented by derived classes. */
     virtual double total_mass() const;
     
-    /** This function returns the potential \f$\Psi(r)\f$ at radius \f$r\f$. It is calculated as \f[ \Psi(r) = \frac{GM(r)}{r} + 4\pi\,G\int_r^\infty \rho(u)\,u\,{\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    /** This function returns the potential \f$\Psi(r)\f$ at radius \f$r\f$. It is calculated as \f[ \Psi(r) = \frac{GM(r)}{r} + 4\pi\,G\int_r^\infty \rho(u)\,u\,{\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature, or analytically beyond the cutoff of the outer asymptotic expansion of the density, if the model declares one. Within the cutoff of the inner expansion, the potential is calculated as \f$\Psi(r) = \Psi_0 - 4\pi G\int_0^r \rho(u)\,(1-u/r)\,u\,{\text{d}}u\f$. This function is a virtual function that can be reimplemented by derived classes. */
     virtual double potential(double r) const;
     
-    /** This function returns the central potential \f$\Psi_0\f$. It is calculated as \f[ \Psi(r) = 4\pi\,G\int_0^\infty \rho(u)\,u\,{\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes.  This function is a virtual function that can be reimplemented by derived classes. */
+    /** This function returns the central potential \f$\Psi_0\f$. It is calculated as \f[ \Psi(r) = 4\pi\,G\int_0^\infty \rho(u)\,u\,{\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature, once until the parameters or the integrators of the model change. This function is a virtual function that can be reimplemented by derived classes.  This function is a virtual function that can be reimplemented by derived classes. */
     virtual double central_potential() const;
 
-    /** This function returns the surface density \f$\Sigma(R)\f$ at projected radius \f$R\f$. It is calculated as \f[ \Sigma(R) = 2\int_R^\infty \frac{\rho(u)\,u\,{\text{d}} u}{\sqrt{u^2-R^2}}. \f] */
+    /** This function returns the surface density \f$\Sigma(R)\f$ at projected radius \f$R\f$. It is calculated as \f[ \Sigma(R) = 2\int_R^\infty \frac{\rho(u)\,u\,{\text{d}} u}{\sqrt{u^2-R^2}}. \f] Beyond the cutoff of the outer asymptotic expansion of the density, if the model declares one, the integral is evaluated analytically. */
     double surface_density(double R) const;
     
     /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ at projected radius \f$R\f$. It is calculated as \f[ \Sigma'(R) = 2\int_R^\infty \frac{[\rho(u)+ u\,\rho'(u)]\,u\,{\text{d}} u}{R \sqrt{u^2-R^2}}. \f] */
     double derivative_surface_density(double R) const;
+
+    /** This function returns the surface density slope \f$\gamma_{\text{p}}(R)\f$ at projected radius \f$R\f$. The surface density and its derivative are calculated as in the functions surface_density() and derivative_surface_density(), but both Abel integrals are estimated in a single pass over the nodes. */
+    double surface_density_slope(double R) const;
+
+protected:
+
+    /** This function calculates the mass \f$M(r_i)\f$ and the potential \f$\Psi(r_i)\f$ at the radii \f$r_i\f$ in the vector rv, as in the functions mass() and potential(), and stores them in the vectors Mv and Psiv. If the radii are sorted in increasing order, the integrals for all radii are evaluated in a single cumulative sweep: the mass is only integrated from the centre for the innermost radius, and the integral \f$\int_r^\infty \rho(u)\,u\,{\text{d}}u\f$ is only integrated to infinity for the outermost radius. The contributions of the intervals \f$[r_i,r_{i+1}]\f$ are estimated using a 16-point Gauss-Legendre rule in \f$\ln u\f$ on panels no wider than 0.5, split at the breakpoints of the model, and are accumulated outward for the mass and inward for the potential, \f[ M(r_{i+1}) = M(r_i) + 4\pi \int_{r_i}^{r_{i+1}} \rho(u)\,u^2\,{\text{d}}u, \qquad \Psi(r_i) = \frac{GM(r_i)}{r_i} + 4\pi\,G \left[ \int_{r_i}^{r_{i+1}} \rho(u)\,u\,{\text{d}}u + \int_{r_{i+1}}^\infty \rho(u)\,u\,{\text{d}}u \right]. \f] The density is evaluated once for all nodes, such that the cost grows with the number of radii plus the number of nodes of a single integral, rather than with their product. Radii within the cutoff of the inner or beyond the cutoff of the outer expansion of the density are treated analytically as in the functions mass() and potential(). If the radii are not sorted, or in adaptive mode, the function falls back to the batched functions mass() and potential(). Derived classes that do not reimplement mass() and potential() can use this function to reimplement the function mass_and_potential_profiles(). Models defined by their surface density, i.e. the subclasses of SurfaceDensityModel, do not derive from DensityModel and cannot use this sweep, since their mass and potential are integrals over the surface density with kernels that depend on the radius itself; they share the evaluations of the surface density between the mass and the potential instead. */
+    void cumulative_mass_and_potential(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
 };
 
 //////////////////////////////////////////////////////////////////////
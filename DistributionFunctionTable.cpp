@@ -0,0 +1,167 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "DistributionFunctionTable.hpp"
+#include "Model.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The degree of the Chebyshev expansions on each panel
+    const int N = 16;
+
+    // The width in ln r of the initial panels
+    const double hinit = 2.0;
+
+    // The width in ln r below which panels are no longer bisected
+    const double hmin = 1e-3;
+
+    // The factor by which a bisection should at least reduce the last coefficients of an expansion
+    const double minreduction = 2.0;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+DistributionFunctionTable::DistributionFunctionTable(const Model* model, double ra, double tol, double xmin, double xmax)
+{
+    _model = model;
+    _ra = ra;
+
+    // Set up the initial panels, with the breakpoints of the model as additional boundaries
+
+    double rs = model->scale_radius();
+    std::vector<double> bv = {log(xmin*rs), log(xmax*rs)};
+    for (double rbp : model->breakpoints())
+        if (rbp>xmin*rs && rbp<xmax*rs) bv.push_back(log(rbp));
+    std::sort(bv.begin(),bv.end());
+    bv.erase(std::unique(bv.begin(),bv.end()),bv.end());
+
+    struct Pending
+    {
+        double a;
+        double b;
+        double parent;
+    };
+    const double unknown = std::numeric_limits<double>::infinity();
+    std::vector<Pending> pending;
+    for (size_t i=0; i+1<bv.size(); i++)
+    {
+        int num = static_cast<int>(ceil((bv[i+1]-bv[i])/hinit));
+        for (int j=0; j<num; j++)
+            pending.push_back({bv[i]+(bv[i+1]-bv[i])*j/num, bv[i]+(bv[i+1]-bv[i])*(j+1)/num, unknown});
+    }
+
+    // Sample the distribution function at the Chebyshev-Lobatto points of the pending panels, and bisect the panels
+    // whose expansions have not converged
+
+    while (!pending.empty())
+    {
+        std::vector<Pending> next;
+        for (const Pending& P : pending)
+        {
+            double h = P.b-P.a;
+            std::vector<double> fv(N+1);
+            bool positive = true;
+            for (int j=0; j<=N; j++)
+            {
+                fv[j] = direct(exp(0.5*(P.a+P.b) + 0.5*h*cos(j*M_PI/N)));
+                if (!(fv[j]>0.0 && fv[j]<std::numeric_limits<double>::infinity())) positive = false;
+            }
+            if (!positive)
+            {
+                if (h>hmin)
+                {
+                    next.push_back({P.a, 0.5*(P.a+P.b), unknown});
+                    next.push_back({0.5*(P.a+P.b), P.b, unknown});
+                }
+                else _panels.push_back({P.a, P.b, true, std::vector<double>()});
+                continue;
+            }
+
+            // The coefficients c_k = (2/N) sum_j'' ln f_j cos(jk pi/N), with the first and last terms halved
+
+            std::vector<double> c(N+1);
+            for (int k=0; k<=N; k++)
+            {
+                double sum = 0.0;
+                for (int j=0; j<=N; j++)
+                {
+                    double w = (j==0 || j==N) ? 0.5 : 1.0;
+                    sum += w * log(fv[j]) * cos(j*k*M_PI/N);
+                }
+                c[k] = 2.0/N * sum;
+            }
+            c[0] *= 0.5;
+            c[N] *= 0.5;
+            double tail = fabs(c[N-1]) + fabs(c[N]);
+            if (tail>tol && tail*minreduction<P.parent && h>hmin)
+            {
+                next.push_back({P.a, 0.5*(P.a+P.b), tail});
+                next.push_back({0.5*(P.a+P.b), P.b, tail});
+                continue;
+            }
+            _panels.push_back({P.a, P.b, false, c});
+        }
+        pending.swap(next);
+    }
+
+    std::sort(_panels.begin(), _panels.end(), [](const Panel& P1, const Panel& P2) { return P1.a<P2.a; });
+    for (const Panel& P : _panels) _av.push_back(P.a);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double DistributionFunctionTable::anisotropy_radius() const
+{
+    return _ra;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool DistributionFunctionTable::isotropic() const
+{
+    return _ra==std::numeric_limits<double>::infinity();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double DistributionFunctionTable::direct(double r) const
+{
+    return isotropic() ? _model->isotropic_distribution_function(r) : _model->osipkov_merritt_distribution_function(r,_ra);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double DistributionFunctionTable::value(double r) const
+{
+    double x = log(r);
+    if (_panels.empty() || !(x>=_av.front() && x<=_panels.back().b)) return direct(r);
+    int p = static_cast<int>(std::upper_bound(_av.begin(),_av.end(),x) - _av.begin()) - 1;
+    const Panel& P = _panels[max(p,0)];
+    if (P.direct) return direct(r);
+
+    // Clenshaw's recurrence
+
+    double t = (2.0*x-P.a-P.b)/(P.b-P.a);
+    double b1 = 0.0, b2 = 0.0;
+    for (int k=N; k>=1; k--)
+    {
+        double b0 = 2.0*t*b1 - b2 + P.c[k];
+        b2 = b1;
+        b1 = b0;
+    }
+    return exp(P.c[0] + t*b1 - b2);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+size_t DistributionFunctionTable::num_panels() const
+{
+    return _panels.size();
+}
+
+//////////////////////////////////////////////////////////////////////
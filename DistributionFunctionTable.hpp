@@ -0,0 +1,68 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef DISTRIBUTIONFUNCTIONTABLE_HPP
+#define DISTRIBUTIONFUNCTIONTABLE_HPP
+
+#include "Basics.hpp"
+
+class Model;
+
+//////////////////////////////////////////////////////////////////////
+
+/** DistributionFunctionTable is the class that tabulates the distribution function \f$f({\cal{E}})\f$ of a model, either for an isotropic orbital structure or for an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$, in which case the distribution function depends on \f$Q\f$ rather than on \f${\cal{E}}\f$. Every evaluation of the distribution function by the Model class is itself an integral over the potential, such that the moments of the distribution function, such as the density, the dispersion, the total mass and the total integrated binding energy, are double or triple integrals. Once a table has been selected for a model with the functions Model::set_isotropic_distribution_function_table() or Model::set_osipkov_merritt_distribution_function_table(), these moments interpolate the distribution function from the table instead, which reduces their cost by a factor of the order of the number of nodes of the integrator.
+
+    Since the binding energy \f${\cal{E}} = \Psi(r)\f$ is a monotonic function of radius, the distribution function is tabulated as a function of \f$x = \ln r\f$, which is the variable in which the moment integrals evaluate it. The logarithm of the distribution function is expanded in Chebyshev polynomials of degree \f$N=16\f$ on a set of panels in \f$x\f$, which are bisected until the last two coefficients of every expansion are smaller than the tolerance, as in the ChebyshevModel class. The breakpoints of the model are panel boundaries. On panels where the distribution function is not strictly positive, which can occur for an Osipkov-Merritt orbital structure with a small anisotropy radius, and outside the tabulated range, the distribution function is calculated by the model directly. */
+
+class DistributionFunctionTable
+{
+public:
+
+    /** Constructor of the DistributionFunctionTable class. It reads in the model, the anisotropy radius \f$r_{\text{a}}\f$, which should be infinite for an isotropic orbital structure, the tolerance of the expansions, and the range of the table in units of the scale radius of the model. The table is constructed before it is selected for the model, such that it is built from the distribution function calculated by the model directly. */
+    DistributionFunctionTable(const Model* model, double ra = std::numeric_limits<double>::infinity(), double tol = 1e-10, double xmin = 1e-4, double xmax = 1e4);
+
+    /** This function returns the anisotropy radius \f$r_{\text{a}}\f$ of the table, which is infinite for an isotropic orbital structure. */
+    double anisotropy_radius() const;
+
+    /** This function returns true if the table describes an isotropic orbital structure. */
+    bool isotropic() const;
+
+    /** This function returns the distribution function at binding energy \f${\cal{E}} = \Psi(r)\f$, or at \f$Q = \Psi(r)\f$ for an Osipkov-Merritt orbital structure, interpolated from the table or, outside the tabulated range, calculated by the model directly. */
+    double value(double r) const;
+
+    /** This function returns the number of panels of the expansions. */
+    size_t num_panels() const;
+
+private:
+
+    /** Panel is a structure that describes a panel \f$[a,b]\f$ in \f$x = \ln r\f$ with the Chebyshev coefficients of \f$\ln f\f$. If direct is true, the distribution function on the panel is calculated by the model. */
+    struct Panel
+    {
+        double a;
+        double b;
+        bool direct;
+        std::vector<double> c;
+    };
+
+    /** This function returns the distribution function at radius \f$r\f$, calculated by the model directly. */
+    double direct(double r) const;
+
+    /** The model. */
+    const Model* _model;
+
+    /** The anisotropy radius \f$r_{\text{a}}\f$. */
+    double _ra;
+
+    /** The panels, sorted in \f$x\f$. */
+    std::vector<Panel> _panels;
+
+    /** The lower boundaries of the panels, for the lookup. */
+    std::vector<double> _av;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
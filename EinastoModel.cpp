@@ -5,41 +5,73 @@
 ///////////////////////////////////////////////////////////////// */
 
 #include "EinastoModel.hpp"
-#include <fstream>
+#include "EinastodTable.hpp"
+#include "IncompleteGamma.hpp"
 #include <iostream>
 
 //////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // This function looks up the exact value of d for the Einasto index n in the table, and returns false if n does not
+    // lie on the grid of the table
+    bool tabulated_d(double n, double& d)
+    {
+        double x = (n-EinastodTable::nmin)/EinastodTable::dn;
+        if (!(x>-0.5 && x<EinastodTable::num-0.5)) return false;
+        int j = static_cast<int>(lround(x));
+        if (fabs(n-(EinastodTable::nmin+j*EinastodTable::dn))>=1e-9) return false;
+        d = EinastodTable::d[j];
+        return true;
+    }
+
+    // This function returns an initial guess for d for the Einasto index n, interpolated linearly in ln d from the table
+    // within its range, or zero beyond, which selects the default initial guess of the solver
+    double initial_d(double n)
+    {
+        double x = (n-EinastodTable::nmin)/EinastodTable::dn;
+        if (!(x>=0.0 && x<=EinastodTable::num-1)) return 0.0;
+        int j = min(static_cast<int>(x), EinastodTable::num-2);
+        double h = x-j;
+        return exp((1.0-h)*log(EinastodTable::d[j]) + h*log(EinastodTable::d[j+1]));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
 EinastoModel::EinastoModel(double Mtot, double rh, double n, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, rh, n);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void EinastoModel::set_parameters(double Mtot, double rh, double n)
 {
     _Mtot = Mtot;
     _rh = rh;
     _n = n;
 
-    // Determine the value of d. Seach it among the exact values in the file Einastod.txt. This file contains exact values for all n between 0.01 and 15 with a spacing of 0.001. If it is not there exit.
+    // Determine the value of d. First look it up in the table of exact values for all n between 0.01 and 15 with a spacing of 0.001. If n is not in the table, solve the equation P(3n,d) = 1/2 for d, starting from the table.
     
-    std::ifstream file("Einastod.txt");
-    bool dset = false;
-    double nf, df;
-    for (int j=0; j<14990; j++)
-    {
-        file >> nf >> df;
-        if (fabs(_n-nf)<1e-9)
-        {
-            _d = df;
-            dset = true;
-            break;
-        }
-    }
-    if (!dset)
+    if (!(_n>0.0))
     {
-        std::cerr << "Attempting to set up an EinastoModel object with unknown value for n"
+        std::cerr << "Attempting to set up an EinastoModel object with non-positive value for n"
         << std::endl;
         exit(1);
     }
+    if (!tabulated_d(_n,_d)) _d = IncompleteGamma::median(3.0*_n, initial_d(_n));
     
     _rho0 = _Mtot/pow(_rh,3) * pow(_d,3.0*_n)/(4.0*M_PI*_n*tgamma(3.0*_n));
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> EinastoModel::parameters() const
+{
+    return {_Mtot, _rh, _n};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -51,6 +83,16 @@ double EinastoModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool EinastoModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    b = _d;
+    r0 = _rh;
+    m = _n;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double EinastoModel::density(double r) const
 {
     double t = r/_rh;
@@ -60,6 +102,13 @@ double EinastoModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void EinastoModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = EinastoModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double EinastoModel::derivative_density(double r) const
 {
     double t = r/_rh;
@@ -78,6 +127,13 @@ double EinastoModel::second_derivative_density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void EinastoModel::mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    cumulative_mass_and_potential(rv,Mv,Psiv);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double EinastoModel::total_mass() const
 {
     return _Mtot;
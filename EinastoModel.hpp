@@ -19,12 +19,24 @@ public:
     
     /** Constructor of the EinastoModel class. */
     EinastoModel(double Mtot, double rh, double n, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the EinastoModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double rh, double n);
+
+    /** This function returns the parameters of the EinastoModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the half-mass radius \f$r_{\text{h}}\f$ of the Einasto model. */
     double scale_radius() const;
     
+    /** This function returns true, since the density of the Einasto model decays as \f$\exp[-d_n\,(r/r_{\text{h}})^{1/n}]\f$ at large radii, and stores the corresponding parameters. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+    
     /** This function returns the density \f$\rho(r)\f$ of the Einasto model at radius \f$r\f$. */
     double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the Einasto model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
     
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the Einasto model at radius \f$r\f$. */
     double derivative_density(double r) const;
@@ -32,6 +44,9 @@ public:
     /** This function returns the second derivative of the density \f$\rho''(r)\f$ of the Einasto model at radius \f$r\f$. */
     double second_derivative_density(double r) const;
 
+    /** This function calculates the mass \f$M(r_i)\f$ and the potential \f$\Psi(r_i)\f$ of the Einasto model at the radii \f$r_i\f$ in the vector rv, in a single cumulative sweep over the radii. */
+    void mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
+
     /** This function returns the total mass \f$M_{\text{tot}}\f$ of the Einasto model. */
     double total_mass() const;
 
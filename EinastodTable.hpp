@@ -0,0 +1,3781 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef EINASTODTABLE_HPP
+#define EINASTODTABLE_HPP
+
+//////////////////////////////////////////////////////////////////////
+
+/** The EinastodTable namespace holds the exact values of the parameter \f$d\f$ of the Einasto model for all Einasto indices \f$n\f$ between 0.01 and 15 with a spacing of 0.001, as listed in the file Einastod.txt, such that the values are compiled into the program and can be looked up by index rather than read from the file. */
+
+namespace EinastodTable
+{
+    /** The first Einasto index of the table. */
+    constexpr double nmin = 0.01;
+
+    /** The spacing of the Einasto indices in the table. */
+    constexpr double dn = 0.001;
+
+    /** The number of entries of the table. */
+    constexpr int num = 14991;
+
+    /** The values \f$d(n_j)\f$ at the Einasto indices \f$n_j = n_{\text{min}} + j\,\Delta n\f$. */
+    constexpr double d[num] =
+    {
+        5.31554143088228e-11, 4.35310680540284e-10, 2.51196078154508e-9, 1.10732015006978e-8,
+        3.95040081820374e-8, 1.18985670666528e-7, 3.12332495480185e-7, 7.32063941841807e-7,
+        1.56130687881932e-6, 3.07543932762985e-6, 5.66217821782892e-6, 9.83805079208679e-6,
+        0.0000162597321660866, 0.0000257294087767511, 0.0000391939924656674, 0.000057738565729905,
+        0.0000825748389942578, 0.000115025639129443, 0.0001565065436218, 0.000208505757862796,
+        0.000272563237936635, 0.000350249919138286, 0.000443147746657915, 0.000552831038333576,
+        0.00068084955291709, 0.000828713498618587, 0.000997880599544301, 0.00118974524293925,
+        0.0014056296569335, 0.00164677701468744, 0.00191434632379367, 0.00220940893670472,
+        0.00253294650608106, 0.00288585020579091, 0.00326892104165116, 0.0036828710840221,
+        0.00412832546553533, 0.00460582500032637, 0.00511582929521465, 0.00565872023760872,
+        0.00623480575899022, 0.0068443237862818, 0.00748744630598889, 0.00816428347757975,
+        0.00887488774306047, 0.0096192578890956, 0.0103973430263429, 0.0112090464579618,
+        0.0120542294155844, 0.0129327146464865, 0.0138442898403369, 0.0147887108878276,
+        0.0157657049667692, 0.0167749734539508, 0.0178161946632906, 0.0188890264125914,
+        0.0199931084226483, 0.0211280645535566, 0.0222935048839158, 0.023489027639235,
+        0.0247142209762702, 0.0259686646302934, 0.0272519314324264, 0.0285635887042059,
+        0.0299031995364928, 0.0312703239597144, 0.0326645200122558, 0.0340853447136007,
+        0.0355323549485778, 0.0370051082688015, 0.0385031636171169, 0.0400260819805718,
+        0.0415734269771453, 0.0431447653811745, 0.0447396675921335, 0.0463577080511386,
+        0.0479984656092822, 0.0496615238516336, 0.0513464713804962, 0.053052902061265,
+        0.0547804152340039, 0.0565286158936392, 0.0582971148414656, 0.0600855288104613,
+        0.061893480566729, 0.0637205989892088, 0.0655665191296431, 0.0674308822546293,
+        0.0693133358714506, 0.0712135337392449, 0.0731311358669519, 0.07506580849936,
+        0.0770172240924738, 0.0789850612793194, 0.0809690048272192, 0.0829687455874769,
+        0.0849839804383413, 0.0870144122220392, 0.0890597496766057, 0.0911197073631744,
+        0.0931940055893342, 0.0952823703291071, 0.0973845331400505, 0.099500231077946,
+        0.101629206609491, 0.103771207523374, 0.105925986840079, 0.108093302720734,
+        0.110272918375275, 0.112464601970207, 0.114668126536152, 0.11688326987544,
+        0.119109814469883, 0.121347547388933, 0.123596260198352, 0.125855748869541,
+        0.128125813689634, 0.130406259172468, 0.13269689397052, 0.134997530787888,
+        0.137307986294393, 0.139628081040847, 0.141957639375564, 0.144296489362128,
+        0.146644462698481, 0.149001394637342, 0.151367123907993, 0.153741492639447,
+        0.156124346285008, 0.158515533548241, 0.160914906310352, 0.163322319558981,
+        0.165737631318405, 0.168160702581156, 0.170591397241035, 0.173029582027521,
+        0.175475126441565, 0.177927902692753, 0.180387785637823, 0.182854652720524,
+        0.185328383912798, 0.187808861657272, 0.190295970811029, 0.192789598590654,
+        0.195289634518523, 0.197795970370325, 0.200308500123777, 0.20282711990854,
+        0.205351727957285, 0.207882224557902, 0.210418512006832, 0.212960494563489,
+        0.215508078405761, 0.218061171586563, 0.220619683991413, 0.223183527297024,
+        0.225752614930881, 0.228326862031777, 0.2309061854113, 0.233490503516235,
+        0.236079736391875, 0.238673805646202, 0.241272634414943, 0.24387614732745,
+        0.246484270473413, 0.249096931370371, 0.251714058932002, 0.254335583437178,
+        0.25696143649977, 0.259591551039174, 0.262225861251551, 0.264864302581752,
+        0.267506811695934, 0.270153326454813, 0.272803785887582, 0.275458130166439,
+        0.278116300581733, 0.280778239517708, 0.283443890428824, 0.286113197816646,
+        0.288786107207288, 0.29146256512939, 0.294142519092632, 0.296825917566741,
+        0.299512709961018, 0.302202846604338, 0.304896278725628, 0.307592958434809,
+        0.310292838704187, 0.312995873350287, 0.315702017016108, 0.318411225153804,
+        0.321123454007768, 0.323838660598111, 0.326556802704531, 0.329277838850558,
+        0.332001728288169, 0.334728430982753, 0.337457907598437, 0.340190119483743,
+        0.342925028657583, 0.345662597795573, 0.348402790216667, 0.351145569870094,
+        0.353890901322598, 0.356638749745969, 0.359389080904863, 0.36214186114489,
+        0.364897057380987, 0.367654637086042, 0.370414568279783, 0.37317681951792,
+        0.375941359881523, 0.378708158966653, 0.381477186874207, 0.384248414200014,
+        0.387021812025128, 0.389797351906357, 0.392575005866994, 0.395354746387752,
+        0.398136546397903, 0.400920379266619, 0.403706218794487, 0.406494039205228,
+        0.409283815137592, 0.412075521637421, 0.414869134149903, 0.417664628511977,
+        0.420461980944917, 0.423261168047066, 0.426062166786737, 0.428864954495259,
+        0.431669508860174, 0.434475807918585, 0.437283830050644, 0.440093553973172,
+        0.44290495873343, 0.445718023703005, 0.44853272857184, 0.451349053342382,
+        0.454166978323856, 0.456986484126659, 0.459807551656874, 0.462630162110892,
+        0.465454296970158, 0.468279937996014, 0.471107067224656, 0.473935666962197,
+        0.476765719779824, 0.479597208509066, 0.48243011623715, 0.485264426302457,
+        0.488100122290069, 0.490937188027409, 0.493775607579966, 0.496615365247114,
+        0.499456445558005, 0.502298833267558, 0.505142513352515, 0.507987471007589,
+        0.510833691641678, 0.513681160874167, 0.51652986453129, 0.519379788642578,
+        0.522230919437366, 0.525083243341377, 0.527936746973368, 0.53079141714185,
+        0.53364724084186, 0.536504205251811, 0.539362297730391, 0.54222150581353,
+        0.545081817211422, 0.547943219805609, 0.550805701646117, 0.553669250948651,
+        0.55653385609184, 0.559399505614539, 0.562266188213181, 0.565133892739179,
+        0.56800260819638, 0.570872323738562, 0.573743028666987, 0.576614712427991,
+        0.579487364610626, 0.582360974944347, 0.585235533296734, 0.588111029671269,
+        0.590987454205143, 0.593864797167114, 0.596743048955394, 0.599622200095588,
+        0.602502241238659, 0.605383163158937, 0.608264956752166, 0.611147613033583,
+        0.614031123136034, 0.616915478308123, 0.619800669912397, 0.622686689423563,
+        0.625573528426739, 0.628461178615731, 0.631349631791349, 0.634238879859748,
+        0.637128914830802, 0.640019728816501, 0.642911314029386, 0.645803662781008,
+        0.648696767480406, 0.65159062063263, 0.654485214837271, 0.657380542787032,
+        0.660276597266314, 0.663173371149833, 0.666070857401258, 0.668969049071876,
+        0.671867939299275, 0.674767521306058, 0.67766778839857, 0.680568733965653,
+        0.683470351477425, 0.686372634484071, 0.689275576614663, 0.692179171575998,
+        0.695083413151453, 0.697988295199864, 0.700893811654423, 0.703799956521589,
+        0.706706723880025, 0.709614107879548, 0.712522102740099, 0.715430702750727,
+        0.718339902268594, 0.721249695717999, 0.724160077589408, 0.727071042438511,
+        0.72998258488529, 0.7328946996131, 0.735807381367776, 0.738720624956737,
+        0.741634425248123, 0.744548777169933, 0.747463675709185, 0.750379115911087,
+        0.75329509287822, 0.756211601769737, 0.759128637800574, 0.762046196240672,
+        0.764964272414219, 0.76788286169889, 0.770801959525116, 0.773721561375353,
+        0.776641662783365, 0.779562259333526, 0.782483346660119, 0.78540492044666,
+        0.788326976425227, 0.791249510375796, 0.794172518125596, 0.797095995548466,
+        0.800019938564226, 0.80294434313806, 0.805869205279905, 0.808794521043849,
+        0.811720286527543, 0.814646497871618, 0.817573151259112, 0.82050024291491,
+        0.823427769105182, 0.826355726136846, 0.829284110357021, 0.832212918152506,
+        0.835142145949251, 0.838071790211849, 0.841001847443027, 0.843932314183153,
+        0.846863187009739, 0.849794462536963, 0.852726137415193, 0.855658208330518,
+        0.858590672004287, 0.861523525192653, 0.86445676468613, 0.867390387309149,
+        0.870324389919624, 0.873258769408526, 0.87619352269946, 0.879128646748252,
+        0.882064138542539, 0.884999995101366, 0.887936213474793, 0.890872790743496,
+        0.893809724018391, 0.89674701044025, 0.899684647179325, 0.902622631434985,
+        0.90556096043535, 0.908499631436932, 0.911438641724284, 0.914377988609653,
+        0.917317669432639, 0.920257681559853, 0.923198022384588, 0.926138689326491,
+        0.929079679831238, 0.932020991370218, 0.934962621440217, 0.937904567563112,
+        0.940846827285561, 0.943789398178705, 0.946732277837873, 0.949675463882289,
+        0.952618953954781, 0.9555627457215, 0.958506836871642, 0.961451225117166,
+        0.964395908192526, 0.967340883854404, 0.970286149881439, 0.973231704073975,
+        0.976177544253795, 0.979123668263872, 0.98207007396812, 0.985016759251143,
+        0.987963722017994, 0.990910960193936, 0.993858471724203, 0.996806254573767,
+        0.999754306727111, 1.002702626188, 1.00565121097924, 1.0086000591425,
+        1.01154916873806, 1.01449853784458, 1.01744816455894, 1.02039804699598,
+        1.02334818328834, 1.02629857158621, 1.02924921005715, 1.03220009688591,
+        1.03515123027421, 1.03810260844055, 1.04105422962003, 1.04400609206413,
+        1.0469581940406, 1.04991053383318, 1.0528631097415, 1.05581592008084,
+        1.05876896318202, 1.06172223739114, 1.06467574106951, 1.0676294725934,
+        1.0705834303539, 1.07353761275677, 1.07649201822228, 1.07944664518499,
+        1.08240149209369, 1.08535655741115, 1.08831183961403, 1.0912673371927,
+        1.09422304865109, 1.09717897250655, 1.1001351072897, 1.10309145154427,
+        1.10604800382701, 1.10900476270747, 1.11196172676793, 1.11491889460322,
+        1.11787626482061, 1.12083383603966, 1.1237916068921, 1.12674957602168,
+        1.12970774208407, 1.13266610374671, 1.1356246596887, 1.13858340860064,
+        1.14154234918458, 1.14450148015381, 1.14746080023282, 1.15042030815712,
+        1.15338000267316, 1.15633988253822, 1.15929994652025, 1.16226019339782,
+        1.16522062195996, 1.16818123100607, 1.17114201934582, 1.17410298579902,
+        1.17706412919555, 1.18002544837522, 1.18298694218767, 1.1859486094923,
+        1.18891044915813, 1.19187246006374, 1.19483464109714, 1.19779699115568,
+        1.20075950914597, 1.20372219398376, 1.20668504459388, 1.20964805991011,
+        1.21261123887512, 1.21557458044036, 1.21853808356599, 1.22150174722076,
+        1.22446557038195, 1.2274295520353, 1.23039369117487, 1.23335798680301,
+        1.23632243793024, 1.2392870435752, 1.24225180276454, 1.24521671453287,
+        1.24818177792263, 1.25114699198409, 1.25411235577519, 1.25707786836153,
+        1.26004352881625, 1.26300933621996, 1.26597528966072, 1.26894138823389,
+        1.2719076310421, 1.27487401719518, 1.27784054581008, 1.28080721601079,
+        1.28377402692831, 1.28674097770053, 1.28970806747219, 1.29267529539484,
+        1.29564266062672, 1.29861016233272, 1.30157779968433, 1.30454557185957,
+        1.30751347804289, 1.31048151742518, 1.31344968920364, 1.31641799258175,
+        1.31938642676923, 1.32235499098192, 1.32532368444179, 1.32829250637684,
+        1.33126145602106, 1.33423053261436, 1.33719973540253, 1.34016906363715,
+        1.34313851657561, 1.34610809348097, 1.34907779362194, 1.35204761627286,
+        1.35501756071359, 1.3579876262295, 1.36095781211141, 1.36392811765552,
+        1.36689854216339, 1.36986908494185, 1.37283974530301, 1.37581052256415,
+        1.3787814160477, 1.38175242508121, 1.38472354899726, 1.38769478713347,
+        1.3906661388324, 1.39363760344152, 1.39660918031319, 1.39958086880459,
+        1.40255266827768, 1.40552457809916, 1.40849659764044, 1.41146872627757,
+        1.41444096339122, 1.41741330836661, 1.42038576059353, 1.42335831946621,
+        1.42633098438336, 1.4293037547481, 1.4322766299679, 1.43524960945457,
+        1.4382226926242, 1.44119587889714, 1.44416916769797, 1.44714255845542,
+        1.45011605060237, 1.45308964357582, 1.4560633368168, 1.4590371297704,
+        1.46201102188571, 1.46498501261575, 1.4679591014175, 1.4709332877518,
+        1.47390757108336, 1.47688195088072, 1.47985642661621, 1.4828309977659,
+        1.48580566380959, 1.48878042423078, 1.49175527851663, 1.49473022615791,
+        1.497705266649, 1.50068039948784, 1.50365562417591, 1.50663094021819,
+        1.50960634712313, 1.51258184440264, 1.51555743157201, 1.51853310814995,
+        1.52150887365852, 1.52448472762308, 1.52746066957233, 1.5304366990382,
+        1.5334128155559, 1.53638901866382, 1.53936530790358, 1.54234168281991,
+        1.54531814296073, 1.54829468787702, 1.55127131712288, 1.55424803025543,
+        1.55722482683486, 1.56020170642432, 1.56317866858999, 1.56615571290096,
+        1.56913283892928, 1.57211004624989, 1.57508733444062, 1.57806470308215,
+        1.581042151758, 1.5840196800545, 1.58699728756077, 1.58997497386869,
+        1.59295273857288, 1.59593058127069, 1.59890850156214, 1.60188649904995,
+        1.60486457333949, 1.60784272403876, 1.61082095075835, 1.61379925311146,
+        1.61677763071385, 1.61975608318383, 1.62273461014223, 1.62571321121238,
+        1.6286918860201, 1.63167063419368, 1.63464945536385, 1.63762834916377,
+        1.64060731522898, 1.64358635319744, 1.64656546270947, 1.64954464340772,
+        1.65252389493717, 1.65550321694514, 1.65848260908121, 1.66146207099724,
+        1.66444160234737, 1.66742120278794, 1.67040087197754, 1.67338060957694,
+        1.67636041524912, 1.67934028865921, 1.68232022947448, 1.68530023736436,
+        1.68828031200039, 1.69126045305619, 1.69424066020748, 1.69722093313206,
+        1.70020127150975, 1.70318167502243, 1.70616214335399, 1.70914267619032,
+        1.71212327321931, 1.71510393413081, 1.71808465861664, 1.72106544637054,
+        1.7240462970882, 1.72702721046721, 1.73000818620707, 1.73298922400914,
+        1.73597032357667, 1.73895148461476, 1.74193270683033, 1.74491398993216,
+        1.7478953336308, 1.75087673763865, 1.75385820166984, 1.7568397254403,
+        1.75982130866772, 1.76280295107152, 1.76578465237286, 1.7687664122946,
+        1.77174823056134, 1.77473010689934, 1.77771204103655, 1.78069403270257,
+        1.78367608162869, 1.7866581875478, 1.78964035019446, 1.7926225693048,
+        1.79560484461659, 1.79858717586919, 1.80156956280351, 1.80455200516208,
+        1.80753450268893, 1.81051705512969, 1.81349966223148, 1.81648232374297,
+        1.81946503941432, 1.82244780899722, 1.82543063224482, 1.82841350891177,
+        1.83139643875416, 1.83437942152958, 1.83736245699702, 1.84034554491693,
+        1.84332868505119, 1.84631187716308, 1.84929512101728, 1.85227841637989,
+        1.85526176301836, 1.85824516070154, 1.86122860919963, 1.86421210828419,
+        1.86719565772812, 1.87017925730566, 1.87316290679237, 1.87614660596512,
+        1.8791303546021, 1.88211415248278, 1.88509799938793, 1.88808189509959,
+        1.89106583940106, 1.89404983207693, 1.89703387291301, 1.90001796169636,
+        1.90300209821527, 1.90598628225928, 1.9089705136191, 1.91195479208667,
+        1.91493911745515, 1.91792348951885, 1.92090790807328, 1.92389237291513,
+        1.92687688384224, 1.92986144065361, 1.93284604314939, 1.93583069113087,
+        1.93881538440048, 1.94180012276177, 1.94478490601938, 1.9477697339791,
+        1.9507546064478, 1.95373952323344, 1.95672448414508, 1.95970948899283,
+        1.9626945375879, 1.96567962974256, 1.96866476527011, 1.97164994398493,
+        1.97463516570241, 1.97762043023901, 1.98060573741218, 1.98359108704042,
+        1.98657647894322, 1.98956191294109, 1.99254738885554, 1.99553290650905,
+        1.99851846572511, 2.00150406632818, 2.00448970814369, 2.00747539099804,
+        2.01046111471858, 2.01344687913362, 2.01643268407241, 2.01941852936515,
+        2.02240441484295, 2.02539034033787, 2.02837630568289, 2.03136231071188,
+        2.03434835525965, 2.03733443916187, 2.04032056225516, 2.04330672437698,
+        2.04629292536571, 2.04927916506058, 2.05226544330171, 2.05525175993008,
+        2.05823811478753, 2.06122450771675, 2.06421093856129, 2.06719740716554,
+        2.07018391337473, 2.0731704570349, 2.07615703799295, 2.07914365609657,
+        2.0821303111943, 2.08511700313546, 2.08810373177019, 2.09109049694942,
+        2.09407729852489, 2.09706413634911, 2.10005101027539, 2.10303792015781,
+        2.10602486585123, 2.10901184721127, 2.11199886409433, 2.11498591635754,
+        2.11797300385882, 2.12096012645681, 2.12394728401091, 2.12693447638125,
+        2.1299217034287, 2.13290896501487, 2.13589626100206, 2.13888359125333,
+        2.14187095563243, 2.14485835400385, 2.14784578623274, 2.15083325218499,
+        2.15382075172718, 2.15680828472658, 2.15979585105114, 2.16278345056951,
+        2.16577108315101, 2.16875874866563, 2.17174644698404, 2.17473417797759,
+        2.17772194151825, 2.1807097374787, 2.18369756573225, 2.18668542615284,
+        2.1896733186151, 2.19266124299426, 2.19564919916622, 2.19863718700749,
+        2.20162520639522, 2.20461325720719, 2.2076013393218, 2.21058945261806,
+        2.21357759697561, 2.21656577227467, 2.21955397839611, 2.22254221522137,
+        2.22553048263249, 2.22851878051212, 2.2315071087435, 2.23449546721045,
+        2.23748385579737, 2.24047227438926, 2.24346072287168, 2.24644920113076,
+        2.24943770905322, 2.25242624652633, 2.25541481343792, 2.2584034096764,
+        2.26139203513071, 2.26438068969036, 2.26736937324541, 2.27035808568645,
+        2.27334682690463, 2.27633559679163, 2.27932439523966, 2.28231322214149,
+        2.28530207739037, 2.28829096088013, 2.29127987250509, 2.29426881216009,
+        2.2972577797405, 2.30024677514221, 2.30323579826159, 2.30622484899554,
+        2.30921392724147, 2.31220303289727, 2.31519216586134, 2.31818132603257,
+        2.32117051331036, 2.32415972759458, 2.32714896878558, 2.33013823678422,
+        2.33312753149181, 2.33611685281017, 2.33910620064156, 2.34209557488875,
+        2.34508497545493, 2.34807440224381, 2.35106385515953, 2.3540533341067,
+        2.35704283899038, 2.3600323697161, 2.36302192618983, 2.36601150831799,
+        2.36900111600747, 2.37199074916557, 2.37498040770005, 2.37797009151911,
+        2.38095980053139, 2.38394953464595, 2.38693929377231, 2.38992907782037,
+        2.39291888670051, 2.3959087203235, 2.39889857860055, 2.40188846144327,
+        2.40487836876371, 2.40786830047432, 2.41085825648796, 2.41384823671791,
+        2.41683824107785, 2.41982826948186, 2.42281832184444, 2.42580839808047,
+        2.42879849810524, 2.43178862183443, 2.43477876918412, 2.43776894007077,
+        2.44075913441124, 2.44374935212277, 2.44673959312299, 2.44972985732991,
+        2.4527201446619, 2.45571045503775, 2.45870078837658, 2.46169114459792,
+        2.46468152362165, 2.46767192536803, 2.47066234975767, 2.47365279671157,
+        2.47664326615107, 2.47963375799789, 2.4826242721741, 2.48561480860211,
+        2.48860536720473, 2.49159594790506, 2.49458655062662, 2.49757717529321,
+        2.50056782182904, 2.50355849015861, 2.50654918020681, 2.50953989189883,
+        2.51253062516023, 2.5155213799169, 2.51851215609504, 2.52150295362123,
+        2.52449377242234, 2.52748461242559, 2.53047547355852, 2.533466355749,
+        2.53645725892522, 2.53944818301571, 2.5424391279493, 2.54543009365514,
+        2.54842108006271, 2.55141208710179, 2.55440311470249, 2.55739416279522,
+        2.5603852313107, 2.56337632017997, 2.56636742933436, 2.56935855870553,
+        2.57234970822541, 2.57534087782625, 2.57833206744061, 2.58132327700134,
+        2.58431450644157, 2.58730575569474, 2.5902970246946, 2.59328831337516,
+        2.59627962167074, 2.59927094951595, 2.60226229684568, 2.6052536635951,
+        2.60824504969967, 2.61123645509514, 2.61422787971754, 2.61721932350317,
+        2.62021078638861, 2.62320226831072, 2.62619376920663, 2.62918528901376,
+        2.63217682766978, 2.63516838511264, 2.63815996128056, 2.64115155611203,
+        2.64414316954581, 2.6471348015209, 2.6501264519766, 2.65311812085245,
+        2.65610980808825, 2.65910151362406, 2.66209323740021, 2.66508497935728,
+        2.66807673943609, 2.67106851757774, 2.67406031372356, 2.67705212781515,
+        2.68004395979434, 2.68303580960323, 2.68602767718415, 2.68901956247968,
+        2.69201146543265, 2.69500338598612, 2.69799532408342, 2.70098727966808,
+        2.70397925268391, 2.70697124307493, 2.70996325078541, 2.71295527575985,
+        2.71594731794299, 2.7189393772798, 2.72193145371547, 2.72492354719545,
+        2.7279156576654, 2.7309077850712, 2.73389992935898, 2.73689209047507,
+        2.73988426836605, 2.74287646297871, 2.74586867426007, 2.74886090215736,
+        2.75185314661803, 2.75484540758977, 2.75783768502047, 2.76082997885823,
+        2.76382228905139, 2.76681461554849, 2.76980695829827, 2.77279931724972,
+        2.77579169235199, 2.7787840835545, 2.78177649080682, 2.78476891405877,
+        2.78776135326036, 2.79075380836181, 2.79374627931355, 2.79673876606619,
+        2.79973126857058, 2.80272378677773, 2.8057163206389, 2.8087088701055,
+        2.81170143512918, 2.81469401566175, 2.81768661165525, 2.8206792230619,
+        2.82367184983412, 2.82666449192451, 2.82965714928588, 2.83264982187122,
+        2.83564250963373, 2.83863521252677, 2.84162793050391, 2.8446206635189,
+        2.84761341152569, 2.8506061744784, 2.85359895233133, 2.856591745039,
+        2.85958455255607, 2.86257737483741, 2.86557021183805, 2.86856306351324,
+        2.87155592981835, 2.87454881070899, 2.87754170614091, 2.88053461607004,
+        2.8835275404525, 2.88652047924458, 2.88951343240274, 2.89250639988362,
+        2.89549938164403, 2.89849237764095, 2.90148538783152, 2.90447841217309,
+        2.90747145062312, 2.9104645031393, 2.91345756967944, 2.91645065020153,
+        2.91944374466375, 2.92243685302442, 2.92542997524202, 2.92842311127522,
+        2.93141626108282, 2.93440942462382, 2.93740260185734, 2.94039579274269,
+        2.94338899723933, 2.94638221530689, 2.94937544690513, 2.952368691994,
+        2.95536195053358, 2.95835522248412, 2.96134850780603, 2.96434180645986,
+        2.96733511840632, 2.97032844360628, 2.97332178202075, 2.9763151336109,
+        2.97930849833805, 2.98230187616366, 2.98529526704936, 2.98828867095689,
+        2.99128208784819, 2.99427551768531, 2.99726896043045, 3.00026241604598,
+        3.00325588449437, 3.00624936573829, 3.00924285974051, 3.01223636646396,
+        3.01522988587171, 3.01822341792697, 3.0212169625931, 3.02421051983358,
+        3.02720408961206, 3.0301976718923, 3.03319126663822, 3.03618487381385,
+        3.03917849338339, 3.04217212531115, 3.04516576956159, 3.0481594260993,
+        3.05115309488902, 3.05414677589559, 3.057140469084, 3.0601341744194,
+        3.06312789186702, 3.06612162139227, 3.06911536296065, 3.07210911653782,
+        3.07510288208955, 3.07809665958176, 3.08109044898047, 3.08408425025185,
+        3.08707806336219, 3.09007188827791, 3.09306572496555, 3.09605957339178,
+        3.09905343352338, 3.10204730532727, 3.1050411887705, 3.10803508382023,
+        3.11102899044373, 3.11402290860843, 3.11701683828184, 3.12001077943162,
+        3.12300473202553, 3.12599869603147, 3.12899267141743, 3.13198665815156,
+        3.13498065620208, 3.13797466553737, 3.14096868612589, 3.14396271793625,
+        3.14695676093716, 3.14995081509744, 3.15294488038603, 3.15593895677199,
+        3.15893304422449, 3.1619271427128, 3.16492125220632, 3.16791537267456,
+        3.17090950408714, 3.17390364641378, 3.17689779962433, 3.17989196368873,
+        3.18288613857705, 3.18588032425945, 3.18887452070622, 3.19186872788773,
+        3.19486294577448, 3.19785717433707, 3.20085141354621, 3.20384566337272,
+        3.2068399237875, 3.20983419476159, 3.21282847626611, 3.2158227682723,
+        3.2188170707515, 3.22181138367515, 3.22480570701478, 3.22780004074205,
+        3.23079438482871, 3.2337887392466, 3.23678310396768, 3.239777478964,
+        3.2427718642077, 3.24576625967105, 3.24876066532638, 3.25175508114616,
+        3.25474950710293, 3.25774394316934, 3.26073838931813, 3.26373284552214,
+        3.2667273117543, 3.26972178798766, 3.27271627419534, 3.27571077035058,
+        3.27870527642668, 3.28169979239706, 3.28469431823523, 3.2876888539148,
+        3.29068339940947, 3.29367795469301, 3.29667251973932, 3.29966709452236,
+        3.3026616790162, 3.305656273195, 3.30865087703301, 3.31164549050457,
+        3.3146401135841, 3.31763474624612, 3.32062938846524, 3.32362404021616,
+        3.32661870147366, 3.32961337221261, 3.33260805240798, 3.33560274203482,
+        3.33859744106825, 3.34159214948351, 3.3445868672559, 3.34758159436082,
+        3.35057633077374, 3.35357107647024, 3.35656583142596, 3.35956059561663,
+        3.36255536901808, 3.36555015160621, 3.36854494335701, 3.37153974424653,
+        3.37453455425095, 3.37752937334648, 3.38052420150944, 3.38351903871624,
+        3.38651388494335, 3.38950874016732, 3.39250360436481, 3.39549847751253,
+        3.39849335958728, 3.40148825056594, 3.40448315042547, 3.40747805914291,
+        3.41047297669538, 3.41346790306006, 3.41646283821424, 3.41945778213525,
+        3.42245273480054, 3.42544769618759, 3.428442666274, 3.43143764503743,
+        3.43443263245559, 3.43742762850631, 3.44042263316746, 3.44341764641701,
+        3.44641266823298, 3.44940769859349, 3.45240273747671, 3.45539778486091,
+        3.4583928407244, 3.4613879050456, 3.46438297780298, 3.46737805897508,
+        3.47037314854052, 3.473368246478, 3.47636335276627, 3.47935846738417,
+        3.48235359031061, 3.48534872152457, 3.48834386100508, 3.49133900873126,
+        3.4943341646823, 3.49732932883746, 3.50032450117605, 3.50331968167748,
+        3.50631487032121, 3.50931006708676, 3.51230527195374, 3.5153004849018,
+        3.5182957059107, 3.52129093496021, 3.52428617203023, 3.52728141710067,
+        3.53027667015155, 3.53327193116292, 3.53626720011493, 3.53926247698777,
+        3.5422577617617, 3.54525305441706, 3.54824835493424, 3.5512436632937,
+        3.55423897947595, 3.5572343034616, 3.56022963523129, 3.56322497476573,
+        3.5662203220457, 3.56921567705204, 3.57221103976566, 3.57520641016752,
+        3.57820178823865, 3.58119717396013, 3.58419256731313, 3.58718796827885,
+        3.59018337683857, 3.59317879297362, 3.59617421666541, 3.59916964789537,
+        3.60216508664504, 3.60516053289599, 3.60815598662986, 3.61115144782833,
+        3.61414691647318, 3.6171423925462, 3.62013787602928, 3.62313336690434,
+        3.62612886515338, 3.62912437075844, 3.63211988370163, 3.63511540396512,
+        3.63811093153111, 3.6411064663819, 3.64410200849982, 3.64709755786725,
+        3.65009311446665, 3.65308867828052, 3.65608424929142, 3.65907982748197,
+        3.66207541283484, 3.66507100533275, 3.6680666049585, 3.6710622116949,
+        3.67405782552487, 3.67705344643134, 3.68004907439731, 3.68304470940585,
+        3.68604035144005, 3.68903600048309, 3.69203165651817, 3.69502731952856,
+        3.69802298949759, 3.70101866640864, 3.70401435024512, 3.70701004099052,
+        3.71000573862838, 3.71300144314226, 3.71599715451582, 3.71899287273274,
+        3.72198859777675, 3.72498432963165, 3.72798006828127, 3.73097581370951,
+        3.73397156590031, 3.73696732483767, 3.73996309050562, 3.74295886288825,
+        3.74595464196972, 3.7489504277342, 3.75194622016596, 3.75494201924926,
+        3.75793782496846, 3.76093363730793, 3.76392945625213, 3.76692528178553,
+        3.76992111389267, 3.77291695255813, 3.77591279776653, 3.77890864950256,
+        3.78190450775095, 3.78490037249646, 3.78789624372391, 3.79089212141817,
+        3.79388800556415, 3.79688389614681, 3.79987979315116, 3.80287569656226,
+        3.80587160636519, 3.80886752254511, 3.8118634450872, 3.8148593739767,
+        3.81785530919889, 3.8208512507391, 3.8238471985827, 3.82684315271511,
+        3.82983911312178, 3.83283507978822, 3.83583105269998, 3.83882703184265,
+        3.84182301720188, 3.84481900876335, 3.84781500651277, 3.85081101043592,
+        3.85380702051862, 3.85680303674671, 3.8597990591061, 3.86279508758273,
+        3.86579112216258, 3.86878716283167, 3.87178320957608, 3.87477926238193,
+        3.87777532123535, 3.88077138612255, 3.88376745702976, 3.88676353394327,
+        3.88975961684939, 3.89275570573448, 3.89575180058495, 3.89874790138724,
+        3.90174400812784, 3.90474012079326, 3.90773623937008, 3.91073236384489,
+        3.91372849420436, 3.91672463043515, 3.919720772524, 3.92271692045768,
+        3.92571307422298, 3.92870923380676, 3.93170539919589, 3.93470157037731,
+        3.93769774733797, 3.94069393006487, 3.94369011854505, 3.9466863127656,
+        3.94968251271362, 3.95267871837629, 3.95567492974077, 3.95867114679432,
+        3.9616673695242, 3.96466359791771, 3.9676598319622, 3.97065607164505,
+        3.97365231695369, 3.97664856787556, 3.97964482439816, 3.98264108650903,
+        3.98563735419573, 3.98863362744586, 3.99162990624706, 3.99462619058702,
+        3.99762248045344, 4.00061877583408, 4.00361507671671, 4.00661138308917,
+        4.0096076949393, 4.012604012255, 4.0156003350242, 4.01859666323486,
+        4.02159299687498, 4.02458933593259, 4.02758568039577, 4.03058203025261,
+        4.03357838549125, 4.03657474609987, 4.03957111206667, 4.04256748337989,
+        4.04556386002782, 4.04856024199875, 4.05155662928104, 4.05455302186305,
+        4.05754941973321, 4.06054582287995, 4.06354223129176, 4.06653864495714,
+        4.06953506386464, 4.07253148800284, 4.07552791736035, 4.07852435192582,
+        4.08152079168791, 4.08451723663534, 4.08751368675685, 4.09051014204121,
+        4.09350660247724, 4.09650306805376, 4.09949953875965, 4.10249601458381,
+        4.10549249551518, 4.10848898154272, 4.11148547265543, 4.11448196884234,
+        4.1174784700925, 4.12047497639502, 4.12347148773901, 4.12646800411363,
+        4.12946452550806, 4.13246105191151, 4.13545758331324, 4.13845411970252,
+        4.14145066106866, 4.144447207401, 4.1474437586889, 4.15044031492176,
+        4.15343687608901, 4.15643344218011, 4.15943001318455, 4.16242658909184,
+        4.16542316989154, 4.16841975557321, 4.17141634612648, 4.17441294154096,
+        4.17740954180633, 4.18040614691228, 4.18340275684854, 4.18639937160486,
+        4.18939599117101, 4.19239261553681, 4.19538924469209, 4.19838587862673,
+        4.20138251733061, 4.20437916079367, 4.20737580900585, 4.21037246195713,
+        4.21336911963753, 4.21636578203707, 4.21936244914582, 4.22235912095387,
+        4.22535579745135, 4.22835247862839, 4.23134916447518, 4.23434585498191,
+        4.23734255013881, 4.24033924993614, 4.24333595436418, 4.24633266341324,
+        4.24932937707366, 4.25232609533581, 4.25532281819006, 4.25831954562684,
+        4.2613162776366, 4.2643130142098, 4.26730975533693, 4.27030650100853,
+        4.27330325121513, 4.27630000594732, 4.2792967651957, 4.28229352895088,
+        4.28529029720353, 4.28828706994432, 4.29128384716396, 4.29428062885317,
+        4.29727741500271, 4.30027420560335, 4.30327100064592, 4.30626780012122,
+        4.30926460402013, 4.31226141233352, 4.31525822505229, 4.31825504216738,
+        4.32125186366975, 4.32424868955036, 4.32724551980023, 4.33024235441039,
+        4.33323919337188, 4.33623603667579, 4.33923288431321, 4.34222973627528,
+        4.34522659255315, 4.34822345313798, 4.35122031802098, 4.35421718719336,
+        4.35721406064638, 4.36021093837131, 4.36320782035943, 4.36620470660206,
+        4.36920159709055, 4.37219849181625, 4.37519539077056, 4.37819229394487,
+        4.38118920133064, 4.38418611291931, 4.38718302870236, 4.3901799486713,
+        4.39317687281764, 4.39617380113294, 4.39917073360877, 4.40216767023671,
+        4.4051646110084, 4.40816155591545, 4.41115850494954, 4.41415545810235,
+        4.41715241536557, 4.42014937673095, 4.42314634219022, 4.42614331173516,
+        4.42914028535756, 4.43213726304924, 4.43513424480203, 4.43813123060779,
+        4.44112822045841, 4.44412521434577, 4.44712221226182, 4.45011921419848,
+        4.45311622014773, 4.45611323010156, 4.45911024405197, 4.46210726199099,
+        4.46510428391067, 4.46810130980309, 4.47109833966034, 4.47409537347452,
+        4.47709241123779, 4.48008945294228, 4.48308649858018, 4.48608354814368,
+        4.48908060162501, 4.49207765901639, 4.49507472031008, 4.49807178549837,
+        4.50106885457355, 4.50406592752794, 4.50706300435388, 4.51006008504373,
+        4.51305716958986, 4.51605425798468, 4.5190513502206, 4.52204844629006,
+        4.52504554618553, 4.52804264989947, 4.53103975742439, 4.53403686875281,
+        4.53703398387725, 4.54003110279028, 4.54302822548447, 4.54602535195241,
+        4.54902248218673, 4.55201961618005, 4.55501675392502, 4.55801389541432,
+        4.56101104064063, 4.56400818959667, 4.56700534227517, 4.57000249866886,
+        4.57299965877052, 4.57599682257293, 4.5789939900689, 4.58199116125124,
+        4.58498833611279, 4.58798551464642, 4.590982696845, 4.59397988270142,
+        4.5969770722086, 4.59997426535947, 4.60297146214698, 4.6059686625641,
+        4.60896586660382, 4.61196307425913, 4.61496028552307, 4.61795750038866,
+        4.62095471884897, 4.62395194089707, 4.62694916652606, 4.62994639572904,
+        4.63294362849915, 4.63594086482953, 4.63893810471335, 4.64193534814377,
+        4.64493259511401, 4.64792984561728, 4.65092709964681, 4.65392435719585,
+        4.65692161825766, 4.65991888282554, 4.66291615089278, 4.6659134224527,
+        4.66891069749864, 4.67190797602394, 4.67490525802198, 4.67790254348614,
+        4.68089983240982, 4.68389712478644, 4.68689442060945, 4.68989171987228,
+        4.69288902256841, 4.69588632869133, 4.69888363823453, 4.70188095119153,
+        4.70487826755588, 4.7078755873211, 4.71087291048078, 4.7138702370285,
+        4.71686756695785, 4.71986490026246, 4.72286223693594, 4.72585957697195,
+        4.72885692036415, 4.73185426710622, 4.73485161719185, 4.73784897061476,
+        4.74084632736866, 4.7438436874473, 4.74684105084445, 4.74983841755386,
+        4.75283578756933, 4.75583316088466, 4.75883053749367, 4.7618279173902,
+        4.76482530056809, 4.76782268702121, 4.77082007674344, 4.77381746972867,
+        4.77681486597082, 4.77981226546381, 4.78280966820159, 4.7858070741781,
+        4.78880448338732, 4.79180189582323, 4.79479931147983, 4.79779673035115,
+        4.8007941524312, 4.80379157771403, 4.80678900619371, 4.8097864378643,
+        4.81278387271989, 4.8157813107546, 4.81877875196253, 4.82177619633781,
+        4.8247736438746, 4.82777109456705, 4.83076854840934, 4.83376600539566,
+        4.83676346552021, 4.83976092877721, 4.84275839516089, 4.84575586466549,
+        4.84875333728529, 4.85175081301454, 4.85474829184754, 4.85774577377859,
+        4.86074325880201, 4.86374074691213, 4.86673823810328, 4.86973573236983,
+        4.87273322970615, 4.87573073010662, 4.87872823356564, 4.88172574007762,
+        4.88472324963699, 4.88772076223819, 4.89071827787566, 4.89371579654388,
+        4.89671331823732, 4.89971084295048, 4.90270837067786, 4.90570590141398,
+        4.90870343515337, 4.91170097189058, 4.91469851162017, 4.91769605433671,
+        4.92069360003478, 4.92369114870898, 4.92668870035393, 4.92968625496424,
+        4.93268381253456, 4.93568137305952, 4.93867893653381, 4.94167650295208,
+        4.94467407230903, 4.94767164459936, 4.95066921981779, 4.95366679795903,
+        4.95666437901783, 4.95966196298894, 4.96265954986712, 4.96565713964715,
+        4.96865473232381, 4.97165232789192, 4.97464992634628, 4.97764752768171,
+        4.98064513189306, 4.98364273897518, 4.98664034892293, 4.98963796173118,
+        4.99263557739483, 4.99563319590876, 4.9986308172679, 5.00162844146716,
+        5.00462606850149, 5.00762369836582, 5.01062133105512, 5.01361896656436,
+        5.01661660488852, 5.0196142460226, 5.0226118899616, 5.02560953670055,
+        5.02860718623447, 5.03160483855841, 5.03460249366741, 5.03760015155655,
+        5.0405978122209, 5.04359547565555, 5.0465931418556, 5.04959081081616,
+        5.05258848253236, 5.05558615699933, 5.05858383421221, 5.06158151416617,
+        5.06457919685637, 5.06757688227799, 5.07057457042622, 5.07357226129626,
+        5.07656995488334, 5.07956765118267, 5.08256535018949, 5.08556305189905,
+        5.0885607563066, 5.09155846340742, 5.09455617319678, 5.09755388566998,
+        5.10055160082231, 5.1035493186491, 5.10654703914566, 5.10954476230734,
+        5.11254248812947, 5.11554021660741, 5.11853794773653, 5.12153568151221,
+        5.12453341792983, 5.1275311569848, 5.13052889867253, 5.13352664298843,
+        5.13652438992794, 5.1395221394865, 5.14251989165956, 5.14551764644259,
+        5.14851540383105, 5.15151316382043, 5.15451092640623, 5.15750869158395,
+        5.1605064593491, 5.16350422969721, 5.16650200262381, 5.16949977812446,
+        5.1724975561947, 5.1754953368301, 5.17849312002624, 5.1814909057787,
+        5.18448869408308, 5.18748648493499, 5.19048427833005, 5.19348207426387,
+        5.1964798727321, 5.19947767373038, 5.20247547725437, 5.20547328329973,
+        5.20847109186215, 5.2114689029373, 5.21446671652089, 5.21746453260861,
+        5.22046235119619, 5.22346017227935, 5.22645799585382, 5.22945582191535,
+        5.23245365045969, 5.23545148148261, 5.23844931497988, 5.24144715094728,
+        5.24444498938061, 5.24744283027566, 5.25044067362825, 5.2534385194342,
+        5.25643636768934, 5.25943421838951, 5.26243207153056, 5.26542992710835,
+        5.26842778511874, 5.27142564555762, 5.27442350842086, 5.27742137370437,
+        5.28041924140405, 5.28341711151581, 5.28641498403558, 5.28941285895929,
+        5.29241073628288, 5.2954086160023, 5.29840649811352, 5.30140438261249,
+        5.3044022694952, 5.30740015875764, 5.3103980503958, 5.31339594440569,
+        5.31639384078331, 5.3193917395247, 5.32238964062588, 5.3253875440829,
+        5.32838544989179, 5.33138335804863, 5.33438126854948, 5.33737918139041,
+        5.34037709656751, 5.34337501407687, 5.34637293391459, 5.34937085607678,
+        5.35236878055957, 5.35536670735907, 5.35836463647143, 5.36136256789278,
+        5.36436050161929, 5.36735843764712, 5.37035637597243, 5.3733543165914,
+        5.37635225950022, 5.37935020469509, 5.3823481521722, 5.38534610192778,
+        5.38834405395804, 5.39134200825921, 5.39433996482753, 5.39733792365925,
+        5.40033588475061, 5.40333384809788, 5.40633181369733, 5.40932978154525,
+        5.4123277516379, 5.4153257239716, 5.41832369854264, 5.42132167534733,
+        5.42431965438199, 5.42731763564296, 5.43031561912656, 5.43331360482914,
+        5.43631159274705, 5.43930958287664, 5.4423075752143, 5.44530556975638,
+        5.44830356649928, 5.45130156543938, 5.45429956657308, 5.45729756989679,
+        5.46029557540693, 5.46329358309991, 5.46629159297217, 5.46928960502014,
+        5.47228761924028, 5.47528563562902, 5.47828365418283, 5.48128167489819,
+        5.48427969777156, 5.48727772279944, 5.49027574997831, 5.49327377930467,
+        5.49627181077502, 5.49926984438589, 5.50226788013379, 5.50526591801526,
+        5.50826395802682, 5.51126200016503, 5.51426004442643, 5.51725809080759,
+        5.52025613930507, 5.52325418991544, 5.52625224263528, 5.52925029746119,
+        5.53224835438976, 5.53524641341759, 5.5382444745413, 5.54124253775749,
+        5.5442406030628, 5.54723867045386, 5.5502367399273, 5.55323481147978,
+        5.55623288510795, 5.55923096080846, 5.56222903857799, 5.56522711841321,
+        5.5682252003108, 5.57122328426746, 5.57422137027988, 5.57721945834476,
+        5.58021754845881, 5.58321564061876, 5.58621373482131, 5.58921183106322,
+        5.59220992934121, 5.59520802965203, 5.59820613199243, 5.60120423635917,
+        5.60420234274903, 5.60720045115876, 5.61019856158515, 5.61319667402499,
+        5.61619478847507, 5.61919290493218, 5.62219102339315, 5.62518914385477,
+        5.62818726631388, 5.63118539076729, 5.63418351721184, 5.63718164564438,
+        5.64017977606174, 5.64317790846079, 5.64617604283838, 5.64917417919138,
+        5.65217231751667, 5.65517045781111, 5.65816860007161, 5.66116674429505,
+        5.66416489047834, 5.66716303861837, 5.67016118871207, 5.67315934075635,
+        5.67615749474813, 5.67915565068436, 5.68215380856196, 5.68515196837789,
+        5.68815013012909, 5.69114829381252, 5.69414645942515, 5.69714462696394,
+        5.70014279642588, 5.70314096780794, 5.70613914110712, 5.70913731632041,
+        5.71213549344481, 5.71513367247734, 5.718131853415, 5.72113003625481,
+        5.72412822099381, 5.72712640762902, 5.73012459615748, 5.73312278657625,
+        5.73612097888237, 5.73911917307289, 5.74211736914489, 5.74511556709543,
+        5.74811376692158, 5.75111196862044, 5.75411017218908, 5.7571083776246,
+        5.7601065849241, 5.76310479408469, 5.76610300510347, 5.76910121797757,
+        5.77209943270411, 5.77509764928022, 5.77809586770303, 5.78109408796968,
+        5.78409231007733, 5.78709053402313, 5.79008875980423, 5.7930869874178,
+        5.796085216861, 5.79908344813103, 5.80208168122505, 5.80507991614026,
+        5.80807815287385, 5.81107639142302, 5.81407463178498, 5.81707287395693,
+        5.8200711179361, 5.82306936371969, 5.82606761130496, 5.82906586068912,
+        5.83206411186941, 5.83506236484309, 5.8380606196074, 5.84105887615959,
+        5.84405713449694, 5.8470553946167, 5.85005365651615, 5.85305192019257,
+        5.85605018564324, 5.85904845286545, 5.8620467218565, 5.86504499261369,
+        5.86804326513432, 5.8710415394157, 5.87403981545515, 5.87703809325,
+        5.88003637279757, 5.88303465409519, 5.88603293714021, 5.88903122192996,
+        5.8920295084618, 5.89502779673308, 5.89802608674116, 5.9010243784834,
+        5.90402267195719, 5.90702096715988, 5.91001926408887, 5.91301756274153,
+        5.91601586311527, 5.91901416520748, 5.92201246901556, 5.92501077453691,
+        5.92800908176896, 5.93100739070911, 5.9340057013548, 5.93700401370344,
+        5.94000232775248, 5.94300064349935, 5.94599896094149, 5.94899728007636,
+        5.9519956009014, 5.95499392341409, 5.95799224761187, 5.96099057349222,
+        5.96398890105261, 5.96698723029053, 5.96998556120345, 5.97298389378887,
+        5.97598222804427, 5.97898056396717, 5.98197890155506, 5.98497724080545,
+        5.98797558171586, 5.9909739242838, 5.9939722685068, 5.99697061438239,
+        5.99996896190811, 6.00296731108148, 6.00596566190005, 6.00896401436138,
+        6.01196236846302, 6.01496072420251, 6.01795908157744, 6.02095744058535,
+        6.02395580122384, 6.02695416349047, 6.02995252738282, 6.03295089289849,
+        6.03594926003506, 6.03894762879013, 6.04194599916131, 6.04494437114619,
+        6.04794274474239, 6.05094111994753, 6.05393949675922, 6.05693787517508,
+        6.05993625519276, 6.06293463680988, 6.06593302002408, 6.068931404833,
+        6.07192979123429, 6.07492817922561, 6.07792656880461, 6.08092495996895,
+        6.0839233527163, 6.08692174704433, 6.08992014295072, 6.09291854043314,
+        6.09591693948928, 6.09891534011683, 6.10191374231348, 6.10491214607693,
+        6.10791055140489, 6.11090895829505, 6.11390736674514, 6.11690577675286,
+        6.11990418831594, 6.1229026014321, 6.12590101609907, 6.12889943231459,
+        6.13189785007639, 6.13489626938221, 6.13789469022981, 6.14089311261693,
+        6.14389153654133, 6.14688996200077, 6.14988838899301, 6.15288681751582,
+        6.15588524756698, 6.15888367914426, 6.16188211224544, 6.16488054686831,
+        6.16787898301065, 6.17087742067027, 6.17387585984496, 6.17687430053253,
+        6.17987274273078, 6.18287118643752, 6.18586963165056, 6.18886807836774,
+        6.19186652658686, 6.19486497630577, 6.19786342752228, 6.20086188023425,
+        6.2038603344395, 6.20685879013589, 6.20985724732126, 6.21285570599346,
+        6.21585416615036, 6.21885262778981, 6.22185109090968, 6.22484955550783,
+        6.22784802158215, 6.23084648913051, 6.23384495815079, 6.23684342864087,
+        6.23984190059865, 6.24284037402202, 6.24583884890887, 6.24883732525712,
+        6.25183580306466, 6.2548342823294, 6.25783276304926, 6.26083124522216,
+        6.26382972884601, 6.26682821391875, 6.2698267004383, 6.27282518840259,
+        6.27582367780957, 6.27882216865717, 6.28182066094335, 6.28481915466604,
+        6.2878176498232, 6.29081614641279, 6.29381464443277, 6.2968131438811,
+        6.29981164475575, 6.3028101470547, 6.30580865077592, 6.30880715591739,
+        6.3118056624771, 6.31480417045302, 6.31780267984316, 6.32080119064551,
+        6.32379970285806, 6.32679821647882, 6.3297967315058, 6.33279524793701,
+        6.33579376577046, 6.33879228500416, 6.34179080563614, 6.34478932766443,
+        6.34778785108705, 6.35078637590204, 6.35378490210743, 6.35678342970126,
+        6.35978195868157, 6.36278048904642, 6.36577902079385, 6.36877755392192,
+        6.37177608842869, 6.37477462431221, 6.37777316157056, 6.3807717002018,
+        6.38377024020401, 6.38676878157525, 6.38976732431362, 6.39276586841719,
+        6.39576441388406, 6.39876296071231, 6.40176150890003, 6.40476005844533,
+        6.4077586093463, 6.41075716160105, 6.41375571520769, 6.41675427016433,
+        6.41975282646909, 6.42275138412008, 6.42574994311542, 6.42874850345325,
+        6.43174706513169, 6.43474562814887, 6.43774419250293, 6.44074275819202,
+        6.44374132521426, 6.44673989356782, 6.44973846325083, 6.45273703426145,
+        6.45573560659785, 6.45873418025817, 6.46173275524059, 6.46473133154327,
+        6.46772990916437, 6.47072848810208, 6.47372706835457, 6.47672564992002,
+        6.47972423279662, 6.48272281698255, 6.485721402476, 6.48871998927516,
+        6.49171857737824, 6.49471716678344, 6.49771575748895, 6.50071434949298,
+        6.50371294279375, 6.50671153738946, 6.50971013327834, 6.51270873045861,
+        6.51570732892848, 6.51870592868619, 6.52170452972996, 6.52470313205803,
+        6.52770173566863, 6.53070034056001, 6.5336989467304, 6.53669755417805,
+        6.53969616290122, 6.54269477289815, 6.54569338416709, 6.54869199670632,
+        6.55169061051408, 6.55468922558865, 6.55768784192829, 6.56068645953127,
+        6.56368507839587, 6.56668369852037, 6.56968231990304, 6.57268094254218,
+        6.57567956643606, 6.57867819158298, 6.58167681798123, 6.5846754456291,
+        6.5876740745249, 6.59067270466693, 6.5936713360535, 6.5966699686829,
+        6.59966860255346, 6.60266723766349, 6.60566587401131, 6.60866451159523,
+        6.61166315041358, 6.61466179046469, 6.61766043174689, 6.62065907425851,
+        6.62365771799789, 6.62665636296335, 6.62965500915326, 6.63265365656595,
+        6.63565230519976, 6.63865095505306, 6.64164960612419, 6.64464825841151,
+        6.64764691191338, 6.65064556662816, 6.65364422255422, 6.65664287968992,
+        6.65964153803365, 6.66264019758376, 6.66563885833864, 6.66863752029667,
+        6.67163618345624, 6.67463484781572, 6.67763351337351, 6.68063218012799,
+        6.68363084807757, 6.68662951722064, 6.68962818755559, 6.69262685908084,
+        6.69562553179479, 6.69862420569585, 6.70162288078242, 6.70462155705293,
+        6.70762023450579, 6.71061891313942, 6.71361759295225, 6.71661627394269,
+        6.71961495610918, 6.72261363945015, 6.72561232396403, 6.72861100964926,
+        6.73160969650428, 6.73460838452753, 6.73760707371746, 6.74060576407251,
+        6.74360445559114, 6.74660314827179, 6.74960184211293, 6.75260053711301,
+        6.7555992332705, 6.75859793058385, 6.76159662905154, 6.76459532867204,
+        6.76759402944381, 6.77059273136534, 6.77359143443509, 6.77659013865156,
+        6.77958884401322, 6.78258755051856, 6.78558625816607, 6.78858496695423,
+        6.79158367688155, 6.79458238794652, 6.79758110014763, 6.80057981348339,
+        6.80357852795231, 6.80657724355289, 6.80957596028364, 6.81257467814307,
+        6.81557339712969, 6.81857211724203, 6.82157083847861, 6.82456956083794,
+        6.82756828431855, 6.83056700891897, 6.83356573463773, 6.83656446147336,
+        6.8395631894244, 6.84256191848939, 6.84556064866686, 6.84855937995536,
+        6.85155811235343, 6.85455684585963, 6.8575555804725, 6.86055431619059,
+        6.86355305301247, 6.86655179093669, 6.8695505299618, 6.87254927008638,
+        6.87554801130899, 6.8785467536282, 6.88154549704257, 6.88454424155069,
+        6.88754298715112, 6.89054173384244, 6.89354048162325, 6.8965392304921,
+        6.89953798044761, 6.90253673148834, 6.90553548361289, 6.90853423681986,
+        6.91153299110784, 6.91453174647543, 6.91753050292122, 6.92052926044382,
+        6.92352801904183, 6.92652677871387, 6.92952553945854, 6.93252430127444,
+        6.93552306416021, 6.93852182811445, 6.94152059313579, 6.94451935922284,
+        6.94751812637422, 6.95051689458858, 6.95351566386452, 6.95651443420069,
+        6.95951320559572, 6.96251197804824, 6.96551075155689, 6.96850952612032,
+        6.97150830173716, 6.97450707840606, 6.97750585612566, 6.98050463489463,
+        6.9835034147116, 6.98650219557523, 6.98950097748418, 6.99249976043711,
+        6.99549854443268, 6.99849732946955, 7.00149611554639, 7.00449490266187,
+        7.00749369081465, 7.01049248000341, 7.01349127022683, 7.01649006148357,
+        7.01948885377233, 7.02248764709178, 7.0254864414406, 7.02848523681748,
+        7.03148403322111, 7.03448283065019, 7.03748162910339, 7.04048042857942,
+        7.04347922907698, 7.04647803059476, 7.04947683313146, 7.0524756366858,
+        7.05547444125646, 7.05847324684217, 7.06147205344164, 7.06447086105357,
+        7.06746966967668, 7.07046847930968, 7.07346728995131, 7.07646610160027,
+        7.07946491425528, 7.08246372791509, 7.08546254257841, 7.08846135824397,
+        7.09146017491051, 7.09445899257675, 7.09745781124144, 7.10045663090331,
+        7.10345545156111, 7.10645427321357, 7.10945309585944, 7.11245191949747,
+        7.11545074412641, 7.118449569745, 7.12144839635201, 7.12444722394618,
+        7.12744605252627, 7.13044488209104, 7.13344371263925, 7.13644254416968,
+        7.13944137668107, 7.1424402101722, 7.14543904464184, 7.14843788008877,
+        7.15143671651174, 7.15443555390955, 7.15743439228096, 7.16043323162476,
+        7.16343207193973, 7.16643091322466, 7.16942975547832, 7.17242859869951,
+        7.17542744288702, 7.17842628803964, 7.18142513415616, 7.18442398123538,
+        7.1874228292761, 7.19042167827711, 7.19342052823723, 7.19641937915524,
+        7.19941823102997, 7.20241708386021, 7.20541593764478, 7.20841479238249,
+        7.21141364807215, 7.21441250471258, 7.2174113623026, 7.22041022084102,
+        7.22340908032667, 7.22640794075837, 7.22940680213495, 7.23240566445523,
+        7.23540452771804, 7.23840339192222, 7.2414022570666, 7.24440112315002,
+        7.2473999901713, 7.25039885812929, 7.25339772702284, 7.25639659685078,
+        7.25939546761195, 7.26239433930521, 7.26539321192941, 7.26839208548339,
+        7.27139095996601, 7.27438983537611, 7.27738871171257, 7.28038758897423,
+        7.28338646715995, 7.2863853462686, 7.28938422629904, 7.29238310725014,
+        7.29538198912076, 7.29838087190977, 7.30137975561605, 7.30437864023846,
+        7.30737752577588, 7.31037641222719, 7.31337529959127, 7.31637418786699,
+        7.31937307705324, 7.32237196714891, 7.32537085815287, 7.32836975006401,
+        7.33136864288123, 7.33436753660342, 7.33736643122946, 7.34036532675826,
+        7.34336422318871, 7.3463631205197, 7.34936201875015, 7.35236091787894,
+        7.35535981790499, 7.3583587188272, 7.36135762064447, 7.36435652335572,
+        7.36735542695986, 7.3703543314558, 7.37335323684245, 7.37635214311873,
+        7.37935105028355, 7.38234995833585, 7.38534886727453, 7.38834777709852,
+        7.39134668780675, 7.39434559939815, 7.39734451187163, 7.40034342522614,
+        7.40334233946059, 7.40634125457394, 7.4093401705651, 7.41233908743303,
+        7.41533800517665, 7.41833692379491, 7.42133584328675, 7.42433476365111,
+        7.42733368488694, 7.43033260699318, 7.43333152996879, 7.43633045381272,
+        7.43932937852391, 7.44232830410133, 7.44532723054392, 7.44832615785064,
+        7.45132508602046, 7.45432401505233, 7.45732294494522, 7.46032187569809,
+        7.4633208073099, 7.46631973977962, 7.46931867310623, 7.47231760728869,
+        7.47531654232597, 7.47831547821705, 7.4813144149609, 7.4843133525565,
+        7.48731229100283, 7.49031123029888, 7.49331017044361, 7.49630911143602,
+        7.49930805327509, 7.5023069959598, 7.50530593948915, 7.50830488386213,
+        7.51130382907772, 7.51430277513493, 7.51730172203274, 7.52030066977015,
+        7.52329961834616, 7.52629856775977, 7.52929751800998, 7.5322964690958,
+        7.53529542101622, 7.53829437377026, 7.54129332735692, 7.54429228177521,
+        7.54729123702414, 7.55029019310272, 7.55328915000997, 7.55628810774491,
+        7.55928706630654, 7.5622860256939, 7.56528498590599, 7.56828394694184,
+        7.57128290880047, 7.57428187148092, 7.57728083498219, 7.58027979930333,
+        7.58327876444336, 7.58627773040131, 7.58927669717621, 7.59227566476711,
+        7.59527463317302, 7.598273602393, 7.60127257242607, 7.60427154327129,
+        7.60727051492768, 7.6102694873943, 7.61326846067018, 7.61626743475438,
+        7.61926640964594, 7.62226538534391, 7.62526436184734, 7.62826333915528,
+        7.63126231726678, 7.63426129618091, 7.63726027589671, 7.64025925641325,
+        7.64325823772958, 7.64625721984477, 7.64925620275787, 7.65225518646796,
+        7.65525417097409, 7.65825315627533, 7.66125214237075, 7.66425112925943,
+        7.66725011694042, 7.67024910541281, 7.67324809467566, 7.67624708472806,
+        7.67924607556908, 7.68224506719779, 7.68524405961329, 7.68824305281464,
+        7.69124204680093, 7.69424104157124, 7.69724003712467, 7.70023903346029,
+        7.7032380305772, 7.70623702847449, 7.70923602715123, 7.71223502660654,
+        7.7152340268395, 7.71823302784921, 7.72123202963476, 7.72423103219525,
+        7.72723003552978, 7.73022903963745, 7.73322804451737, 7.73622705016864,
+        7.73922605659036, 7.74222506378164, 7.74522407174158, 7.7482230804693,
+        7.75122208996391, 7.75422110022452, 7.75722011125024, 7.76021912304018,
+        7.76321813559347, 7.76621714890921, 7.76921616298654, 7.77221517782456,
+        7.7752141934224, 7.77821320977918, 7.78121222689403, 7.78421124476607,
+        7.78721026339443, 7.79020928277824, 7.79320830291662, 7.79620732380871,
+        7.79920634545364, 7.80220536785054, 7.80520439099855, 7.8082034148968,
+        7.81120243954443, 7.81420146494058, 7.81720049108439, 7.82019951797501,
+        7.82319854561156, 7.8261975739932, 7.82919660311908, 7.83219563298833,
+        7.83519466360011, 7.83819369495357, 7.84119272704786, 7.84419175988212,
+        7.84719079345552, 7.8501898277672, 7.85318886281633, 7.85618789860205,
+        7.85918693512353, 7.86218597237993, 7.8651850103704, 7.86818404909412,
+        7.87118308855023, 7.87418212873792, 7.87718116965634, 7.88018021130465,
+        7.88317925368204, 7.88617829678767, 7.8891773406207, 7.89217638518032,
+        7.89517543046569, 7.89817447647599, 7.9011735232104, 7.90417257066809,
+        7.90717161884824, 7.91017066775003, 7.91316971737265, 7.91616876771527,
+        7.91916781877707, 7.92216687055725, 7.92516592305499, 7.92816497626947,
+        7.93116403019988, 7.93416308484542, 7.93716214020527, 7.94016119627862,
+        7.94316025306468, 7.94615931056263, 7.94915836877166, 7.95215742769098,
+        7.95515648731979, 7.95815554765728, 7.96115460870265, 7.9641536704551,
+        7.96715273291384, 7.97015179607808, 7.97315085994701, 7.97614992451985,
+        7.97914898979579, 7.98214805577406, 7.98514712245385, 7.98814618983439,
+        7.99114525791488, 7.99414432669453, 7.99714339617257, 8.0001424663482,
+        8.00314153722065, 8.00614060878913, 8.00913968105286, 8.01213875401106,
+        8.01513782766296, 8.01813690200777, 8.02113597704473, 8.02413505277305,
+        8.02713412919196, 8.0301332063007, 8.03313228409848, 8.03613136258454,
+        8.03913044175811, 8.04212952161842, 8.0451286021647, 8.0481276833962,
+        8.05112676531213, 8.05412584791175, 8.05712493119429, 8.06012401515898,
+        8.06312309980508, 8.06612218513181, 8.06912127113842, 8.07212035782415,
+        8.07511944518826, 8.07811853322998, 8.08111762194856, 8.08411671134325,
+        8.08711580141329, 8.09011489215795, 8.09311398357646, 8.09611307566809,
+        8.09911216843208, 8.10211126186769, 8.10511035597417, 8.10810945075079,
+        8.1111085461968, 8.11410764231145, 8.11710673909402, 8.12010583654375,
+        8.12310493465991, 8.12610403344177, 8.12910313288859, 8.13210223299964,
+        8.13510133377417, 8.13810043521146, 8.14109953731078, 8.1440986400714,
+        8.14709774349259, 8.15009684757361, 8.15309595231375, 8.15609505771227,
+        8.15909416376846, 8.16209327048158, 8.16509237785092, 8.16809148587575,
+        8.17109059455536, 8.17408970388901, 8.177088813876, 8.18008792451561,
+        8.18308703580712, 8.18608614774981, 8.18908526034298, 8.1920843735859,
+        8.19508348747786, 8.19808260201816, 8.20108171720608, 8.20408083304092,
+        8.20707994952196, 8.2100790666485, 8.21307818441983, 8.21607730283525,
+        8.21907642189406, 8.22207554159554, 8.22507466193901, 8.22807378292374,
+        8.23107290454906, 8.23407202681426, 8.23707114971863, 8.24007027326149,
+        8.24306939744214, 8.24606852225988, 8.24906764771402, 8.25206677380387,
+        8.25506590052872, 8.25806502788791, 8.26106415588072, 8.26406328450648,
+        8.2670624137645, 8.27006154365408, 8.27306067417455, 8.27605980532522,
+        8.27905893710541, 8.28205806951442, 8.28505720255159, 8.28805633621622,
+        8.29105547050765, 8.29405460542518, 8.29705374096815, 8.30005287713587,
+        8.30305201392767, 8.30605115134287, 8.3090502893808, 8.31204942804079,
+        8.31504856732217, 8.31804770722426, 8.32104684774639, 8.32404598888789,
+        8.3270451306481, 8.33004427302635, 8.33304341602197, 8.33604255963429,
+        8.33904170386266, 8.34204084870641, 8.34503999416487, 8.34803914023738,
+        8.35103828692329, 8.35403743422193, 8.35703658213264, 8.36003573065478,
+        8.36303487978767, 8.36603402953066, 8.36903317988311, 8.37203233084435,
+        8.37503148241373, 8.3780306345906, 8.38102978737431, 8.3840289407642,
+        8.38702809475963, 8.39002724935996, 8.39302640456452, 8.39602556037268,
+        8.39902471678379, 8.40202387379721, 8.40502303141228, 8.40802218962838,
+        8.41102134844484, 8.41402050786105, 8.41701966787635, 8.4200188284901,
+        8.42301798970167, 8.42601715151042, 8.42901631391571, 8.4320154769169,
+        8.43501464051337, 8.43801380470448, 8.44101296948959, 8.44401213486807,
+        8.4470113008393, 8.45001046740263, 8.45300963455745, 8.45600880230312,
+        8.45900797063902, 8.46200713956451, 8.46500630907898, 8.46800547918179,
+        8.47100464987233, 8.47400382114997, 8.47700299301409, 8.48000216546406,
+        8.48300133849927, 8.48600051211909, 8.48899968632292, 8.49199886111012,
+        8.49499803648008, 8.49799721243219, 8.50099638896583, 8.50399556608039,
+        8.50699474377524, 8.50999392204979, 8.51299310090341, 8.51599228033551,
+        8.51899146034545, 8.52199064093265, 8.52498982209648, 8.52798900383634,
+        8.53098818615163, 8.53398736904173, 8.53698655250605, 8.53998573654398,
+        8.54298492115491, 8.54598410633824, 8.54898329209338, 8.55198247841972,
+        8.55498166531665, 8.55798085278359, 8.56098004081993, 8.56397922942507,
+        8.56697841859842, 8.56997760833939, 8.57297679864737, 8.57597598952177,
+        8.57897518096201, 8.58197437296748, 8.5849735655376, 8.58797275867177,
+        8.59097195236941, 8.59397114662992, 8.59697034145272, 8.59996953683722,
+        8.60296873278283, 8.60596792928897, 8.60896712635505, 8.61196632398048,
+        8.61496552216469, 8.61796472090709, 8.6209639202071, 8.62396312006414,
+        8.62696232047763, 8.62996152144698, 8.63296072297163, 8.63595992505098,
+        8.63895912768447, 8.64195833087152, 8.64495753461155, 8.64795673890399,
+        8.65095594374826, 8.65395514914379, 8.65695435509001, 8.65995356158635,
+        8.66295276863224, 8.6659519762271, 8.66895118437037, 8.67195039306148,
+        8.67494960229986, 8.67794881208495, 8.68094802241617, 8.68394723329297,
+        8.68694644471477, 8.68994565668102, 8.69294486919115, 8.69594408224461,
+        8.69894329584082, 8.70194250997923, 8.70494172465928, 8.70794093988041,
+        8.71094015564206, 8.71393937194367, 8.71693858878469, 8.71993780616456,
+        8.72293702408272, 8.72593624253863, 8.72893546153172, 8.73193468106145,
+        8.73493390112726, 8.73793312172861, 8.74093234286493, 8.74393156453568,
+        8.74693078674032, 8.74993000947828, 8.75292923274903, 8.75592845655202,
+        8.7589276808867, 8.76192690575253, 8.76492613114896, 8.76792535707545,
+        8.77092458353145, 8.77392381051643, 8.77692303802983, 8.77992226607113,
+        8.78292149463977, 8.78592072373523, 8.78891995335696, 8.79191918350441,
+        8.79491841417707, 8.79791764537438, 8.80091687709582, 8.80391610934085,
+        8.80691534210893, 8.80991457539953, 8.81291380921211, 8.81591304354616,
+        8.81891227840112, 8.82191151377648, 8.8249107496717, 8.82790998608626,
+        8.83090922301962, 8.83390846047125, 8.83690769844064, 8.83990693692725,
+        8.84290617593056, 8.84590541545004, 8.84890465548517, 8.85190389603542,
+        8.85490313710028, 8.85790237867921, 8.8609016207717, 8.86390086337723,
+        8.86690010649528, 8.86989935012533, 8.87289859426685, 8.87589783891933,
+        8.87889708408226, 8.88189632975512, 8.88489557593739, 8.88789482262855,
+        8.89089406982809, 8.89389331753551, 8.89689256575027, 8.89989181447188,
+        8.90289106369982, 8.90589031343358, 8.90888956367265, 8.91188881441652,
+        8.91488806566468, 8.91788731741662, 8.92088656967183, 8.92388582242981,
+        8.92688507569005, 8.92988432945205, 8.9328835837153, 8.9358828384793,
+        8.93888209374353, 8.94188134950751, 8.94488060577073, 8.94787986253268,
+        8.95087911979287, 8.95387837755079, 8.95687763580595, 8.95987689455784,
+        8.96287615380597, 8.96587541354985, 8.96887467378896, 8.97187393452283,
+        8.97487319575095, 8.97787245747282, 8.98087171968796, 8.98387098239587,
+        8.98687024559605, 8.98986950928802, 8.99286877347128, 8.99586803814535,
+        8.99886730330972, 9.00186656896392, 9.00486583510745, 9.00786510173982,
+        9.01086436886055, 9.01386363646915, 9.01686290456514, 9.01986217314802,
+        9.02286144221732, 9.02586071177254, 9.02885998181321, 9.03185925233883,
+        9.03485852334894, 9.03785779484304, 9.04085706682066, 9.04385633928131,
+        9.04685561222452, 9.04985488564981, 9.05285415955669, 9.05585343394468,
+        9.05885270881332, 9.06185198416213, 9.06485125999062, 9.06785053629832,
+        9.07084981308477, 9.07384909034947, 9.07684836809197, 9.07984764631178,
+        9.08284692500843, 9.08584620418146, 9.08884548383039, 9.09184476395475,
+        9.09484404455407, 9.09784332562788, 9.10084260717571, 9.1038418891971,
+        9.10684117169157, 9.10984045465867, 9.11283973809792, 9.11583902200885,
+        9.11883830639101, 9.12183759124393, 9.12483687656714, 9.12783616236019,
+        9.1308354486226, 9.13383473535392, 9.13683402255368, 9.13983331022144,
+        9.14283259835671, 9.14583188695905, 9.148831176028, 9.15183046556309,
+        9.15482975556387, 9.15782904602989, 9.16082833696068, 9.1638276283558,
+        9.16682692021477, 9.16982621253716, 9.1728255053225, 9.17582479857035,
+        9.17882409228024, 9.18182338645174, 9.18482268108437, 9.1878219761777,
+        9.19082127173127, 9.19382056774464, 9.19681986421735, 9.19981916114895,
+        9.202818458539, 9.20581775638705, 9.20881705469265, 9.21181635345535,
+        9.21481565267472, 9.21781495235029, 9.22081425248164, 9.22381355306831,
+        9.22681285410986, 9.22981215560584, 9.23281145755582, 9.23581075995936,
+        9.23881006281601, 9.24180936612532, 9.24480866988687, 9.24780797410021,
+        9.2508072787649, 9.2538065838805, 9.25680588944658, 9.2598051954627,
+        9.26280450192841, 9.2658038088433, 9.26880311620691, 9.27180242401881,
+        9.27480173227858, 9.27780104098577, 9.28080035013995, 9.28379965974069,
+        9.28679896978755, 9.28979828028012, 9.29279759121794, 9.2957969026006,
+        9.29879621442766, 9.30179552669869, 9.30479483941327, 9.30779415257097,
+        9.31079346617135, 9.31379278021399, 9.31679209469847, 9.31979140962435,
+        9.32279072499122, 9.32579004079864, 9.32878935704619, 9.33178867373345,
+        9.33478799086, 9.3377873084254, 9.34078662642925, 9.34378594487111,
+        9.34678526375057, 9.3497845830672, 9.35278390282059, 9.35578322301031,
+        9.35878254363595, 9.36178186469708, 9.3647811861933, 9.36778050812417,
+        9.37077983048929, 9.37377915328824, 9.37677847652059, 9.37977780018595,
+        9.38277712428388, 9.38577644881398, 9.38877577377583, 9.39177509916903,
+        9.39477442499314, 9.39777375124778, 9.40077307793251, 9.40377240504694,
+        9.40677173259065, 9.40977106056323, 9.41277038896426, 9.41576971779335,
+        9.41876904705009, 9.42176837673405, 9.42476770684485, 9.42776703738206,
+        9.43076636834529, 9.43376569973412, 9.43676503154816, 9.43976436378699,
+        9.44276369645022, 9.44576302953743, 9.44876236304823, 9.45176169698221,
+        9.45476103133896, 9.4577603661181, 9.46075970131921, 9.4637590369419,
+        9.46675837298576, 9.46975770945039, 9.4727570463354, 9.47575638364039,
+        9.47875572136496, 9.4817550595087, 9.48475439807123, 9.48775373705214,
+        9.49075307645104, 9.49375241626754, 9.49675175650123, 9.49975109715172,
+        9.50275043821863, 9.50574977970155, 9.50874912160008, 9.51174846391385,
+        9.51474780664246, 9.5177471497855, 9.5207464933426, 9.52374583731336,
+        9.5267451816974, 9.52974452649431, 9.53274387170371, 9.53574321732522,
+        9.53874256335844, 9.54174190980299, 9.54474125665848, 9.54774060392452,
+        9.55073995160072, 9.5537392996867, 9.55673864818207, 9.55973799708646,
+        9.56273734639946, 9.56573669612071, 9.56873604624981, 9.57173539678639,
+        9.57473474773005, 9.57773409908042, 9.58073345083712, 9.58373280299976,
+        9.58673215556797, 9.58973150854136, 9.59273086191956, 9.59573021570217,
+        9.59872956988884, 9.60172892447917, 9.60472827947279, 9.60772763486932,
+        9.61072699066839, 9.61372634686961, 9.61672570347262, 9.61972506047703,
+        9.62272441788248, 9.62572377568858, 9.62872313389496, 9.63172249250126,
+        9.63472185150708, 9.63772121091207, 9.64072057071586, 9.64371993091805,
+        9.6467192915183, 9.64971865251622, 9.65271801391145, 9.65571737570362,
+        9.65871673789235, 9.66171610047727, 9.66471546345803, 9.66771482683424,
+        9.67071419060555, 9.67371355477158, 9.67671291933197, 9.67971228428636,
+        9.68271164963436, 9.68571101537563, 9.6887103815098, 9.69170974803649,
+        9.69470911495535, 9.69770848226602, 9.70070784996812, 9.7037072180613,
+        9.7067065865452, 9.70970595541944, 9.71270532468368, 9.71570469433755,
+        9.71870406438069, 9.72170343481274, 9.72470280563334, 9.72770217684213,
+        9.73070154843875, 9.73370092042285, 9.73670029279406, 9.73969966555203,
+        9.7426990386964, 9.74569841222682, 9.74869778614292, 9.75169716044436,
+        9.75469653513078, 9.75769591020181, 9.76069528565712, 9.76369466149634,
+        9.76669403771913, 9.76969341432512, 9.77269279131396, 9.77569216868531,
+        9.77869154643881, 9.78169092457411, 9.78469030309086, 9.78768968198871,
+        9.7906890612673, 9.7936884409263, 9.79668782096534, 9.79968720138409,
+        9.80268658218218, 9.80568596335928, 9.80868534491504, 9.81168472684911,
+        9.81468410916114, 9.81768349185079, 9.82068287491771, 9.82368225836156,
+        9.82668164218199, 9.82968102637865, 9.8326804109512, 9.83567979589931,
+        9.83867918122262, 9.84167856692079, 9.84467795299348, 9.84767733944035,
+        9.85067672626105, 9.85367611345525, 9.8566755010226, 9.85967488896277,
+        9.86267427727541, 9.86567366596019, 9.86867305501676, 9.87167244444478,
+        9.87467183424393, 9.87767122441385, 9.88067061495422, 9.88367000586469,
+        9.88666939714493, 9.8896687887946, 9.89266818081337, 9.89566757320091,
+        9.89866696595686, 9.90166635908091, 9.90466575257272, 9.90766514643195,
+        9.91066454065827, 9.91366393525134, 9.91666333021084, 9.91966272553644,
+        9.92266212122779, 9.92566151728457, 9.92866091370645, 9.9316603104931,
+        9.93465970764418, 9.93765910515937, 9.94065850303834, 9.94365790128075,
+        9.94665729988629, 9.94965669885462, 9.95265609818541, 9.95565549787834,
+        9.95865489793307, 9.96165429834929, 9.96465369912667, 9.96765310026488,
+        9.97065250176359, 9.97365190362248, 9.97665130584123, 9.9796507084195,
+        9.98265011135699, 9.98564951465335, 9.98864891830828, 9.99164832232145,
+        9.99464772669253, 9.9976471314212, 10.0006465365071, 10.00364594195,
+        10.0066453477496, 10.0096447539054, 10.0126441604172, 10.0156435672847,
+        10.0186429745075, 10.0216423820854, 10.024641790018, 10.027641198305,
+        10.030640606946, 10.0336400159408, 10.0366394252891, 10.0396388349905,
+        10.0426382450447, 10.0456376554514, 10.0486370662102, 10.0516364773209,
+        10.0546358887832, 10.0576353005967, 10.0606347127611, 10.0636341252762,
+        10.0666335381415, 10.0696329513568, 10.0726323649217, 10.0756317788361,
+        10.0786311930994, 10.0816306077115, 10.084630022672, 10.0876294379807,
+        10.0906288536371, 10.093628269641, 10.0966276859921, 10.0996271026901,
+        10.1026265197346, 10.1056259371254, 10.1086253548621, 10.1116247729445,
+        10.1146241913722, 10.1176236101449, 10.1206230292623, 10.1236224487242,
+        10.1266218685301, 10.1296212886799, 10.1326207091731, 10.1356201300096,
+        10.1386195511889, 10.1416189727108, 10.1446183945749, 10.1476178167811,
+        10.1506172393289, 10.1536166622181, 10.1566160854483, 10.1596155090194,
+        10.1626149329308, 10.1656143571825, 10.168613781774, 10.171613206705,
+        10.1746126319753, 10.1776120575846, 10.1806114835325, 10.1836109098188,
+        10.1866103364432, 10.1896097634053, 10.1926091907049, 10.1956086183416,
+        10.1986080463152, 10.2016074746254, 10.2046069032719, 10.2076063322543,
+        10.2106057615725, 10.213605191226, 10.2166046212146, 10.219604051538,
+        10.2226034821959, 10.225602913188, 10.2286023445141, 10.2316017761737,
+        10.2346012081667, 10.2376006404927, 10.2406000731515, 10.2435995061427,
+        10.2465989394661, 10.2495983731213, 10.2525978071081, 10.2555972414262,
+        10.2585966760753, 10.2615961110551, 10.2645955463653, 10.2675949820057,
+        10.2705944179759, 10.2735938542756, 10.2765932909046, 10.2795927278625,
+        10.2825921651492, 10.2855916027642, 10.2885910407074, 10.2915904789783,
+        10.2945899175768, 10.2975893565026, 10.3005887957553, 10.3035882353347,
+        10.3065876752405, 10.3095871154723, 10.3125865560301, 10.3155859969133,
+        10.3185854381218, 10.3215848796553, 10.3245843215135, 10.3275837636961,
+        10.3305832062028, 10.3335826490333, 10.3365820921874, 10.3395815356648,
+        10.3425809794652, 10.3455804235883, 10.3485798680338, 10.3515793128015,
+        10.354578757891, 10.3575782033022, 10.3605776490347, 10.3635770950882,
+        10.3665765414624, 10.3695759881572, 10.3725754351722, 10.375574882507,
+        10.3785743301616, 10.3815737781355, 10.3845732264285, 10.3875726750403,
+        10.3905721239706, 10.3935715732192, 10.3965710227859, 10.3995704726702,
+        10.402569922872, 10.4055693733909, 10.4085688242267, 10.4115682753792,
+        10.414567726848, 10.4175671786328, 10.4205666307335, 10.4235660831497,
+        10.4265655358811, 10.4295649889276, 10.4325644422887, 10.4355638959643,
+        10.438563349954, 10.4415628042577, 10.444562258875, 10.4475617138056,
+        10.4505611690493, 10.4535606246059, 10.456560080475, 10.4595595366563,
+        10.4625589931497, 10.4655584499548, 10.4685579070714, 10.4715573644992,
+        10.474556822238, 10.4775562802874, 10.4805557386473, 10.4835551973172,
+        10.4865546562971, 10.4895541155865, 10.4925535751853, 10.4955530350932,
+        10.4985524953099, 10.5015519558352, 10.5045514166687, 10.5075508778102,
+        10.5105503392596, 10.5135498010164, 10.5165492630804, 10.5195487254514,
+        10.5225481881291, 10.5255476511132, 10.5285471144036, 10.5315465779998,
+        10.5345460419017, 10.5375455061091, 10.5405449706215, 10.5435444354388,
+        10.5465439005608, 10.5495433659871, 10.5525428317175, 10.5555422977517,
+        10.5585417640895, 10.5615412307307, 10.5645406976749, 10.5675401649219,
+        10.5705396324714, 10.5735391003233, 10.5765385684771, 10.5795380369328,
+        10.58253750569, 10.5855369747484, 10.5885364441078, 10.591535913768,
+        10.5945353837287, 10.5975348539896, 10.6005343245506, 10.6035337954112,
+        10.6065332665713, 10.6095327380307, 10.612532209789, 10.615531681846,
+        10.6185311542015, 10.6215306268552, 10.6245300998069, 10.6275295730563,
+        10.6305290466031, 10.6335285204471, 10.6365279945881, 10.6395274690258,
+        10.6425269437599, 10.6455264187902, 10.6485258941165, 10.6515253697385,
+        10.6545248456559, 10.6575243218685, 10.6605237983761, 10.6635232751783,
+        10.666522752275, 10.669522229666, 10.6725217073508, 10.6755211853294,
+        10.6785206636015, 10.6815201421667, 10.684519621025, 10.6875191001759,
+        10.6905185796193, 10.693518059355, 10.6965175393826, 10.699517019702,
+        10.7025165003129, 10.705515981215, 10.7085154624081, 10.711514943892,
+        10.7145144256663, 10.717513907731, 10.7205133900857, 10.7235128727301,
+        10.7265123556641, 10.7295118388874, 10.7325113223997, 10.7355108062009,
+        10.7385102902906, 10.7415097746687, 10.7445092593348, 10.7475087442888,
+        10.7505082295304, 10.7535077150594, 10.7565072008754, 10.7595066869784,
+        10.762506173368, 10.765505660044, 10.7685051470062, 10.7715046342543,
+        10.7745041217881, 10.7775036096073, 10.7805030977118, 10.7835025861012,
+        10.7865020747753, 10.789501563734, 10.7925010529769, 10.7955005425038,
+        10.7985000323146, 10.8014995224088, 10.8044990127864, 10.8074985034471,
+        10.8104979943906, 10.8134974856167, 10.8164969771252, 10.8194964689158,
+        10.8224959609883, 10.8254954533425, 10.8284949459782, 10.831494438895,
+        10.8344939320928, 10.8374934255713, 10.8404929193303, 10.8434924133696,
+        10.846491907689, 10.8494914022881, 10.8524908971668, 10.8554903923249,
+        10.858489887762, 10.861489383478, 10.8644888794727, 10.8674883757458,
+        10.8704878722971, 10.8734873691263, 10.8764868662333, 10.8794863636178,
+        10.8824858612795, 10.8854853592182, 10.8884848574338, 10.8914843559259,
+        10.8944838546944, 10.897483353739, 10.9004828530596, 10.9034823526557,
+        10.9064818525274, 10.9094813526742, 10.912480853096, 10.9154803537926,
+        10.9184798547637, 10.9214793560091, 10.9244788575286, 10.9274783593219,
+        10.9304778613889, 10.9334773637293, 10.9364768663428, 10.9394763692294,
+        10.9424758723886, 10.9454753758204, 10.9484748795244, 10.9514743835005,
+        10.9544738877484, 10.9574733922679, 10.9604728970589, 10.9634724021209,
+        10.966471907454, 10.9694714130577, 10.972470918932, 10.9754704250765,
+        10.9784699314911, 10.9814694381755, 10.9844689451295, 10.987468452353,
+        10.9904679598456, 10.9934674676071, 10.9964669756374, 10.9994664839362,
+        11.0024659925033, 11.0054655013384, 11.0084650104414, 11.0114645198121,
+        11.0144640294501, 11.0174635393554, 11.0204630495276, 11.0234625599666,
+        11.0264620706722, 11.0294615816441, 11.032461092882, 11.0354606043859,
+        11.0384601161555, 11.0414596281905, 11.0444591404907, 11.047458653056,
+        11.0504581658861, 11.0534576789808, 11.0564571923398, 11.0594567059631,
+        11.0624562198503, 11.0654557340012, 11.0684552484156, 11.0714547630934,
+        11.0744542780342, 11.0774537932379, 11.0804533087043, 11.0834528244331,
+        11.0864523404242, 11.0894518566773, 11.0924513731922, 11.0954508899688,
+        11.0984504070067, 11.1014499243058, 11.1044494418658, 11.1074489596866,
+        11.110448477768, 11.1134479961097, 11.1164475147115, 11.1194470335732,
+        11.1224465526946, 11.1254460720755, 11.1284455917157, 11.131445111615,
+        11.1344446317731, 11.1374441521899, 11.1404436728651, 11.1434431937986,
+        11.1464427149901, 11.1494422364394, 11.1524417581463, 11.1554412801107,
+        11.1584408023322, 11.1614403248107, 11.164439847546, 11.1674393705379,
+        11.1704388937861, 11.1734384172905, 11.1764379410508, 11.1794374650669,
+        11.1824369893386, 11.1854365138656, 11.1884360386477, 11.1914355636847,
+        11.1944350889765, 11.1974346145228, 11.2004341403234, 11.2034336663781,
+        11.2064331926867, 11.209432719249, 11.2124322460648, 11.2154317731339,
+        11.2184313004561, 11.2214308280312, 11.2244303558589, 11.2274298839392,
+        11.2304294122717, 11.2334289408563, 11.2364284696928, 11.239427998781,
+        11.2424275281206, 11.2454270577115, 11.2484265875535, 11.2514261176463,
+        11.2544256479898, 11.2574251785838, 11.2604247094281, 11.2634242405224,
+        11.2664237718666, 11.2694233034605, 11.2724228353038, 11.2754223673964,
+        11.2784218997381, 11.2814214323286, 11.2844209651679, 11.2874204982556,
+        11.2904200315915, 11.2934195651756, 11.2964190990076, 11.2994186330872,
+        11.3024181674143, 11.3054177019887, 11.3084172368103, 11.3114167718787,
+        11.3144163071938, 11.3174158427554, 11.3204153785633, 11.3234149146174,
+        11.3264144509174, 11.3294139874631, 11.3324135242543, 11.3354130612908,
+        11.3384125985725, 11.3414121360992, 11.3444116738706, 11.3474112118865,
+        11.3504107501468, 11.3534102886513, 11.3564098273997, 11.359409366392,
+        11.3624089056278, 11.365408445107, 11.3684079848294, 11.3714075247949,
+        11.3744070650031, 11.377406605454, 11.3804061461473, 11.3834056870829,
+        11.3864052282605, 11.3894047696799, 11.3924043113411, 11.3954038532437,
+        11.3984033953876, 11.4014029377726, 11.4044024803985, 11.4074020232651,
+        11.4104015663723, 11.4134011097198, 11.4164006533074, 11.419400197135,
+        11.4223997412024, 11.4253992855094, 11.4283988300557, 11.4313983748413,
+        11.4343979198658, 11.4373974651292, 11.4403970106312, 11.4433965563717,
+        11.4463961023505, 11.4493956485673, 11.452395195022, 11.4553947417144,
+        11.4583942886444, 11.4613938358116, 11.4643933832161, 11.4673929308574,
+        11.4703924787356, 11.4733920268503, 11.4763915752014, 11.4793911237888,
+        11.4823906726121, 11.4853902216714, 11.4883897709663, 11.4913893204966,
+        11.4943888702623, 11.497388420263, 11.5003879704987, 11.5033875209691,
+        11.5063870716741, 11.5093866226135, 11.512386173787, 11.5153857251945,
+        11.5183852768359, 11.5213848287109, 11.5243843808194, 11.5273839331612,
+        11.530383485736, 11.5333830385438, 11.5363825915842, 11.5393821448573,
+        11.5423816983627, 11.5453812521003, 11.5483808060699, 11.5513803602713,
+        11.5543799147044, 11.5573794693689, 11.5603790242647, 11.5633785793916,
+        11.5663781347495, 11.5693776903381, 11.5723772461572, 11.5753768022068,
+        11.5783763584865, 11.5813759149963, 11.5843754717359, 11.5873750287052,
+        11.590374585904, 11.5933741433321, 11.5963737009894, 11.5993732588756,
+        11.6023728169906, 11.6053723753342, 11.6083719339062, 11.6113714927064,
+        11.6143710517348, 11.617370610991, 11.620370170475, 11.6233697301865,
+        11.6263692901253, 11.6293688502914, 11.6323684106844, 11.6353679713044,
+        11.6383675321509, 11.641367093224, 11.6443666545234, 11.6473662160489,
+        11.6503657778004, 11.6533653397776, 11.6563649019805, 11.6593644644089,
+        11.6623640270625, 11.6653635899412, 11.6683631530448, 11.6713627163731,
+        11.6743622799261, 11.6773618437034, 11.680361407705, 11.6833609719306,
+        11.6863605363801, 11.6893601010533, 11.69235966595, 11.6953592310701,
+        11.6983587964134, 11.7013583619798, 11.7043579277689, 11.7073574937808,
+        11.7103570600152, 11.7133566264719, 11.7163561931508, 11.7193557600516,
+        11.7223553271743, 11.7253548945187, 11.7283544620845, 11.7313540298717,
+        11.73435359788, 11.7373531661092, 11.7403527345593, 11.74335230323,
+        11.7463518721212, 11.7493514412327, 11.7523510105643, 11.7553505801159,
+        11.7583501498873, 11.7613497198783, 11.7643492900887, 11.7673488605185,
+        11.7703484311673, 11.7733480020352, 11.7763475731218, 11.779347144427,
+        11.7823467159507, 11.7853462876927, 11.7883458596528, 11.7913454318308,
+        11.7943450042266, 11.7973445768401, 11.800344149671, 11.8033437227192,
+        11.8063432959845, 11.8093428694668, 11.8123424431659, 11.8153420170816,
+        11.8183415912137, 11.8213411655622, 11.8243407401268, 11.8273403149074,
+        11.8303398899037, 11.8333394651157, 11.8363390405432, 11.839338616186,
+        11.842338192044, 11.8453377681169, 11.8483373444047, 11.8513369209071,
+        11.854336497624, 11.8573360745552, 11.8603356517007, 11.8633352290601,
+        11.8663348066333, 11.8693343844203, 11.8723339624208, 11.8753335406346,
+        11.8783331190617, 11.8813326977017, 11.8843322765547, 11.8873318556203,
+        11.8903314348985, 11.8933310143892, 11.896330594092, 11.8993301740069,
+        11.9023297541337, 11.9053293344723, 11.9083289150225, 11.9113284957841,
+        11.9143280767569, 11.9173276579409, 11.9203272393358, 11.9233268209416,
+        11.9263264027579, 11.9293259847847, 11.9323255670219, 11.9353251494692,
+        11.9383247321265, 11.9413243149937, 11.9443238980705, 11.9473234813568,
+        11.9503230648526, 11.9533226485575, 11.9563222324715, 11.9593218165944,
+        11.962321400926, 11.9653209854662, 11.9683205702148, 11.9713201551717,
+        11.9743197403367, 11.9773193257096, 11.9803189112904, 11.9833184970788,
+        11.9863180830746, 11.9893176692779, 11.9923172556882, 11.9953168423056,
+        11.9983164291299, 12.0013160161609, 12.0043156033984, 12.0073151908423,
+        12.0103147784925, 12.0133143663488, 12.016313954411, 12.0193135426789,
+        12.0223131311525, 12.0253127198316, 12.028312308716, 12.0313118978056,
+        12.0343114871002, 12.0373110765996, 12.0403106663037, 12.0433102562124,
+        12.0463098463255, 12.0493094366429, 12.0523090271643, 12.0553086178897,
+        12.0583082088189, 12.0613077999517, 12.064307391288, 12.0673069828276,
+        12.0703065745704, 12.0733061665162, 12.076305758665, 12.0793053510164,
+        12.0823049435705, 12.0853045363269, 12.0883041292857, 12.0913037224465,
+        12.0943033158094, 12.097302909374, 12.1003025031404, 12.1033020971082,
+        12.1063016912775, 12.1093012856479, 12.1123008802195, 12.1153004749919,
+        12.1183000699652, 12.121299665139, 12.1242992605134, 12.1272988560881,
+        12.130298451863, 12.1332980478379, 12.1362976440126, 12.1392972403872,
+        12.1422968369613, 12.1452964337348, 12.1482960307077, 12.1512956278797,
+        12.1542952252507, 12.1572948228205, 12.160294420589, 12.1632940185561,
+        12.1662936167217, 12.1692932150854, 12.1722928136473, 12.1752924124072,
+        12.1782920113649, 12.1812916105202, 12.1842912098731, 12.1872908094234,
+        12.1902904091709, 12.1932900091155, 12.1962896092571, 12.1992892095955,
+        12.2022888101305, 12.205288410862, 12.2082880117899, 12.2112876129141,
+        12.2142872142343, 12.2172868157504, 12.2202864174624, 12.22328601937,
+        12.226285621473, 12.2292852237715, 12.2322848262651, 12.2352844289539,
+        12.2382840318375, 12.241283634916, 12.2442832381891, 12.2472828416566,
+        12.2502824453186, 12.2532820491747, 12.2562816532249, 12.2592812574691,
+        12.262280861907, 12.2652804665386, 12.2682800713637, 12.2712796763821,
+        12.2742792815938, 12.2772788869985, 12.2802784925961, 12.2832780983866,
+        12.2862777043697, 12.2892773105453, 12.2922769169133, 12.2952765234735,
+        12.2982761302258, 12.30127573717, 12.3042753443061, 12.3072749516338,
+        12.3102745591531, 12.3132741668637, 12.3162737747656, 12.3192733828586,
+        12.3222729911425, 12.3252725996173, 12.3282722082828, 12.3312718171388,
+        12.3342714261852, 12.3372710354219, 12.3402706448487, 12.3432702544655,
+        12.3462698642722, 12.3492694742686, 12.3522690844546, 12.35526869483,
+        12.3582683053947, 12.3612679161486, 12.3642675270915, 12.3672671382233,
+        12.3702667495439, 12.373266361053, 12.3762659727507, 12.3792655846367,
+        12.3822651967109, 12.3852648089731, 12.3882644214233, 12.3912640340613,
+        12.3942636468869, 12.3972632599001, 12.4002628731006, 12.4032624864884,
+        12.4062621000633, 12.4092617138252, 12.4122613277739, 12.4152609419094,
+        12.4182605562314, 12.4212601707398, 12.4242597854345, 12.4272594003154,
+        12.4302590153824, 12.4332586306352, 12.4362582460738, 12.439257861698,
+        12.4422574775077, 12.4452570935028, 12.4482567096831, 12.4512563260485,
+        12.4542559425988, 12.457255559334, 12.4602551762539, 12.4632547933583,
+        12.4662544106471, 12.4692540281202, 12.4722536457775, 12.4752532636188,
+        12.4782528816441, 12.481252499853, 12.4842521182456, 12.4872517368217,
+        12.4902513555811, 12.4932509745238, 12.4962505936496, 12.4992502129583,
+        12.5022498324499, 12.5052494521242, 12.508249071981, 12.5112486920203,
+        12.5142483122419, 12.5172479326457, 12.5202475532315, 12.5232471739993,
+        12.5262467949488, 12.52924641608, 12.5322460373927, 12.5352456588868,
+        12.5382452805621, 12.5412449024186, 12.5442445244561, 12.5472441466745,
+        12.5502437690736, 12.5532433916533, 12.5562430144135, 12.5592426373541,
+        12.5622422604749, 12.5652418837758, 12.5682415072566, 12.5712411309173,
+        12.5742407547577, 12.5772403787777, 12.5802400029772, 12.583239627356,
+        12.5862392519139, 12.589238876651, 12.5922385015669, 12.5952381266617,
+        12.5982377519352, 12.6012373773872, 12.6042370030177, 12.6072366288265,
+        12.6102362548134, 12.6132358809784, 12.6162355073213, 12.619235133842,
+        12.6222347605404, 12.6252343874163, 12.6282340144696, 12.6312336417002,
+        12.634233269108, 12.6372328966928, 12.6402325244545, 12.643232152393,
+        12.6462317805082, 12.6492314087999, 12.652231037268, 12.6552306659124,
+        12.6582302947329, 12.6612299237295, 12.6642295529019, 12.6672291822502,
+        12.6702288117741, 12.6732284414735, 12.6762280713484, 12.6792277013985,
+        12.6822273316238, 12.6852269620241, 12.6882265925993, 12.6912262233493,
+        12.694225854274, 12.6972254853732, 12.7002251166468, 12.7032247480947,
+        12.7062243797167, 12.7092240115128, 12.7122236434829, 12.7152232756267,
+        12.7182229079442, 12.7212225404352, 12.7242221730997, 12.7272218059375,
+        12.7302214389485, 12.7332210721325, 12.7362207054894, 12.7392203390192,
+        12.7422199727217, 12.7452196065967, 12.7482192406442, 12.751218874864,
+        12.7542185092561, 12.7572181438202, 12.7602177785562, 12.7632174134641,
+        12.7662170485438, 12.769216683795, 12.7722163192177, 12.7752159548118,
+        12.7782155905771, 12.7812152265135, 12.7842148626209, 12.7872144988992,
+        12.7902141353483, 12.793213771968, 12.7962134087582, 12.7992130457188,
+        12.8022126828496, 12.8052123201507, 12.8082119576217, 12.8112115952627,
+        12.8142112330735, 12.8172108710539, 12.820210509204, 12.8232101475234,
+        12.8262097860122, 12.8292094246702, 12.8322090634972, 12.8352087024932,
+        12.8382083416581, 12.8412079809917, 12.8442076204939, 12.8472072601646,
+        12.8502069000037, 12.853206540011, 12.8562061801865, 12.85920582053,
+        12.8622054610414, 12.8652051017206, 12.8682047425674, 12.8712043835818,
+        12.8742040247637, 12.8772036661128, 12.8802033076291, 12.8832029493126,
+        12.886202591163, 12.8892022331802, 12.8922018753642, 12.8952015177148,
+        12.8982011602319, 12.9012008029154, 12.9042004457651, 12.907200088781,
+        12.9101997319629, 12.9131993753108, 12.9161990188245, 12.9191986625038,
+        12.9221983063487, 12.9251979503591, 12.9281975945348, 12.9311972388758,
+        12.9341968833819, 12.9371965280529, 12.9401961728889, 12.9431958178896,
+        12.946195463055, 12.9491951083849, 12.9521947538792, 12.9551943995379,
+        12.9581940453607, 12.9611936913477, 12.9641933374986, 12.9671929838133,
+        12.9701926302918, 12.9731922769339, 12.9761919237396, 12.9791915707086,
+        12.9821912178409, 12.9851908651364, 12.988190512595, 12.9911901602165,
+        12.9941898080009, 12.9971894559479, 13.0001891040576, 13.0031887523298,
+        13.0061884007644, 13.0091880493612, 13.0121876981202, 13.0151873470412,
+        13.0181869961242, 13.021186645369, 13.0241862947755, 13.0271859443437,
+        13.0301855940733, 13.0331852439643, 13.0361848940165, 13.0391845442299,
+        13.0421841946044, 13.0451838451398, 13.048183495836, 13.0511831466929,
+        13.0541827977104, 13.0571824488884, 13.0601821002268, 13.0631817517254,
+        13.0661814033842, 13.0691810552031, 13.0721807071819, 13.0751803593205,
+        13.0781800116188, 13.0811796640768, 13.0841793166942, 13.0871789694711,
+        13.0901786224072, 13.0931782755024, 13.0961779287568, 13.0991775821701,
+        13.1021772357422, 13.105176889473, 13.1081765433625, 13.1111761974105,
+        13.1141758516169, 13.1171755059816, 13.1201751605045, 13.1231748151854,
+        13.1261744700243, 13.1291741250211, 13.1321737801757, 13.1351734354879,
+        13.1381730909576, 13.1411727465847, 13.1441724023692, 13.1471720583109,
+        13.1501717144097, 13.1531713706655, 13.1561710270782, 13.1591706836477,
+        13.1621703403738, 13.1651699972565, 13.1681696542957, 13.1711693114913,
+        13.1741689688431, 13.177168626351, 13.1801682840149, 13.1831679418348,
+        13.1861675998106, 13.189167257942, 13.192166916229, 13.1951665746716,
+        13.1981662332695, 13.2011658920228, 13.2041655509312, 13.2071652099947,
+        13.2101648692132, 13.2131645285865, 13.2161641881147, 13.2191638477974,
+        13.2221635076348, 13.2251631676265, 13.2281628277726, 13.231162488073,
+        13.2341621485275, 13.237161809136, 13.2401614698984, 13.2431611308147,
+        13.2461607918846, 13.2491604531082, 13.2521601144853, 13.2551597760158,
+        13.2581594376996, 13.2611590995365, 13.2641587615266, 13.2671584236697,
+        13.2701580859656, 13.2731577484143, 13.2761574110157, 13.2791570737696,
+        13.282156736676, 13.2851563997348, 13.2881560629459, 13.2911557263091,
+        13.2941553898243, 13.2971550534915, 13.3001547173106, 13.3031543812814,
+        13.3061540454038, 13.3091537096778, 13.3121533741032, 13.31515303868,
+        13.3181527034079, 13.3211523682871, 13.3241520333172, 13.3271516984983,
+        13.3301513638302, 13.3331510293128, 13.3361506949461, 13.3391503607298,
+        13.342150026664, 13.3451496927485, 13.3481493589832, 13.351149025368,
+        13.3541486919029, 13.3571483585876, 13.3601480254222, 13.3631476924065,
+        13.3661473595404, 13.3691470268238, 13.3721466942566, 13.3751463618387,
+        13.37814602957, 13.3811456974504, 13.3841453654798, 13.3871450336582,
+        13.3901447019853, 13.3931443704611, 13.3961440390856, 13.3991437078585,
+        13.4021433767799, 13.4051430458496, 13.4081427150674, 13.4111423844334,
+        13.4141420539474, 13.4171417236093, 13.420141393419, 13.4231410633764,
+        13.4261407334815, 13.429140403734, 13.432140074134, 13.4351397446812,
+        13.4381394153757, 13.4411390862173, 13.444138757206, 13.4471384283415,
+        13.4501380996239, 13.453137771053, 13.4561374426287, 13.4591371143509,
+        13.4621367862196, 13.4651364582346, 13.4681361303958, 13.4711358027032,
+        13.4741354751566, 13.477135147756, 13.4801348205012, 13.4831344933921,
+        13.4861341664287, 13.4891338396109, 13.4921335129385, 13.4951331864114,
+        13.4981328600296, 13.501132533793, 13.5041322077015, 13.5071318817549,
+        13.5101315559532, 13.5131312302962, 13.516130904784, 13.5191305794163,
+        13.5221302541932, 13.5251299291144, 13.5281296041799, 13.5311292793896,
+        13.5341289547434, 13.5371286302412, 13.540128305883, 13.5431279816685,
+        13.5461276575978, 13.5491273336707, 13.5521270098871, 13.555126686247,
+        13.5581263627502, 13.5611260393967, 13.5641257161863, 13.5671253931189,
+        13.5701250701945, 13.573124747413, 13.5761244247743, 13.5791241022782,
+        13.5821237799247, 13.5851234577137, 13.5881231356451, 13.5911228137188,
+        13.5941224919346, 13.5971221702926, 13.6001218487926, 13.6031215274346,
+        13.6061212062183, 13.6091208851438, 13.612120564211, 13.6151202434196,
+        13.6181199227698, 13.6211196022613, 13.624119281894, 13.6271189616679,
+        13.630118641583, 13.6331183216389, 13.6361180018358, 13.6391176821735,
+        13.6421173626519, 13.6451170432709, 13.6481167240304, 13.6511164049304,
+        13.6541160859707, 13.6571157671512, 13.6601154484719, 13.6631151299327,
+        13.6661148115334, 13.669114493274, 13.6721141751543, 13.6751138571744,
+        13.6781135393341, 13.6811132216332, 13.6841129040718, 13.6871125866497,
+        13.6901122693668, 13.6931119522231, 13.6961116352184, 13.6991113183527,
+        13.7021110016259, 13.7051106850378, 13.7081103685884, 13.7111100522776,
+        13.7141097361053, 13.7171094200714, 13.7201091041758, 13.7231087884185,
+        13.7261084727993, 13.7291081573181, 13.7321078419749, 13.7351075267696,
+        13.738107211702, 13.7411068967721, 13.7441065819798, 13.7471062673251,
+        13.7501059528077, 13.7531056384277, 13.7561053241849, 13.7591050100792,
+        13.7621046961107, 13.765104382279, 13.7681040685843, 13.7711037550263,
+        13.7741034416051, 13.7771031283204, 13.7801028151723, 13.7831025021606,
+        13.7861021892852, 13.7891018765461, 13.7921015639432, 13.7951012514763,
+        13.7981009391454, 13.8011006269504, 13.8041003148913, 13.8071000029678,
+        13.81009969118, 13.8130993795277, 13.8160990680109, 13.8190987566294,
+        13.8220984453832, 13.8250981342722, 13.8280978232963, 13.8310975124555,
+        13.8340972017495, 13.8370968911784, 13.840096580742, 13.8430962704403,
+        13.8460959602732, 13.8490956502406, 13.8520953403424, 13.8550950305784,
+        13.8580947209487, 13.8610944114532, 13.8640941020917, 13.8670937928642,
+        13.8700934837705, 13.8730931748106, 13.8760928659845, 13.8790925572919,
+        13.8820922487329, 13.8850919403073, 13.8880916320151, 13.8910913238562,
+        13.8940910158304, 13.8970907079378, 13.9000904001781, 13.9030900925514,
+        13.9060897850575, 13.9090894776964, 13.912089170468, 13.9150888633721,
+        13.9180885564087, 13.9210882495778, 13.9240879428791, 13.9270876363127,
+        13.9300873298785, 13.9330870235763, 13.9360867174061, 13.9390864113679,
+        13.9420861054614, 13.9450857996866, 13.9480854940435, 13.951085188532,
+        13.9540848831519, 13.9570845779032, 13.9600842727858, 13.9630839677997,
+        13.9660836629447, 13.9690833582207, 13.9720830536277, 13.9750827491656,
+        13.9780824448342, 13.9810821406336, 13.9840818365636, 13.9870815326242,
+        13.9900812288152, 13.9930809251366, 13.9960806215883, 13.9990803181702,
+        14.0020800148822, 14.0050797117243, 14.0080794086963, 14.0110791057982,
+        14.0140788030299, 14.0170785003913, 14.0200781978823, 14.0230778955028,
+        14.0260775932529, 14.0290772911323, 14.0320769891409, 14.0350766872788,
+        14.0380763855459, 14.0410760839419, 14.044075782467, 14.0470754811209,
+        14.0500751799036, 14.053074878815, 14.056074577855, 14.0590742770236,
+        14.0620739763207, 14.0650736757461, 14.0680733752999, 14.0710730749818,
+        14.0740727747919, 14.0770724747301, 14.0800721747962, 14.0830718749902,
+        14.0860715753121, 14.0890712757616, 14.0920709763388, 14.0950706770436,
+        14.0980703778759, 14.1010700788355, 14.1040697799225, 14.1070694811367,
+        14.1100691824781, 14.1130688839466, 14.116068585542, 14.1190682872644,
+        14.1220679891136, 14.1250676910895, 14.1280673931922, 14.1310670954214,
+        14.1340667977771, 14.1370665002593, 14.1400662028678, 14.1430659056026,
+        14.1460656084636, 14.1490653114507, 14.1520650145638, 14.1550647178028,
+        14.1580644211678, 14.1610641246585, 14.1640638282749, 14.167063532017,
+        14.1700632358846, 14.1730629398777, 14.1760626439961, 14.1790623482399,
+        14.1820620526089, 14.1850617571031, 14.1880614617223, 14.1910611664665,
+        14.1940608713357, 14.1970605763296, 14.2000602814484, 14.2030599866918,
+        14.2060596920598, 14.2090593975523, 14.2120591031692, 14.2150588089105,
+        14.2180585147761, 14.2210582207659, 14.2240579268799, 14.2270576331178,
+        14.2300573394798, 14.2330570459656, 14.2360567525752, 14.2390564593086,
+        14.2420561661656, 14.2450558731462, 14.2480555802503, 14.2510552874778,
+        14.2540549948287, 14.2570547023028, 14.2600544099001, 14.2630541176205,
+        14.266053825464, 14.2690535334304, 14.2720532415196, 14.2750529497317,
+        14.2780526580665, 14.2810523665239, 14.2840520751039, 14.2870517838064,
+        14.2900514926313, 14.2930512015785, 14.296050910648, 14.2990506198397,
+        14.3020503291535, 14.3050500385893, 14.308049748147, 14.3110494578266,
+        14.314049167628, 14.3170488775512, 14.320048587596, 14.3230482977623,
+        14.3260480080501, 14.3290477184594, 14.33204742899, 14.3350471396418,
+        14.3380468504149, 14.341046561309, 14.3440462723242, 14.3470459834603,
+        14.3500456947173, 14.3530454060951, 14.3560451175937, 14.3590448292129,
+        14.3620445409527, 14.365044252813, 14.3680439647937, 14.3710436768947,
+        14.3740433891161, 14.3770431014576, 14.3800428139193, 14.383042526501,
+        14.3860422392027, 14.3890419520243, 14.3920416649657, 14.3950413780269,
+        14.3980410912077, 14.4010408045082, 14.4040405179281, 14.4070402314676,
+        14.4100399451264, 14.4130396589045, 14.4160393728018, 14.4190390868183,
+        14.4220388009538, 14.4250385152084, 14.4280382295819, 14.4310379440743,
+        14.4340376586854, 14.4370373734152, 14.4400370882637, 14.4430368032308,
+        14.4460365183163, 14.4490362335202, 14.4520359488425, 14.455035664283,
+        14.4580353798418, 14.4610350955186, 14.4640348113135, 14.4670345272264,
+        14.4700342432571, 14.4730339594057, 14.476033675672, 14.479033392056,
+        14.4820331085576, 14.4850328251768, 14.4880325419134, 14.4910322587674,
+        14.4940319757387, 14.4970316928272, 14.5000314100329, 14.5030311273557,
+        14.5060308447955, 14.5090305623523, 14.5120302800259, 14.5150299978164,
+        14.5180297157236, 14.5210294337474, 14.5240291518878, 14.5270288701448,
+        14.5300285885181, 14.5330283070079, 14.5360280256139, 14.5390277443362,
+        14.5420274631746, 14.5450271821291, 14.5480269011996, 14.5510266203861,
+        14.5540263396884, 14.5570260591065, 14.5600257786404, 14.5630254982899,
+        14.5660252180549, 14.5690249379355, 14.5720246579315, 14.5750243780429,
+        14.5780240982696, 14.5810238186115, 14.5840235390685, 14.5870232596407,
+        14.5900229803278, 14.5930227011299, 14.5960224220468, 14.5990221430786,
+        14.602021864225, 14.6050215854862, 14.6080213068619, 14.6110210283521,
+        14.6140207499568, 14.6170204716758, 14.6200201935092, 14.6230199154568,
+        14.6260196375185, 14.6290193596944, 14.6320190819842, 14.635018804388,
+        14.6380185269057, 14.6410182495372, 14.6440179722825, 14.6470176951414,
+        14.6500174181139, 14.6530171412, 14.6560168643995, 14.6590165877124,
+        14.6620163111386, 14.6650160346781, 14.6680157583308, 14.6710154820966,
+        14.6740152059754, 14.6770149299672, 14.6800146540719, 14.6830143782895,
+        14.6860141026198, 14.6890138270628, 14.6920135516185, 14.6950132762867,
+        14.6980130010674, 14.7010127259605, 14.704012450966, 14.7070121760837,
+        14.7100119013137, 14.7130116266558, 14.7160113521101, 14.7190110776763,
+        14.7220108033544, 14.7250105291445, 14.7280102550463, 14.7310099810599,
+        14.7340097071851, 14.737009433422, 14.7400091597704, 14.7430088862302,
+        14.7460086128014, 14.749008339484, 14.7520080662778, 14.7550077931829,
+        14.758007520199, 14.7610072473262, 14.7640069745644, 14.7670067019135,
+        14.7700064293735, 14.7730061569443, 14.7760058846257, 14.7790056124179,
+        14.7820053403206, 14.7850050683338, 14.7880047964575, 14.7910045246915,
+        14.7940042530359, 14.7970039814905, 14.8000037100553, 14.8030034387302,
+        14.8060031675152, 14.8090028964102, 14.812002625415, 14.8150023545297,
+        14.8180020837542, 14.8210018130884, 14.8240015425322, 14.8270012720857,
+        14.8300010017486, 14.833000731521, 14.8360004614027, 14.8390001913938,
+        14.8419999214941, 14.8449996517036, 14.8479993820222, 14.8509991124499,
+        14.8539988429866, 14.8569985736321, 14.8599983043865, 14.8629980352497,
+        14.8659977662217, 14.8689974973022, 14.8719972284914, 14.8749969597891,
+        14.8779966911952, 14.8809964227098, 14.8839961543326, 14.8869958860637,
+        14.889995617903, 14.8929953498505, 14.895995081906, 14.8989948140695,
+        14.9019945463409, 14.9049942787202, 14.9079940112073, 14.9109937438021,
+        14.9139934765046, 14.9169932093147, 14.9199929422324, 14.9229926752575,
+        14.9259924083901, 14.92899214163, 14.9319918749771, 14.9349916084315,
+        14.9379913419931, 14.9409910756617, 14.9439908094374, 14.94699054332,
+        14.9499902773095, 14.9529900114059, 14.955989745609, 14.9589894799188,
+        14.9619892143352, 14.9649889488583, 14.9679886834878, 14.9709884182238,
+        14.9739881530662, 14.9769878880148, 14.9799876230698, 14.9829873582309,
+        14.9859870934982, 14.9889868288715, 14.9919865643508, 14.9949862999361,
+        14.9979860356272, 15.0009857714241, 15.0039855073268, 15.0069852433352,
+        15.0099849794491, 15.0129847156687, 15.0159844519937, 15.0189841884241,
+        15.02198392496, 15.0249836616011, 15.0279833983474, 15.030983135199,
+        15.0339828721556, 15.0369826092173, 15.039982346384, 15.0429820836556,
+        15.0459818210321, 15.0489815585133, 15.0519812960993, 15.05498103379,
+        15.0579807715853, 15.0609805094851, 15.0639802474894, 15.0669799855982,
+        15.0699797238113, 15.0729794621287, 15.0759792005503, 15.0789789390761,
+        15.081978677706, 15.08497841644, 15.087978155278, 15.0909778942199,
+        15.0939776332656, 15.0969773724152, 15.0999771116684, 15.1029768510254,
+        15.105976590486, 15.1089763300501, 15.1119760697178, 15.1149758094888,
+        15.1179755493632, 15.120975289341, 15.123975029422, 15.1269747696061,
+        15.1299745098934, 15.1329742502838, 15.1359739907771, 15.1389737313734,
+        15.1419734720726, 15.1449732128746, 15.1479729537793, 15.1509726947867,
+        15.1539724358968, 15.1569721771095, 15.1599719184246, 15.1629716598422,
+        15.1659714013622, 15.1689711429845, 15.1719708847091, 15.1749706265359,
+        15.1779703684649, 15.1809701104959, 15.183969852629, 15.186969594864,
+        15.1899693372009, 15.1929690796397, 15.1959688221803, 15.1989685648226,
+        15.2019683075665, 15.2049680504121, 15.2079677933592, 15.2109675364078,
+        15.2139672795578, 15.2169670228091, 15.2199667661618, 15.2229665096157,
+        15.2259662531708, 15.228965996827, 15.2319657405843, 15.2349654844426,
+        15.2379652284019, 15.240964972462, 15.2439647166229, 15.2469644608846,
+        15.2499642052471, 15.2529639497101, 15.2559636942738, 15.258963438938,
+        15.2619631837026, 15.2649629285677, 15.2679626735331, 15.2709624185988,
+        15.2739621637647, 15.2769619090308, 15.279961654397, 15.2829613998633,
+        15.2859611454296, 15.2889608910958, 15.2919606368619, 15.2949603827278,
+        15.2979601286935, 15.3009598747588, 15.3039596209239, 15.3069593671885,
+        15.3099591135526, 15.3129588600162, 15.3159586065792, 15.3189583532415,
+        15.3219581000032, 15.3249578468641, 15.3279575938241, 15.3309573408833,
+        15.3339570880415, 15.3369568352988, 15.3399565826549, 15.34295633011,
+        15.3459560776639, 15.3489558253165, 15.3519555730679, 15.3549553209179,
+        15.3579550688666, 15.3609548169137, 15.3639545650594, 15.3669543133034,
+        15.3699540616458, 15.3729538100866, 15.3759535586255, 15.3789533072627,
+        15.381953055998, 15.3849528048314, 15.3879525537628, 15.3909523027922,
+        15.3939520519194, 15.3969518011446, 15.3999515504675, 15.4029512998881,
+        15.4059510494064, 15.4089507990224, 15.4119505487359, 15.4149502985469,
+        15.4179500484553, 15.4209497984611, 15.4239495485643, 15.4269492987648,
+        15.4299490490625, 15.4329487994573, 15.4359485499492, 15.4389483005382,
+        15.4419480512242, 15.4449478020072, 15.447947552887, 15.4509473038636,
+        15.453947054937, 15.4569468061071, 15.4599465573739, 15.4629463087373,
+        15.4659460601972, 15.4689458117536, 15.4719455634064, 15.4749453151556,
+        15.4779450670011, 15.4809448189429, 15.4839445709809, 15.486944323115,
+        15.4899440753453, 15.4929438276716, 15.4959435800938, 15.498943332612,
+        15.5019430852261, 15.5049428379359, 15.5079425907416, 15.5109423436429,
+        15.5139420966399, 15.5169418497325, 15.5199416029206, 15.5229413562042,
+        15.5259411095832, 15.5289408630576, 15.5319406166273, 15.5349403702923,
+        15.5379401240525, 15.5409398779078, 15.5439396318583, 15.5469393859037,
+        15.5499391400442, 15.5529388942796, 15.5559386486099, 15.5589384030349,
+        15.5619381575548, 15.5649379121694, 15.5679376668786, 15.5709374216824,
+        15.5739371765808, 15.5769369315736, 15.5799366866609, 15.5829364418426,
+        15.5859361971186, 15.5889359524889, 15.5919357079534, 15.5949354635121,
+        15.5979352191649, 15.6009349749117, 15.6039347307526, 15.6069344866874,
+        15.609934242716, 15.6129339988386, 15.6159337550549, 15.6189335113649,
+        15.6219332677686, 15.624933024266, 15.6279327808569, 15.6309325375413,
+        15.6339322943192, 15.6369320511905, 15.6399318081552, 15.6429315652131,
+        15.6459313223643, 15.6489310796087, 15.6519308369462, 15.6549305943769,
+        15.6579303519005, 15.6609301095172, 15.6639298672267, 15.6669296250291,
+        15.6699293829244, 15.6729291409124, 15.6759288989931, 15.6789286571665,
+        15.6819284154325, 15.6849281737911, 15.6879279322421, 15.6909276907856,
+        15.6939274494215, 15.6969272081497, 15.6999269669702, 15.702926725883,
+        15.7059264848879, 15.708926243985, 15.7119260031741, 15.7149257624552,
+        15.7179255218284, 15.7209252812934, 15.7239250408503, 15.726924800499,
+        15.7299245602395, 15.7329243200717, 15.7359240799956, 15.738923840011,
+        15.741923600118, 15.7449233603165, 15.7479231206065, 15.7509228809878,
+        15.7539226414605, 15.7569224020244, 15.7599221626796, 15.762921923426,
+        15.7659216842636, 15.7689214451922, 15.7719212062118, 15.7749209673224,
+        15.7779207285239, 15.7809204898163, 15.7839202511995, 15.7869200126735,
+        15.7899197742383, 15.7929195358936, 15.7959192976396, 15.7989190594762,
+        15.8019188214032, 15.8049185834208, 15.8079183455287, 15.810918107727,
+        15.8139178700156, 15.8169176323944, 15.8199173948635, 15.8229171574227,
+        15.8259169200719, 15.8289166828113, 15.8319164456406, 15.8349162085599,
+        15.8379159715691, 15.8409157346681, 15.8439154978569, 15.8469152611355,
+        15.8499150245037, 15.8529147879616, 15.8559145515091, 15.8589143151461,
+        15.8619140788726, 15.8649138426886, 15.8679136065939, 15.8709133705885,
+        15.8739131346725, 15.8769128988457, 15.879912663108, 15.8829124274595,
+        15.8859121919001, 15.8889119564297, 15.8919117210483, 15.8949114857558,
+        15.8979112505522, 15.9009110154374, 15.9039107804114, 15.9069105454741,
+        15.9099103106255, 15.9129100758656, 15.9159098411942, 15.9189096066113,
+        15.9219093721169, 15.924909137711, 15.9279089033934, 15.9309086691642,
+        15.9339084350232, 15.9369082009705, 15.9399079670059, 15.9429077331295,
+        15.9459074993411, 15.9489072656408, 15.9519070320285, 15.9549067985041,
+        15.9579065650675, 15.9609063317188, 15.9639060984579, 15.9669058652847,
+        15.9699056321992, 15.9729053992013, 15.9759051662911, 15.9789049334683,
+        15.981904700733, 15.9849044680852, 15.9879042355248, 15.9909040030516,
+        15.9939037706658, 15.9969035383672, 15.9999033061558, 16.0029030740316,
+        16.0059028419944, 16.0089026100443, 16.0119023781812, 16.014902146405,
+        16.0179019147157, 16.0209016831133, 16.0239014515976, 16.0269012201688,
+        16.0299009888266, 16.032900757571, 16.0359005264021, 16.0389002953197,
+        16.0419000643238, 16.0448998334144, 16.0478996025914, 16.0508993718548,
+        16.0538991412045, 16.0568989106404, 16.0598986801625, 16.0628984497708,
+        16.0658982194653, 16.0688979892458, 16.0718977591123, 16.0748975290648,
+        16.0778972991032, 16.0808970692275, 16.0838968394377, 16.0868966097336,
+        16.0898963801152, 16.0928961505826, 16.0958959211355, 16.0988956917741,
+        16.1018954624982, 16.1048952333078, 16.1078950042028, 16.1108947751833,
+        16.1138945462491, 16.1168943174002, 16.1198940886365, 16.1228938599581,
+        16.1258936313648, 16.1288934028567, 16.1318931744336, 16.1348929460955,
+        16.1378927178424, 16.1408924896742, 16.1438922615909, 16.1468920335924,
+        16.1498918056787, 16.1528915778497, 16.1558913501054, 16.1588911224458,
+        16.1618908948707, 16.1648906673802, 16.1678904399742, 16.1708902126527,
+        16.1738899854155, 16.1768897582627, 16.1798895311942, 16.18288930421,
+        16.18588907731, 16.1888888504942, 16.1918886237625, 16.1948883971148,
+        16.1978881705512, 16.2008879440716, 16.2038877176759, 16.2068874913641,
+        16.2098872651361, 16.212887038992, 16.2158868129316, 16.2188865869548,
+        16.2218863610618, 16.2248861352523, 16.2278859095265, 16.2308856838841,
+        16.2338854583252, 16.2368852328497, 16.2398850074577, 16.2428847821489,
+        16.2458845569234, 16.2488843317812, 16.2518841067222, 16.2548838817463,
+        16.2578836568535, 16.2608834320437, 16.263883207317, 16.2668829826733,
+        16.2698827581124, 16.2728825336345, 16.2758823092393, 16.2788820849269,
+        16.2818818606973, 16.2848816365504, 16.2878814124861, 16.2908811885044,
+        16.2938809646052, 16.2968807407886, 16.2998805170544, 16.3028802934026,
+        16.3058800698332, 16.3088798463462, 16.3118796229414, 16.3148793996188,
+        16.3178791763784, 16.3208789532202, 16.3238787301441, 16.32687850715,
+        16.3298782842379, 16.3328780614078, 16.3358778386596, 16.3388776159932,
+        16.3418773934087, 16.344877170906, 16.347876948485, 16.3508767261457,
+        16.3538765038881, 16.356876281712, 16.3598760596175, 16.3628758376045,
+        16.365875615673, 16.3688753938229, 16.3718751720542, 16.3748749503668,
+        16.3778747287607, 16.3808745072359, 16.3838742857922, 16.3868740644297,
+        16.3898738431483, 16.392873621948, 16.3958734008286, 16.3988731797903,
+        16.4018729588329, 16.4048727379564, 16.4078725171607, 16.4108722964458,
+        16.4138720758117, 16.4168718552582, 16.4198716347855, 16.4228714143933,
+        16.4258711940818, 16.4288709738507, 16.4318707537002, 16.4348705336301,
+        16.4378703136404, 16.440870093731, 16.443869873902, 16.4468696541532,
+        16.4498694344847, 16.4528692148963, 16.4558689953881, 16.45886877596,
+        16.4618685566119, 16.4648683373438, 16.4678681181557, 16.4708678990475,
+        16.4738676800191, 16.4768674610706, 16.4798672422019, 16.4828670234129,
+        16.4858668047037, 16.4888665860741, 16.491866367524, 16.4948661490536,
+        16.4978659306627, 16.5008657123513, 16.5038654941193, 16.5068652759667,
+        16.5098650578934, 16.5128648398995, 16.5158646219848, 16.5188644041493,
+        16.5218641863931, 16.5248639687159, 16.5278637511179, 16.5308635335989,
+        16.5338633161589, 16.5368630987978, 16.5398628815157, 16.5428626643125,
+        16.5458624471881, 16.5488622301425, 16.5518620131756, 16.5548617962875,
+        16.557861579478, 16.5608613627471, 16.5638611460948, 16.5668609295211,
+        16.5698607130258, 16.572860496609, 16.5758602802706, 16.5788600640106,
+        16.5818598478288, 16.5848596317254, 16.5878594157002, 16.5908591997532,
+        16.5938589838843, 16.5968587680936, 16.5998585523809, 16.6028583367462,
+        16.6058581211895, 16.6088579057108, 16.61185769031, 16.614857474987,
+        16.6178572597418, 16.6208570445744, 16.6238568294847, 16.6268566144727,
+        16.6298563995384, 16.6328561846817, 16.6358559699025, 16.6388557552008,
+        16.6418555405767, 16.6448553260299, 16.6478551115606, 16.6508548971686,
+        16.6538546828539, 16.6568544686164, 16.6598542544562, 16.6628540403732,
+        16.6658538263674, 16.6688536124386, 16.6718533985869, 16.6748531848122,
+        16.6778529711145, 16.6808527574937, 16.6838525439498, 16.6868523304828,
+        16.6898521170925, 16.6928519037791, 16.6958516905423, 16.6988514773823,
+        16.7018512642989, 16.7048510512921, 16.7078508383618, 16.7108506255081,
+        16.7138504127309, 16.7168502000301, 16.7198499874057, 16.7228497748576,
+        16.7258495623859, 16.7288493499904, 16.7318491376712, 16.7348489254282,
+        16.7378487132613, 16.7408485011705, 16.7438482891558, 16.7468480772171,
+        16.7498478653544, 16.7528476535677, 16.7558474418569, 16.7588472302219,
+        16.7618470186627, 16.7648468071794, 16.7678465957717, 16.7708463844398,
+        16.7738461731835, 16.7768459620029, 16.7798457508978, 16.7828455398683,
+        16.7858453289143, 16.7888451180357, 16.7918449072325, 16.7948446965048,
+        16.7978444858523, 16.8008442752752, 16.8038440647733, 16.8068438543466,
+        16.8098436439951, 16.8128434337188, 16.8158432235175, 16.8188430133913,
+        16.8218428033401, 16.8248425933639, 16.8278423834626, 16.8308421736362,
+        16.8338419638847, 16.836841754208, 16.839841544606, 16.8428413350788,
+        16.8458411256263, 16.8488409162484, 16.8518407069452, 16.8548404977165,
+        16.8578402885623, 16.8608400794827, 16.8638398704775, 16.8668396615467,
+        16.8698394526903, 16.8728392439083, 16.8758390352005, 16.878838826567,
+        16.8818386180077, 16.8848384095226, 16.8878382011116, 16.8908379927747,
+        16.8938377845119, 16.8968375763231, 16.8998373682083, 16.9028371601674,
+        16.9058369522004, 16.9088367443073, 16.911836536488, 16.9148363287425,
+        16.9178361210707, 16.9208359134726, 16.9238357059482, 16.9268354984975,
+        16.9298352911203, 16.9328350838166, 16.9358348765865, 16.9388346694298,
+        16.9418344623466, 16.9448342553368, 16.9478340484003, 16.9508338415371,
+        16.9538336347472, 16.9568334280306, 16.9598332213871, 16.9628330148168,
+        16.9658328083196, 16.9688326018955, 16.9718323955444, 16.9748321892664,
+        16.9778319830613, 16.9808317769291, 16.9838315708698, 16.9868313648834,
+        16.9898311589698, 16.9928309531289, 16.9958307473608, 16.9988305416654,
+        17.0018303360426, 17.0048301304925, 17.0078299250149, 17.0108297196098,
+        17.0138295142773, 17.0168293090172, 17.0198291038296, 17.0228288987143,
+        17.0258286936714, 17.0288284887008, 17.0318282838025, 17.0348280789764,
+        17.0378278742225, 17.0408276695408, 17.0438274649311, 17.0468272603936,
+        17.0498270559281, 17.0528268515346, 17.0558266472131, 17.0588264429635,
+        17.0618262387858, 17.0648260346799, 17.0678258306459, 17.0708256266836,
+        17.0738254227931, 17.0768252189743, 17.0798250152271, 17.0828248115516,
+        17.0858246079477, 17.0888244044153, 17.0918242009544, 17.094823997565,
+        17.0978237942471, 17.1008235910005, 17.1038233878253, 17.1068231847214,
+        17.1098229816888, 17.1128227787275, 17.1158225758374, 17.1188223730184,
+        17.1218221702706, 17.1248219675939, 17.1278217649882, 17.1308215624536,
+        17.13382135999, 17.1368211575973, 17.1398209552755, 17.1428207530246,
+        17.1458205508446, 17.1488203487353, 17.1518201466968, 17.1548199447291,
+        17.157819742832, 17.1608195410056, 17.1638193392498, 17.1668191375645,
+        17.1698189359499, 17.1728187344057, 17.175818532932, 17.1788183315287,
+        17.1818181301958, 17.1848179289333, 17.1878177277411, 17.1908175266191,
+        17.1938173255675, 17.196817124586, 17.1998169236747, 17.2028167228336,
+        17.2058165220625, 17.2088163213615, 17.2118161207305, 17.2148159201696,
+        17.2178157196785, 17.2208155192574, 17.2238153189062, 17.2268151186248,
+        17.2298149184133, 17.2328147182715, 17.2358145181994, 17.238814318197,
+        17.2418141182643, 17.2448139184012, 17.2478137186077, 17.2508135188838,
+        17.2538133192293, 17.2568131196444, 17.2598129201289, 17.2628127206828,
+        17.2658125213061, 17.2688123219987, 17.2718121227606, 17.2748119235918,
+        17.2778117244922, 17.2808115254617, 17.2838113265005, 17.2868111276083,
+        17.2898109287853, 17.2928107300313, 17.2958105313463, 17.2988103327302,
+        17.3018101341832, 17.304809935705, 17.3078097372957, 17.3108095389552,
+        17.3138093406835, 17.3168091424805, 17.3198089443463, 17.3228087462808,
+        17.3258085482839, 17.3288083503557, 17.331808152496, 17.3348079547049,
+        17.3378077569823, 17.3408075593281, 17.3438073617424, 17.3468071642251,
+        17.3498069667762, 17.3528067693956, 17.3558065720833, 17.3588063748393,
+        17.3618061776635, 17.3648059805558, 17.3678057835164, 17.370805586545,
+        17.3738053896417, 17.3768051928065, 17.3798049960393, 17.3828047993401,
+        17.3858046027088, 17.3888044061455, 17.39180420965, 17.3948040132223,
+        17.3978038168624, 17.4008036205703, 17.403803424346, 17.4068032281893,
+        17.4098030321003, 17.412802836079, 17.4158026401252, 17.418802444239,
+        17.4218022484203, 17.4248020526691, 17.4278018569853, 17.430801661369,
+        17.43380146582, 17.4368012703384, 17.4398010749241, 17.4428008795771,
+        17.4458006842974, 17.4488004890848, 17.4518002939394, 17.4548000988612,
+        17.45779990385, 17.460799708906, 17.463799514029, 17.4667993192189,
+        17.4697991244759, 17.4727989297997, 17.4757987351905, 17.4787985406482,
+        17.4817983461726, 17.4847981517639, 17.4877979574219, 17.4907977631467,
+        17.4937975689381, 17.4967973747962, 17.4997971807209, 17.5027969867122,
+        17.5057967927701, 17.5087965988945, 17.5117964050854, 17.5147962113427,
+        17.5177960176664, 17.5207958240566, 17.523795630513, 17.5267954370358,
+        17.5297952436249, 17.5327950502802, 17.5357948570018, 17.5387946637895,
+        17.5417944706433, 17.5447942775633, 17.5477940845494, 17.5507938916014,
+        17.5537936987196, 17.5567935059036, 17.5597933131537, 17.5627931204696,
+        17.5657929278514, 17.568792735299, 17.5717925428125, 17.5747923503917,
+        17.5777921580367, 17.5807919657474, 17.5837917735237, 17.5867915813657,
+        17.5897913892733, 17.5927911972464, 17.5957910052851, 17.5987908133893,
+        17.601790621559, 17.6047904297941, 17.6077902380946, 17.6107900464605,
+        17.6137898548917, 17.6167896633883, 17.6197894719501, 17.6227892805771,
+        17.6257890892693, 17.6287888980268, 17.6317887068493, 17.6347885157369,
+        17.6377883246897, 17.6407881337074, 17.6437879427902, 17.6467877519379,
+        17.6497875611506, 17.6527873704282, 17.6557871797706, 17.6587869891779,
+        17.66178679865, 17.6647866081869, 17.6677864177885, 17.6707862274548,
+        17.6737860371858, 17.6767858469814, 17.6797856568416, 17.6827854667664,
+        17.6857852767558, 17.6887850868096, 17.691784896928, 17.6947847071107,
+        17.6977845173579, 17.7007843276695, 17.7037841380454, 17.7067839484856,
+        17.7097837589901, 17.7127835695589, 17.7157833801918, 17.718783190889,
+        17.7217830016503, 17.7247828124757, 17.7277826233652, 17.7307824343187,
+        17.7337822453363, 17.7367820564178, 17.7397818675633, 17.7427816787728,
+        17.7457814900461, 17.7487813013833, 17.7517811127842, 17.754780924249,
+        17.7577807357776, 17.7607805473699, 17.7637803590258, 17.7667801707455,
+        17.7697799825287, 17.7727797943756, 17.775779606286, 17.77877941826,
+        17.7817792302974, 17.7847790423983, 17.7877788545627, 17.7907786667905,
+        17.7937784790816, 17.7967782914361, 17.7997781038539, 17.802777916335,
+        17.8057777288793, 17.8087775414868, 17.8117773541575, 17.8147771668914,
+        17.8177769796884, 17.8207767925484, 17.8237766054715, 17.8267764184577,
+        17.8297762315068, 17.8327760446189, 17.8357758577939, 17.8387756710318,
+        17.8417754843325, 17.8447752976961, 17.8477751111225, 17.8507749246117,
+        17.8537747381636, 17.8567745517782, 17.8597743654555, 17.8627741791954,
+        17.8657739929979, 17.868773806863, 17.8717736207906, 17.8747734347808,
+        17.8777732488335, 17.8807730629486, 17.8837728771261, 17.886772691366,
+        17.8897725056682, 17.8927723200328, 17.8957721344597, 17.8987719489489,
+        17.9017717635002, 17.9047715781138, 17.9077713927896, 17.9107712075274,
+        17.9137710223274, 17.9167708371895, 17.9197706521136, 17.9227704670997,
+        17.9257702821479, 17.9287700972579, 17.9317699124299, 17.9347697276638,
+        17.9377695429595, 17.940769358317, 17.9437691737364, 17.9467689892175,
+        17.9497688047604, 17.9527686203649, 17.9557684360311, 17.958768251759,
+        17.9617680675485, 17.9647678833995, 17.9677676993121, 17.9707675152862,
+        17.9737673313218, 17.9767671474189, 17.9797669635774, 17.9827667797973,
+        17.9857665960785, 17.9887664124211, 17.991766228825, 17.9947660452901,
+        17.9977658618165, 18.0007656784041, 18.0037654950529, 18.0067653117628,
+        18.0097651285339, 18.012764945366, 18.0157647622592, 18.0187645792134,
+        18.0217643962286, 18.0247642133048, 18.0277640304419, 18.0307638476399,
+        18.0337636648988, 18.0367634822186, 18.0397632995991, 18.0427631170404,
+        18.0457629345425, 18.0487627521053, 18.0517625697288, 18.054762387413,
+        18.0577622051578, 18.0607620229632, 18.0637618408292, 18.0667616587557,
+        18.0697614767427, 18.0727612947902, 18.0757611128982, 18.0787609310665,
+        18.0817607492953, 18.0847605675844, 18.0877603859339, 18.0907602043436,
+        18.0937600228137, 18.0967598413439, 18.0997596599344, 18.1027594785851,
+        18.1057592972959, 18.1087591160668, 18.1117589348978, 18.1147587537889,
+        18.11775857274, 18.1207583917511, 18.1237582108222, 18.1267580299532,
+        18.1297578491442, 18.132757668395, 18.1357574877057, 18.1387573070762,
+        18.1417571265064, 18.1447569459965, 18.1477567655463, 18.1507565851558,
+        18.1537564048249, 18.1567562245537, 18.1597560443422, 18.1627558641902,
+        18.1657556840977, 18.1687555040648, 18.1717553240914, 18.1747551441775,
+        18.177754964323, 18.1807547845279, 18.1837546047921, 18.1867544251158,
+        18.1897542454987, 18.192754065941, 18.1957538864425, 18.1987537070032,
+        18.2017535276231, 18.2047533483022, 18.2077531690405, 18.2107529898379,
+        18.2137528106943, 18.2167526316099, 18.2197524525844, 18.2227522736179,
+        18.2257520947104, 18.2287519158619, 18.2317517370723, 18.2347515583415,
+        18.2377513796696, 18.2407512010565, 18.2437510225022, 18.2467508440067,
+        18.2497506655699, 18.2527504871919, 18.2557503088725, 18.2587501306117,
+        18.2617499524096, 18.2647497742661, 18.2677495961811, 18.2707494181547,
+        18.2737492401867, 18.2767490622773, 18.2797488844263, 18.2827487066337,
+        18.2857485288995, 18.2887483512237, 18.2917481736062, 18.294747996047,
+        18.2977478185461, 18.3007476411034, 18.3037474637189, 18.3067472863927,
+        18.3097471091245, 18.3127469319146, 18.3157467547627, 18.3187465776689,
+        18.3217464006332, 18.3247462236554, 18.3277460467357, 18.3307458698739,
+        18.3337456930701, 18.3367455163241, 18.3397453396361, 18.3427451630058,
+        18.3457449864334, 18.3487448099188, 18.351744633462, 18.3547444570629,
+        18.3577442807215, 18.3607441044377, 18.3637439282116, 18.3667437520432,
+        18.3697435759323, 18.372743399879, 18.3757432238832, 18.378743047945,
+        18.3817428720642, 18.3847426962409, 18.3877425204749, 18.3907423447664,
+        18.3937421691153, 18.3967419935215, 18.399741817985, 18.4027416425058,
+        18.4057414670838, 18.4087412917191, 18.4117411164116, 18.4147409411612,
+        18.417740765968, 18.4207405908319, 18.4237404157528, 18.4267402407309,
+        18.429740065766, 18.432739890858, 18.4357397160071, 18.4387395412131,
+        18.441739366476, 18.4447391917958, 18.4477390171725, 18.450738842606,
+        18.4537386680963, 18.4567384936434, 18.4597383192473, 18.4627381449079,
+        18.4657379706252, 18.4687377963991, 18.4717376222297, 18.4747374481169,
+        18.4777372740607, 18.4807371000611, 18.483736926118, 18.4867367522314,
+        18.4897365784012, 18.4927364046276, 18.4957362309103, 18.4987360572494,
+        18.5017358836449, 18.5047357100968, 18.507735536605, 18.5107353631694,
+        18.5137351897901, 18.516735016467, 18.5197348432002, 18.5227346699895,
+        18.5257344968349, 18.5287343237365, 18.5317341506942, 18.5347339777079,
+        18.5377338047777, 18.5407336319035, 18.5437334590853, 18.546733286323,
+        18.5497331136167, 18.5527329409663, 18.5557327683717, 18.558732595833,
+        18.5617324233502, 18.5647322509231, 18.5677320785518, 18.5707319062362,
+        18.5737317339763, 18.5767315617721, 18.5797313896236, 18.5827312175308,
+        18.5857310454935, 18.5887308735118, 18.5917307015856, 18.594730529715,
+        18.5977303578999, 18.6007301861403, 18.6037300144361, 18.6067298427873,
+        18.6097296711939, 18.6127294996558, 18.6157293281732, 18.6187291567458,
+        18.6217289853737, 18.6247288140568, 18.6277286427952, 18.6307284715888,
+        18.6337283004376, 18.6367281293415, 18.6397279583006, 18.6427277873147,
+        18.6457276163839, 18.6487274455082, 18.6517272746875, 18.6547271039217,
+        18.657726933211, 18.6607267625551, 18.6637265919542, 18.6667264214082,
+        18.669726250917, 18.6727260804807, 18.6757259100991, 18.6787257397724,
+        18.6817255695003, 18.6847253992831, 18.6877252291205, 18.6907250590126,
+        18.6937248889593, 18.6967247189607, 18.6997245490166, 18.7027243791272,
+        18.7057242092922, 18.7087240395118, 18.7117238697859, 18.7147237001144,
+        18.7177235304974, 18.7207233609348, 18.7237231914265, 18.7267230219727,
+        18.7297228525731, 18.7327226832279, 18.7357225139369, 18.7387223447002,
+        18.7417221755178, 18.7447220063895, 18.7477218373154, 18.7507216682954,
+        18.7537214993296, 18.7567213304179, 18.7597211615602, 18.7627209927566,
+        18.7657208240071, 18.7687206553115, 18.7717204866698, 18.7747203180822,
+        18.7777201495484, 18.7807199810685, 18.7837198126425, 18.7867196442703,
+        18.789719475952, 18.7927193076874, 18.7957191394766, 18.7987189713195,
+        18.8017188032162, 18.8047186351665, 18.8077184671705, 18.8107182992281,
+        18.8137181313393, 18.8167179635041, 18.8197177957225, 18.8227176279944,
+        18.8257174603198, 18.8287172926987, 18.831717125131, 18.8347169576168,
+        18.8377167901559, 18.8407166227485, 18.8437164553943, 18.8467162880936,
+        18.8497161208461, 18.8527159536519, 18.8557157865109, 18.8587156194232,
+        18.8617154523886, 18.8647152854073, 18.8677151184791, 18.870714951604,
+        18.873714784782, 18.876714618013, 18.8797144512972, 18.8827142846343,
+        18.8857141180245, 18.8887139514676, 18.8917137849636, 18.8947136185126,
+        18.8977134521145, 18.9007132857692, 18.9037131194768, 18.9067129532372,
+        18.9097127870504, 18.9127126209164, 18.9157124548351, 18.9187122888065,
+        18.9217121228307, 18.9247119569075, 18.9277117910369, 18.930711625219,
+        18.9337114594536, 18.9367112937408, 18.9397111280806, 18.9427109624729,
+        18.9457107969177, 18.9487106314149, 18.9517104659646, 18.9547103005667,
+        18.9577101352212, 18.9607099699281, 18.9637098046873, 18.9667096394989,
+        18.9697094743627, 18.9727093092788, 18.9757091442472, 18.9787089792677,
+        18.9817088143405, 18.9847086494654, 18.9877084846425, 18.9907083198717,
+        18.993708155153, 18.9967079904864, 18.9997078258718, 19.0027076613092,
+        19.0057074967987, 19.0087073323401, 19.0117071679334, 19.0147070035787,
+        19.0177068392759, 19.020706675025, 19.0237065108259, 19.0267063466786,
+        19.0297061825832, 19.0327060185395, 19.0357058545475, 19.0387056906073,
+        19.0417055267188, 19.044705362882, 19.0477051990968, 19.0507050353633,
+        19.0537048716813, 19.056704708051, 19.0597045444722, 19.0627043809449,
+        19.0657042174692, 19.0687040540449, 19.0717038906721, 19.0747037273507,
+        19.0777035640807, 19.0807034008622, 19.0837032376949, 19.0867030745791,
+        19.0897029115145, 19.0927027485012, 19.0957025855392, 19.0987024226284,
+        19.1017022597689, 19.1047020969605, 19.1077019342033, 19.1107017714973,
+        19.1137016088424, 19.1167014462385, 19.1197012836858, 19.1227011211841,
+        19.1257009587334, 19.1287007963337, 19.131700633985, 19.1347004716873,
+        19.1377003094404, 19.1407001472445, 19.1436999850995, 19.1466998230053,
+        19.1496996609619, 19.1526994989694, 19.1556993370276, 19.1586991751366,
+        19.1616990132964, 19.1646988515068, 19.167698689768, 19.1706985280798,
+        19.1736983664423, 19.1766982048553, 19.179698043319, 19.1826978818332,
+        19.185697720398, 19.1886975590133, 19.1916973976791, 19.1946972363954,
+        19.1976970751621, 19.2006969139793, 19.2036967528469, 19.2066965917648,
+        19.2096964307331, 19.2126962697518, 19.2156961088207, 19.2186959479399,
+        19.2216957871094, 19.2246956263292, 19.2276954655991, 19.2306953049193,
+        19.2336951442896, 19.2366949837101, 19.2396948231807, 19.2426946627013,
+        19.2456945022721, 19.2486943418929, 19.2516941815638, 19.2546940212846,
+        19.2576938610554, 19.2606937008762, 19.2636935407469, 19.2666933806676,
+        19.2696932206381, 19.2726930606585, 19.2756929007287, 19.2786927408487,
+        19.2816925810186, 19.2846924212382, 19.2876922615075, 19.2906921018266,
+        19.2936919421954, 19.2966917826139, 19.299691623082, 19.3026914635998,
+        19.3056913041671, 19.3086911447841, 19.3116909854506, 19.3146908261666,
+        19.3176906669322, 19.3206905077473, 19.3236903486118, 19.3266901895258,
+        19.3296900304892, 19.332689871502, 19.3356897125642, 19.3386895536758,
+        19.3416893948366, 19.3446892360468, 19.3476890773063, 19.350688918615,
+        19.353688759973, 19.3566886013802, 19.3596884428366, 19.3626882843422,
+        19.3656881258969, 19.3686879675007, 19.3716878091537, 19.3746876508557,
+        19.3776874926068, 19.3806873344069, 19.383687176256, 19.3866870181542,
+        19.3896868601012, 19.3926867020973, 19.3956865441422, 19.3986863862361,
+        19.4016862283788, 19.4046860705704, 19.4076859128108, 19.4106857551,
+        19.413685597438, 19.4166854398248, 19.4196852822603, 19.4226851247445,
+        19.4256849672775, 19.4286848098591, 19.4316846524893, 19.4346844951682,
+        19.4376843378957, 19.4406841806717, 19.4436840234963, 19.4466838663695,
+        19.4496837092912, 19.4526835522613, 19.45568339528, 19.4586832383471,
+        19.4616830814626, 19.4646829246265, 19.4676827678388, 19.4706826110994,
+        19.4736824544084, 19.4766822977657, 19.4796821411713, 19.4826819846251,
+        19.4856818281272, 19.4886816716776, 19.4916815152761, 19.4946813589228,
+        19.4976812026177, 19.5006810463607, 19.5036808901518, 19.506680733991,
+        19.5096805778783, 19.5126804218136, 19.5156802657969, 19.5186801098283,
+        19.5216799539076, 19.5246797980349, 19.5276796422101, 19.5306794864332,
+        19.5336793307042, 19.5366791750231, 19.5396790193899, 19.5426788638044,
+        19.5456787082668, 19.5486785527769, 19.5516783973348, 19.5546782419405,
+        19.5576780865938, 19.5606779312949, 19.5636777760436, 19.56667762084,
+        19.569677465684, 19.5726773105756, 19.5756771555148, 19.5786770005015,
+        19.5816768455358, 19.5846766906176, 19.5876765357469, 19.5906763809237,
+        19.5936762261479, 19.5966760714196, 19.5996759167386, 19.6026757621051,
+        19.6056756075189, 19.6086754529801, 19.6116752984886, 19.6146751440443,
+        19.6176749896474, 19.6206748352977, 19.6236746809953, 19.62667452674,
+        19.629674372532, 19.6326742183711, 19.6356740642574, 19.6386739101908,
+        19.6416737561713, 19.6446736021989, 19.6476734482736, 19.6506732943952,
+        19.653673140564, 19.6566729867797, 19.6596728330423, 19.662672679352,
+        19.6656725257086, 19.668672372112, 19.6716722185624, 19.6746720650596,
+        19.6776719116037, 19.6806717581946, 19.6836716048324, 19.6866714515169,
+        19.6896712982481, 19.6926711450261, 19.6956709918508, 19.6986708387222,
+        19.7016706856403, 19.7046705326051, 19.7076703796165, 19.7106702266744,
+        19.713670073779, 19.7166699209302, 19.7196697681279, 19.7226696153721,
+        19.7256694626628, 19.72866931, 19.7316691573837, 19.7346690048138,
+        19.7376688522903, 19.7406686998133, 19.7436685473826, 19.7466683949983,
+        19.7496682426603, 19.7526680903686, 19.7556679381232, 19.7586677859241,
+        19.7616676337712, 19.7646674816646, 19.7676673296042, 19.7706671775899,
+        19.7736670256219, 19.7766668737, 19.7796667218242, 19.7826665699945,
+        19.7856664182109, 19.7886662664733, 19.7916661147818, 19.7946659631363,
+        19.7976658115368, 19.8006656599833, 19.8036655084758, 19.8066653570142,
+        19.8096652055985, 19.8126650542287, 19.8156649029047, 19.8186647516267,
+        19.8216646003944, 19.824664449208, 19.8276642980673, 19.8306641469725,
+        19.8336639959233, 19.83666384492, 19.8396636939623, 19.8426635430503,
+        19.8456633921839, 19.8486632413633, 19.8516630905882, 19.8546629398587,
+        19.8576627891749, 19.8606626385365, 19.8636624879438, 19.8666623373965,
+        19.8696621868948, 19.8726620364385, 19.8756618860277, 19.8786617356623,
+        19.8816615853424, 19.8846614350678, 19.8876612848386, 19.8906611346548,
+        19.8936609845163, 19.8966608344232, 19.8996606843753, 19.9026605343727,
+        19.9056603844153, 19.9086602345032, 19.9116600846363, 19.9146599348146,
+        19.9176597850381, 19.9206596353067, 19.9236594856205, 19.9266593359793,
+        19.9296591863833, 19.9326590368323, 19.9356588873264, 19.9386587378655,
+        19.9416585884496, 19.9446584390787, 19.9476582897528, 19.9506581404718,
+        19.9536579912357, 19.9566578420446, 19.9596576928983, 19.9626575437969,
+        19.9656573947404, 19.9686572457286, 19.9716570967617, 19.9746569478396,
+        19.9776567989622, 19.9806566501296, 19.9836565013417, 19.9866563525986,
+        19.9896562039001, 19.9926560552462, 19.995655906637, 19.9986557580725,
+        20.0016556095525, 20.0046554610772, 20.0076553126464, 20.0106551642601,
+        20.0136550159184, 20.0166548676211, 20.0196547193684, 20.0226545711601,
+        20.0256544229963, 20.0286542748768, 20.0316541268018, 20.0346539787712,
+        20.037653830785, 20.040653682843, 20.0436535349455, 20.0466533870922,
+        20.0496532392832, 20.0526530915184, 20.055652943798, 20.0586527961217,
+        20.0616526484896, 20.0646525009018, 20.0676523533581, 20.0706522058585,
+        20.0736520584031, 20.0766519109918, 20.0796517636245, 20.0826516163014,
+        20.0856514690222, 20.0886513217871, 20.0916511745961, 20.094651027449,
+        20.0976508803458, 20.1006507332867, 20.1036505862714, 20.1066504393001,
+        20.1096502923726, 20.112650145489, 20.1156499986493, 20.1186498518534,
+        20.1216497051013, 20.124649558393, 20.1276494117285, 20.1306492651077,
+        20.1336491185307, 20.1366489719973, 20.1396488255077, 20.1426486790617,
+        20.1456485326594, 20.1486483863008, 20.1516482399857, 20.1546480937142,
+        20.1576479474864, 20.160647801302, 20.1636476551613, 20.166647509064,
+        20.1696473630102, 20.1726472169999, 20.1756470710331, 20.1786469251097,
+        20.1816467792297, 20.1846466333932, 20.1876464876, 20.1906463418502,
+        20.1936461961437, 20.1966460504805, 20.1996459048607, 20.2026457592841,
+        20.2056456137508, 20.2086454682608, 20.211645322814, 20.2146451774104,
+        20.21764503205, 20.2206448867327, 20.2236447414586, 20.2266445962276,
+        20.2296444510398, 20.232644305895, 20.2356441607933, 20.2386440157347,
+        20.2416438707191, 20.2446437257465, 20.247643580817, 20.2506434359304,
+        20.2536432910867, 20.256643146286, 20.2596430015282, 20.2626428568133,
+        20.2656427121414, 20.2686425675122, 20.2716424229259, 20.2746422783825,
+        20.2776421338818, 20.280641989424, 20.2836418450089, 20.2866417006365,
+        20.2896415563069, 20.29264141202, 20.2956412677758, 20.2986411235743,
+        20.3016409794154, 20.3046408352991, 20.3076406912255, 20.3106405471945,
+        20.313640403206, 20.3166402592601, 20.3196401153568, 20.322639971496,
+        20.3256398276777, 20.3286396839018, 20.3316395401685, 20.3346393964775,
+        20.3376392528291, 20.340639109223, 20.3436389656593, 20.346638822138,
+        20.349638678659, 20.3526385352224, 20.3556383918281, 20.3586382484761,
+        20.3616381051663, 20.3646379618989, 20.3676378186736, 20.3706376754906,
+        20.3736375323498, 20.3766373892512, 20.3796372461948, 20.3826371031805,
+        20.3856369602083, 20.3886368172782, 20.3916366743903, 20.3946365315444,
+        20.3976363887405, 20.4006362459787, 20.4036361032589, 20.4066359605812,
+        20.4096358179454, 20.4126356753515, 20.4156355327996, 20.4186353902896,
+        20.4216352478216, 20.4246351053954, 20.4276349630111, 20.4306348206686,
+        20.433634678368, 20.4366345361092, 20.4396343938922, 20.442634251717,
+        20.4456341095835, 20.4486339674918, 20.4516338254418, 20.4546336834335,
+        20.4576335414669, 20.4606333995419, 20.4636332576586, 20.4666331158169,
+        20.4696329740169, 20.4726328322584, 20.4756326905415, 20.4786325488662,
+        20.4816324072324, 20.4846322656402, 20.4876321240894, 20.4906319825801,
+        20.4936318411123, 20.496631699686, 20.499631558301, 20.5026314169575,
+        20.5056312756554, 20.5086311343946, 20.5116309931752, 20.5146308519972,
+        20.5176307108605, 20.520630569765, 20.5236304287109, 20.526630287698,
+        20.5296301467264, 20.532630005796, 20.5356298649068, 20.5386297240588,
+        20.541629583252, 20.5446294424863, 20.5476293017618, 20.5506291610784,
+        20.5536290204361, 20.5566288798349, 20.5596287392748, 20.5626285987557,
+        20.5656284582777, 20.5686283178406, 20.5716281774446, 20.5746280370895,
+        20.5776278967754, 20.5806277565023, 20.58362761627, 20.5866274760787,
+        20.5896273359283, 20.5926271958187, 20.59562705575, 20.5986269157221,
+        20.601626775735, 20.6046266357888, 20.6076264958833, 20.6106263560186,
+        20.6136262161946, 20.6166260764114, 20.6196259366688, 20.622625796967,
+        20.6256256573058, 20.6286255176853, 20.6316253781055, 20.6346252385662,
+        20.6376250990676, 20.6406249596095, 20.643624820192, 20.6466246808151,
+        20.6496245414787, 20.6526244021828, 20.6556242629274, 20.6586241237125,
+        20.6616239845381, 20.6646238454041, 20.6676237063105, 20.6706235672573,
+        20.6736234282446, 20.6766232892722, 20.6796231503401, 20.6826230114484,
+        20.685622872597, 20.688622733786, 20.6916225950152, 20.6946224562847,
+        20.6976223175944, 20.7006221789444, 20.7036220403345, 20.7066219017649,
+        20.7096217632355, 20.7126216247462, 20.7156214862971, 20.7186213478881,
+        20.7216212095192, 20.7246210711904, 20.7276209329017, 20.7306207946531,
+        20.7336206564445, 20.7366205182759, 20.7396203801473, 20.7426202420587,
+        20.7456201040101, 20.7486199660014, 20.7516198280327, 20.7546196901039,
+        20.757619552215, 20.760619414366, 20.7636192765569, 20.7666191387876,
+        20.7696190010581, 20.7726188633685, 20.7756187257186, 20.7786185881086,
+        20.7816184505383, 20.7846183130077, 20.7876181755169, 20.7906180380658,
+        20.7936179006544, 20.7966177632827, 20.7996176259506, 20.8026174886582,
+        20.8056173514054, 20.8086172141922, 20.8116170770186, 20.8146169398846,
+        20.8176168027902, 20.8206166657353, 20.8236165287199, 20.826616391744,
+        20.8296162548076, 20.8326161179107, 20.8356159810532, 20.8386158442352,
+        20.8416157074566, 20.8446155707174, 20.8476154340176, 20.8506152973572,
+        20.8536151607361, 20.8566150241544, 20.859614887612, 20.8626147511089,
+        20.865614614645, 20.8686144782205, 20.8716143418352, 20.8746142054891,
+        20.8776140691823, 20.8806139329146, 20.8836137966861, 20.8866136604968,
+        20.8896135243467, 20.8926133882357, 20.8956132521638, 20.898613116131,
+        20.9016129801373, 20.9046128441826, 20.9076127082671, 20.9106125723905,
+        20.9136124365529, 20.9166123007544, 20.9196121649948, 20.9226120292742,
+        20.9256118935926, 20.9286117579499, 20.9316116223461, 20.9346114867812,
+        20.9376113512552, 20.940611215768, 20.9436110803197, 20.9466109449103,
+        20.9496108095396, 20.9526106742077, 20.9556105389147, 20.9586104036604,
+        20.9616102684448, 20.964610133268, 20.9676099981299, 20.9706098630304,
+        20.9736097279697, 20.9766095929476, 20.9796094579642, 20.9826093230194,
+        20.9856091881133, 20.9886090532457, 20.9916089184167, 20.9946087836263,
+        20.9976086488744, 21.0006085141611, 21.0036083794863, 21.0066082448499,
+        21.0096081102521, 21.0126079756927, 21.0156078411718, 21.0186077066893,
+        21.0216075722453, 21.0246074378396, 21.0276073034723, 21.0306071691434,
+        21.0336070348528, 21.0366069006006, 21.0396067663867, 21.0426066322111,
+        21.0456064980738, 21.0486063639747, 21.0516062299139, 21.0546060958914,
+        21.057605961907, 21.0606058279609, 21.063605694053, 21.0666055601832,
+        21.0696054263516, 21.0726052925581, 21.0756051588027, 21.0786050250855,
+        21.0816048914063, 21.0846047577652, 21.0876046241622, 21.0906044905972,
+        21.0936043570703, 21.0966042235813, 21.0996040901304, 21.1026039567174,
+        21.1056038233424, 21.1086036900053, 21.1116035567061, 21.1146034234449,
+        21.1176032902215, 21.1206031570361, 21.1236030238885, 21.1266028907787,
+        21.1296027577068, 21.1326026246727, 21.1356024916764, 21.1386023587179,
+        21.1416022257971, 21.1446020929141, 21.1476019600688, 21.1506018272613,
+        21.1536016944914, 21.1566015617593, 21.1596014290648, 21.1626012964079,
+        21.1656011637887, 21.1686010312071, 21.1716008986632, 21.1746007661568,
+        21.177600633688, 21.1806005012567, 21.183600368863, 21.1866002365068,
+        21.1896001041882, 21.192599971907, 21.1955998396633, 21.198599707457,
+        21.2015995752883, 21.2045994431569, 21.207599311063, 21.2105991790064,
+        21.2135990469872, 21.2165989150054, 21.219598783061, 21.2225986511539,
+        21.2255985192841, 21.2285983874516, 21.2315982556564, 21.2345981238985,
+        21.2375979921778, 21.2405978604944, 21.2435977288482, 21.2465975972392,
+        21.2495974656674, 21.2525973341328, 21.2555972026353, 21.258597071175,
+        21.2615969397518, 21.2645968083658, 21.2675966770168, 21.2705965457049,
+        21.2735964144301, 21.2765962831923, 21.2795961519916, 21.2825960208279,
+        21.2855958897011, 21.2885957586114, 21.2915956275587, 21.2945954965429,
+        21.297595365564, 21.3005952346221, 21.3035951037171, 21.306594972849,
+        21.3095948420178, 21.3125947112234, 21.3155945804659, 21.3185944497452,
+        21.3215943190613, 21.3245941884143, 21.327594057804, 21.3305939272305,
+        21.3335937966937, 21.3365936661937, 21.3395935357304, 21.3425934053038,
+        21.3455932749139, 21.3485931445607, 21.3515930142442, 21.3545928839643,
+        21.357592753721, 21.3605926235143, 21.3635924933443, 21.3665923632108,
+        21.3695922331139, 21.3725921030536, 21.3755919730298, 21.3785918430425,
+        21.3815917130917, 21.3845915831774, 21.3875914532996, 21.3905913234583,
+        21.3935911936534, 21.3965910638849, 21.3995909341529, 21.4025908044572,
+        21.405590674798, 21.4085905451751, 21.4115904155885, 21.4145902860384,
+        21.4175901565245, 21.4205900270469, 21.4235898976056, 21.4265897682007,
+        21.4295896388319, 21.4325895094994, 21.4355893802032, 21.4385892509432,
+        21.4415891217193, 21.4445889925317, 21.4475888633802, 21.4505887342649,
+        21.4535886051857, 21.4565884761427, 21.4595883471358, 21.4625882181649,
+        21.4655880892302, 21.4685879603315, 21.4715878314688, 21.4745877026422,
+        21.4775875738516, 21.4805874450971, 21.4835873163785, 21.4865871876959,
+        21.4895870590492, 21.4925869304385, 21.4955868018637, 21.4985866733249,
+        21.5015865448219, 21.5045864163548, 21.5075862879236, 21.5105861595282,
+        21.5135860311687, 21.516585902845, 21.5195857745572, 21.5225856463051,
+        21.5255855180888, 21.5285853899082, 21.5315852617634, 21.5345851336544,
+        21.537585005581, 21.5405848775434, 21.5435847495415, 21.5465846215752,
+        21.5495844936446, 21.5525843657496, 21.5555842378903, 21.5585841100666,
+        21.5615839822785, 21.5645838545259, 21.567583726809, 21.5705835991276,
+        21.5735834714817, 21.5765833438714, 21.5795832162966, 21.5825830887572,
+        21.5855829612534, 21.588582833785, 21.5915827063521, 21.5945825789546,
+        21.5975824515926, 21.6005823242659, 21.6035821969746, 21.6065820697188,
+        21.6095819424982, 21.6125818153131, 21.6155816881632, 21.6185815610487,
+        21.6215814339695, 21.6245813069256, 21.6275811799169, 21.6305810529436,
+        21.6335809260054, 21.6365807991025, 21.6395806722348, 21.6425805454023,
+        21.645580418605, 21.6485802918429, 21.6515801651159, 21.6545800384241,
+        21.6575799117674, 21.6605797851458, 21.6635796585593, 21.666579532008,
+        21.6695794054916, 21.6725792790104, 21.6755791525641, 21.6785790261529,
+        21.6815788997767, 21.6845787734355, 21.6875786471293, 21.6905785208581,
+        21.6935783946218, 21.6965782684205, 21.699578142254, 21.7025780161225,
+        21.7055778900259, 21.7085777639642, 21.7115776379373, 21.7145775119453,
+        21.7175773859881, 21.7205772600658, 21.7235771341783, 21.7265770083255,
+        21.7295768825076, 21.7325767567244, 21.7355766309759, 21.7385765052622,
+        21.7415763795832, 21.7445762539389, 21.7475761283294, 21.7505760027545,
+        21.7535758772142, 21.7565757517086, 21.7595756262377, 21.7625755008014,
+        21.7655753753997, 21.7685752500325, 21.7715751247, 21.774574999402,
+        21.7775748741386, 21.7805747489097, 21.7835746237153, 21.7865744985555,
+        21.7895743734301, 21.7925742483392, 21.7955741232828, 21.7985739982608,
+        21.8015738732733, 21.8045737483202, 21.8075736234015, 21.8105734985172,
+        21.8135733736673, 21.8165732488517, 21.8195731240705, 21.8225729993236,
+        21.8255728746111, 21.8285727499328, 21.8315726252889, 21.8345725006792,
+        21.8375723761038, 21.8405722515627, 21.8435721270558, 21.8465720025831,
+        21.8495718781447, 21.8525717537404, 21.8555716293703, 21.8585715050344,
+        21.8615713807326, 21.864571256465, 21.8675711322315, 21.8705710080321,
+        21.8735708838668, 21.8765707597356, 21.8795706356384, 21.8825705115754,
+        21.8855703875463, 21.8885702635513, 21.8915701395903, 21.8945700156633,
+        21.8975698917703, 21.9005697679112, 21.9035696440862, 21.906569520295,
+        21.9095693965378, 21.9125692728145, 21.9155691491251, 21.9185690254696,
+        21.921568901848, 21.9245687782602, 21.9275686547063, 21.9305685311862,
+        21.9335684076999, 21.9365682842474, 21.9395681608288, 21.9425680374439,
+        21.9455679140927, 21.9485677907753, 21.9515676674917, 21.9545675442417,
+        21.9575674210255, 21.960567297843, 21.9635671746941, 21.9665670515789,
+        21.9695669284974, 21.9725668054495, 21.9755666824352, 21.9785665594546,
+        21.9815664365075, 21.984566313594, 21.9875661907141, 21.9905660678678,
+        21.993565945055, 21.9965658222757, 21.9995656995299, 22.0025655768177,
+        22.0055654541389, 22.0085653314936, 22.0115652088817, 22.0145650863033,
+        22.0175649637584, 22.0205648412468, 22.0235647187687, 22.0265645963239,
+        22.0295644739126, 22.0325643515346, 22.0355642291899, 22.0385641068786,
+        22.0415639846006, 22.0445638623559, 22.0475637401445, 22.0505636179664,
+        22.0535634958216, 22.05656337371, 22.0595632516316, 22.0625631295865,
+        22.0655630075746, 22.0685628855959, 22.0715627636504, 22.0745626417381,
+        22.0775625198589, 22.0805623980129, 22.0835622762, 22.0865621544202,
+        22.0895620326735, 22.09256191096, 22.0955617892795, 22.098561667632,
+        22.1015615460177, 22.1045614244363, 22.107561302888, 22.1105611813727,
+        22.1135610598904, 22.1165609384411, 22.1195608170247, 22.1225606956414,
+        22.1255605742909, 22.1285604529734, 22.1315603316888, 22.1345602104371,
+        22.1375600892183, 22.1405599680324, 22.1435598468794, 22.1465597257592,
+        22.1495596046718, 22.1525594836173, 22.1555593625955, 22.1585592416066,
+        22.1615591206505, 22.1645589997271, 22.1675588788365, 22.1705587579786,
+        22.1735586371535, 22.176558516361, 22.1795583956013, 22.1825582748743,
+        22.18555815418, 22.1885580335183, 22.1915579128892, 22.1945577922929,
+        22.1975576717291, 22.2005575511979, 22.2035574306994, 22.2065573102334,
+        22.2095571898, 22.2125570693992, 22.2155569490309, 22.2185568286951,
+        22.2215567083919, 22.2245565881211, 22.2275564678829, 22.2305563476771,
+        22.2335562275039, 22.236556107363, 22.2395559872546, 22.2425558671786,
+        22.2455557471351, 22.2485556271239, 22.2515555071452, 22.2545553871988,
+        22.2575552672847, 22.2605551474031, 22.2635550275537, 22.2665549077367,
+        22.269554787952, 22.2725546681996, 22.2755545484794, 22.2785544287916,
+        22.2815543091359, 22.2845541895126, 22.2875540699215, 22.2905539503625,
+        22.2935538308358, 22.2965537113413, 22.299553591879, 22.3025534724488,
+        22.3055533530508, 22.3085532336849, 22.3115531143512, 22.3145529950495,
+        22.31755287578, 22.3205527565426, 22.3235526373372, 22.3265525181639,
+        22.3295523990226, 22.3325522799134, 22.3355521608362, 22.338552041791,
+        22.3415519227778, 22.3445518037966, 22.3475516848474, 22.3505515659301,
+        22.3535514470448, 22.3565513281914, 22.3595512093699, 22.3625510905804,
+        22.3655509718227, 22.3685508530969, 22.371550734403, 22.3745506157409,
+        22.3775504971107, 22.3805503785123, 22.3835502599458, 22.386550141411,
+        22.389550022908, 22.3925499044368, 22.3955497859974, 22.3985496675898,
+        22.4015495492138, 22.4045494308696, 22.4075493125571, 22.4105491942764,
+        22.4135490760273, 22.4165489578099, 22.4195488396241, 22.42254872147,
+        22.4255486033476, 22.4285484852567, 22.4315483671975, 22.4345482491699,
+        22.4375481311739, 22.4405480132094, 22.4435478952765, 22.4465477773752,
+        22.4495476595054, 22.4525475416671, 22.4555474238604, 22.4585473060851,
+        22.4615471883413, 22.464547070629, 22.4675469529482, 22.4705468352988,
+        22.4735467176809, 22.4765466000944, 22.4795464825392, 22.4825463650155,
+        22.4855462475232, 22.4885461300623, 22.4915460126327, 22.4945458952344,
+        22.4975457778675, 22.5005456605319, 22.5035455432277, 22.5065454259547,
+        22.509545308713, 22.5125451915026, 22.5155450743234, 22.5185449571755,
+        22.5215448400589, 22.5245447229734, 22.5275446059192, 22.5305444888962,
+        22.5335443719043, 22.5365442549437, 22.5395441380142, 22.5425440211158,
+        22.5455439042486, 22.5485437874125, 22.5515436706075, 22.5545435538336,
+        22.5575434370908, 22.5605433203791, 22.5635432036984, 22.5665430870488,
+        22.5695429704302, 22.5725428538426, 22.5755427372861, 22.5785426207606,
+        22.581542504266, 22.5845423878024, 22.5875422713698, 22.5905421549682,
+        22.5935420385974, 22.5965419222576, 22.5995418059487, 22.6025416896708,
+        22.6055415734237, 22.6085414572074, 22.6115413410221, 22.6145412248676,
+        22.6175411087439, 22.6205409926511, 22.6235408765891, 22.6265407605578,
+        22.6295406445574, 22.6325405285878, 22.6355404126489, 22.6385402967408,
+        22.6415401808634, 22.6445400650167, 22.6475399492008, 22.6505398334156,
+        22.653539717661, 22.6565396019372, 22.659539486244, 22.6625393705814,
+        22.6655392549495, 22.6685391393483, 22.6715390237776, 22.6745389082376,
+        22.6775387927282, 22.6805386772493, 22.683538561801, 22.6865384463833,
+        22.6895383309962, 22.6925382156395, 22.6955381003134, 22.6985379850178,
+        22.7015378697527, 22.7045377545181, 22.7075376393139, 22.7105375241402,
+        22.713537408997, 22.7165372938842, 22.7195371788018, 22.7225370637499,
+        22.7255369487283, 22.7285368337372, 22.7315367187764, 22.734536603846,
+        22.7375364889459, 22.7405363740762, 22.7435362592368, 22.7465361444277,
+        22.7495360296489, 22.7525359149004, 22.7555358001822, 22.7585356854943,
+        22.7615355708367, 22.7645354562092, 22.767535341612, 22.7705352270451,
+        22.7735351125083, 22.7765349980018, 22.7795348835254, 22.7825347690792,
+        22.7855346546632, 22.7885345402773, 22.7915344259215, 22.7945343115959,
+        22.7975341973004, 22.800534083035, 22.8035339687997, 22.8065338545944,
+        22.8095337404193, 22.8125336262742, 22.8155335121591, 22.8185333980741,
+        22.821533284019, 22.824533169994, 22.827533055999, 22.830532942034,
+        22.8335328280989, 22.8365327141938, 22.8395326003187, 22.8425324864735,
+        22.8455323726582, 22.8485322588728, 22.8515321451173, 22.8545320313918,
+        22.857531917696, 22.8605318040302, 22.8635316903942, 22.8665315767881,
+        22.8695314632118, 22.8725313496653, 22.8755312361486, 22.8785311226617,
+        22.8815310092046, 22.8845308957773, 22.8875307823797, 22.8905306690119,
+        22.8935305556738, 22.8965304423654, 22.8995303290868, 22.9025302158378,
+        22.9055301026186, 22.908529989429, 22.9115298762691, 22.9145297631388,
+        22.9175296500382, 22.9205295369672, 22.9235294239259, 22.9265293109141,
+        22.929529197932, 22.9325290849794, 22.9355289720564, 22.938528859163,
+        22.9415287462991, 22.9445286334648, 22.94752852066, 22.9505284078847,
+        22.9535282951389, 22.9565281824226, 22.9595280697357, 22.9625279570784,
+        22.9655278444505, 22.968527731852, 22.971527619283, 22.9745275067434,
+        22.9775273942333, 22.9805272817525, 22.9835271693011, 22.9865270568791,
+        22.9895269444865, 22.9925268321232, 22.9955267197892, 22.9985266074846,
+        23.0015264952093, 23.0045263829633, 23.0075262707466, 23.0105261585592,
+        23.0135260464011, 23.0165259342722, 23.0195258221726, 23.0225257101022,
+        23.0255255980611, 23.0285254860491, 23.0315253740664, 23.0345252621129,
+        23.0375251501885, 23.0405250382933, 23.0435249264273, 23.0465248145904,
+        23.0495247027827, 23.0525245910041, 23.0555244792546, 23.0585243675342,
+        23.0615242558429, 23.0645241441807, 23.0675240325475, 23.0705239209434,
+        23.0735238093684, 23.0765236978224, 23.0795235863054, 23.0825234748174,
+        23.0855233633584, 23.0885232519284, 23.0915231405274, 23.0945230291553,
+        23.0975229178123, 23.1005228064981, 23.1035226952129, 23.1065225839566,
+        23.1095224727292, 23.1125223615307, 23.1155222503611, 23.1185221392204,
+        23.1215220281086, 23.1245219170256, 23.1275218059714, 23.1305216949461,
+        23.1335215839496, 23.1365214729819, 23.139521362043, 23.1425212511329,
+        23.1455211402515, 23.148521029399, 23.1515209185752, 23.1545208077801,
+        23.1575206970137, 23.1605205862761, 23.1635204755672, 23.166520364887,
+        23.1695202542354, 23.1725201436126, 23.1755200330184, 23.1785199224528,
+        23.1815198119159, 23.1845197014077, 23.187519590928, 23.190519480477,
+        23.1935193700545, 23.1965192596607, 23.1995191492954, 23.2025190389587,
+        23.2055189286505, 23.2085188183709, 23.2115187081198, 23.2145185978972,
+        23.2175184877031, 23.2205183775376, 23.2235182674005, 23.2265181572919,
+        23.2295180472117, 23.23251793716, 23.2355178271368, 23.238517717142,
+        23.2415176071756, 23.2445174972376, 23.247517387328, 23.2505172774468,
+        23.2535171675939, 23.2565170577695, 23.2595169479734, 23.2625168382056,
+        23.2655167284662, 23.2685166187551, 23.2715165090723, 23.2745163994178,
+        23.2775162897915, 23.2805161801936, 23.2835160706239, 23.2865159610825,
+        23.2895158515694, 23.2925157420844, 23.2955156326277, 23.2985155231992,
+        23.3015154137989, 23.3045153044268, 23.3075151950829, 23.3105150857671,
+        23.3135149764795, 23.31651486722, 23.3195147579887, 23.3225146487855,
+        23.3255145396104, 23.3285144304634, 23.3315143213446, 23.3345142122537,
+        23.337514103191, 23.3405139941563, 23.3435138851497, 23.3465137761711,
+        23.3495136672205, 23.352513558298, 23.3555134494035, 23.3585133405369,
+        23.3615132316984, 23.3645131228878, 23.3675130141051, 23.3705129053505,
+        23.3735127966237, 23.3765126879249, 23.379512579254, 23.3825124706111,
+        23.385512361996, 23.3885122534088, 23.3915121448495, 23.394512036318,
+        23.3975119278144, 23.4005118193387, 23.4035117108908, 23.4065116024707,
+        23.4095114940784, 23.4125113857139, 23.4155112773772, 23.4185111690683,
+        23.4215110607872, 23.4245109525338, 23.4275108443082, 23.4305107361103,
+        23.4335106279401, 23.4365105197977, 23.4395104116829, 23.4425103035959,
+        23.4455101955365, 23.4485100875048, 23.4515099795008, 23.4545098715244,
+        23.4575097635757, 23.4605096556546, 23.4635095477611, 23.4665094398952,
+        23.4695093320569, 23.4725092242462, 23.4755091164631, 23.4785090087076,
+        23.4815089009796, 23.4845087932792, 23.4875086856063, 23.4905085779609,
+        23.493508470343, 23.4965083627527, 23.4995082551898, 23.5025081476544,
+        23.5055080401465, 23.5085079326661, 23.5115078252131, 23.5145077177875,
+        23.5175076103894, 23.5205075030187, 23.5235073956754, 23.5265072883595,
+        23.529507181071, 23.5325070738099, 23.5355069665761, 23.5385068593697,
+        23.5415067521906, 23.5445066450389, 23.5475065379145, 23.5505064308174,
+        23.5535063237477, 23.5565062167052, 23.55950610969, 23.562506002702,
+        23.5655058957414, 23.568505788808, 23.5715056819018, 23.5745055750229,
+        23.5775054681712, 23.5805053613467, 23.5835052545494, 23.5865051477792,
+        23.5895050410363, 23.5925049343205, 23.5955048276319, 23.5985047209705,
+        23.6015046143362, 23.604504507729, 23.6075044011489, 23.6105042945959,
+        23.6135041880701, 23.6165040815713, 23.6195039750996, 23.622503868655,
+        23.6255037622374, 23.6285036558468, 23.6315035494833, 23.6345034431469,
+        23.6375033368374, 23.6405032305549, 23.6435031242995, 23.646503018071,
+        23.6495029118695, 23.6525028056949, 23.6555026995474, 23.6585025934267,
+        23.661502487333, 23.6645023812662, 23.6675022752263, 23.6705021692133,
+        23.6735020632272, 23.676501957268, 23.6795018513357, 23.6825017454302,
+        23.6855016395516, 23.6885015336998, 23.6915014278749, 23.6945013220767,
+        23.6975012163054, 23.7005011105609, 23.7035010048431, 23.7065008991522,
+        23.709500793488, 23.7125006878505, 23.7155005822399, 23.7185004766559,
+        23.7215003710987, 23.7245002655682, 23.7275001600644, 23.7305000545873,
+        23.7334999491369, 23.7364998437132, 23.7394997383161, 23.7424996329457,
+        23.745499527602, 23.7484994222849, 23.7514993169944, 23.7544992117305,
+        23.7574991064932, 23.7604990012826, 23.7634988960985, 23.766498790941,
+        23.76949868581, 23.7724985807056, 23.7754984756278, 23.7784983705765,
+        23.7814982655517, 23.7844981605535, 23.7874980555817, 23.7904979506365,
+        23.7934978457177, 23.7964977408254, 23.7994976359596, 23.8024975311202,
+        23.8054974263073, 23.8084973215208, 23.8114972167607, 23.8144971120271,
+        23.8174970073199, 23.820496902639, 23.8234967979846, 23.8264966933565,
+        23.8294965887548, 23.8324964841794, 23.8354963796304, 23.8384962751077,
+        23.8414961706114, 23.8444960661413, 23.8474959616976, 23.8504958572802,
+        23.853495752889, 23.8564956485242, 23.8594955441856, 23.8624954398732,
+        23.8654953355871, 23.8684952313273, 23.8714951270936, 23.8744950228862,
+        23.877494918705, 23.88049481455, 23.8834947104212, 23.8864946063185,
+        23.8894945022421, 23.8924943981917, 23.8954942941676, 23.8984941901695,
+        23.9014940861976, 23.9044939822518, 23.9074938783322, 23.9104937744386,
+        23.9134936705711, 23.9164935667297, 23.9194934629144, 23.9224933591251,
+        23.9254932553619, 23.9284931516247, 23.9314930479135, 23.9344929442284,
+        23.9374928405692, 23.9404927369361, 23.943492633329, 23.9464925297478,
+        23.9494924261926, 23.9524923226634, 23.9554922191602, 23.9584921156828,
+        23.9614920122314, 23.964491908806, 23.9674918054064, 23.9704917020328,
+        23.973491598685, 23.9764914953631, 23.9794913920671, 23.982491288797,
+        23.9854911855527, 23.9884910823342, 23.9914909791416, 23.9944908759749,
+        23.9974907728339, 24.0004906697188, 24.0034905666294, 24.0064904635658,
+        24.009490360528, 24.012490257516, 24.0154901545297, 24.0184900515692,
+        24.0214899486344, 24.0244898457254, 24.027489742842, 24.0304896399844,
+        24.0334895371525, 24.0364894343463, 24.0394893315657, 24.0424892288108,
+        24.0454891260816, 24.048489023378, 24.0514889207001, 24.0544888180478,
+        24.0574887154211, 24.0604886128201, 24.0634885102446, 24.0664884076948,
+        24.0694883051705, 24.0724882026718, 24.0754881001987, 24.0784879977511,
+        24.081487895329, 24.0844877929326, 24.0874876905616, 24.0904875882161,
+        24.0934874858962, 24.0964873836018, 24.0994872813328, 24.1024871790893,
+        24.1054870768713, 24.1084869746788, 24.1114868725117, 24.11448677037,
+        24.1174866682538, 24.120486566163, 24.1234864640977, 24.1264863620577,
+        24.1294862600431, 24.1324861580539, 24.1354860560901, 24.1384859541516,
+        24.1414858522385, 24.1444857503508, 24.1474856484883, 24.1504855466513,
+        24.1534854448395, 24.156485343053, 24.1594852412919, 24.162485139556,
+        24.1654850378454, 24.1684849361601, 24.1714848345, 24.1744847328652,
+        24.1774846312557, 24.1804845296713, 24.1834844281122, 24.1864843265783,
+        24.1894842250697, 24.1924841235862, 24.1954840221279, 24.1984839206948,
+        24.2014838192868, 24.204483717904, 24.2074836165464, 24.2104835152139,
+        24.2134834139065, 24.2164833126242, 24.2194832113671, 24.222483110135,
+        24.2254830089281, 24.2284829077462, 24.2314828065895, 24.2344827054577,
+        24.2374826043511, 24.2404825032694, 24.2434824022129, 24.2464823011813,
+        24.2494822001748, 24.2524820991933, 24.2554819982367, 24.2584818973052,
+        24.2614817963986, 24.2644816955171, 24.2674815946604, 24.2704814938288,
+        24.2734813930221, 24.2764812922403, 24.2794811914834, 24.2824810907515,
+        24.2854809900445, 24.2884808893623, 24.2914807887051, 24.2944806880727,
+        24.2974805874652, 24.3004804868826, 24.3034803863248, 24.3064802857919,
+        24.3094801852838, 24.3124800848005, 24.315479984342, 24.3184798839084,
+        24.3214797834995, 24.3244796831154, 24.3274795827561, 24.3304794824216,
+        24.3334793821119, 24.3364792818268, 24.3394791815666, 24.342479081331,
+        24.3454789811202, 24.3484788809341, 24.3514787807727, 24.354478680636,
+        24.357478580524, 24.3604784804367, 24.363478380374, 24.366478280336,
+        24.3694781803227, 24.372478080334, 24.3754779803699, 24.3784778804304,
+        24.3814777805156, 24.3844776806254, 24.3874775807597, 24.3904774809187,
+        24.3934773811022, 24.3964772813103, 24.399477181543, 24.4024770818002,
+        24.4054769820819, 24.4084768823882, 24.411476782719, 24.4144766830743,
+        24.4174765834541, 24.4204764838585, 24.4234763842873, 24.4264762847406,
+        24.4294761852183, 24.4324760857205, 24.4354759862472, 24.4384758867983,
+        24.4414757873739, 24.4444756879738, 24.4474755885982, 24.450475489247,
+        24.4534753899202, 24.4564752906178, 24.4594751913397, 24.462475092086,
+        24.4654749928567, 24.4684748936518, 24.4714747944712, 24.4744746953149,
+        24.4774745961829, 24.4804744970753, 24.483474397992, 24.4864742989329,
+        24.4894741998982, 24.4924741008877, 24.4954740019015, 24.4984739029396,
+        24.5014738040019, 24.5044737050885, 24.5074736061993, 24.5104735073343,
+        24.5134734084936, 24.5164733096771, 24.5194732108847, 24.5224731121166,
+        24.5254730133726, 24.5284729146528, 24.5314728159572, 24.5344727172858,
+        24.5374726186384, 24.5404725200153, 24.5434724214162, 24.5464723228413,
+        24.5494722242905, 24.5524721257638, 24.5554720272611, 24.5584719287826,
+        24.5614718303281, 24.5644717318978, 24.5674716334914, 24.5704715351092,
+        24.5734714367509, 24.5764713384167, 24.5794712401065, 24.5824711418204,
+        24.5854710435582, 24.58847094532, 24.5914708471059, 24.5944707489157,
+        24.5974706507495, 24.6004705526072, 24.6034704544889, 24.6064703563945,
+        24.6094702583241, 24.6124701602776, 24.615470062255, 24.6184699642564,
+        24.6214698662816, 24.6244697683307, 24.6274696704037, 24.6304695725006,
+        24.6334694746213, 24.636469376766, 24.6394692789344, 24.6424691811267,
+        24.6454690833428, 24.6484689855828, 24.6514688878465, 24.6544687901341,
+        24.6574686924455, 24.6604685947806, 24.6634684971395, 24.6664683995222,
+        24.6694683019287, 24.6724682043589, 24.6754681068129, 24.6784680092906,
+        24.681467911792, 24.6844678143171, 24.687467716866, 24.6904676194385,
+        24.6934675220348, 24.6964674246547, 24.6994673272983, 24.7024672299656,
+        24.7054671326565, 24.7084670353711, 24.7114669381093, 24.7144668408711,
+        24.7174667436566, 24.7204666464657, 24.7234665492984, 24.7264664521547,
+        24.7294663550345, 24.732466257938, 24.735466160865, 24.7384660638156,
+        24.7414659667898, 24.7444658697875, 24.7474657728087, 24.7504656758535,
+        24.7534655789217, 24.7564654820135, 24.7594653851288, 24.7624652882676,
+        24.7654651914299, 24.7684650946156, 24.7714649978249, 24.7744649010576,
+        24.7774648043137, 24.7804647075933, 24.7834646108963, 24.7864645142227,
+        24.7894644175726, 24.7924643209459, 24.7954642243425, 24.7984641277626,
+        24.801464031206, 24.8044639346729, 24.807463838163, 24.8104637416766,
+        24.8134636452135, 24.8164635487737, 24.8194634523573, 24.8224633559642,
+        24.8254632595944, 24.8284631632479, 24.8314630669247, 24.8344629706249,
+        24.8374628743482, 24.8404627780949, 24.8434626818648, 24.846462585658,
+        24.8494624894745, 24.8524623933141, 24.8554622971771, 24.8584622010632,
+        24.8614621049725, 24.8644620089051, 24.8674619128608, 24.8704618168398,
+        24.8734617208419, 24.8764616248672, 24.8794615289157, 24.8824614329873,
+        24.8854613370821, 24.8884612412, 24.891461145341, 24.8944610495052,
+        24.8974609536924, 24.9004608579028, 24.9034607621363, 24.9064606663928,
+        24.9094605706725, 24.9124604749752, 24.915460379301, 24.9184602836498,
+        24.9214601880217, 24.9244600924166, 24.9274599968346, 24.9304599012756,
+        24.9334598057396, 24.9364597102266, 24.9394596147366, 24.9424595192696,
+        24.9454594238255, 24.9484593284045, 24.9514592330064, 24.9544591376312,
+        24.957459042279, 24.9604589469498, 24.9634588516435, 24.9664587563601,
+        24.9694586610996, 24.972458565862, 24.9754584706473, 24.9784583754555,
+        24.9814582802866, 24.9844581851406, 24.9874580900174, 24.9904579949171,
+        24.9934578998397, 24.996457804785, 24.9994577097533, 25.0024576147443,
+        25.0054575197581, 25.0084574247948, 25.0114573298543, 25.0144572349365,
+        25.0174571400415, 25.0204570451693, 25.0234569503199, 25.0264568554933,
+        25.0294567606893, 25.0324566659082, 25.0354565711497, 25.038456476414,
+        25.041456381701, 25.0444562870107, 25.0474561923431, 25.0504560976982,
+        25.053456003076, 25.0564559084765, 25.0594558138996, 25.0624557193454,
+        25.0654556248139, 25.068455530305, 25.0714554358187, 25.074455341355,
+        25.077455246914, 25.0804551524956, 25.0834550580998, 25.0864549637266,
+        25.089454869376, 25.0924547750479, 25.0954546807424, 25.0984545864595,
+        25.1014544921992, 25.1044543979614, 25.1074543037461, 25.1104542095533,
+        25.1134541153831, 25.1164540212354, 25.1194539271102, 25.1224538330075,
+        25.1254537389273, 25.1284536448696, 25.1314535508343, 25.1344534568215,
+        25.1374533628312, 25.1404532688633, 25.1434531749179, 25.1464530809949,
+        25.1494529870943, 25.1524528932162, 25.1554527993604, 25.1584527055271,
+        25.1614526117161, 25.1644525179275, 25.1674524241614, 25.1704523304175,
+        25.1734522366961, 25.176452142997, 25.1794520493202, 25.1824519556658,
+        25.1854518620337, 25.1884517684239, 25.1914516748365, 25.1944515812713,
+        25.1974514877285, 25.2004513942079, 25.2034513007096, 25.2064512072336,
+        25.2094511137799, 25.2124510203484, 25.2154509269392, 25.2184508335522,
+        25.2214507401874, 25.2244506468449, 25.2274505535246, 25.2304504602265,
+        25.2334503669506, 25.2364502736969, 25.2394501804654, 25.242450087256,
+        25.2454499940689, 25.2484499009039, 25.251449807761, 25.2544497146403,
+        25.2574496215417, 25.2604495284653, 25.263449435411, 25.2664493423788,
+        25.2694492493687, 25.2724491563807, 25.2754490634148, 25.278448970471,
+        25.2814488775493, 25.2844487846496, 25.287448691772, 25.2904485989165,
+        25.293448506083, 25.2964484132715, 25.2994483204821, 25.3024482277146,
+        25.3054481349692, 25.3084480422458, 25.3114479495444, 25.314447856865,
+        25.3174477642076, 25.3204476715721, 25.3234475789586, 25.3264474863671,
+        25.3294473937975, 25.3324473012499, 25.3354472087242, 25.3384471162204,
+        25.3414470237386, 25.3444469312786, 25.3474468388406, 25.3504467464244,
+        25.3534466540302, 25.3564465616578, 25.3594464693073, 25.3624463769787,
+        25.3654462846719, 25.368446192387, 25.3714461001239, 25.3744460078826,
+        25.3774459156632, 25.3804458234656, 25.3834457312898, 25.3864456391358,
+        25.3894455470036, 25.3924454548932, 25.3954453628045, 25.3984452707377,
+        25.4014451786926, 25.4044450866693, 25.4074449946677, 25.4104449026878,
+        25.4134448107297, 25.4164447187933, 25.4194446268787, 25.4224445349857,
+        25.4254444431144, 25.4284443512649, 25.431444259437, 25.4344441676308,
+        25.4374440758463, 25.4404439840834, 25.4434438923422, 25.4464438006227,
+        25.4494437089248, 25.4524436172485, 25.4554435255939, 25.4584434339608,
+        25.4614433423494, 25.4644432507596, 25.4674431591914, 25.4704430676448,
+        25.4734429761197, 25.4764428846162, 25.4794427931343, 25.482442701674,
+        25.4854426102352, 25.4884425188179, 25.4914424274222, 25.494442336048,
+        25.4974422446953, 25.5004421533641, 25.5034420620544, 25.5064419707663,
+        25.5094418794996, 25.5124417882544, 25.5154416970307, 25.5184416058284,
+        25.5214415146476, 25.5244414234883, 25.5274413323504, 25.5304412412339,
+        25.5334411501388, 25.5364410590652, 25.539440968013, 25.5424408769822,
+        25.5454407859728, 25.5484406949848, 25.5514406040182, 25.5544405130729,
+        25.557440422149, 25.5604403312465, 25.5634402403653, 25.5664401495055,
+        25.569440058667, 25.5724399678499, 25.575439877054, 25.5784397862795,
+        25.5814396955263, 25.5844396047944, 25.5874395140838, 25.5904394233945,
+        25.5934393327264, 25.5964392420796, 25.5994391514541, 25.6024390608498,
+        25.6054389702668, 25.608438879705, 25.6114387891645, 25.6144386986452,
+        25.6174386081471, 25.6204385176702, 25.6234384272145, 25.62643833678,
+        25.6294382463667, 25.6324381559746, 25.6354380656037, 25.6384379752539,
+        25.6414378849253, 25.6444377946178, 25.6474377043315, 25.6504376140663,
+        25.6534375238222, 25.6564374335993, 25.6594373433974, 25.6624372532167,
+        25.6654371630571, 25.6684370729186, 25.6714369828011, 25.6744368927048,
+        25.6774368026295, 25.6804367125752, 25.6834366225421, 25.6864365325299,
+        25.6894364425388, 25.6924363525688, 25.6954362626198, 25.6984361726917,
+        25.7014360827847, 25.7044359928987, 25.7074359030337, 25.7104358131897,
+        25.7134357233667, 25.7164356335646, 25.7194355437835, 25.7224354540234,
+        25.7254353642842, 25.728435274566, 25.7314351848687, 25.7344350951923,
+        25.7374350055369, 25.7404349159023, 25.7434348262887, 25.746434736696,
+        25.7494346471241, 25.7524345575732, 25.7554344680431, 25.7584343785339,
+        25.7614342890456, 25.7644341995781, 25.7674341101315, 25.7704340207057,
+        25.7734339313008, 25.7764338419167, 25.7794337525534, 25.7824336632109,
+        25.7854335738892, 25.7884334845883, 25.7914333953082, 25.7944333060489,
+        25.7974332168104, 25.8004331275926, 25.8034330383956, 25.8064329492194,
+        25.8094328600639, 25.8124327709291, 25.8154326818151, 25.8184325927218,
+        25.8214325036492, 25.8244324145974, 25.8274323255662, 25.8304322365558,
+        25.833432147566, 25.8364320585969, 25.8394319696485, 25.8424318807207,
+        25.8454317918136, 25.8484317029272, 25.8514316140614, 25.8544315252163,
+        25.8574314363918, 25.8604313475879, 25.8634312588046, 25.866431170042,
+        25.8694310812999, 25.8724309925785, 25.8754309038776, 25.8784308151973,
+        25.8814307265376, 25.8844306378984, 25.8874305492799, 25.8904304606818,
+        25.8934303721044, 25.8964302835474, 25.899430195011, 25.9024301064951,
+        25.9054300179997, 25.9084299295249, 25.9114298410705, 25.9144297526367,
+        25.9174296642233, 25.9204295758304, 25.923429487458, 25.9264293991061,
+        25.9294293107746, 25.9324292224636, 25.935429134173, 25.9384290459028,
+        25.9414289576531, 25.9444288694239, 25.947428781215, 25.9504286930265,
+        25.9534286048585, 25.9564285167108, 25.9594284285836, 25.9624283404767,
+        25.9654282523902, 25.968428164324, 25.9714280762783, 25.9744279882529,
+        25.9774279002478, 25.9804278122631, 25.9834277242987, 25.9864276363546,
+        25.9894275484308, 25.9924274605274, 25.9954273726443, 25.9984272847814,
+        26.0014271969389, 26.0044271091166, 26.0074270213146, 26.0104269335329,
+        26.0134268457715, 26.0164267580303, 26.0194266703093, 26.0224265826086,
+        26.0254264949282, 26.0284264072679, 26.0314263196279, 26.0344262320081,
+        26.0374261444085, 26.0404260568291, 26.0434259692699, 26.0464258817309,
+        26.0494257942121, 26.0524257067134, 26.0554256192349, 26.0584255317766,
+        26.0614254443384, 26.0644253569203, 26.0674252695224, 26.0704251821446,
+        26.073425094787, 26.0764250074494, 26.079424920132, 26.0824248328347,
+        26.0854247455574, 26.0884246583003, 26.0914245710632, 26.0944244838463,
+        26.0974243966493, 26.1004243094725, 26.1034242223157, 26.1064241351789,
+        26.1094240480622, 26.1124239609655, 26.1154238738889, 26.1184237868322,
+        26.1214236997956, 26.124423612779, 26.1274235257824, 26.1304234388058,
+        26.1334233518491, 26.1364232649125, 26.1394231779958, 26.142423091099,
+        26.1454230042223, 26.1484229173655, 26.1514228305286, 26.1544227437116,
+        26.1574226569146, 26.1604225701376, 26.1634224833804, 26.1664223966431,
+        26.1694223099258, 26.1724222232283, 26.1754221365507, 26.1784220498931,
+        26.1814219632552, 26.1844218766373, 26.1874217900392, 26.190421703461,
+        26.1934216169026, 26.1964215303641, 26.1994214438454, 26.2024213573465,
+        26.2054212708674, 26.2084211844082, 26.2114210979688, 26.2144210115491,
+        26.2174209251493, 26.2204208387692, 26.2234207524089, 26.2264206660684,
+        26.2294205797477, 26.2324204934467, 26.2354204071655, 26.238420320904,
+        26.2414202346623, 26.2444201484403, 26.247420062238, 26.2504199760554,
+        26.2534198898926, 26.2564198037494, 26.259419717626, 26.2624196315222,
+        26.2654195454382, 26.2684194593738, 26.2714193733291, 26.274419287304,
+        26.2774192012986, 26.2804191153129, 26.2834190293468, 26.2864189434003,
+        26.2894188574735, 26.2924187715663, 26.2954186856787, 26.2984185998107,
+        26.3014185139623, 26.3044184281336, 26.3074183423244, 26.3104182565348,
+        26.3134181707647, 26.3164180850143, 26.3194179992834, 26.3224179135721,
+        26.3254178278803, 26.3284177422081, 26.3314176565554, 26.3344175709222,
+        26.3374174853085, 26.3404173997144, 26.3434173141398, 26.3464172285847,
+        26.3494171430491, 26.3524170575329, 26.3554169720363, 26.3584168865591,
+        26.3614168011014, 26.3644167156632, 26.3674166302444, 26.3704165448451,
+        26.3734164594652, 26.3764163741048, 26.3794162887638, 26.3824162034422,
+        26.38541611814, 26.3884160328573, 26.3914159475939, 26.39441586235,
+        26.3974157771254, 26.4004156919202, 26.4034156067344, 26.406415521568,
+        26.4094154364209, 26.4124153512932, 26.4154152661849, 26.4184151810959,
+        26.4214150960262, 26.4244150109759, 26.4274149259448, 26.4304148409331,
+        26.4334147559407, 26.4364146709677, 26.4394145860139, 26.4424145010794,
+        26.4454144161642, 26.4484143312683, 26.4514142463916, 26.4544141615342,
+        26.4574140766961, 26.4604139918772, 26.4634139070776, 26.4664138222972,
+        26.469413737536, 26.4724136527941, 26.4754135680714, 26.4784134833679,
+        26.4814133986836, 26.4844133140185, 26.4874132293726, 26.4904131447459,
+        26.4934130601384, 26.49641297555, 26.4994128909809, 26.5024128064308,
+        26.5054127219, 26.5084126373882, 26.5114125528957, 26.5144124684222,
+        26.5174123839679, 26.5204122995327, 26.5234122151166, 26.5264121307197,
+        26.5294120463418, 26.532411961983, 26.5354118776433, 26.5384117933227,
+        26.5414117090212, 26.5444116247388, 26.5474115404754, 26.5504114562311,
+        26.5534113720058, 26.5564112877996, 26.5594112036124, 26.5624111194442,
+        26.5654110352951, 26.568410951165, 26.5714108670538, 26.5744107829617,
+        26.5774106988886, 26.5804106148345, 26.5834105307994, 26.5864104467833,
+        26.5894103627861, 26.5924102788079, 26.5954101948487, 26.5984101109084,
+        26.601410026987, 26.6044099430846, 26.6074098592012, 26.6104097753367,
+        26.613409691491, 26.6164096076644, 26.6194095238566, 26.6224094400677,
+        26.6254093562977, 26.6284092725466, 26.6314091888144, 26.6344091051011,
+        26.6374090214066, 26.640408937731, 26.6434088540743, 26.6464087704364,
+        26.6494086868174, 26.6524086032172, 26.6554085196358, 26.6584084360732,
+        26.6614083525295, 26.6644082690046, 26.6674081854985, 26.6704081020112,
+        26.6734080185427, 26.676407935093, 26.6794078516621, 26.6824077682499,
+        26.6854076848565, 26.6884076014819, 26.691407518126, 26.6944074347889,
+        26.6974073514705, 26.7004072681709, 26.70340718489, 26.7064071016278,
+        26.7094070183844, 26.7124069351596, 26.7154068519536, 26.7184067687662,
+        26.7214066855976, 26.7244066024476, 26.7274065193164, 26.7304064362037,
+        26.7334063531098, 26.7364062700345, 26.7394061869779, 26.74240610394,
+        26.7454060209206, 26.7484059379199, 26.7514058549379, 26.7544057719745,
+        26.7574056890296, 26.7604056061034, 26.7634055231958, 26.7664054403068,
+        26.7694053574364, 26.7724052745846, 26.7754051917514, 26.7784051089367,
+        26.7814050261406, 26.7844049433631, 26.7874048606041, 26.7904047778637,
+        26.7934046951418, 26.7964046124385, 26.7994045297537, 26.8024044470874,
+        26.8054043644396, 26.8084042818103, 26.8114041991996, 26.8144041166073,
+        26.8174040340336, 26.8204039514783, 26.8234038689415, 26.8264037864232,
+        26.8294037039233, 26.8324036214419, 26.835403538979, 26.8384034565345,
+        26.8414033741085, 26.8444032917009, 26.8474032093117, 26.850403126941,
+        26.8534030445887, 26.8564029622548, 26.8594028799393, 26.8624027976422,
+        26.8654027153634, 26.8684026331031, 26.8714025508612, 26.8744024686376,
+        26.8774023864324, 26.8804023042456, 26.8834022220771, 26.886402139927,
+        26.8894020577952, 26.8924019756818, 26.8954018935867, 26.8984018115099,
+        26.9014017294515, 26.9044016474113, 26.9074015653895, 26.910401483386,
+        26.9134014014007, 26.9164013194338, 26.9194012374851, 26.9224011555547,
+        26.9254010736426, 26.9284009917488, 26.9314009098732, 26.9344008280159,
+        26.9374007461768, 26.9404006643559, 26.9434005825533, 26.946400500769,
+        26.9494004190028, 26.9524003372549, 26.9554002555251, 26.9584001738136,
+        26.9614000921203, 26.9644000104451, 26.9673999287882, 26.9703998471494,
+        26.9733997655288, 26.9763996839264, 26.9793996023421, 26.982399520776,
+        26.9853994392281, 26.9883993576983, 26.9913992761866, 26.994399194693,
+        26.9973991132176, 27.0003990317603, 27.0033989503211, 27.0063988689001,
+        27.0093987874971, 27.0123987061122, 27.0153986247454, 27.0183985433967,
+        27.0213984620661, 27.0243983807535, 27.027398299459, 27.0303982181826,
+        27.0333981369242, 27.0363980556839, 27.0393979744616, 27.0423978932573,
+        27.0453978120711, 27.0483977309029, 27.0513976497527, 27.0543975686205,
+        27.0573974875064, 27.0603974064102, 27.063397325332, 27.0663972442718,
+        27.0693971632296, 27.0723970822054, 27.0753970011991, 27.0783969202108,
+        27.0813968392405, 27.0843967582881, 27.0873966773537, 27.0903965964372,
+        27.0933965155386, 27.0963964346579, 27.0993963537952, 27.1023962729504,
+        27.1053961921235, 27.1083961113145, 27.1113960305234, 27.1143959497502,
+        27.1173958689949, 27.1203957882575, 27.1233957075379, 27.1263956268362,
+        27.1293955461524, 27.1323954654864, 27.1353953848383, 27.138395304208,
+        27.1413952235955, 27.1443951430009, 27.1473950624241, 27.1503949818652,
+        27.153394901324, 27.1563948208007, 27.1593947402952, 27.1623946598074,
+        27.1653945793375, 27.1683944988853, 27.1713944184509, 27.1743943380343,
+        27.1773942576355, 27.1803941772544, 27.1833940968911, 27.1863940165455,
+        27.1893939362177, 27.1923938559076, 27.1953937756152, 27.1983936953406,
+        27.2013936150837, 27.2043935348445, 27.207393454623, 27.2103933744192,
+        27.2133932942331, 27.2163932140647, 27.219393133914, 27.222393053781,
+        27.2253929736656, 27.2283928935679, 27.2313928134879, 27.2343927334255,
+        27.2373926533808, 27.2403925733537, 27.2433924933443, 27.2463924133525,
+        27.2493923333783, 27.2523922534218, 27.2553921734828, 27.2583920935615,
+        27.2613920136578, 27.2643919337716, 27.2673918539031, 27.2703917740521,
+        27.2733916942188, 27.276391614403, 27.2793915346048, 27.2823914548241,
+        27.285391375061, 27.2883912953154, 27.2913912155874, 27.294391135877,
+        27.297391056184, 27.3003909765086, 27.3033908968507, 27.3063908172104,
+        27.3093907375875, 27.3123906579822, 27.3153905783943, 27.318390498824,
+        27.3213904192711, 27.3243903397357, 27.3273902602178, 27.3303901807174,
+        27.3333901012344, 27.3363900217689, 27.3393899423208, 27.3423898628902,
+        27.345389783477, 27.3483897040813, 27.351389624703, 27.3543895453421,
+        27.3573894659987, 27.3603893866726, 27.363389307364, 27.3663892280727,
+        27.3693891487989, 27.3723890695424, 27.3753889903034, 27.3783889110817,
+        27.3813888318774, 27.3843887526904, 27.3873886735208, 27.3903885943686,
+        27.3933885152337, 27.3963884361162, 27.399388357016, 27.4023882779331,
+        27.4053881988676, 27.4083881198194, 27.4113880407885, 27.4143879617749,
+        27.4173878827786, 27.4203878037997, 27.423387724838, 27.4263876458936,
+        27.4293875669664, 27.4323874880566, 27.435387409164, 27.4383873302887,
+        27.4413872514307, 27.4443871725899, 27.4473870937663, 27.45038701496,
+        27.453386936171, 27.4563868573991, 27.4593867786445, 27.4623866999071,
+        27.465386621187, 27.468386542484, 27.4713864637982, 27.4743863851297,
+        27.4773863064783, 27.4803862278441, 27.4833861492271, 27.4863860706273,
+        27.4893859920446, 27.4923859134791, 27.4953858349308, 27.4983857563996,
+        27.5013856778855, 27.5043855993886, 27.5073855209089, 27.5103854424462,
+        27.5133853640007, 27.5163852855723, 27.519385207161, 27.5223851287669,
+        27.5253850503898, 27.5283849720298, 27.5313848936869, 27.5343848153611,
+        27.5373847370524, 27.5403846587608, 27.5433845804862, 27.5463845022287,
+        27.5493844239882, 27.5523843457648, 27.5553842675584, 27.5583841893691,
+        27.5613841111968, 27.5643840330416, 27.5673839549033, 27.5703838767821,
+        27.5733837986779, 27.5763837205907, 27.5793836425205, 27.5823835644673,
+        27.5853834864311, 27.5883834084119, 27.5913833304096, 27.5943832524244,
+        27.5973831744561, 27.6003830965047, 27.6033830185704, 27.6063829406529,
+        27.6093828627524, 27.6123827848689, 27.6153827070023, 27.6183826291526,
+        27.6213825513198, 27.624382473504, 27.6273823957051, 27.6303823179231,
+        27.6333822401579, 27.6363821624097, 27.6393820846784, 27.642382006964,
+        27.6453819292664, 27.6483818515857, 27.6513817739219, 27.6543816962749,
+        27.6573816186448, 27.6603815410316, 27.6633814634352, 27.6663813858556,
+        27.6693813082929, 27.672381230747, 27.6753811532179, 27.6783810757057,
+        27.6813809982103, 27.6843809207316, 27.6873808432698, 27.6903807658248,
+        27.6933806883966, 27.6963806109851, 27.6993805335905, 27.7023804562126,
+        27.7053803788515, 27.7083803015071, 27.7113802241795, 27.7143801468687,
+        27.7173800695746, 27.7203799922972, 27.7233799150366, 27.7263798377928,
+        27.7293797605656, 27.7323796833552, 27.7353796061615, 27.7383795289845,
+        27.7413794518242, 27.7443793746806, 27.7473792975537, 27.7503792204434,
+        27.7533791433499, 27.7563790662731, 27.7593789892129, 27.7623789121694,
+        27.7653788351425, 27.7683787581323, 27.7713786811388, 27.7743786041619,
+        27.7773785272016, 27.780378450258, 27.783378373331, 27.7863782964206,
+        27.7893782195269, 27.7923781426497, 27.7953780657892, 27.7983779889453,
+        27.801377912118, 27.8043778353072, 27.8073777585131, 27.8103776817355,
+        27.8133776049745, 27.8163775282301, 27.8193774515022, 27.8223773747909,
+        27.8253772980962, 27.828377221418, 27.8313771447563, 27.8343770681112,
+        27.8373769914826, 27.8403769148706, 27.843376838275, 27.846376761696,
+        27.8493766851335, 27.8523766085875, 27.855376532058, 27.858376455545,
+        27.8613763790485, 27.8643763025685, 27.8673762261049, 27.8703761496578,
+        27.8733760732272, 27.8763759968131, 27.8793759204154, 27.8823758440342,
+        27.8853757676694, 27.888375691321, 27.8913756149891, 27.8943755386736,
+        27.8973754623746, 27.900375386092, 27.9033753098258, 27.906375233576,
+        27.9093751573426, 27.9123750811256, 27.915375004925, 27.9183749287407,
+        27.9213748525729, 27.9243747764215, 27.9273747002864, 27.9303746241677,
+        27.9333745480653, 27.9363744719793, 27.9393743959097, 27.9423743198564,
+        27.9453742438195, 27.9483741677989, 27.9513740917946, 27.9543740158066,
+        27.957373939835, 27.9603738638797, 27.9633737879407, 27.966373712018,
+        27.9693736361115, 27.9723735602214, 27.9753734843476, 27.9783734084901,
+        27.9813733326488, 27.9843732568238, 27.9873731810151, 27.9903731052227,
+        27.9933730294465, 27.9963729536865, 27.9993728779428, 28.0023728022154,
+        28.0053727265042, 28.0083726508092, 28.0113725751304, 28.0143724994679,
+        28.0173724238215, 28.0203723481914, 28.0233722725775, 28.0263721969798,
+        28.0293721213983, 28.032372045833, 28.0353719702838, 28.0383718947509,
+        28.0413718192341, 28.0443717437335, 28.047371668249, 28.0503715927808,
+        28.0533715173286, 28.0563714418926, 28.0593713664728, 28.0623712910691,
+        28.0653712156815, 28.06837114031, 28.0713710649547, 28.0743709896155,
+        28.0773709142924, 28.0803708389854, 28.0833707636945, 28.0863706884197,
+        28.089370613161, 28.0923705379184, 28.0953704626919, 28.0983703874814,
+        28.1013703122871, 28.1043702371087, 28.1073701619465, 28.1103700868003,
+        28.1133700116701, 28.116369936556, 28.1193698614579, 28.1223697863759,
+        28.1253697113099, 28.1283696362599, 28.131369561226, 28.134369486208,
+        28.1373694112061, 28.1403693362201, 28.1433692612502, 28.1463691862963,
+        28.1493691113583, 28.1523690364364, 28.1553689615304, 28.1583688866403,
+        28.1613688117663, 28.1643687369082, 28.1673686620661, 28.1703685872399,
+        28.1733685124297, 28.1763684376354, 28.1793683628571, 28.1823682880946,
+        28.1853682133482, 28.1883681386176, 28.191368063903, 28.1943679892042,
+        28.1973679145214, 28.2003678398545, 28.2033677652034, 28.2063676905683,
+        28.2093676159491, 28.2123675413457, 28.2153674667582, 28.2183673921866,
+        28.2213673176308, 28.2243672430909, 28.2273671685669, 28.2303670940587,
+        28.2333670195664, 28.2363669450899, 28.2393668706292, 28.2423667961844,
+        28.2453667217554, 28.2483666473422, 28.2513665729449, 28.2543664985633,
+        28.2573664241975, 28.2603663498476, 28.2633662755135, 28.2663662011951,
+        28.2693661268925, 28.2723660526057, 28.2753659783347, 28.2783659040795,
+        28.28136582984, 28.2843657556163, 28.2873656814083, 28.2903656072161,
+        28.2933655330396, 28.2963654588789, 28.2993653847339, 28.3023653106046,
+        28.3053652364911, 28.3083651623933, 28.3113650883112, 28.3143650142448,
+        28.3173649401941, 28.3203648661591, 28.3233647921398, 28.3263647181362,
+        28.3293646441483, 28.3323645701761, 28.3353644962195, 28.3383644222786,
+        28.3413643483534, 28.3443642744439, 28.3473642005499, 28.3503641266717,
+        28.3533640528091, 28.3563639789621, 28.3593639051308, 28.3623638313151,
+        28.365363757515, 28.3683636837306, 28.3713636099617, 28.3743635362085,
+        28.3773634624709, 28.3803633887489, 28.3833633150425, 28.3863632413516,
+        28.3893631676764, 28.3923630940167, 28.3953630203726, 28.3983629467441,
+        28.4013628731312, 28.4043627995338, 28.4073627259519, 28.4103626523857,
+        28.4133625788349, 28.4163625052997, 28.4193624317801, 28.422362358276,
+        28.4253622847874, 28.4283622113143, 28.4313621378568, 28.4343620644147,
+        28.4373619909882, 28.4403619175772, 28.4433618441816, 28.4463617708016,
+        28.449361697437, 28.452361624088, 28.4553615507544, 28.4583614774362,
+        28.4613614041336, 28.4643613308464, 28.4673612575747, 28.4703611843184,
+        28.4733611110776, 28.4763610378522, 28.4793609646422, 28.4823608914477,
+        28.4853608182686, 28.488360745105, 28.4913606719568, 28.4943605988239,
+        28.4973605257065, 28.5003604526045, 28.5033603795179, 28.5063603064467,
+        28.5093602333909, 28.5123601603504, 28.5153600873254, 28.5183600143157,
+        28.5213599413214, 28.5243598683424, 28.5273597953788, 28.5303597224306,
+        28.5333596494977, 28.5363595765802, 28.539359503678, 28.5423594307912,
+        28.5453593579196, 28.5483592850635, 28.5513592122226, 28.554359139397,
+        28.5573590665868, 28.5603589937919, 28.5633589210122, 28.5663588482479,
+        28.5693587754989, 28.5723587027651, 28.5753586300466, 28.5783585573435,
+        28.5813584846555, 28.5843584119829, 28.5873583393255, 28.5903582666834,
+        28.5933581940565, 28.5963581214449, 28.5993580488485, 28.6023579762674,
+        28.6053579037015, 28.6083578311509, 28.6113577586154, 28.6143576860952,
+        28.6173576135902, 28.6203575411004, 28.6233574686258, 28.6263573961665,
+        28.6293573237223, 28.6323572512933, 28.6353571788795, 28.6383571064809,
+        28.6413570340974, 28.6443569617292, 28.6473568893761, 28.6503568170381,
+        28.6533567447154, 28.6563566724077, 28.6593566001153, 28.662356527838,
+        28.6653564555758, 28.6683563833287, 28.6713563110968, 28.67435623888,
+        28.6773561666783, 28.6803560944918, 28.6833560223203, 28.686355950164,
+        28.6893558780228, 28.6923558058966, 28.6953557337856, 28.6983556616896,
+        28.7013555896087, 28.7043555175429, 28.7073554454922, 28.7103553734566,
+        28.713355301436, 28.7163552294304, 28.71935515744, 28.7223550854645,
+        28.7253550135042, 28.7283549415588, 28.7313548696285, 28.7343547977132,
+        28.737354725813, 28.7403546539278, 28.7433545820576, 28.7463545102024,
+        28.7493544383622, 28.752354366537, 28.7553542947268, 28.7583542229316,
+        28.7613541511514, 28.7643540793862, 28.767354007636, 28.7703539359007,
+        28.7733538641804, 28.7763537924751, 28.7793537207847, 28.7823536491093,
+        28.7853535774488, 28.7883535058033, 28.7913534341728, 28.7943533625571,
+        28.7973532909564, 28.8003532193706, 28.8033531477998, 28.8063530762439,
+        28.8093530047028, 28.8123529331767, 28.8153528616655, 28.8183527901692,
+        28.8213527186878, 28.8243526472213, 28.8273525757697, 28.8303525043329,
+        28.833352432911, 28.836352361504, 28.8393522901119, 28.8423522187346,
+        28.8453521473722, 28.8483520760247, 28.851352004692, 28.8543519333741,
+        28.8573518620711, 28.8603517907829, 28.8633517195095, 28.866351648251,
+        28.8693515770073, 28.8723515057784, 28.8753514345643, 28.878351363365,
+        28.8813512921805, 28.8843512210108, 28.887351149856, 28.8903510787159,
+        28.8933510075906, 28.89635093648, 28.8993508653843, 28.9023507943033,
+        28.9053507232371, 28.9083506521856, 28.9113505811489, 28.914350510127,
+        28.9173504391197, 28.9203503681273, 28.9233502971496, 28.9263502261866,
+        28.9293501552383, 28.9323500843048, 28.935350013386, 28.9383499424819,
+        28.9413498715925, 28.9443498007178, 28.9473497298578, 28.9503496590125,
+        28.9533495881819, 28.956349517366, 28.9593494465648, 28.9623493757783,
+        28.9653493050064, 28.9683492342492, 28.9713491635067, 28.9743490927788,
+        28.9773490220656, 28.980348951367, 28.9833488806831, 28.9863488100138,
+        28.9893487393592, 28.9923486687192, 28.9953485980938, 28.9983485274831,
+        29.0013484568869, 29.0043483863054, 29.0073483157385, 29.0103482451862,
+        29.0133481746485, 29.0163481041254, 29.0193480336169, 29.022347963123,
+        29.0253478926436, 29.0283478221789, 29.0313477517287, 29.0343476812931,
+        29.037347610872, 29.0403475404655, 29.0433474700736, 29.0463473996962,
+        29.0493473293334, 29.0523472589851, 29.0553471886513, 29.0583471183321,
+        29.0613470480274, 29.0643469777372, 29.0673469074616, 29.0703468372005,
+        29.0733467669538, 29.0763466967217, 29.0793466265041, 29.082346556301,
+        29.0853464861124, 29.0883464159382, 29.0913463457786, 29.0943462756334,
+        29.0973462055027, 29.1003461353865, 29.1033460652848, 29.1063459951975,
+        29.1093459251246, 29.1123458550662, 29.1153457850223, 29.1183457149928,
+        29.1213456449778, 29.1243455749771, 29.127345504991, 29.1303454350192,
+        29.1333453650619, 29.1363452951189, 29.1393452251904, 29.1423451552763,
+        29.1453450853766, 29.1483450154913, 29.1513449456204, 29.1543448757639,
+        29.1573448059218, 29.160344736094, 29.1633446662807, 29.1663445964817,
+        29.169344526697, 29.1723444569268, 29.1753443871709, 29.1783443174293,
+        29.1813442477021, 29.1843441779893, 29.1873441082908, 29.1903440386066,
+        29.1933439689368, 29.1963438992812, 29.19934382964, 29.2023437600132,
+        29.2053436904006, 29.2083436208024, 29.2113435512184, 29.2143434816488,
+        29.2173434120935, 29.2203433425524, 29.2233432730257, 29.2263432035132,
+        29.229343134015, 29.2323430645311, 29.2353429950614, 29.2383429256061,
+        29.2413428561649, 29.2443427867381, 29.2473427173255, 29.2503426479271,
+        29.253342578543, 29.2563425091731, 29.2593424398175, 29.2623423704761,
+        29.2653423011489, 29.268342231836, 29.2713421625372, 29.2743420932527,
+        29.2773420239824, 29.2803419547263, 29.2833418854844, 29.2863418162567,
+        29.2893417470432, 29.2923416778438, 29.2953416086587, 29.2983415394877,
+        29.3013414703309, 29.3043414011883, 29.3073413320599, 29.3103412629456,
+        29.3133411938454, 29.3163411247594, 29.3193410556876, 29.3223409866299,
+        29.3253409175864, 29.328340848557, 29.3313407795417, 29.3343407105405,
+        29.3373406415535, 29.3403405725806, 29.3433405036218, 29.3463404346771,
+        29.3493403657465, 29.35234029683, 29.3553402279276, 29.3583401590393,
+        29.3613400901651, 29.364340021305, 29.3673399524589, 29.370339883627,
+        29.3733398148091, 29.3763397460052, 29.3793396772155, 29.3823396084397,
+        29.3853395396781, 29.3883394709305, 29.3913394021969, 29.3943393334774,
+        29.3973392647719, 29.4003391960804, 29.403339127403, 29.4063390587396,
+        29.4093389900902, 29.4123389214548, 29.4153388528335, 29.4183387842261,
+        29.4213387156328, 29.4243386470534, 29.4273385784881, 29.4303385099367,
+        29.4333384413993, 29.4363383728759, 29.4393383043664, 29.442338235871,
+        29.4453381673895, 29.448338098922, 29.4513380304684, 29.4543379620288,
+        29.4573378936031, 29.4603378251914, 29.4633377567936, 29.4663376884098,
+        29.4693376200399, 29.4723375516839, 29.4753374833418, 29.4783374150137,
+        29.4813373466995, 29.4843372783992, 29.4873372101128, 29.4903371418403,
+        29.4933370735817, 29.496337005337, 29.4993369371062, 29.5023368688893,
+        29.5053368006863, 29.5083367324971, 29.5113366643218, 29.5143365961604,
+        29.5173365280129, 29.5203364598792, 29.5233363917594, 29.5263363236534,
+        29.5293362555613, 29.532336187483, 29.5353361194185, 29.5383360513679,
+        29.5413359833312, 29.5443359153082, 29.5473358472991, 29.5503357793038,
+        29.5533357113223, 29.5563356433546, 29.5593355754008, 29.5623355074607,
+        29.5653354395344, 29.5683353716219, 29.5713353037233, 29.5743352358384,
+        29.5773351679672, 29.5803351001099, 29.5833350322663, 29.5863349644365,
+        29.5893348966205, 29.5923348288182, 29.5953347610297, 29.5983346932549,
+        29.6013346254939, 29.6043345577466, 29.6073344900131, 29.6103344222933,
+        29.6133343545872, 29.6163342868949, 29.6193342192163, 29.6223341515514,
+        29.6253340839002, 29.6283340162627, 29.6313339486389, 29.6343338810289,
+        29.6373338134325, 29.6403337458498, 29.6433336782808, 29.6463336107255,
+        29.6493335431839, 29.6523334756559, 29.6553334081417, 29.6583333406411,
+        29.6613332731541, 29.6643332056809, 29.6673331382212, 29.6703330707753,
+        29.6733330033429, 29.6763329359243, 29.6793328685192, 29.6823328011278,
+        29.68533273375, 29.6883326663859, 29.6913325990354, 29.6943325316985,
+        29.6973324643752, 29.7003323970655, 29.7033323297694, 29.706332262487,
+        29.7093321952181, 29.7123321279628, 29.7153320607211, 29.718331993493,
+        29.7213319262785, 29.7243318590776, 29.7273317918902, 29.7303317247164,
+        29.7333316575562, 29.7363315904095, 29.7393315232764, 29.7423314561568,
+        29.7453313890508, 29.7483313219584, 29.7513312548794, 29.7543311878141,
+        29.7573311207622, 29.7603310537239, 29.7633309866991, 29.7663309196878,
+        29.76933085269, 29.7723307857058, 29.775330718735, 29.7783306517778,
+        29.781330584834, 29.7843305179038, 29.787330450987, 29.7903303840838,
+        29.793330317194, 29.7963302503177, 29.7993301834549, 29.8023301166055,
+        29.8053300497696, 29.8083299829472, 29.8113299161382, 29.8143298493427,
+        29.8173297825606, 29.820329715792, 29.8233296490369, 29.8263295822951,
+        29.8293295155668, 29.832329448852, 29.8353293821505, 29.8383293154625,
+        29.8413292487879, 29.8443291821267, 29.8473291154789, 29.8503290488446,
+        29.8533289822236, 29.856328915616, 29.8593288490219, 29.8623287824411,
+        29.8653287158737, 29.8683286493197, 29.871328582779, 29.8743285162518,
+        29.8773284497379, 29.8803283832374, 29.8833283167502, 29.8863282502764,
+        29.8893281838159, 29.8923281173688, 29.8953280509351, 29.8983279845147,
+        29.9013279181076, 29.9043278517138, 29.9073277853334, 29.9103277189663,
+        29.9133276526126, 29.9163275862721, 29.919327519945, 29.9223274536312,
+        29.9253273873307, 29.9283273210434, 29.9313272547695, 29.9343271885089,
+        29.9373271222616, 29.9403270560275, 29.9433269898067, 29.9463269235993,
+        29.949326857405, 29.9523267912241, 29.9553267250564, 29.958326658902,
+        29.9613265927608, 29.9643265266329, 29.9673264605183, 29.9703263944169,
+        29.9733263283287, 29.9763262622538, 29.9793261961921, 29.9823261301436,
+        29.9853260641084, 29.9883259980863, 29.9913259320775, 29.994325866082,
+        29.9973258000996, 30.0003257341304, 30.0033256681744, 30.0063256022317,
+        30.0093255363021, 30.0123254703857, 30.0153254044825, 30.0183253385925,
+        30.0213252727157, 30.024325206852, 30.0273251410015, 30.0303250751642,
+        30.03332500934, 30.036324943529, 30.0393248777312, 30.0423248119465,
+        30.0453247461749, 30.0483246804165, 30.0513246146712, 30.0543245489391,
+        30.0573244832201, 30.0603244175142, 30.0633243518215, 30.0663242861418,
+        30.0693242204753, 30.0723241548219, 30.0753240891816, 30.0783240235544,
+        30.0813239579403, 30.0843238923393, 30.0873238267514, 30.0903237611766,
+        30.0933236956148, 30.0963236300662, 30.0993235645306, 30.1023234990081,
+        30.1053234334986, 30.1083233680023, 30.111323302519, 30.1143232370487,
+        30.1173231715915, 30.1203231061473, 30.1233230407162, 30.1263229752982,
+        30.1293229098931, 30.1323228445011, 30.1353227791221, 30.1383227137562,
+        30.1413226484033, 30.1443225830634, 30.1473225177365, 30.1503224524226,
+        30.1533223871217, 30.1563223218338, 30.159322256559, 30.1623221912971,
+        30.1653221260482, 30.1683220608123, 30.1713219955894, 30.1743219303794,
+        30.1773218651825, 30.1803217999985, 30.1833217348274, 30.1863216696694,
+        30.1893216045243, 30.1923215393921, 30.1953214742729, 30.1983214091667,
+        30.2013213440734, 30.204321278993, 30.2073212139256, 30.2103211488711,
+        30.2133210838295, 30.2163210188008, 30.2193209537851, 30.2223208887823,
+        30.2253208237924, 30.2283207588154, 30.2313206938514, 30.2343206289002,
+        30.2373205639619, 30.2403204990365, 30.243320434124, 30.2463203692244,
+        30.2493203043377, 30.2523202394638, 30.2553201746029, 30.2583201097548,
+        30.2613200449195, 30.2643199800972, 30.2673199152876, 30.270319850491,
+        30.2733197857072, 30.2763197209362, 30.2793196561781, 30.2823195914329,
+        30.2853195267004, 30.2883194619808, 30.291319397274, 30.2943193325801,
+        30.297319267899, 30.3003192032307, 30.3033191385752, 30.3063190739325,
+        30.3093190093026, 30.3123189446855, 30.3153188800812, 30.3183188154898,
+        30.3213187509111, 30.3243186863452, 30.327318621792, 30.3303185572517,
+        30.3333184927241, 30.3363184282093, 30.3393183637073, 30.342318299218,
+        30.3453182347415, 30.3483181702778, 30.3513181058268, 30.3543180413886,
+        30.3573179769631, 30.3603179125503, 30.3633178481503, 30.366317783763,
+        30.3693177193884, 30.3723176550266, 30.3753175906775, 30.3783175263411,
+        30.3813174620174, 30.3843173977065, 30.3873173334082, 30.3903172691227,
+        30.3933172048498, 30.3963171405897, 30.3993170763422, 30.4023170121075,
+        30.4053169478854, 30.408316883676, 30.4113168194792, 30.4143167552952,
+        30.4173166911238, 30.4203166269651, 30.423316562819, 30.4263164986856,
+        30.4293164345649, 30.4323163704568, 30.4353163063614, 30.4383162422786,
+        30.4413161782084, 30.4443161141509, 30.447316050106, 30.4503159860738,
+        30.4533159220541, 30.4563158580471, 30.4593157940527, 30.4623157300709,
+        30.4653156661018, 30.4683156021452, 30.4713155382012, 30.4743154742699,
+        30.4773154103511, 30.4803153464449, 30.4833152825513, 30.4863152186703,
+        30.4893151548019, 30.4923150909461, 30.4953150271028, 30.4983149632721,
+        30.501314899454, 30.5043148356484, 30.5073147718554, 30.5103147080749,
+        30.513314644307, 30.5163145805516, 30.5193145168088, 30.5223144530785,
+        30.5253143893608, 30.5283143256556, 30.5313142619629, 30.5343141982827,
+        30.5373141346151, 30.5403140709599, 30.5433140073173, 30.5463139436872,
+        30.5493138800696, 30.5523138164646, 30.555313752872, 30.5583136892919,
+        30.5613136257243, 30.5643135621692, 30.5673134986265, 30.5703134350964,
+        30.5733133715787, 30.5763133080735, 30.5793132445808, 30.5823131811005,
+        30.5853131176327, 30.5883130541774, 30.5913129907345, 30.594312927304,
+        30.597312863886, 30.6003128004805, 30.6033127370874, 30.6063126737067,
+        30.6093126103385, 30.6123125469827, 30.6153124836393, 30.6183124203083,
+        30.6213123569898, 30.6243122936837, 30.62731223039, 30.6303121671086,
+        30.6333121038397, 30.6363120405832, 30.6393119773391, 30.6423119141074,
+        30.6453118508881, 30.6483117876812, 30.6513117244866, 30.6543116613044,
+        30.6573115981346, 30.6603115349772, 30.6633114718321, 30.6663114086994,
+        30.6693113455791, 30.6723112824711, 30.6753112193754, 30.6783111562922,
+        30.6813110932212, 30.6843110301626, 30.6873109671164, 30.6903109040824,
+        30.6933108410608, 30.6963107780516, 30.6993107150546, 30.70231065207,
+        30.7053105890977, 30.7083105261377, 30.71131046319, 30.7143104002547,
+        30.7173103373316, 30.7203102744208, 30.7233102115223, 30.7263101486361,
+        30.7293100857622, 30.7323100229006, 30.7353099600513, 30.7383098972142,
+        30.7413098343894, 30.7443097715769, 30.7473097087767, 30.7503096459887,
+        30.753309583213, 30.7563095204495, 30.7593094576983, 30.7623093949593,
+        30.7653093322326, 30.7683092695181, 30.7713092068158, 30.7743091441258,
+        30.777309081448, 30.7803090187825, 30.7833089561291, 30.786308893488,
+        30.7893088308591, 30.7923087682424, 30.7953087056379, 30.7983086430457,
+        30.8013085804656, 30.8043085178977, 30.807308455342, 30.8103083927986,
+        30.8133083302673, 30.8163082677481, 30.8193082052412, 30.8223081427464,
+        30.8253080802639, 30.8283080177934, 30.8313079553352, 30.8343078928891,
+        30.8373078304552, 30.8403077680334, 30.8433077056238, 30.8463076432263,
+        30.849307580841, 30.8523075184678, 30.8553074561067, 30.8583073937578,
+        30.861307331421, 30.8643072690964, 30.8673072067838, 30.8703071444834,
+        30.8733070821951, 30.8763070199189, 30.8793069576549, 30.8823068954029,
+        30.885306833163, 30.8883067709353, 30.8913067087196, 30.894306646516,
+        30.8973065843245, 30.9003065221451, 30.9033064599778, 30.9063063978225,
+        30.9093063356794, 30.9123062735483, 30.9153062114292, 30.9183061493223,
+        30.9213060872273, 30.9243060251445, 30.9273059630737, 30.9303059010149,
+        30.9333058389682, 30.9363057769336, 30.9393057149109, 30.9423056529003,
+        30.9453055909018, 30.9483055289153, 30.9513054669407, 30.9543054049783,
+        30.9573053430278, 30.9603052810894, 30.9633052191629, 30.9663051572485,
+        30.9693050953461, 30.9723050334556, 30.9753049715772, 30.9783049097108,
+        30.9813048478563, 30.9843047860139, 30.9873047241834, 30.9903046623649,
+        30.9933046005584, 30.9963045387638, 30.9993044769812, 31.0023044152106,
+        31.005304353452, 31.0083042917053, 31.0113042299705, 31.0143041682478,
+        31.0173041065369, 31.020304044838, 31.0233039831511, 31.0263039214761,
+        31.029303859813, 31.0323037981619, 31.0353037365226, 31.0383036748953,
+        31.04130361328, 31.0443035516765, 31.047303490085, 31.0503034285053,
+        31.0533033669376, 31.0563033053818, 31.0593032438379, 31.0623031823058,
+        31.0653031207857, 31.0683030592775, 31.0713029977811, 31.0743029362966,
+        31.077302874824, 31.0803028133633, 31.0833027519145, 31.0863026904775,
+        31.0893026290524, 31.0923025676391, 31.0953025062378, 31.0983024448482,
+        31.1013023834705, 31.1043023221047, 31.1073022607507, 31.1103021994086,
+        31.1133021380783, 31.1163020767598, 31.1193020154531, 31.1223019541583,
+        31.1253018928753, 31.1283018316042, 31.1313017703448, 31.1343017090973,
+        31.1373016478615, 31.1403015866376, 31.1433015254255, 31.1463014642252,
+        31.1493014030367, 31.1523013418599, 31.155301280695, 31.1583012195418,
+        31.1613011584005, 31.1643010972709, 31.1673010361531, 31.170300975047,
+        31.1733009139528, 31.1763008528703, 31.1793007917995, 31.1823007307406,
+        31.1853006696933, 31.1883006086579, 31.1913005476341, 31.1943004866222,
+        31.1973004256219, 31.2003003646335, 31.2033003036567, 31.2063002426917,
+        31.2093001817384, 31.2123001207968, 31.215300059867, 31.2182999989488,
+        31.2212999380424, 31.2242998771477, 31.2272998162647, 31.2302997553935,
+        31.2332996945339, 31.236299633686, 31.2392995728498, 31.2422995120253,
+        31.2452994512125, 31.2482993904114, 31.2512993296219, 31.2542992688442,
+        31.2572992080781, 31.2602991473237, 31.2632990865809, 31.2662990258498,
+        31.2692989651304, 31.2722989044226, 31.2752988437265, 31.2782987830421,
+        31.2812987223693, 31.2842986617081, 31.2872986010586, 31.2902985404207,
+        31.2932984797945, 31.2962984191798, 31.2992983585768, 31.3022982979855,
+        31.3052982374057, 31.3082981768376, 31.3112981162811, 31.3142980557362,
+        31.3172979952029, 31.3202979346812, 31.3232978741711, 31.3262978136727,
+        31.3292977531858, 31.3322976927105, 31.3352976322468, 31.3382975717946,
+        31.3412975113541, 31.3442974509251, 31.3472973905077, 31.3502973301019,
+        31.3532972697076, 31.356297209325, 31.3592971489538, 31.3622970885943,
+        31.3652970282462, 31.3682969679098, 31.3712969075849, 31.3742968472715,
+        31.3772967869697, 31.3802967266794, 31.3832966664006, 31.3862966061334,
+        31.3892965458777, 31.3922964856335, 31.3952964254009, 31.3982963651798,
+        31.4012963049701, 31.404296244772, 31.4072961845855, 31.4102961244104,
+        31.4132960642468, 31.4162960040947, 31.4192959439541, 31.422295883825,
+        31.4252958237074, 31.4282957636013, 31.4312957035066, 31.4342956434234,
+        31.4372955833517, 31.4402955232915, 31.4432954632428, 31.4462954032055,
+        31.4492953431797, 31.4522952831653, 31.4552952231624, 31.458295163171,
+        31.4612951031909, 31.4642950432224, 31.4672949832653, 31.4702949233196,
+        31.4732948633854, 31.4762948034626, 31.4792947435512, 31.4822946836512,
+        31.4852946237627, 31.4882945638856, 31.4912945040199, 31.4942944441656,
+        31.4972943843228, 31.5002943244913, 31.5032942646712, 31.5062942048626,
+        31.5092941450653, 31.5122940852794, 31.515294025505, 31.5182939657419,
+        31.5212939059902, 31.5242938462499, 31.5272937865209, 31.5302937268033,
+        31.5332936670971, 31.5362936074023, 31.5392935477188, 31.5422934880467,
+        31.545293428386, 31.5482933687366, 31.5512933090985, 31.5542932494718,
+        31.5572931898565, 31.5602931302525, 31.5632930706598, 31.5662930110785,
+        31.5692929515085, 31.5722928919498, 31.5752928324024, 31.5782927728664,
+        31.5812927133417, 31.5842926538283, 31.5872925943262, 31.5902925348355,
+        31.593292475356, 31.5962924158879, 31.599292356431, 31.6022922969854,
+        31.6052922375512, 31.6082921781282, 31.6112921187165, 31.6142920593161,
+        31.617291999927, 31.6202919405491, 31.6232918811825, 31.6262918218272,
+        31.6292917624832, 31.6322917031504, 31.6352916438289, 31.6382915845187,
+        31.6412915252197, 31.6442914659319, 31.6472914066554, 31.6502913473902,
+        31.6532912881362, 31.6562912288934, 31.6592911696618, 31.6622911104415,
+        31.6652910512325, 31.6682909920346, 31.671290932848, 31.6742908736726,
+        31.6772908145084, 31.6802907553554, 31.6832906962136, 31.6862906370831,
+        31.6892905779637, 31.6922905188556, 31.6952904597586, 31.6982904006729,
+        31.7012903415983, 31.7042902825349, 31.7072902234827, 31.7102901644417,
+        31.7132901054118, 31.7162900463932, 31.7192899873857, 31.7222899283894,
+        31.7252898694042, 31.7282898104302, 31.7312897514674, 31.7342896925157,
+        31.7372896335752, 31.7402895746458, 31.7432895157276, 31.7462894568205,
+        31.7492893979245, 31.7522893390397, 31.755289280166, 31.7582892213035,
+        31.7612891624521, 31.7642891036118, 31.7672890447826, 31.7702889859646,
+        31.7732889271576, 31.7762888683618, 31.7792888095771, 31.7822887508035,
+        31.785288692041, 31.7882886332895, 31.7912885745492, 31.79428851582,
+        31.7972884571019, 31.8002883983948, 31.8032883396989, 31.806288281014,
+        31.8092882223402, 31.8122881636775, 31.8152881050258, 31.8182880463852,
+        31.8212879877557, 31.8242879291372, 31.8272878705298, 31.8302878119335,
+        31.8332877533482, 31.8362876947739, 31.8392876362107, 31.8422875776586,
+        31.8452875191175, 31.8482874605874, 31.8512874020683, 31.8542873435603,
+        31.8572872850633, 31.8602872265774, 31.8632871681024, 31.8662871096385,
+        31.8692870511856, 31.8722869927437, 31.8752869343128, 31.8782868758929,
+        31.881286817484, 31.8842867590861, 31.8872867006992, 31.8902866423233,
+        31.8932865839584, 31.8962865256045, 31.8992864672616, 31.9022864089296,
+        31.9052863506087, 31.9082862922987, 31.9112862339996, 31.9142861757116,
+        31.9172861174345, 31.9202860591683, 31.9232860009132, 31.9262859426689,
+        31.9292858844357, 31.9322858262134, 31.935285768002, 31.9382857098016,
+        31.9412856516121, 31.9442855934335, 31.9472855352659, 31.9502854771092,
+        31.9532854189635, 31.9562853608286, 31.9592853027047, 31.9622852445917,
+        31.9652851864897, 31.9682851283985, 31.9712850703183, 31.9742850122489,
+        31.9772849541905, 31.9802848961429, 31.9832848381063, 31.9862847800805,
+        31.9892847220657, 31.9922846640617, 31.9952846060686, 31.9982845480864,
+        32.0012844901151, 32.0042844321547, 32.0072843742051, 32.0102843162664,
+        32.0132842583385, 32.0162842004216, 32.0192841425155, 32.0222840846202,
+        32.0252840267358, 32.0282839688623, 32.0312839109996, 32.0342838531477,
+        32.0372837953067, 32.0402837374765, 32.0432836796572, 32.0462836218487,
+        32.049283564051, 32.0522835062642, 32.0552834484881, 32.0582833907229,
+        32.0612833329685, 32.064283275225, 32.0672832174922, 32.0702831597703,
+        32.0732831020591, 32.0762830443588, 32.0792829866693, 32.0822829289905,
+        32.0852828713226, 32.0882828136654, 32.091282756019, 32.0942826983835,
+        32.0972826407586, 32.1002825831446, 32.1032825255414, 32.1062824679489,
+        32.1092824103672, 32.1122823527962, 32.1152822952361, 32.1182822376867,
+        32.121282180148, 32.1242821226201, 32.1272820651029, 32.1302820075965,
+        32.1332819501009, 32.136281892616, 32.1392818351418, 32.1422817776783,
+        32.1452817202256, 32.1482816627837, 32.1512816053524, 32.1542815479319,
+        32.1572814905221, 32.160281433123, 32.1632813757346, 32.166281318357,
+        32.16928126099, 32.1722812036338, 32.1752811462882, 32.1782810889534,
+        32.1812810316292, 32.1842809743158, 32.187280917013, 32.190280859721,
+        32.1932808024396, 32.1962807451689, 32.1992806879089, 32.2022806306595,
+        32.2052805734209, 32.2082805161929, 32.2112804589755, 32.2142804017689,
+        32.2172803445728, 32.2202802873875, 32.2232802302128, 32.2262801730488,
+        32.2292801158954, 32.2322800587526, 32.2352800016205, 32.2382799444991,
+        32.2412798873883, 32.2442798302881, 32.2472797731985, 32.2502797161196,
+        32.2532796590513, 32.2562796019936, 32.2592795449466, 32.2622794879101,
+        32.2652794308843, 32.2682793738691, 32.2712793168645, 32.2742792598705,
+        32.2772792028871, 32.2802791459143, 32.2832790889521, 32.2862790320004,
+        32.2892789750594, 32.292278918129, 32.2952788612091, 32.2982788042999,
+        32.3012787474012, 32.3042786905131, 32.3072786336355, 32.3102785767686,
+        32.3132785199121, 32.3162784630663, 32.319278406231, 32.3222783494063,
+        32.3252782925921, 32.3282782357885, 32.3312781789955, 32.3342781222129,
+        32.337278065441, 32.3402780086795, 32.3432779519286, 32.3462778951883,
+        32.3492778384584, 32.3522777817391, 32.3552777250303, 32.3582776683321,
+        32.3612776116443, 32.3642775549671, 32.3672774983004, 32.3702774416442,
+        32.3732773849985, 32.3762773283634, 32.3792772717387, 32.3822772151245,
+        32.3852771585208, 32.3882771019276, 32.3912770453449, 32.3942769887727,
+        32.397276932211, 32.4002768756597, 32.403276819119, 32.4062767625887,
+        32.4092767060688, 32.4122766495595, 32.4152765930606, 32.4182765365722,
+        32.4212764800942, 32.4242764236267, 32.4272763671697, 32.4302763107231,
+        32.433276254287, 32.4362761978613, 32.439276141446, 32.4422760850412,
+        32.4452760286469, 32.4482759722629, 32.4512759158894, 32.4542758595264,
+        32.4572758031737, 32.4602757468315, 32.4632756904997, 32.4662756341783,
+        32.4692755778673, 32.4722755215668, 32.4752754652766, 32.4782754089969,
+        32.4812753527276, 32.4842752964686, 32.4872752402201, 32.4902751839819,
+        32.4932751277542, 32.4962750715368, 32.4992750153298, 32.5022749591333,
+        32.505274902947, 32.5082748467712, 32.5112747906057, 32.5142747344507,
+        32.5172746783059, 32.5202746221716, 32.5232745660476, 32.526274509934,
+        32.5292744538307, 32.5322743977378, 32.5352743416552, 32.538274285583,
+        32.5412742295211, 32.5442741734696, 32.5472741174284, 32.5502740613976,
+        32.553274005377, 32.5562739493669, 32.559273893367, 32.5622738373775,
+        32.5652737813983, 32.5682737254294, 32.5712736694708, 32.5742736135226,
+        32.5772735575846, 32.580273501657, 32.5832734457397, 32.5862733898326,
+        32.5892733339359, 32.5922732780495, 32.5952732221734, 32.5982731663075,
+        32.601273110452, 32.6042730546067, 32.6072729987717, 32.610272942947,
+        32.6132728871326, 32.6162728313284, 32.6192727755346, 32.622272719751,
+        32.6252726639776, 32.6282726082145, 32.6312725524617, 32.6342724967192,
+        32.6372724409869, 32.6402723852648, 32.643272329553, 32.6462722738514,
+        32.6492722181601, 32.6522721624791, 32.6552721068082, 32.6582720511476,
+        32.6612719954973, 32.6642719398571, 32.6672718842272, 32.6702718286075,
+        32.6732717729981, 32.6762717173988, 32.6792716618098, 32.682271606231,
+        32.6852715506623, 32.6882714951039, 32.6912714395557, 32.6942713840177,
+        32.6972713284899, 32.7002712729723, 32.7032712174649, 32.7062711619677,
+        32.7092711064807, 32.7122710510038, 32.7152709955372, 32.7182709400807,
+        32.7212708846344, 32.7242708291982, 32.7272707737723, 32.7302707183565,
+        32.7332706629508, 32.7362706075553, 32.73927055217, 32.7422704967949,
+        32.7452704414299, 32.748270386075, 32.7512703307303, 32.7542702753958,
+        32.7572702200713, 32.7602701647571, 32.7632701094529, 32.7662700541589,
+        32.769269998875, 32.7722699436013, 32.7752698883377, 32.7782698330842,
+        32.7812697778408, 32.7842697226075, 32.7872696673844, 32.7902696121714,
+        32.7932695569684, 32.7962695017756, 32.7992694465929, 32.8022693914203,
+        32.8052693362578, 32.8082692811054, 32.811269225963, 32.8142691708308,
+        32.8172691157086, 32.8202690605966, 32.8232690054946, 32.8262689504027,
+        32.8292688953209, 32.8322688402491, 32.8352687851874, 32.8382687301358,
+        32.8412686750942, 32.8442686200628, 32.8472685650413, 32.8502685100299,
+        32.8532684550286, 32.8562684000374, 32.8592683450561, 32.862268290085,
+        32.8652682351238, 32.8682681801727, 32.8712681252317, 32.8742680703006,
+        32.8772680153797, 32.8802679604687, 32.8832679055678, 32.8862678506768,
+        32.889267795796, 32.8922677409251, 32.8952676860642, 32.8982676312134,
+        32.9012675763725, 32.9042675215417, 32.9072674667209, 32.9102674119101,
+        32.9132673571093, 32.9162673023184, 32.9192672475376, 32.9222671927668,
+        32.9252671380059, 32.928267083255, 32.9312670285141, 32.9342669737832,
+        32.9372669190623, 32.9402668643513, 32.9432668096504, 32.9462667549594,
+        32.9492667002783, 32.9522666456072, 32.9552665909461, 32.9582665362949,
+        32.9612664816537, 32.9642664270225, 32.9672663724011, 32.9702663177898,
+        32.9732662631884, 32.9762662085969, 32.9792661540154, 32.9822660994438,
+        32.9852660448821, 32.9882659903303, 32.9912659357885, 32.9942658812567,
+        32.9972658267347, 33.0002657722227, 33.0032657177205, 33.0062656632283,
+        33.009265608746, 33.0122655542736, 33.0152654998112, 33.0182654453586,
+        33.0212653909159, 33.0242653364831, 33.0272652820603, 33.0302652276473,
+        33.0332651732442, 33.036265118851, 33.0392650644676, 33.0422650100942,
+        33.0452649557306, 33.0482649013769, 33.0512648470331, 33.0542647926992,
+        33.0572647383751, 33.0602646840609, 33.0632646297565, 33.0662645754621,
+        33.0692645211774, 33.0722644669027, 33.0752644126377, 33.0782643583827,
+        33.0812643041375, 33.0842642499021, 33.0872641956766, 33.0902641414609,
+        33.093264087255, 33.096264033059, 33.0992639788728, 33.1022639246964,
+        33.1052638705299, 33.1082638163732, 33.1112637622263, 33.1142637080892,
+        33.1172636539619, 33.1202635998445, 33.1232635457368, 33.126263491639,
+        33.129263437551, 33.1322633834727, 33.1352633294043, 33.1382632753457,
+        33.1412632212969, 33.1442631672578, 33.1472631132285, 33.1502630592091,
+        33.1532630051994, 33.1562629511995, 33.1592628972093, 33.162262843229,
+        33.1652627892584, 33.1682627352976, 33.1712626813466, 33.1742626274053,
+        33.1772625734738, 33.180262519552, 33.18326246564, 33.1862624117377,
+        33.1892623578452, 33.1922623039625, 33.1952622500895, 33.1982621962262,
+        33.2012621423727, 33.2042620885289, 33.2072620346949, 33.2102619808706,
+        33.213261927056, 33.2162618732511, 33.219261819456, 33.2222617656706,
+        33.2252617118949, 33.228261658129, 33.2312616043727, 33.2342615506262,
+        33.2372614968893, 33.2402614431622, 33.2432613894448, 33.246261335737,
+        33.249261282039, 33.2522612283507, 33.2552611746721, 33.2582611210031,
+        33.2612610673439, 33.2642610136943, 33.2672609600544, 33.2702609064242,
+        33.2732608528037, 33.2762607991928, 33.2792607455916, 33.2822606920001,
+        33.2852606384183, 33.2882605848461, 33.2912605312836, 33.2942604777307,
+        33.2972604241875, 33.3002603706539, 33.30326031713, 33.3062602636158,
+        33.3092602101112, 33.3122601566162, 33.3152601031309, 33.3182600496552,
+        33.3212599961892, 33.3242599427328, 33.327259889286, 33.3302598358489,
+        33.3332597824213, 33.3362597290034, 33.3392596755951, 33.3422596221965,
+        33.3452595688074, 33.348259515428, 33.3512594620582, 33.3542594086979,
+        33.3572593553473, 33.3602593020063, 33.3632592486749, 33.3662591953531,
+        33.3692591420409, 33.3722590887382, 33.3752590354452, 33.3782589821617,
+        33.3812589288879, 33.3842588756236, 33.3872588223689, 33.3902587691237,
+        33.3932587158882, 33.3962586626622, 33.3992586094457, 33.4022585562389,
+        33.4052585030416, 33.4082584498539, 33.4112583966757, 33.4142583435071,
+        33.417258290348, 33.4202582371985, 33.4232581840585, 33.4262581309281,
+        33.4292580778072, 33.4322580246959, 33.4352579715941, 33.4382579185018,
+        33.4412578654191, 33.4442578123459, 33.4472577592822, 33.450257706228,
+        33.4532576531834, 33.4562576001483, 33.4592575471227, 33.4622574941066,
+        33.4652574411001, 33.468257388103, 33.4712573351154, 33.4742572821374,
+        33.4772572291689, 33.4802571762098, 33.4832571232603, 33.4862570703202,
+        33.4892570173896, 33.4922569644686, 33.495256911557, 33.4982568586549,
+        33.5012568057622, 33.5042567528791, 33.5072567000054, 33.5102566471412,
+        33.5132565942865, 33.5162565414413, 33.5192564886055, 33.5222564357791,
+        33.5252563829623, 33.5282563301549, 33.5312562773569, 33.5342562245684,
+        33.5372561717894, 33.5402561190198, 33.5432560662596, 33.5462560135089,
+        33.5492559607676, 33.5522559080358, 33.5552558553134, 33.5582558026004,
+        33.5612557498969, 33.5642556972028, 33.5672556445181, 33.5702555918429,
+        33.573255539177, 33.5762554865206, 33.5792554338736, 33.582255381236,
+        33.5852553286078, 33.5882552759891, 33.5912552233797, 33.5942551707797,
+        33.5972551181892, 33.600255065608, 33.6032550130362, 33.6062549604738,
+        33.6092549079209, 33.6122548553773, 33.615254802843, 33.6182547503182,
+        33.6212546978028, 33.6242546452967, 33.6272545928, 33.6302545403126,
+        33.6332544878347, 33.6362544353661, 33.6392543829069, 33.642254330457,
+        33.6452542780165, 33.6482542255854, 33.6512541731636, 33.6542541207511,
+        33.657254068348, 33.6602540159543, 33.6632539635699, 33.6662539111948,
+        33.6692538588291, 33.6722538064728, 33.6752537541257, 33.678253701788,
+        33.6812536494596, 33.6842535971406, 33.6872535448308, 33.6902534925304,
+        33.6932534402393, 33.6962533879576, 33.6992533356851, 33.702253283422,
+        33.7052532311682, 33.7082531789236, 33.7112531266884, 33.7142530744625,
+        33.7172530222459, 33.7202529700386, 33.7232529178406, 33.7262528656518,
+        33.7292528134724, 33.7322527613022, 33.7352527091414, 33.7382526569898,
+        33.7412526048475, 33.7442525527145, 33.7472525005907, 33.7502524484762,
+        33.753252396371, 33.7562523442751, 33.7592522921884, 33.762252240111,
+        33.7652521880428, 33.768252135984, 33.7712520839343, 33.7742520318939,
+        33.7772519798628, 33.7802519278409, 33.7832518758283, 33.7862518238249,
+        33.7892517718307, 33.7922517198458, 33.7952516678701, 33.7982516159037,
+        33.8012515639465, 33.8042515119985, 33.8072514600597, 33.8102514081302,
+        33.8132513562098, 33.8162513042987, 33.8192512523969, 33.8222512005042,
+        33.8252511486207, 33.8282510967465, 33.8312510448814, 33.8342509930256,
+        33.837250941179, 33.8402508893415, 33.8432508375133, 33.8462507856942,
+        33.8492507338844, 33.8522506820837, 33.8552506302922, 33.8582505785099,
+        33.8612505267368, 33.8642504749729, 33.8672504232181, 33.8702503714725,
+        33.8732503197361, 33.8762502680089, 33.8792502162908, 33.8822501645819,
+        33.8852501128821, 33.8882500611915, 33.8912500095101, 33.8942499578378,
+        33.8972499061747, 33.9002498545207, 33.9032498028759, 33.9062497512402,
+        33.9092496996137, 33.9122496479963, 33.915249596388, 33.9182495447889,
+        33.9212494931989, 33.9242494416181, 33.9272493900463, 33.9302493384837,
+        33.9332492869303, 33.9362492353859, 33.9392491838507, 33.9422491323245,
+        33.9452490808075, 33.9482490292996, 33.9512489778008, 33.9542489263111,
+        33.9572488748306, 33.9602488233591, 33.9632487718967, 33.9662487204434,
+        33.9692486689992, 33.9722486175641, 33.9752485661381, 33.9782485147212,
+        33.9812484633134, 33.9842484119146, 33.9872483605249, 33.9902483091444,
+        33.9932482577728, 33.9962482064104, 33.999248155057, 34.0022481037127,
+        34.0052480523775, 34.0082480010513, 34.0112479497342, 34.0142478984261,
+        34.0172478471271, 34.0202477958372, 34.0232477445563, 34.0262476932844,
+        34.0292476420216, 34.0322475907678, 34.0352475395231, 34.0382474882874,
+        34.0412474370608, 34.0442473858432, 34.0472473346346, 34.0502472834351,
+        34.0532472322446, 34.0562471810631, 34.0592471298906, 34.0622470787271,
+        34.0652470275727, 34.0682469764273, 34.0712469252909, 34.0742468741635,
+        34.0772468230451, 34.0802467719357, 34.0832467208354, 34.086246669744,
+        34.0892466186616, 34.0922465675882, 34.0952465165238, 34.0982464654684,
+        34.101246414422, 34.1042463633846, 34.1072463123562, 34.1102462613367,
+        34.1132462103263, 34.1162461593248, 34.1192461083322, 34.1222460573487,
+        34.1252460063741, 34.1282459554085, 34.1312459044519, 34.1342458535042,
+        34.1372458025655, 34.1402457516357, 34.1432457007149, 34.1462456498031,
+        34.1492455989002, 34.1522455480062, 34.1552454971212, 34.1582454462451,
+        34.161245395378, 34.1642453445198, 34.1672452936706, 34.1702452428303,
+        34.1732451919989, 34.1762451411765, 34.179245090363, 34.1822450395584,
+        34.1852449887627, 34.188244937976, 34.1912448871981, 34.1942448364292,
+        34.1972447856692, 34.2002447349181, 34.2032446841759, 34.2062446334427,
+        34.2092445827183, 34.2122445320028, 34.2152444812963, 34.2182444305986,
+        34.2212443799098, 34.22424432923, 34.227244278559, 34.2302442278969,
+        34.2332441772436, 34.2362441265993, 34.2392440759639, 34.2422440253373,
+        34.2452439747196, 34.2482439241108, 34.2512438735108, 34.2542438229197,
+        34.2572437723375, 34.2602437217641, 34.2632436711997, 34.266243620644,
+        34.2692435700973, 34.2722435195593, 34.2752434690303, 34.2782434185101,
+        34.2812433679987, 34.2842433174962, 34.2872432670025, 34.2902432165177,
+        34.2932431660417, 34.2962431155745, 34.2992430651162, 34.3022430146667,
+        34.305242964226, 34.3082429137942, 34.3112428633712, 34.314242812957,
+        34.3172427625516, 34.3202427121551, 34.3232426617673, 34.3262426113884,
+        34.3292425610183, 34.332242510657, 34.3352424603045, 34.3382424099608,
+        34.3412423596259, 34.3442423092998, 34.3472422589826, 34.3502422086741,
+        34.3532421583744, 34.3562421080834, 34.3592420578013, 34.362242007528,
+        34.3652419572634, 34.3682419070076, 34.3712418567607, 34.3742418065224,
+        34.377241756293, 34.3802417060723, 34.3832416558604, 34.3862416056573,
+        34.3892415554629, 34.3922415052773, 34.3952414551005, 34.3982414049324,
+        34.401241354773, 34.4042413046225, 34.4072412544806, 34.4102412043476,
+        34.4132411542232, 34.4162411041076, 34.4192410540008, 34.4222410039027,
+        34.4252409538133, 34.4282409037327, 34.4312408536608, 34.4342408035976,
+        34.4372407535432, 34.4402407034975, 34.4432406534605, 34.4462406034322,
+        34.4492405534127, 34.4522405034018, 34.4552404533997, 34.4582404034063,
+        34.4612403534216, 34.4642403034456, 34.4672402534783, 34.4702402035198,
+        34.4732401535699, 34.4762401036287, 34.4792400536962, 34.4822400037724,
+        34.4852399538574, 34.4882399039509, 34.4912398540532, 34.4942398041642,
+        34.4972397542838, 34.5002397044122, 34.5032396545492, 34.5062396046949,
+        34.5092395548492, 34.5122395050123, 34.515239455184, 34.5182394053643,
+        34.5212393555534, 34.5242393057511, 34.5272392559574, 34.5302392061724,
+        34.5332391563961, 34.5362391066284, 34.5392390568694, 34.542239007119,
+        34.5452389573773, 34.5482389076442, 34.5512388579198, 34.554238808204,
+        34.5572387584968, 34.5602387087983, 34.5632386591084, 34.5662386094271,
+        34.5692385597545, 34.5722385100905, 34.5752384604351, 34.5782384107883,
+        34.5812383611502, 34.5842383115207, 34.5872382618998, 34.5902382122875,
+        34.5932381626838, 34.5962381130887, 34.5992380635022, 34.6022380139244,
+        34.6052379643551, 34.6082379147944, 34.6112378652424, 34.6142378156989,
+        34.617237766164, 34.6202377166377, 34.62323766712, 34.6262376176109,
+        34.6292375681104, 34.6322375186184, 34.6352374691351, 34.6382374196603,
+        34.6412373701941, 34.6442373207364, 34.6472372712874, 34.6502372218469,
+        34.6532371724149, 34.6562371229915, 34.6592370735767, 34.6622370241705,
+        34.6652369747728, 34.6682369253836, 34.671236876003, 34.674236826631,
+        34.6772367772675, 34.6802367279126, 34.6832366785662, 34.6862366292283,
+        34.689236579899, 34.6922365305782, 34.695236481266, 34.6982364319623,
+        34.7012363826671, 34.7042363333804, 34.7072362841023, 34.7102362348327,
+        34.7132361855716, 34.7162361363191, 34.719236087075, 34.7222360378395,
+        34.7252359886125, 34.728235939394, 34.731235890184, 34.7342358409825,
+        34.7372357917895, 34.740235742605, 34.743235693429, 34.7462356442615,
+        34.7492355951025, 34.752235545952, 34.75523549681, 34.7582354476765,
+        34.7612353985515, 34.7642353494349, 34.7672353003269, 34.7702352512273,
+        34.7732352021362, 34.7762351530535, 34.7792351039794, 34.7822350549137,
+        34.7852350058565, 34.7882349568077, 34.7912349077674, 34.7942348587356,
+        34.7972348097122, 34.8002347606973, 34.8032347116909, 34.8062346626929,
+        34.8092346137033, 34.8122345647222, 34.8152345157496, 34.8182344667854,
+        34.8212344178296, 34.8242343688823, 34.8272343199434, 34.830234271013,
+        34.833234222091, 34.8362341731774, 34.8392341242722, 34.8422340753755,
+        34.8452340264872, 34.8482339776073, 34.8512339287359, 34.8542338798728,
+        34.8572338310182, 34.860233782172, 34.8632337333342, 34.8662336845048,
+        34.8692336356838, 34.8722335868713, 34.8752335380671, 34.8782334892713,
+        34.881233440484, 34.884233391705, 34.8872333429344, 34.8902332941723,
+        34.8932332454185, 34.8962331966731, 34.899233147936, 34.9022330992074,
+        34.9052330504872, 34.9082330017753, 34.9112329530718, 34.9142329043767,
+        34.9172328556899, 34.9202328070116, 34.9232327583415, 34.9262327096799,
+        34.9292326610266, 34.9322326123817, 34.9352325637452, 34.938232515117,
+        34.9412324664971, 34.9442324178857, 34.9472323692825, 34.9502323206877,
+        34.9532322721013, 34.9562322235232, 34.9592321749535, 34.9622321263921,
+        34.965232077839, 34.9682320292943, 34.9712319807579, 34.9742319322298,
+        34.9772318837101, 34.9802318351987, 34.9832317866956, 34.9862317382008,
+        34.9892316897144, 34.9922316412363, 34.9952315927665, 34.998231544305,
+        35.0012314958518, 35.004231447407, 35.0072313989704, 35.0102313505422,
+        35.0132313021222, 35.0162312537106, 35.0192312053073, 35.0222311569122,
+        35.0252311085255, 35.028231060147, 35.0312310117769, 35.034230963415,
+        35.0372309150614, 35.0402308667161, 35.0432308183791, 35.0462307700504,
+        35.0492307217299, 35.0522306734178, 35.0552306251139, 35.0582305768182,
+        35.0612305285309, 35.0642304802518, 35.067230431981, 35.0702303837184,
+        35.0732303354641, 35.0762302872181, 35.0792302389803, 35.0822301907508,
+        35.0852301425295, 35.0882300943165, 35.0912300461117, 35.0942299979152,
+        35.0972299497269, 35.1002299015469, 35.1032298533751, 35.1062298052115,
+        35.1092297570562, 35.1122297089091, 35.1152296607703, 35.1182296126397,
+        35.1212295645173, 35.1242295164031, 35.1272294682971, 35.1302294201994,
+        35.1332293721099, 35.1362293240286, 35.1392292759556, 35.1422292278907,
+        35.1452291798341, 35.1482291317856, 35.1512290837454, 35.1542290357134,
+        35.1572289876895, 35.1602289396739, 35.1632288916665, 35.1662288436673,
+        35.1692287956762, 35.1722287476934, 35.1752286997188, 35.1782286517523,
+        35.181228603794, 35.1842285558439, 35.187228507902, 35.1902284599683,
+        35.1932284120427, 35.1962283641253, 35.1992283162161, 35.2022282683151,
+        35.2052282204223, 35.2082281725376, 35.211228124661, 35.2142280767927,
+        35.2172280289324, 35.2202279810804, 35.2232279332365, 35.2262278854008,
+        35.2292278375732, 35.2322277897538, 35.2352277419425, 35.2382276941393,
+        35.2412276463443, 35.2442275985575, 35.2472275507788, 35.2502275030082,
+        35.2532274552458, 35.2562274074914, 35.2592273597453, 35.2622273120072,
+        35.2652272642773, 35.2682272165555, 35.2712271688419, 35.2742271211363,
+        35.2772270734389, 35.2802270257496, 35.2832269780684, 35.2862269303953,
+        35.2892268827303, 35.2922268350735, 35.2952267874247, 35.2982267397841,
+        35.3012266921515, 35.3042266445271, 35.3072265969107, 35.3102265493025,
+        35.3132265017023, 35.3162264541103, 35.3192264065263, 35.3222263589504,
+        35.3252263113826, 35.3282262638229, 35.3312262162712, 35.3342261687277,
+        35.3372261211922, 35.3402260736648, 35.3432260261455, 35.3462259786342,
+        35.3492259311311, 35.3522258836359, 35.3552258361489, 35.3582257886699,
+        35.361225741199, 35.3642256937361, 35.3672256462813, 35.3702255988346,
+        35.3732255513959, 35.3762255039652, 35.3792254565426, 35.3822254091281,
+        35.3852253617216, 35.3882253143231, 35.3912252669327, 35.3942252195503,
+        35.3972251721759, 35.4002251248096, 35.4032250774513, 35.4062250301011,
+        35.4092249827589, 35.4122249354247, 35.4152248880985, 35.4182248407804,
+        35.4212247934702, 35.4242247461681, 35.4272246988741, 35.430224651588,
+        35.4332246043099, 35.4362245570399, 35.4392245097778, 35.4422244625238,
+        35.4452244152777, 35.4482243680397, 35.4512243208097, 35.4542242735877,
+        35.4572242263736, 35.4602241791676, 35.4632241319695, 35.4662240847795,
+        35.4692240375974, 35.4722239904233, 35.4752239432572, 35.4782238960991,
+        35.481223848949, 35.4842238018068, 35.4872237546726, 35.4902237075464,
+        35.4932236604282, 35.4962236133179, 35.4992235662156, 35.5022235191212,
+        35.5052234720349, 35.5082234249565, 35.511223377886, 35.5142233308235,
+        35.517223283769, 35.5202232367224, 35.5232231896838, 35.5262231426531,
+        35.5292230956303, 35.5322230486156, 35.5352230016087, 35.5382229546098,
+        35.5412229076188, 35.5442228606358, 35.5472228136607, 35.5502227666936,
+        35.5532227197343, 35.556222672783, 35.5592226258397, 35.5622225789042,
+        35.5652225319767, 35.5682224850571, 35.5712224381454, 35.5742223912417,
+        35.5772223443458, 35.5802222974579, 35.5832222505779, 35.5862222037057,
+        35.5892221568415, 35.5922221099852, 35.5952220631368, 35.5982220162964,
+        35.6012219694638, 35.6042219226391, 35.6072218758223, 35.6102218290134,
+        35.6132217822123, 35.6162217354192, 35.619221688634, 35.6222216418566,
+        35.6252215950871, 35.6282215483256, 35.6312215015718, 35.634221454826,
+        35.6372214080881, 35.640221361358, 35.6432213146358, 35.6462212679214,
+        35.6492212212149, 35.6522211745163, 35.6552211278256, 35.6582210811427,
+        35.6612210344677, 35.6642209878005, 35.6672209411412, 35.6702208944898,
+        35.6732208478462, 35.6762208012104, 35.6792207545825, 35.6822207079624,
+        35.6852206613502, 35.6882206147458, 35.6912205681493, 35.6942205215606,
+        35.6972204749797, 35.7002204284067, 35.7032203818415, 35.7062203352841,
+        35.7092202887346, 35.7122202421929, 35.715220195659, 35.7182201491329,
+        35.7212201026147, 35.7242200561043, 35.7272200096017, 35.7302199631069,
+        35.7332199166199, 35.7362198701407, 35.7392198236693, 35.7422197772058,
+        35.74521973075, 35.7482196843021, 35.7512196378619, 35.7542195914295,
+        35.757219545005, 35.7602194985882, 35.7632194521793, 35.7662194057781,
+        35.7692193593847, 35.7722193129991, 35.7752192666212, 35.7782192202512,
+        35.781219173889, 35.7842191275345, 35.7872190811878, 35.7902190348488,
+        35.7932189885177, 35.7962189421943, 35.7992188958787, 35.8022188495708,
+        35.8052188032708, 35.8082187569784, 35.8112187106939, 35.8142186644171,
+        35.8172186181481, 35.8202185718868, 35.8232185256332, 35.8262184793875,
+        35.8292184331494, 35.8322183869191, 35.8352183406966, 35.8382182944818,
+        35.8412182482748, 35.8442182020754, 35.8472181558839, 35.8502181097,
+        35.8532180635239, 35.8562180173556, 35.8592179711949, 35.862217925042,
+        35.8652178788968, 35.8682178327593, 35.8712177866296, 35.8742177405076,
+        35.8772176943933, 35.8802176482867, 35.8832176021878, 35.8862175560967,
+        35.8892175100132, 35.8922174639375, 35.8952174178694, 35.8982173718091,
+        35.9012173257565, 35.9042172797116, 35.9072172336743, 35.9102171876448,
+        35.913217141623, 35.9162170956088, 35.9192170496024, 35.9222170036036,
+        35.9252169576126, 35.9282169116292, 35.9312168656535, 35.9342168196855,
+        35.9372167737251, 35.9402167277725, 35.9432166818275, 35.9462166358902,
+        35.9492165899605, 35.9522165440385, 35.9552164981242, 35.9582164522176,
+        35.9612164063186, 35.9642163604273, 35.9672163145437, 35.9702162686677,
+        35.9732162227994, 35.9762161769387, 35.9792161310857, 35.9822160852403,
+        35.9852160394026, 35.9882159935725, 35.9912159477501, 35.9942159019353,
+        35.9972158561281, 36.0002158103286, 36.0032157645368, 36.0062157187525,
+        36.0092156729759, 36.012215627207, 36.0152155814456, 36.0182155356919,
+        36.0212154899458, 36.0242154442074, 36.0272153984765, 36.0302153527533,
+        36.0332153070377, 36.0362152613297, 36.0392152156294, 36.0422151699366,
+        36.0452151242515, 36.0482150785739, 36.051215032904, 36.0542149872417,
+        36.057214941587, 36.0602148959399, 36.0632148503003, 36.0662148046684,
+        36.0692147590441, 36.0722147134274, 36.0752146678182, 36.0782146222167,
+        36.0812145766227, 36.0842145310364, 36.0872144854576, 36.0902144398864,
+        36.0932143943227, 36.0962143487667, 36.0992143032182, 36.1022142576773,
+        36.105214212144, 36.1082141666183, 36.1112141211001, 36.1142140755895,
+        36.1172140300864, 36.1202139845909, 36.123213939103, 36.1262138936226,
+        36.1292138481498, 36.1322138026846, 36.1352137572269, 36.1382137117767,
+        36.1412136663342, 36.1442136208991, 36.1472135754716, 36.1502135300517,
+        36.1532134846393, 36.1562134392344, 36.1592133938371, 36.1622133484473,
+        36.165213303065, 36.1682132576903, 36.1712132123231, 36.1742131669634,
+        36.1772131216113, 36.1802130762667, 36.1832130309296, 36.1862129856,
+        36.189212940278, 36.1922128949635, 36.1952128496565, 36.198212804357,
+        36.201212759065, 36.2042127137805, 36.2072126685036, 36.2102126232341,
+        36.2132125779722, 36.2162125327178, 36.2192124874708, 36.2222124422314,
+        36.2252123969994, 36.228212351775, 36.231212306558, 36.2342122613486,
+        36.2372122161466, 36.2402121709521, 36.2432121257651, 36.2462120805856,
+        36.2492120354136, 36.2522119902491, 36.255211945092, 36.2582118999424,
+        36.2612118548003, 36.2642118096657, 36.2672117645385, 36.2702117194188,
+        36.2732116743066, 36.2762116292018, 36.2792115841045, 36.2822115390147,
+        36.2852114939323, 36.2882114488574, 36.2912114037899, 36.2942113587299,
+        36.2972113136774, 36.3002112686323, 36.3032112235947, 36.3062111785645,
+        36.3092111335417, 36.3122110885264, 36.3152110435185, 36.3182109985181,
+        36.3212109535251, 36.3242109085396, 36.3272108635615, 36.3302108185908,
+        36.3332107736275, 36.3362107286717, 36.3392106837233, 36.3422106387823,
+        36.3452105938488, 36.3482105489227, 36.351210504004, 36.3542104590927,
+        36.3572104141888, 36.3602103692924, 36.3632103244033, 36.3662102795217,
+        36.3692102346475, 36.3722101897807, 36.3752101449213, 36.3782101000693,
+        36.3812100552247, 36.3842100103875, 36.3872099655577, 36.3902099207353,
+        36.3932098759203, 36.3962098311126, 36.3992097863124, 36.4022097415196,
+        36.4052096967341, 36.4082096519561, 36.4112096071854, 36.4142095624221,
+        36.4172095176662, 36.4202094729176, 36.4232094281765, 36.4262093834427,
+        36.4292093387163, 36.4322092939972, 36.4352092492855, 36.4382092045812,
+        36.4412091598843, 36.4442091151947, 36.4472090705125, 36.4502090258376,
+        36.4532089811701, 36.45620893651, 36.4592088918572, 36.4622088472117,
+        36.4652088025736, 36.4682087579429, 36.4712087133195, 36.4742086687035,
+        36.4772086240948, 36.4802085794934, 36.4832085348994, 36.4862084903127,
+        36.4892084457333, 36.4922084011613, 36.4952083565967, 36.4982083120393,
+        36.5012082674893, 36.5042082229466, 36.5072081784112, 36.5102081338832,
+        36.5132080893625, 36.5162080448491, 36.519208000343, 36.5222079558442,
+        36.5252079113528, 36.5282078668686, 36.5312078223918, 36.5342077779223,
+        36.5372077334601, 36.5402076890052, 36.5432076445575, 36.5462076001172,
+        36.5492075556842, 36.5522075112585, 36.5552074668401, 36.558207422429,
+        36.5612073780252, 36.5642073336287, 36.5672072892395, 36.5702072448575,
+        36.5732072004828, 36.5762071561155, 36.5792071117554, 36.5822070674025,
+        36.585207023057, 36.5882069787188, 36.5912069343878, 36.5942068900641,
+        36.5972068457476, 36.6002068014384, 36.6032067571365, 36.6062067128419,
+        36.6092066685545, 36.6122066242744, 36.6152065800016, 36.618206535736,
+        36.6212064914776, 36.6242064472266, 36.6272064029827, 36.6302063587462,
+        36.6332063145169, 36.6362062702948, 36.63920622608, 36.6422061818724,
+        36.645206137672, 36.6482060934789, 36.6512060492931, 36.6542060051145,
+        36.6572059609431, 36.6602059167789, 36.663205872622, 36.6662058284723,
+        36.6692057843299, 36.6722057401946, 36.6752056960666, 36.6782056519458,
+        36.6812056078323, 36.6842055637259, 36.6872055196268, 36.6902054755349,
+        36.6932054314502, 36.6962053873727, 36.6992053433024, 36.7022052992394,
+        36.7052052551835, 36.7082052111349, 36.7112051670934, 36.7142051230592,
+        36.7172050790322, 36.7202050350123, 36.7232049909997, 36.7262049469942,
+        36.729204902996, 36.7322048590049, 36.735204815021, 36.7382047710443,
+        36.7412047270748, 36.7442046831125, 36.7472046391574, 36.7502045952094,
+        36.7532045512687, 36.7562045073351, 36.7592044634086, 36.7622044194894,
+        36.7652043755773, 36.7682043316724, 36.7712042877747, 36.7742042438841,
+        36.7772042000007, 36.7802041561245, 36.7832041122554, 36.7862040683935,
+        36.7892040245387, 36.7922039806911, 36.7952039368507, 36.7982038930174,
+        36.8012038491912, 36.8042038053722, 36.8072037615604, 36.8102037177557,
+        36.8132036739581, 36.8162036301677, 36.8192035863844, 36.8222035426083,
+        36.8252034988393, 36.8282034550774, 36.8312034113227, 36.8342033675751,
+        36.8372033238347, 36.8402032801013, 36.8432032363751, 36.846203192656,
+        36.8492031489441, 36.8522031052392, 36.8552030615415, 36.8582030178509,
+        36.8612029741674, 36.864202930491, 36.8672028868218, 36.8702028431596,
+        36.8732027995046, 36.8762027558567, 36.8792027122158, 36.8822026685821,
+        36.8852026249555, 36.888202581336, 36.8912025377235, 36.8942024941182,
+        36.89720245052, 36.9002024069289, 36.9032023633448, 36.9062023197679,
+        36.909202276198, 36.9122022326352, 36.9152021890795, 36.9182021455309,
+        36.9212021019894, 36.924202058455, 36.9272020149276, 36.9302019714073,
+        36.9332019278941, 36.9362018843879, 36.9392018408889, 36.9422017973969,
+        36.9452017539119, 36.9482017104341, 36.9512016669633, 36.9542016234995,
+        36.9572015800428, 36.9602015365932, 36.9632014931507, 36.9662014497151,
+        36.9692014062867, 36.9722013628653, 36.9752013194509, 36.9782012760436,
+        36.9812012326434, 36.9842011892502, 36.987201145864, 36.9902011024849,
+        36.9932010591128, 36.9962010157478, 36.9992009723898, 37.0022009290388,
+        37.0052008856948, 37.0082008423579, 37.0112007990281, 37.0142007557052,
+        37.0172007123894, 37.0202006690806, 37.0232006257788, 37.0262005824841,
+        37.0292005391963, 37.0322004959156, 37.0352004526419, 37.0382004093752,
+        37.0412003661156, 37.0442003228629, 37.0472002796173, 37.0502002363786,
+        37.053200193147, 37.0562001499223, 37.0592001067047, 37.0622000634941,
+        37.0652000202905, 37.0681999770938, 37.0711999339042, 37.0741998907216,
+        37.0771998475459, 37.0801998043773, 37.0831997612156, 37.0861997180609,
+        37.0891996749132, 37.0921996317725, 37.0951995886388, 37.098199545512,
+        37.1011995023923, 37.1041994592795, 37.1071994161737, 37.1101993730748,
+        37.1131993299829, 37.116199286898, 37.1191992438201, 37.1221992007492,
+        37.1251991576852, 37.1281991146281, 37.1311990715781, 37.1341990285349,
+        37.1371989854988, 37.1401989424696, 37.1431988994474, 37.1461988564321,
+        37.1491988134237, 37.1521987704224, 37.1551987274279, 37.1581986844404,
+        37.1611986414599, 37.1641985984863, 37.1671985555196, 37.1701985125599,
+        37.1731984696071, 37.1761984266613, 37.1791983837224, 37.1821983407904,
+        37.1851982978654, 37.1881982549473, 37.1911982120361, 37.1941981691318,
+        37.1971981262345, 37.2001980833441, 37.2031980404606, 37.206197997584,
+        37.2091979547144, 37.2121979118516, 37.2151978689958, 37.2181978261469,
+        37.2211977833049, 37.2241977404699, 37.2271976976417, 37.2301976548204,
+        37.2331976120061, 37.2361975691986, 37.239197526398, 37.2421974836044,
+        37.2451974408176, 37.2481973980378, 37.2511973552648, 37.2541973124987,
+        37.2571972697395, 37.2601972269872, 37.2631971842418, 37.2661971415033,
+        37.2691970987717, 37.272197056047, 37.2751970133291, 37.2781969706181,
+        37.281196927914, 37.2841968852168, 37.2871968425264, 37.2901967998429,
+        37.2931967571663, 37.2961967144966, 37.2991966718337, 37.3021966291777,
+        37.3051965865285, 37.3081965438863, 37.3111965012508, 37.3141964586223,
+        37.3171964160006, 37.3201963733858, 37.3231963307778, 37.3261962881766,
+        37.3291962455824, 37.3321962029949, 37.3351961604143, 37.3381961178406,
+        37.3411960752737, 37.3441960327137, 37.3471959901605, 37.3501959476141,
+        37.3531959050746, 37.3561958625419, 37.359195820016, 37.362195777497,
+        37.3651957349848, 37.3681956924795, 37.3711956499809, 37.3741956074892,
+        37.3771955650044, 37.3801955225263, 37.3831954800551, 37.3861954375907,
+        37.3891953951331, 37.3921953526823, 37.3951953102384, 37.3981952678012,
+        37.4011952253709, 37.4041951829474, 37.4071951405306, 37.4101950981207,
+        37.4131950557176, 37.4161950133213, 37.4191949709319, 37.4221949285492,
+        37.4251948861733, 37.4281948438042, 37.4311948014419, 37.4341947590864,
+        37.4371947167377, 37.4401946743957, 37.4431946320606, 37.4461945897323,
+        37.4491945474107, 37.4521945050959, 37.4551944627879, 37.4581944204867,
+        37.4611943781923, 37.4641943359047, 37.4671942936238, 37.4701942513497,
+        37.4731942090823, 37.4761941668218, 37.479194124568, 37.482194082321,
+        37.4851940400807, 37.4881939978472, 37.4911939556205, 37.4941939134006,
+        37.4971938711874, 37.5001938289809, 37.5031937867812, 37.5061937445883,
+        37.5091937024021, 37.5121936602227, 37.51519361805, 37.5181935758841,
+        37.5211935337249, 37.5241934915725, 37.5271934494268, 37.5301934072878,
+        37.5331933651556, 37.5361933230302, 37.5391932809114, 37.5421932387994,
+        37.5451931966942, 37.5481931545957, 37.5511931125039, 37.5541930704188,
+        37.5571930283405, 37.5601929862688, 37.563192944204, 37.5661929021458,
+        37.5691928600943, 37.5721928180496, 37.5751927760116, 37.5781927339803,
+        37.5811926919557, 37.5841926499379, 37.5871926079267, 37.5901925659223,
+        37.5931925239245, 37.5961924819335, 37.5991924399492, 37.6021923979716,
+        37.6051923560007, 37.6081923140364, 37.6111922720789, 37.6141922301281,
+        37.617192188184, 37.6201921462466, 37.6231921043158, 37.6261920623918,
+        37.6291920204744, 37.6321919785637, 37.6351919366598, 37.6381918947625,
+        37.6411918528718, 37.6441918109879, 37.6471917691106, 37.6501917272401,
+        37.6531916853762, 37.6561916435189, 37.6591916016684, 37.6621915598245,
+        37.6651915179873, 37.6681914761567, 37.6711914343329, 37.6741913925157,
+        37.6771913507051, 37.6801913089012, 37.683191267104, 37.6861912253134,
+        37.6891911835295, 37.6921911417523, 37.6951910999817, 37.6981910582177,
+        37.7011910164604, 37.7041909747098, 37.7071909329658, 37.7101908912284,
+        37.7131908494977, 37.7161908077736, 37.7191907660562, 37.7221907243454,
+        37.7251906826413, 37.7281906409438, 37.7311905992529, 37.7341905575686,
+        37.737190515891, 37.74019047422, 37.7431904325557, 37.746190390898,
+        37.7491903492469, 37.7521903076024, 37.7551902659645, 37.7581902243333,
+        37.7611901827087, 37.7641901410907, 37.7671900994793, 37.7701900578745,
+        37.7731900162764, 37.7761899746848, 37.7791899330999, 37.7821898915216,
+        37.7851898499499, 37.7881898083848, 37.7911897668263, 37.7941897252743,
+        37.797189683729, 37.8001896421903, 37.8031896006582, 37.8061895591327,
+        37.8091895176138, 37.8121894761015, 37.8151894345957, 37.8181893930966,
+        37.821189351604, 37.824189310118, 37.8271892686386, 37.8301892271658,
+        37.8331891856996, 37.83618914424, 37.8391891027869, 37.8421890613404,
+        37.8451890199005, 37.8481889784672, 37.8511889370404, 37.8541888956202,
+        37.8571888542066, 37.8601888127995, 37.863188771399, 37.8661887300051,
+        37.8691886886177, 37.8721886472369, 37.8751886058626, 37.8781885644949,
+        37.8811885231338, 37.8841884817792, 37.8871884404312, 37.8901883990897,
+        37.8931883577548, 37.8961883164264, 37.8991882751046, 37.9021882337893,
+        37.9051881924806, 37.9081881511784, 37.9111881098827, 37.9141880685936,
+        37.917188027311, 37.920187986035, 37.9231879447655, 37.9261879035025,
+        37.929187862246, 37.9321878209961, 37.9351877797527, 37.9381877385159,
+        37.9411876972855, 37.9441876560617, 37.9471876148445, 37.9501875736337,
+        37.9531875324294, 37.9561874912317, 37.9591874500405, 37.9621874088558,
+        37.9651873676776, 37.9681873265059, 37.9711872853408, 37.9741872441821,
+        37.97718720303, 37.9801871618843, 37.9831871207452, 37.9861870796125,
+        37.9891870384864, 37.9921869973668, 37.9951869562536, 37.998186915147,
+        38.0011868740468, 38.0041868329532, 38.007186791866, 38.0101867507853,
+        38.0131867097111, 38.0161866686434, 38.0191866275822, 38.0221865865275,
+        38.0251865454792, 38.0281865044375, 38.0311864634022, 38.0341864223734,
+        38.037186381351, 38.0401863403352, 38.0431862993258, 38.0461862583229,
+        38.0491862173264, 38.0521861763364, 38.0551861353529, 38.0581860943759,
+        38.0611860534053, 38.0641860124412, 38.0671859714835, 38.0701859305323,
+        38.0731858895876, 38.0761858486493, 38.0791858077174, 38.0821857667921,
+        38.0851857258731, 38.0881856849607, 38.0911856440546, 38.094185603155,
+        38.0971855622619, 38.1001855213752, 38.103185480495, 38.1061854396212,
+        38.1091853987538, 38.1121853578928, 38.1151853170384, 38.1181852761903,
+        38.1211852353487, 38.1241851945135, 38.1271851536847, 38.1301851128624,
+        38.1331850720465, 38.136185031237, 38.1391849904339, 38.1421849496373,
+        38.1451849088471, 38.1481848680633, 38.1511848272859, 38.1541847865149,
+        38.1571847457504, 38.1601847049922, 38.1631846642405, 38.1661846234952,
+        38.1691845827563, 38.1721845420238, 38.1751845012977, 38.178184460578,
+        38.1811844198648, 38.1841843791579, 38.1871843384574, 38.1901842977633,
+        38.1931842570756, 38.1961842163943, 38.1991841757195, 38.202184135051,
+        38.2051840943888, 38.2081840537331, 38.2111840130838, 38.2141839724408,
+        38.2171839318043, 38.2201838911741, 38.2231838505503, 38.2261838099329,
+        38.2291837693218, 38.2321837287172, 38.2351836881189, 38.238183647527,
+        38.2411836069415, 38.2441835663623, 38.2471835257895, 38.2501834852231,
+        38.253183444663, 38.2561834041093, 38.259183363562, 38.262183323021,
+        38.2651832824864, 38.2681832419582, 38.2711832014363, 38.2741831609207,
+        38.2771831204116, 38.2801830799087, 38.2831830394123, 38.2861829989221,
+        38.2891829584384, 38.2921829179609, 38.2951828774898, 38.2981828370251,
+        38.3011827965667, 38.3041827561147, 38.3071827156689, 38.3101826752296,
+        38.3131826347965, 38.3161825943698, 38.3191825539495, 38.3221825135354,
+        38.3251824731277, 38.3281824327264, 38.3311823923313, 38.3341823519426,
+        38.3371823115602, 38.3401822711841, 38.3431822308144, 38.346182190451,
+        38.3491821500938, 38.3521821097431, 38.3551820693986, 38.3581820290604,
+        38.3611819887286, 38.364181948403, 38.3671819080838, 38.3701818677709,
+        38.3731818274643, 38.376181787164, 38.37918174687, 38.3821817065823,
+        38.3851816663009, 38.3881816260258, 38.391181585757, 38.3941815454945,
+        38.3971815052383, 38.4001814649884, 38.4031814247448, 38.4061813845074,
+        38.4091813442764, 38.4121813040517, 38.4151812638332, 38.418181223621,
+        38.4211811834151, 38.4241811432155, 38.4271811030222, 38.4301810628351,
+        38.4331810226544, 38.4361809824799, 38.4391809423117, 38.4421809021497,
+        38.445180861994, 38.4481808218446, 38.4511807817015, 38.4541807415646,
+        38.457180701434, 38.4601806613097, 38.4631806211916, 38.4661805810798,
+        38.4691805409742, 38.4721805008749, 38.4751804607819, 38.4781804206951,
+        38.4811803806146, 38.4841803405403, 38.4871803004723, 38.4901802604105,
+        38.493180220355, 38.4961801803057, 38.4991801402627, 38.5021801002259,
+        38.5051800601953, 38.508180020171, 38.511179980153, 38.5141799401411,
+        38.5171799001356, 38.5201798601362, 38.5231798201431, 38.5261797801562,
+        38.5291797401755, 38.5321797002011, 38.5351796602329, 38.5381796202709,
+        38.5411795803152, 38.5441795403657, 38.5471795004224, 38.5501794604853,
+        38.5531794205544, 38.5561793806298, 38.5591793407113, 38.5621793007991,
+        38.5651792608931, 38.5681792209933, 38.5711791810998, 38.5741791412124,
+        38.5771791013312, 38.5801790614563, 38.5831790215875, 38.586178981725,
+        38.5891789418687, 38.5921789020185, 38.5951788621746, 38.5981788223368,
+        38.6011787825053, 38.6041787426799, 38.6071787028608, 38.6101786630478,
+        38.613178623241, 38.6161785834404, 38.619178543646, 38.6221785038578,
+        38.6251784640758, 38.6281784242999, 38.6311783845302, 38.6341783447667,
+        38.6371783050094, 38.6401782652583, 38.6431782255134, 38.6461781857746,
+        38.649178146042, 38.6521781063155, 38.6551780665953, 38.6581780268812,
+        38.6611779871732, 38.6641779474715, 38.6671779077759, 38.6701778680864,
+        38.6731778284032, 38.676177788726, 38.6791777490551, 38.6821777093903,
+        38.6851776697316, 38.6881776300791, 38.6911775904328, 38.6941775507926,
+        38.6971775111586, 38.7001774715307, 38.703177431909, 38.7061773922934,
+        38.7091773526839, 38.7121773130806, 38.7151772734835, 38.7181772338924,
+        38.7211771943075, 38.7241771547288, 38.7271771151562, 38.7301770755897,
+        38.7331770360294, 38.7361769964751, 38.7391769569271, 38.7421769173851,
+        38.7451768778493, 38.7481768383196, 38.751176798796, 38.7541767592786,
+        38.7571767197672, 38.760176680262, 38.7631766407629, 38.7661766012699,
+        38.7691765617831, 38.7721765223023, 38.7751764828277, 38.7781764433592,
+        38.7811764038968, 38.7841763644405, 38.7871763249903, 38.7901762855462,
+        38.7931762461082, 38.7961762066763, 38.7991761672505, 38.8021761278309,
+        38.8051760884173, 38.8081760490098, 38.8111760096084, 38.8141759702131,
+        38.8171759308239, 38.8201758914408, 38.8231758520638, 38.8261758126929,
+        38.829175773328, 38.8321757339693, 38.8351756946166, 38.83817565527,
+        38.8411756159295, 38.8441755765951, 38.8471755372667, 38.8501754979445,
+        38.8531754586283, 38.8561754193182, 38.8591753800141, 38.8621753407161,
+        38.8651753014242, 38.8681752621384, 38.8711752228586, 38.874175183585,
+        38.8771751443173, 38.8801751050558, 38.8831750658002, 38.8861750265508,
+        38.8891749873074, 38.8921749480701, 38.8951749088388, 38.8981748696136,
+        38.9011748303944, 38.9041747911813, 38.9071747519743, 38.9101747127733,
+        38.9131746735783, 38.9161746343894, 38.9191745952065, 38.9221745560297,
+        38.9251745168589, 38.9281744776942, 38.9311744385355, 38.9341743993828,
+        38.9371743602362, 38.9401743210956, 38.943174281961, 38.9461742428325,
+        38.94917420371, 38.9521741645936, 38.9551741254831, 38.9581740863787,
+        38.9611740472803, 38.964174008188, 38.9671739691017, 38.9701739300214,
+        38.9731738909471, 38.9761738518788, 38.9791738128165, 38.9821737737603,
+        38.9851737347101, 38.9881736956659, 38.9911736566277, 38.9941736175955,
+        38.9971735785693, 39.0001735395491, 39.003173500535, 39.0061734615268,
+        39.0091734225247, 39.0121733835285, 39.0151733445383, 39.0181733055542,
+        39.021173266576, 39.0241732276039, 39.0271731886377, 39.0301731496776,
+        39.0331731107234, 39.0361730717752, 39.039173032833, 39.0421729938968,
+        39.0451729549666, 39.0481729160423, 39.0511728771241, 39.0541728382118,
+        39.0571727993055, 39.0601727604052, 39.0631727215109, 39.0661726826226,
+        39.0691726437402, 39.0721726048638, 39.0751725659934, 39.0781725271289,
+        39.0811724882704, 39.0841724494179, 39.0871724105714, 39.0901723717308,
+        39.0931723328962, 39.0961722940675, 39.0991722552448, 39.1021722164281,
+        39.1051721776173, 39.1081721388125, 39.1111721000137, 39.1141720612208,
+        39.1171720224338, 39.1201719836528, 39.1231719448778, 39.1261719061087,
+        39.1291718673456, 39.1321718285884, 39.1351717898371, 39.1381717510918,
+        39.1411717123524, 39.144171673619, 39.1471716348915, 39.15017159617,
+        39.1531715574544, 39.1561715187447, 39.159171480041, 39.1621714413432,
+        39.1651714026513, 39.1681713639654, 39.1711713252854, 39.1741712866113,
+        39.1771712479432, 39.1801712092809, 39.1831711706246, 39.1861711319743,
+        39.1891710933298, 39.1921710546913, 39.1951710160586, 39.1981709774319,
+        39.2011709388111, 39.2041709001963, 39.2071708615873, 39.2101708229843,
+        39.2131707843871, 39.2161707457959, 39.2191707072106, 39.2221706686312,
+        39.2251706300577, 39.22817059149, 39.2311705529283, 39.2341705143725,
+        39.2371704758226, 39.2401704372786, 39.2431703987405, 39.2461703602083,
+        39.249170321682, 39.2521702831616, 39.255170244647, 39.2581702061384,
+        39.2611701676356, 39.2641701291388, 39.2671700906478, 39.2701700521627,
+        39.2731700136835, 39.2761699752101, 39.2791699367427, 39.2821698982811,
+        39.2851698598254, 39.2881698213756, 39.2911697829316, 39.2941697444936,
+        39.2971697060614, 39.300169667635, 39.3031696292146, 39.3061695908,
+        39.3091695523913, 39.3121695139884, 39.3151694755914, 39.3181694372003,
+        39.321169398815, 39.3241693604356, 39.3271693220621, 39.3301692836944,
+        39.3331692453326, 39.3361692069766, 39.3391691686265, 39.3421691302822,
+        39.3451690919438, 39.3481690536112, 39.3511690152845, 39.3541689769636,
+        39.3571689386486, 39.3601689003394, 39.363168862036, 39.3661688237385,
+        39.3691687854469, 39.3721687471611, 39.3751687088811, 39.3781686706069,
+        39.3811686323386, 39.3841685940761, 39.3871685558195, 39.3901685175687,
+        39.3931684793237, 39.3961684410845, 39.3991684028512, 39.4021683646237,
+        39.405168326402, 39.4081682881862, 39.4111682499761, 39.4141682117719,
+        39.4171681735735, 39.4201681353809, 39.4231680971942, 39.4261680590132,
+        39.4291680208381, 39.4321679826688, 39.4351679445053, 39.4381679063476,
+        39.4411678681957, 39.4441678300496, 39.4471677919093, 39.4501677537748,
+        39.4531677156462, 39.4561676775233, 39.4591676394062, 39.4621676012949,
+        39.4651675631895, 39.4681675250898, 39.4711674869959, 39.4741674489078,
+        39.4771674108255, 39.480167372749, 39.4831673346783, 39.4861672966134,
+        39.4891672585543, 39.4921672205009, 39.4951671824533, 39.4981671444115,
+        39.5011671063755, 39.5041670683453, 39.5071670303209, 39.5101669923022,
+        39.5131669542893, 39.5161669162822, 39.5191668782809, 39.5221668402853,
+        39.5251668022955, 39.5281667643115, 39.5311667263332, 39.5341666883607,
+        39.537166650394, 39.5401666124331, 39.5431665744779, 39.5461665365284,
+        39.5491664985848, 39.5521664606469, 39.5551664227147, 39.5581663847883,
+        39.5611663468677, 39.5641663089528, 39.5671662710437, 39.5701662331403,
+        39.5731661952426, 39.5761661573508, 39.5791661194646, 39.5821660815842,
+        39.5851660437096, 39.5881660058407, 39.5911659679775, 39.5941659301201,
+        39.5971658922685, 39.6001658544225, 39.6031658165823, 39.6061657787479,
+        39.6091657409191, 39.6121657030961, 39.6151656652789, 39.6181656274673,
+        39.6211655896615, 39.6241655518615, 39.6271655140671, 39.6301654762785,
+        39.6331654384956, 39.6361654007184, 39.639165362947, 39.6421653251812,
+        39.6451652874212, 39.6481652496669, 39.6511652119184, 39.6541651741755,
+        39.6571651364383, 39.6601650987069, 39.6631650609812, 39.6661650232612,
+        39.6691649855469, 39.6721649478383, 39.6751649101354, 39.6781648724382,
+        39.6811648347467, 39.6841647970609, 39.6871647593808, 39.6901647217065,
+        39.6931646840378, 39.6961646463748, 39.6991646087175, 39.7021645710659,
+        39.70516453342, 39.7081644957798, 39.7111644581453, 39.7141644205164,
+        39.7171643828933, 39.7201643452758, 39.7231643076641, 39.726164270058,
+        39.7291642324576, 39.7321641948629, 39.7351641572738, 39.7381641196905,
+        39.7411640821128, 39.7441640445408, 39.7471640069744, 39.7501639694138,
+        39.7531639318588, 39.7561638943095, 39.7591638567658, 39.7621638192278,
+        39.7651637816955, 39.7681637441689, 39.7711637066479, 39.7741636691326,
+        39.777163631623, 39.780163594119, 39.7831635566206, 39.786163519128,
+        39.7891634816409, 39.7921634441596, 39.7951634066839, 39.7981633692138,
+        39.8011633317494, 39.8041632942907, 39.8071632568376, 39.8101632193901,
+        39.8131631819483, 39.8161631445122, 39.8191631070817, 39.8221630696568,
+        39.8251630322376, 39.828162994824, 39.831162957416, 39.8341629200137,
+        39.837162882617, 39.840162845226, 39.8431628078406, 39.8461627704608,
+        39.8491627330867, 39.8521626957182, 39.8551626583553, 39.858162620998,
+        39.8611625836464, 39.8641625463004, 39.86716250896, 39.8701624716253,
+        39.8731624342962, 39.8761623969726, 39.8791623596548, 39.8821623223425,
+        39.8851622850358, 39.8881622477348, 39.8911622104393, 39.8941621731495,
+        39.8971621358653, 39.9001620985867, 39.9031620613137, 39.9061620240464,
+        39.9091619867846, 39.9121619495284, 39.9151619122779, 39.9181618750329,
+        39.9211618377935, 39.9241618005598, 39.9271617633316, 39.9301617261091,
+        39.9331616888921, 39.9361616516807, 39.9391616144749, 39.9421615772747,
+        39.9451615400802, 39.9481615028911, 39.9511614657077, 39.9541614285299,
+        39.9571613913577, 39.960161354191, 39.9631613170299, 39.9661612798744,
+        39.9691612427245, 39.9721612055802, 39.9751611684414, 39.9781611313083,
+        39.9811610941807, 39.9841610570586, 39.9871610199422, 39.9901609828313,
+        39.993160945726, 39.9961609086263, 39.9991608715321, 40.0021608344435,
+        40.0051607973604, 40.008160760283, 40.0111607232111, 40.0141606861447,
+        40.0171606490839, 40.0201606120287, 40.023160574979, 40.0261605379349,
+        40.0291605008964, 40.0321604638634, 40.0351604268359, 40.038160389814,
+        40.0411603527977, 40.0441603157869, 40.0471602787817, 40.050160241782,
+        40.0531602047878, 40.0561601677992, 40.0591601308161, 40.0621600938386,
+        40.0651600568666, 40.0681600199002, 40.0711599829393, 40.0741599459839,
+        40.0771599090341, 40.0801598720898, 40.0831598351511, 40.0861597982178,
+        40.0891597612901, 40.092159724368, 40.0951596874513, 40.0981596505402,
+        40.1011596136346, 40.1041595767346, 40.1071595398401, 40.110159502951,
+        40.1131594660675, 40.1161594291896, 40.1191593923171, 40.1221593554502,
+        40.1251593185888, 40.1281592817329, 40.1311592448825, 40.1341592080376,
+        40.1371591711982, 40.1401591343644, 40.143159097536, 40.1461590607132,
+        40.1491590238958, 40.152158987084, 40.1551589502777, 40.1581589134769,
+        40.1611588766815, 40.1641588398917, 40.1671588031074, 40.1701587663286,
+        40.1731587295552, 40.1761586927874, 40.1791586560251, 40.1821586192682,
+        40.1851585825169, 40.188158545771, 40.1911585090306, 40.1941584722957,
+        40.1971584355663, 40.2001583988424, 40.203158362124, 40.206158325411,
+        40.2091582887036, 40.2121582520016, 40.2151582153051, 40.2181581786141,
+        40.2211581419285, 40.2241581052484, 40.2271580685738, 40.2301580319047,
+        40.233157995241, 40.2361579585828, 40.2391579219301, 40.2421578852829,
+        40.2451578486411, 40.2481578120048, 40.2511577753739, 40.2541577387485,
+        40.2571577021286, 40.2601576655141, 40.2631576289051, 40.2661575923016,
+        40.2691575557035, 40.2721575191109, 40.2751574825237, 40.2781574459419,
+        40.2811574093657, 40.2841573727949, 40.2871573362295, 40.2901572996696,
+        40.2931572631151, 40.296157226566, 40.2991571900225, 40.3021571534843,
+        40.3051571169516, 40.3081570804244, 40.3111570439025, 40.3141570073862,
+        40.3171569708752, 40.3201569343697, 40.3231568978696, 40.326156861375,
+        40.3291568248858, 40.332156788402, 40.3351567519237, 40.3381567154508,
+        40.3411566789833, 40.3441566425212, 40.3471566060646, 40.3501565696134,
+        40.3531565331676, 40.3561564967272, 40.3591564602923, 40.3621564238628,
+        40.3651563874387, 40.36815635102, 40.3711563146067, 40.3741562781989,
+        40.3771562417964, 40.3801562053994, 40.3831561690078, 40.3861561326216,
+        40.3891560962408, 40.3921560598654, 40.3951560234954, 40.3981559871308,
+        40.4011559507716, 40.4041559144179, 40.4071558780695, 40.4101558417265,
+        40.4131558053889, 40.4161557690568, 40.41915573273, 40.4221556964086,
+        40.4251556600926, 40.428155623782, 40.4311555874768, 40.434155551177,
+        40.4371555148826, 40.4401554785935, 40.4431554423099, 40.4461554060316,
+        40.4491553697587, 40.4521553334912, 40.4551552972291, 40.4581552609724,
+        40.461155224721, 40.464155188475, 40.4671551522345, 40.4701551159992,
+        40.4731550797694, 40.4761550435449, 40.4791550073258, 40.4821549711121,
+        40.4851549349037, 40.4881548987007, 40.4911548625031, 40.4941548263109,
+        40.497154790124, 40.5001547539424, 40.5031547177663, 40.5061546815955,
+        40.50915464543, 40.51215460927, 40.5151545731152, 40.5181545369659,
+        40.5211545008219, 40.5241544646832, 40.5271544285499, 40.530154392422,
+        40.5331543562994, 40.5361543201821, 40.5391542840702, 40.5421542479637,
+        40.5451542118625, 40.5481541757666, 40.5511541396761, 40.5541541035909,
+        40.5571540675111, 40.5601540314366, 40.5631539953675, 40.5661539593037,
+        40.5691539232452, 40.572153887192, 40.5751538511442, 40.5781538151018,
+        40.5811537790646, 40.5841537430328, 40.5871537070063, 40.5901536709852,
+        40.5931536349694, 40.5961535989589, 40.5991535629537, 40.6021535269539,
+        40.6051534909593, 40.6081534549701, 40.6111534189863, 40.6141533830077,
+        40.6171533470345, 40.6201533110665, 40.6231532751039, 40.6261532391466,
+        40.6291532031946, 40.632153167248, 40.6351531313066, 40.6381530953705,
+        40.6411530594398, 40.6441530235144, 40.6471529875942, 40.6501529516794,
+        40.6531529157699, 40.6561528798657, 40.6591528439668, 40.6621528080731,
+        40.6651527721848, 40.6681527363018, 40.6711527004241, 40.6741526645517,
+        40.6771526286845, 40.6801525928227, 40.6831525569662, 40.6861525211149,
+        40.6891524852689, 40.6921524494283, 40.6951524135929, 40.6981523777628,
+        40.701152341938, 40.7041523061184, 40.7071522703042, 40.7101522344952,
+        40.7131521986915, 40.7161521628931, 40.7191521271, 40.7221520913121,
+        40.7251520555295, 40.7281520197522, 40.7311519839802, 40.7341519482135,
+        40.737151912452, 40.7401518766958, 40.7431518409448, 40.7461518051991,
+        40.7491517694587, 40.7521517337236, 40.7551516979937, 40.7581516622691,
+        40.7611516265497, 40.7641515908356, 40.7671515551268, 40.7701515194232,
+        40.7731514837249, 40.7761514480318, 40.779151412344, 40.7821513766614,
+        40.7851513409841, 40.7881513053121, 40.7911512696453, 40.7941512339837,
+        40.7971511983274, 40.8001511626763, 40.8031511270305, 40.80615109139,
+        40.8091510557546, 40.8121510201245, 40.8151509844997, 40.8181509488801,
+        40.8211509132657, 40.8241508776566, 40.8271508420527, 40.830150806454,
+        40.8331507708606, 40.8361507352724, 40.8391506996895, 40.8421506641118,
+        40.8451506285393, 40.848150592972, 40.8511505574099, 40.8541505218531,
+        40.8571504863015, 40.8601504507552, 40.863150415214, 40.8661503796781,
+        40.8691503441474, 40.8721503086219, 40.8751502731016, 40.8781502375866,
+        40.8811502020768, 40.8841501665721, 40.8871501310727, 40.8901500955785,
+        40.8931500600895, 40.8961500246058, 40.8991499891272, 40.9021499536538,
+        40.9051499181857, 40.9081498827228, 40.911149847265, 40.9141498118125,
+        40.9171497763651, 40.920149740923, 40.9231497054861, 40.9261496700543,
+        40.9291496346278, 40.9321495992064, 40.9351495637903, 40.9381495283793,
+        40.9411494929736, 40.944149457573, 40.9471494221776, 40.9501493867874,
+        40.9531493514024, 40.9561493160226, 40.959149280648, 40.9621492452785,
+        40.9651492099143, 40.9681491745552, 40.9711491392013, 40.9741491038526,
+        40.977149068509, 40.9801490331707, 40.9831489978375, 40.9861489625095,
+        40.9891489271866, 40.992148891869, 40.9951488565565, 40.9981488212492,
+        41.001148785947, 41.00414875065, 41.0071487153582, 41.0101486800716,
+        41.0131486447901, 41.0161486095138, 41.0191485742426, 41.0221485389766,
+        41.0251485037158, 41.0281484684601, 41.0311484332096, 41.0341483979643,
+        41.0371483627241, 41.040148327489, 41.0431482922591, 41.0461482570344,
+        41.0491482218148, 41.0521481866004, 41.0551481513911, 41.0581481161869,
+        41.061148080988, 41.0641480457941, 41.0671480106054, 41.0701479754219,
+        41.0731479402435, 41.0761479050702, 41.0791478699021, 41.0821478347391,
+        41.0851477995812, 41.0881477644285, 41.0911477292809, 41.0941476941385,
+        41.0971476590012, 41.100147623869, 41.103147588742, 41.10614755362,
+        41.1091475185033, 41.1121474833916, 41.1151474482851, 41.1181474131837,
+        41.1211473780874, 41.1241473429962, 41.1271473079102, 41.1301472728293,
+        41.1331472377535, 41.1361472026828, 41.1391471676173, 41.1421471325568,
+        41.1451470975015, 41.1481470624513, 41.1511470274062, 41.1541469923662,
+        41.1571469573313, 41.1601469223016, 41.1631468872769, 41.1661468522574,
+        41.169146817243, 41.1721467822336, 41.1751467472294, 41.1781467122303,
+        41.1811466772363, 41.1841466422473, 41.1871466072635, 41.1901465722848,
+        41.1931465373112, 41.1961465023427, 41.1991464673792, 41.2021464324209,
+        41.2051463974677, 41.2081463625195, 41.2111463275764, 41.2141462926385,
+        41.2171462577056, 41.2201462227778, 41.2231461878551, 41.2261461529375,
+        41.229146118025, 41.2321460831175, 41.2351460482151, 41.2381460133179,
+        41.2411459784256, 41.2441459435385, 41.2471459086565, 41.2501458737795,
+        41.2531458389076, 41.2561458040408, 41.259145769179, 41.2621457343224,
+        41.2651456994708, 41.2681456646242, 41.2711456297827, 41.2741455949464,
+        41.277145560115, 41.2801455252888, 41.2831454904676, 41.2861454556514,
+        41.2891454208403, 41.2921453860343, 41.2951453512334, 41.2981453164375,
+        41.3011452816466, 41.3041452468609, 41.3071452120801, 41.3101451773045,
+        41.3131451425339, 41.3161451077683, 41.3191450730078, 41.3221450382523,
+        41.3251450035019, 41.3281449687566, 41.3311449340162, 41.334144899281,
+        41.3371448645507, 41.3401448298256, 41.3431447951054, 41.3461447603903,
+        41.3491447256803, 41.3521446909752, 41.3551446562753, 41.3581446215803,
+        41.3611445868904, 41.3641445522055, 41.3671445175257, 41.3701444828509,
+        41.3731444481811, 41.3761444135164, 41.3791443788567, 41.382144344202,
+        41.3851443095523, 41.3881442749077, 41.3911442402681, 41.3941442056335,
+        41.3971441710039, 41.4001441363794, 41.4031441017599, 41.4061440671454,
+        41.4091440325359, 41.4121439979314, 41.415143963332, 41.4181439287376,
+        41.4211438941482, 41.4241438595637, 41.4271438249844, 41.43014379041,
+        41.4331437558406, 41.4361437212762, 41.4391436867169, 41.4421436521625,
+        41.4451436176132, 41.4481435830689, 41.4511435485295, 41.4541435139952,
+        41.4571434794659, 41.4601434449415, 41.4631434104222, 41.4661433759079,
+        41.4691433413985, 41.4721433068942, 41.4751432723948, 41.4781432379005,
+        41.4811432034111, 41.4841431689267, 41.4871431344474, 41.490143099973,
+        41.4931430655036, 41.4961430310392, 41.4991429965797, 41.5021429621253,
+        41.5051429276758, 41.5081428932313, 41.5111428587918, 41.5141428243573,
+        41.5171427899278, 41.5201427555032, 41.5231427210836, 41.526142686669,
+        41.5291426522594, 41.5321426178548, 41.5351425834551, 41.5381425490604,
+        41.5411425146706, 41.5441424802858, 41.547142445906, 41.5501424115312,
+        41.5531423771613, 41.5561423427964, 41.5591423084365, 41.5621422740815,
+        41.5651422397315, 41.5681422053865, 41.5711421710464, 41.5741421367112,
+        41.5771421023811, 41.5801420680558, 41.5831420337356, 41.5861419994203,
+        41.5891419651099, 41.5921419308045, 41.5951418965041, 41.5981418622086,
+        41.601141827918, 41.6041417936324, 41.6071417593517, 41.610141725076,
+        41.6131416908053, 41.6161416565395, 41.6191416222786, 41.6221415880226,
+        41.6251415537716, 41.6281415195256, 41.6311414852845, 41.6341414510483,
+        41.637141416817, 41.6401413825907, 41.6431413483694, 41.6461413141529,
+        41.6491412799414, 41.6521412457348, 41.6551412115332, 41.6581411773365,
+        41.6611411431447, 41.6641411089578, 41.6671410747759, 41.6701410405989,
+        41.6731410064268, 41.6761409722596, 41.6791409380974, 41.6821409039401,
+        41.6851408697877, 41.6881408356402, 41.6911408014976, 41.6941407673599,
+        41.6971407332272, 41.7001406990994, 41.7031406649765, 41.7061406308585,
+        41.7091405967454, 41.7121405626372, 41.7151405285339, 41.7181404944356,
+        41.7211404603421, 41.7241404262536, 41.7271403921699, 41.7301403580912,
+        41.7331403240174, 41.7361402899484, 41.7391402558844, 41.7421402218253,
+        41.745140187771, 41.7481401537217, 41.7511401196772, 41.7541400856377,
+        41.757140051603, 41.7601400175733, 41.7631399835484, 41.7661399495284,
+        41.7691399155133, 41.7721398815031, 41.7751398474978, 41.7781398134974,
+        41.7811397795018, 41.7841397455112, 41.7871397115254, 41.7901396775445,
+        41.7931396435685, 41.7961396095974, 41.7991395756311, 41.8021395416697,
+        41.8051395077132, 41.8081394737616, 41.8111394398149, 41.814139405873,
+        41.817139371936, 41.8201393380039, 41.8231393040766, 41.8261392701542,
+        41.8291392362367, 41.8321392023241, 41.8351391684163, 41.8381391345134,
+        41.8411391006153, 41.8441390667221, 41.8471390328338, 41.8501389989504,
+        41.8531389650718, 41.856138931198, 41.8591388973291, 41.8621388634651,
+        41.8651388296059, 41.8681387957516, 41.8711387619021, 41.8741387280575,
+        41.8771386942178, 41.8801386603829, 41.8831386265528, 41.8861385927276,
+        41.8891385589072, 41.8921385250917, 41.8951384912811, 41.8981384574752,
+        41.9011384236743, 41.9041383898781, 41.9071383560868, 41.9101383223004,
+        41.9131382885188, 41.916138254742, 41.91913822097, 41.9221381872029,
+        41.9251381534407, 41.9281381196832, 41.9311380859306, 41.9341380521829,
+        41.9371380184399, 41.9401379847018, 41.9431379509686, 41.9461379172401,
+        41.9491378835165, 41.9521378497977, 41.9551378160837, 41.9581377823746,
+        41.9611377486702, 41.9641377149707, 41.9671376812761, 41.9701376475862,
+        41.9731376139012, 41.9761375802209, 41.9791375465455, 41.9821375128749,
+        41.9851374792092, 41.9881374455482, 41.991137411892, 41.9941373782407,
+        41.9971373445942, 42.0001373109525, 42.0031372773155, 42.0061372436834,
+        42.0091372100561, 42.0121371764336, 42.015137142816, 42.0181371092031,
+        42.021137075595, 42.0241370419917, 42.0271370083932, 42.0301369747995,
+        42.0331369412107, 42.0361369076266, 42.0391368740473, 42.0421368404728,
+        42.0451368069031, 42.0481367733382, 42.0511367397781, 42.0541367062227,
+        42.0571366726722, 42.0601366391265, 42.0631366055855, 42.0661365720493,
+        42.069136538518, 42.0721365049914, 42.0751364714695, 42.0781364379525,
+        42.0811364044402, 42.0841363709328, 42.0871363374301, 42.0901363039322,
+        42.093136270439, 42.0961362369507, 42.0991362034671, 42.1021361699883,
+        42.1051361365143, 42.108136103045, 42.1111360695805, 42.1141360361208,
+        42.1171360026658, 42.1201359692156, 42.1231359357702, 42.1261359023296,
+        42.1291358688937, 42.1321358354626, 42.1351358020362, 42.1381357686146,
+        42.1411357351978, 42.1441357017857, 42.1471356683784, 42.1501356349759,
+        42.1531356015781, 42.156135568185, 42.1591355347967, 42.1621355014132,
+        42.1651354680344, 42.1681354346604, 42.1711354012911, 42.1741353679266,
+        42.1771353345668, 42.1801353012118, 42.1831352678615, 42.186135234516,
+        42.1891352011752, 42.1921351678392, 42.1951351345079, 42.1981351011813,
+        42.2011350678595, 42.2041350345424, 42.2071350012301, 42.2101349679225,
+        42.2131349346196, 42.2161349013215, 42.2191348680281, 42.2221348347394,
+        42.2251348014555, 42.2281347681763, 42.2311347349019, 42.2341347016321,
+        42.2371346683671, 42.2401346351068, 42.2431346018513, 42.2461345686005,
+        42.2491345353544, 42.252134502113, 42.2551344688764, 42.2581344356444,
+        42.2611344024172, 42.2641343691947, 42.267134335977, 42.2701343027639,
+        42.2731342695556, 42.276134236352, 42.2791342031531, 42.2821341699589,
+        42.2851341367694, 42.2881341035846, 42.2911340704046, 42.2941340372292,
+        42.2971340040586, 42.3001339708927, 42.3031339377314, 42.3061339045749,
+        42.3091338714231, 42.312133838276, 42.3151338051336, 42.3181337719959,
+        42.3211337388629, 42.3241337057346, 42.327133672611, 42.3301336394921,
+        42.3331336063779, 42.3361335732684, 42.3391335401635, 42.3421335070634,
+        42.345133473968, 42.3481334408773, 42.3511334077912, 42.3541333747098,
+        42.3571333416332, 42.3601333085612, 42.3631332754939, 42.3661332424313,
+        42.3691332093734, 42.3721331763201, 42.3751331432716, 42.3781331102277,
+        42.3811330771885, 42.384133044154, 42.3871330111242, 42.390132978099,
+        42.3931329450785, 42.3961329120627, 42.3991328790516, 42.4021328460451,
+        42.4051328130433, 42.4081327800462, 42.4111327470538, 42.414132714066,
+        42.4171326810829, 42.4201326481045, 42.4231326151307, 42.4261325821616,
+        42.4291325491972, 42.4321325162374, 42.4351324832823, 42.4381324503319,
+        42.4411324173861, 42.4441323844449, 42.4471323515085, 42.4501323185767,
+        42.4531322856495, 42.456132252727, 42.4591322198092, 42.462132186896,
+        42.4651321539875, 42.4681321210836, 42.4711320881844, 42.4741320552898,
+        42.4771320223998, 42.4801319895146, 42.4831319566339, 42.4861319237579,
+        42.4891318908866, 42.4921318580199, 42.4951318251578, 42.4981317923004,
+        42.5011317594477, 42.5041317265995, 42.507131693756, 42.5101316609172,
+        42.513131628083, 42.5161315952534, 42.5191315624284, 42.5221315296081,
+        42.5251314967925, 42.5281314639814, 42.531131431175, 42.5341313983732,
+        42.5371313655761, 42.5401313327835, 42.5431312999956, 42.5461312672124,
+        42.5491312344337, 42.5521312016597, 42.5551311688903, 42.5581311361255,
+        42.5611311033654, 42.5641310706099, 42.5671310378589, 42.5701310051126,
+        42.573130972371, 42.5761309396339, 42.5791309069015, 42.5821308741736,
+        42.5851308414504, 42.5881308087318, 42.5911307760178, 42.5941307433085,
+        42.5971307106037, 42.6001306779035, 42.603130645208, 42.606130612517,
+        42.6091305798307, 42.612130547149, 42.6151305144718, 42.6181304817993,
+        42.6211304491314, 42.6241304164681, 42.6271303838094, 42.6301303511552,
+        42.6331303185057, 42.6361302858608, 42.6391302532205, 42.6421302205847,
+        42.6451301879536, 42.648130155327, 42.6511301227051, 42.6541300900877,
+        42.6571300574749, 42.6601300248668, 42.6631299922632, 42.6661299596642,
+        42.6691299270697, 42.6721298944799, 42.6751298618947, 42.678129829314,
+        42.6811297967379, 42.6841297641664, 42.6871297315995, 42.6901296990372,
+        42.6931296664794, 42.6961296339262, 42.6991296013776, 42.7021295688336,
+        42.7051295362941, 42.7081295037592, 42.7111294712289, 42.7141294387032,
+        42.717129406182, 42.7201293736654, 42.7231293411534, 42.726129308646,
+        42.7291292761431, 42.7321292436447, 42.735129211151, 42.7381291786618,
+        42.7411291461772, 42.7441291136971, 42.7471290812216, 42.7501290487506,
+        42.7531290162843, 42.7561289838224, 42.7591289513652, 42.7621289189125,
+        42.7651288864643, 42.7681288540207, 42.7711288215817, 42.7741287891472,
+        42.7771287567172, 42.7801287242918, 42.783128691871, 42.7861286594547,
+        42.7891286270429, 42.7921285946358, 42.7951285622331, 42.798128529835,
+        42.8011284974414, 42.8041284650524, 42.8071284326679, 42.810128400288,
+        42.8131283679126, 42.8161283355418, 42.8191283031755, 42.8221282708137,
+        42.8251282384564, 42.8281282061037, 42.8311281737556, 42.8341281414119,
+        42.8371281090728, 42.8401280767383, 42.8431280444082, 42.8461280120827,
+        42.8491279797617, 42.8521279474453, 42.8551279151333, 42.8581278828259,
+        42.8611278505231, 42.8641278182247, 42.8671277859309, 42.8701277536416,
+        42.8731277213568, 42.8761276890766, 42.8791276568008, 42.8821276245296,
+        42.8851275922629, 42.8881275600007, 42.891127527743, 42.8941274954899,
+        42.8971274632412, 42.9001274309971, 42.9031273987575, 42.9061273665224,
+        42.9091273342918, 42.9121273020657, 42.9151272698441, 42.918127237627,
+        42.9211272054144, 42.9241271732064, 42.9271271410028, 42.9301271088038,
+        42.9331270766092, 42.9361270444192, 42.9391270122336, 42.9421269800526,
+        42.945126947876, 42.948126915704, 42.9511268835364, 42.9541268513733,
+        42.9571268192148, 42.9601267870607, 42.9631267549111, 42.966126722766,
+        42.9691266906254, 42.9721266584893, 42.9751266263577, 42.9781265942306,
+        42.981126562108, 42.9841265299898, 42.9871264978761, 42.990126465767,
+        42.9931264336623, 42.996126401562, 42.9991263694663, 43.0021263373751,
+        43.0051263052883, 43.008126273206, 43.0111262411282, 43.0141262090548,
+        43.017126176986, 43.0201261449216, 43.0231261128617, 43.0261260808062,
+        43.0291260487553, 43.0321260167088, 43.0351259846667, 43.0381259526292,
+        43.0411259205961, 43.0441258885675, 43.0471258565433, 43.0501258245236,
+        43.0531257925084, 43.0561257604976, 43.0591257284914, 43.0621256964895,
+        43.0651256644921, 43.0681256324992, 43.0711256005108, 43.0741255685268,
+        43.0771255365473, 43.0801255045722, 43.0831254726016, 43.0861254406354,
+        43.0891254086737, 43.0921253767164, 43.0951253447636, 43.0981253128152,
+        43.1011252808713, 43.1041252489319, 43.1071252169969, 43.1101251850663,
+        43.1131251531402, 43.1161251212185, 43.1191250893013, 43.1221250573885,
+        43.1251250254801, 43.1281249935762, 43.1311249616768, 43.1341249297818,
+        43.1371248978912, 43.140124866005, 43.1431248341233, 43.1461248022461,
+        43.1491247703732, 43.1521247385048, 43.1551247066409, 43.1581246747813,
+        43.1611246429262, 43.1641246110755, 43.1671245792293, 43.1701245473875,
+        43.1731245155501, 43.1761244837171, 43.1791244518886, 43.1821244200645,
+        43.1851243882448, 43.1881243564296, 43.1911243246187, 43.1941242928123,
+        43.1971242610103, 43.2001242292127, 43.2031241974196, 43.2061241656308,
+        43.2091241338465, 43.2121241020666, 43.2151240702911, 43.21812403852,
+        43.2211240067534, 43.2241239749911, 43.2271239432333, 43.2301239114798,
+        43.2331238797308, 43.2361238479862, 43.239123816246, 43.2421237845102,
+        43.2451237527788, 43.2481237210518, 43.2511236893292, 43.254123657611,
+        43.2571236258972, 43.2601235941879, 43.2631235624829, 43.2661235307823,
+        43.2691234990861, 43.2721234673943, 43.2751234357069, 43.2781234040239,
+        43.2811233723453, 43.2841233406711, 43.2871233090013, 43.2901232773359,
+        43.2931232456749, 43.2961232140182, 43.299123182366, 43.3021231507181,
+        43.3051231190747, 43.3081230874356, 43.3111230558009, 43.3141230241706,
+        43.3171229925446, 43.3201229609231, 43.3231229293059, 43.3261228976931,
+        43.3291228660847, 43.3321228344807, 43.335122802881, 43.3381227712858,
+        43.3411227396949, 43.3441227081083, 43.3471226765262, 43.3501226449484,
+        43.353122613375, 43.356122581806, 43.3591225502414, 43.3621225186811,
+        43.3651224871252, 43.3681224555736, 43.3711224240264, 43.3741223924836,
+        43.3771223609452, 43.3801223294111, 43.3831222978814, 43.386122266356,
+        43.389122234835, 43.3921222033184, 43.3951221718061, 43.3981221402982,
+        43.4011221087946, 43.4041220772954, 43.4071220458006, 43.4101220143101,
+        43.413121982824, 43.4161219513422, 43.4191219198648, 43.4221218883917,
+        43.425121856923, 43.4281218254586, 43.4311217939986, 43.4341217625429,
+        43.4371217310916, 43.4401216996446, 43.443121668202, 43.4461216367637,
+        43.4491216053297, 43.4521215739001, 43.4551215424749, 43.458121511054,
+        43.4611214796374, 43.4641214482251, 43.4671214168172, 43.4701213854137,
+        43.4731213540144, 43.4761213226196, 43.479121291229, 43.4821212598428,
+        43.4851212284609, 43.4881211970833, 43.4911211657101, 43.4941211343412,
+        43.4971211029767, 43.5001210716164, 43.5031210402605, 43.5061210089089,
+        43.5091209775617, 43.5121209462187, 43.5151209148801, 43.5181208835459,
+        43.5211208522159, 43.5241208208903, 43.5271207895689, 43.5301207582519,
+        43.5331207269393, 43.5361206956309, 43.5391206643269, 43.5421206330271,
+        43.5451206017317, 43.5481205704406, 43.5511205391538, 43.5541205078714,
+        43.5571204765932, 43.5601204453193, 43.5631204140498, 43.5661203827846,
+        43.5691203515236, 43.572120320267, 43.5751202890147, 43.5781202577667,
+        43.581120226523, 43.5841201952836, 43.5871201640485, 43.5901201328177,
+        43.5931201015912, 43.596120070369, 43.5991200391512, 43.6021200079376,
+        43.6051199767283, 43.6081199455233, 43.6111199143226, 43.6141198831262,
+        43.617119851934, 43.6201198207462, 43.6231197895627, 43.6261197583834,
+        43.6291197272085, 43.6321196960378, 43.6351196648715, 43.6381196337094,
+        43.6411196025516, 43.6441195713981, 43.6471195402489, 43.6501195091039,
+        43.6531194779633, 43.6561194468269, 43.6591194156948, 43.662119384567,
+        43.6651193534434, 43.6681193223242, 43.6711192912092, 43.6741192600985,
+        43.6771192289921, 43.6801191978899, 43.6831191667921, 43.6861191356985,
+        43.6891191046091, 43.6921190735241, 43.6951190424433, 43.6981190113668,
+        43.7011189802945, 43.7041189492266, 43.7071189181629, 43.7101188871034,
+        43.7131188560482, 43.7161188249973, 43.7191187939507, 43.7221187629083,
+        43.7251187318702, 43.7281187008363, 43.7311186698067, 43.7341186387814,
+        43.7371186077603, 43.7401185767435, 43.7431185457309, 43.7461185147226,
+        43.7491184837185, 43.7521184527187, 43.7551184217232, 43.7581183907319,
+        43.7611183597448, 43.764118328762, 43.7671182977835, 43.7701182668092,
+        43.7731182358391, 43.7761182048733, 43.7791181739118, 43.7821181429545,
+        43.7851181120014, 43.7881180810526, 43.791118050108, 43.7941180191677,
+        43.7971179882316, 43.8001179572997, 43.8031179263721, 43.8061178954487,
+        43.8091178645296, 43.8121178336147, 43.815117802704, 43.8181177717976,
+        43.8211177408954, 43.8241177099974, 43.8271176791037, 43.8301176482142,
+        43.8331176173289, 43.8361175864479, 43.8391175555711, 43.8421175246985,
+        43.8451174938301, 43.848117462966, 43.8511174321061, 43.8541174012504,
+        43.857117370399, 43.8601173395517, 43.8631173087087, 43.8661172778699,
+        43.8691172470354, 43.872117216205, 43.8751171853789, 43.878117154557,
+        43.8811171237393, 43.8841170929258, 43.8871170621165, 43.8901170313115,
+        43.8931170005106, 43.896116969714, 43.8991169389216, 43.9021169081334,
+        43.9051168773494, 43.9081168465696, 43.911116815794, 43.9141167850227,
+        43.9171167542555, 43.9201167234926, 43.9231166927338, 43.9261166619793,
+        43.9291166312289, 43.9321166004828, 43.9351165697408, 43.9381165390031,
+        43.9411165082695, 43.9441164775402, 43.9471164468151, 43.9501164160941,
+        43.9531163853774, 43.9561163546648, 43.9591163239564, 43.9621162932523,
+        43.9651162625523, 43.9681162318565, 43.9711162011649, 43.9741161704775,
+        43.9771161397943, 43.9801161091153, 43.9831160784404, 43.9861160477698,
+        43.9891160171033, 43.992115986441, 43.9951159557829, 43.998115925129,
+        44.0011158944793, 44.0041158638337, 44.0071158331924, 44.0101158025552,
+        44.0131157719222, 44.0161157412933, 44.0191157106687, 44.0221156800482,
+        44.0251156494319, 44.0281156188198, 44.0311155882118, 44.034115557608,
+        44.0371155270084, 44.040115496413, 44.0431154658217, 44.0461154352346,
+        44.0491154046517, 44.0521153740729, 44.0551153434984, 44.0581153129279,
+        44.0611152823617, 44.0641152517996, 44.0671152212416, 44.0701151906879,
+        44.0731151601382, 44.0761151295928, 44.0791150990515, 44.0821150685144,
+        44.0851150379814, 44.0881150074526, 44.0911149769279, 44.0941149464074,
+        44.0971149158911, 44.1001148853789, 44.1031148548709, 44.106114824367,
+        44.1091147938672, 44.1121147633717, 44.1151147328802, 44.1181147023929,
+        44.1211146719098, 44.1241146414308, 44.127114610956, 44.1301145804853,
+        44.1331145500187, 44.1361145195563, 44.1391144890981, 44.1421144586439,
+        44.145114428194, 44.1481143977481, 44.1511143673064, 44.1541143368689,
+        44.1571143064355, 44.1601142760062, 44.163114245581, 44.16611421516,
+        44.1691141847431, 44.1721141543304, 44.1751141239218, 44.1781140935173,
+        44.181114063117, 44.1841140327207, 44.1871140023287, 44.1901139719407,
+        44.1931139415569, 44.1961139111772, 44.1991138808016, 44.2021138504301,
+        44.2051138200628, 44.2081137896996, 44.2111137593405, 44.2141137289856,
+        44.2171136986348, 44.220113668288, 44.2231136379454, 44.226113607607,
+        44.2291135772726, 44.2321135469424, 44.2351135166162, 44.2381134862942,
+        44.2411134559763, 44.2441134256626, 44.2471133953529, 44.2501133650473,
+        44.2531133347459, 44.2561133044486, 44.2591132741553, 44.2621132438662,
+        44.2651132135812, 44.2681131833003, 44.2711131530235, 44.2741131227508,
+        44.2771130924823, 44.2801130622178, 44.2831130319574, 44.2861130017011,
+        44.289112971449, 44.2921129412009, 44.2951129109569, 44.298112880717,
+        44.3011128504813, 44.3041128202496, 44.307112790022, 44.3101127597985,
+        44.3131127295791, 44.3161126993638, 44.3191126691526, 44.3221126389455,
+        44.3251126087425, 44.3281125785435, 44.3311125483487, 44.3341125181579,
+        44.3371124879713, 44.3401124577887, 44.3431124276102, 44.3461123974358,
+        44.3491123672655, 44.3521123370992, 44.3551123069371, 44.358112276779,
+        44.361112246625, 44.3641122164751, 44.3671121863293, 44.3701121561875,
+        44.3731121260499, 44.3761120959163, 44.3791120657867, 44.3821120356613,
+        44.3851120055399, 44.3881119754226, 44.3911119453094, 44.3941119152002,
+        44.3971118850952, 44.4001118549942, 44.4031118248972, 44.4061117948043,
+        44.4091117647155, 44.4121117346308, 44.4151117045501, 44.4181116744735,
+        44.421111644401, 44.4241116143325, 44.4271115842681, 44.4301115542078,
+        44.4331115241515, 44.4361114940992, 44.4391114640511, 44.442111434007,
+        44.4451114039669, 44.4481113739309, 44.451111343899, 44.4541113138711,
+        44.4571112838473, 44.4601112538275, 44.4631112238118, 44.4661111938001,
+        44.4691111637925, 44.4721111337889, 44.4751111037894, 44.478111073794,
+        44.4811110438025, 44.4841110138152, 44.4871109838319, 44.4901109538526,
+        44.4931109238773, 44.4961108939062, 44.499110863939, 44.5021108339759,
+        44.5051108040169, 44.5081107740618, 44.5111107441109, 44.5141107141639,
+        44.517110684221, 44.5201106542822, 44.5231106243473, 44.5261105944166,
+        44.5291105644898, 44.5321105345671, 44.5351105046484, 44.5381104747337,
+        44.5411104448231, 44.5441104149165, 44.547110385014, 44.5501103551154,
+        44.5531103252209, 44.5561102953305, 44.559110265444, 44.5621102355616,
+        44.5651102056832, 44.5681101758088, 44.5711101459385, 44.5741101160722,
+        44.5771100862099, 44.5801100563516, 44.5831100264973, 44.5861099966471,
+        44.5891099668009, 44.5921099369587, 44.5951099071205, 44.5981098772863,
+        44.6011098474562, 44.60410981763, 44.6071097878079, 44.6101097579898,
+        44.6131097281757, 44.6161096983656, 44.6191096685596, 44.6221096387575,
+        44.6251096089594, 44.6281095791654, 44.6311095493754, 44.6341095195893,
+        44.6371094898073, 44.6401094600293, 44.6431094302553, 44.6461094004853,
+        44.6491093707192, 44.6521093409572, 44.6551093111992, 44.6581092814452,
+        44.6611092516952, 44.6641092219492, 44.6671091922072
+    };
+}
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,335 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "FamilyModel.hpp"
+#include <iostream>
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The degree of the Chebyshev expansions on each panel
+    const int N = FamilyTable::N;
+
+    // This function stores the coefficients of the derivative of the Chebyshev series c with respect to x in d,
+    // for a panel of width h in x
+    void differentiate(const double* c, double* d, double h)
+    {
+        d[N] = 0.0;
+        double dk1 = 0.0, dk2 = 0.0;
+        for (int k=N; k>=1; k--)
+        {
+            double dk = dk2 + 2.0*k*c[k];
+            d[k-1] = dk;
+            dk2 = dk1;
+            dk1 = dk;
+        }
+        d[0] *= 0.5;
+        for (int k=0; k<=N; k++) d[k] *= 2.0/h;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+FamilyModel::FamilyModel(const FamilyTable* table, double Mtot, double rs, double s, const GaussLegendre* gl)
+{
+    if (!(s>=table->shape_min() && s<=table->shape_max()))
+    {
+        std::cerr << "Attempting to set up a FamilyModel object with a shape parameter outside the range of the table"
+        << std::endl;
+        exit(1);
+    }
+    _table = table;
+    _model.reset(FamilyTable::create_model(table->family(), Mtot, rs, s, gl));
+    _gl = gl;
+    _Mtot = Mtot;
+    _rs = rs;
+    _s = s;
+    double Psi0 = table->central_potential(s);
+    _Psi0 = Psi0<std::numeric_limits<double>::infinity() ? Mtot/rs * Psi0 : _model->central_potential();
+
+    _scale[FamilyTable::LogRho] = Mtot/(rs*rs*rs);
+    _scale[FamilyTable::LogMass] = Mtot;
+    _scale[FamilyTable::LogPsi] = Mtot/rs;
+    _scale[FamilyTable::LogSigma] = Mtot/(rs*rs);
+    _scale[FamilyTable::LogDisp] = Mtot/rs;
+    _scale[FamilyTable::LogDF] = 1.0/sqrt(Mtot*rs*rs*rs);
+
+    // Interpolate the tabulated values to the shape parameter and convert them to Chebyshev coefficients
+
+    int P = table->num_panels();
+    double h = table->panel_width();
+    _c.assign(P*NumSeries*(N+1), 0.0);
+    double v[N+1];
+    for (int p=0; p<P; p++)
+    {
+        double* cp = _c.data() + p*NumSeries*(N+1);
+        for (int k=0; k<FamilyTable::NumProfiles; k++)
+        {
+            if (table->direct(p,k)) continue;
+            table->interpolate(s,p,k,v);
+
+            // The coefficients c_k = (2/N) sum_j'' v_j cos(jk pi/N), with the first and last terms halved
+
+            double* ck = cp + k*(N+1);
+            for (int i=0; i<=N; i++)
+            {
+                double sum = 0.0;
+                for (int j=0; j<=N; j++)
+                {
+                    double w = (j==0 || j==N) ? 0.5 : 1.0;
+                    sum += w * v[j] * cos(j*i*M_PI/N);
+                }
+                ck[i] = 2.0/N * sum;
+            }
+            ck[0] *= 0.5;
+            ck[N] *= 0.5;
+        }
+        if (!table->direct(p,FamilyTable::LogRho))
+        {
+            differentiate(cp+LogRho*(N+1), cp+DLogRho*(N+1), h);
+            differentiate(cp+DLogRho*(N+1), cp+D2LogRho*(N+1), h);
+        }
+        if (!table->direct(p,FamilyTable::LogSigma)) differentiate(cp+LogSigma*(N+1), cp+DLogSigma*(N+1), h);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int FamilyModel::locate(double r, int k, double& t) const
+{
+    double u = (log(r/_rs) - _table->panel_start()) / _table->panel_width();
+    int P = _table->num_panels();
+    if (!(u>=0.0 && u<=P)) return -1;
+    int p = min(static_cast<int>(u), P-1);
+    if (_table->direct(p,k)) return -1;
+    t = 2.0*(u-p) - 1.0;
+    return p;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::evaluate(int p, int s, double t) const
+{
+    const double* c = _c.data() + (p*NumSeries+s)*(N+1);
+    double b1 = 0.0, b2 = 0.0;
+    for (int k=N; k>=1; k--)
+    {
+        double b0 = 2.0*t*b1 - b2 + c[k];
+        b2 = b1;
+        b1 = b0;
+    }
+    return c[0] + t*b1 - b2;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::scale_radius() const
+{
+    return _rs;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> FamilyModel::parameters() const
+{
+    return {_Mtot, _rs, _s};
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool FamilyModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    return _model->exponential_tail(b,r0,m);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> FamilyModel::breakpoints() const
+{
+    return _model->breakpoints();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool FamilyModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->outer_expansion(xt,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool FamilyModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->inner_expansion(xs,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::total_mass() const
+{
+    return _Mtot;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::central_potential() const
+{
+    return _Psi0;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::density(double r) const
+{
+    double t;
+    int p = locate(r,LogRho,t);
+    if (p<0) return _model->density(r);
+    return _scale[LogRho] * exp(evaluate(p,LogRho,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = FamilyModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::derivative_density(double r) const
+{
+    double t;
+    int p = locate(r,LogRho,t);
+    if (p<0) return _model->derivative_density(r);
+    double rho = _scale[LogRho] * exp(evaluate(p,LogRho,t));
+    return rho/r * evaluate(p,DLogRho,t);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyModel::derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = FamilyModel::derivative_density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::second_derivative_density(double r) const
+{
+    double t;
+    int p = locate(r,LogRho,t);
+    if (p<0) return _model->second_derivative_density(r);
+    double rho = _scale[LogRho] * exp(evaluate(p,LogRho,t));
+    double L1 = evaluate(p,DLogRho,t);
+    double L2 = evaluate(p,D2LogRho,t);
+    return rho/(r*r) * (L2 + L1*L1 - L1);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyModel::second_derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = FamilyModel::second_derivative_density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::mass(double r) const
+{
+    double t;
+    int p = locate(r,LogMass,t);
+    if (p<0) return _model->mass(r);
+    return _scale[LogMass] * exp(evaluate(p,LogMass,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyModel::mass(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = FamilyModel::mass(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::potential(double r) const
+{
+    double t;
+    int p = locate(r,LogPsi,t);
+    if (p<0) return _model->potential(r);
+    return _scale[LogPsi] * exp(evaluate(p,LogPsi,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyModel::potential(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = FamilyModel::potential(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::surface_density(double R) const
+{
+    double t;
+    int p = locate(R,LogSigma,t);
+    if (p<0) return _model->surface_density(R);
+    return _scale[LogSigma] * exp(evaluate(p,LogSigma,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyModel::surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = FamilyModel::surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::derivative_surface_density(double R) const
+{
+    double t;
+    int p = locate(R,LogSigma,t);
+    if (p<0) return _model->derivative_surface_density(R);
+    double Sigma = _scale[LogSigma] * exp(evaluate(p,LogSigma,t));
+    return Sigma/R * evaluate(p,DLogSigma,t);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = FamilyModel::derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::isotropic_dispersion(double r) const
+{
+    double t;
+    int p = locate(r,LogDisp,t);
+    if (p<0) return _model->isotropic_dispersion(r);
+    return _scale[LogDisp] * exp(evaluate(p,LogDisp,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::isotropic_distribution_function(double r) const
+{
+    double t;
+    int p = locate(r,LogDF,t);
+    if (p<0) return _model->isotropic_distribution_function(r);
+    return _scale[LogDF] * exp(evaluate(p,LogDF,t));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyModel::shape_parameter() const
+{
+    return _s;
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef FAMILYMODEL_HPP
+#define FAMILYMODEL_HPP
+
+#include "FamilyTable.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** FamilyModel is a subclass of the Model class that represents a member of a one-parameter family of models, with total mass \f$M_{\text{tot}}\f$, scale radius \f$r_{\text{s}}\f$ and shape parameter \f$s\f$, whose profiles are served from a FamilyTable. At construction, the tabulated logarithms of the profiles of the unit model are interpolated to the shape parameter and converted to Chebyshev expansions in \f$x = \ln(r/r_{\text{s}})\f$ on each panel of the table, as in the ChebyshevModel class. The profiles then follow from the exact scalings with the total mass and the scale radius, \f[ \rho(r) = \frac{M_{\text{tot}}}{r_{\text{s}}^3}\,\tilde\rho(x), \quad M(r) = M_{\text{tot}}\,\tilde M(x), \quad \Psi(r) = \frac{GM_{\text{tot}}}{r_{\text{s}}}\,\tilde\Psi(x), \quad \Sigma(R) = \frac{M_{\text{tot}}}{r_{\text{s}}^2}\,\tilde\Sigma(x), \quad \sigma^2_{\text{iso}}(r) = \frac{GM_{\text{tot}}}{r_{\text{s}}}\,\tilde\sigma^2_{\text{iso}}(x), \quad f_{\text{iso}} = \left(G^3M_{\text{tot}}\,r_{\text{s}}^3\right)^{-1/2} \tilde f_{\text{iso}}(x), \f] with the tilde denoting the profiles of the unit model. Each profile costs a single Chebyshev sum, such that a member of a family without analytical profiles, such as a Sérsic model, is about as cheap to evaluate as a Plummer model, and its isotropic dispersion and distribution function are no longer integrals. Outside the range of the table, and on panels where the table marks a profile as direct, the profiles are calculated by a model of the family with the same parameters, which is created at construction. All other properties are calculated by the Model base class from the tabulated profiles. */
+
+class FamilyModel : public Model
+{
+public:
+
+    /** Constructor of the FamilyModel class. It reads in the table, which should remain alive as long as the model is used, the total mass \f$M_{\text{tot}}\f$, the scale radius \f$r_{\text{s}}\f$, the shape parameter \f$s\f$, which should lie within the range of the table, and the Gauss-Legendre integrator. */
+    FamilyModel(const FamilyTable* table, double Mtot, double rs, double s, const GaussLegendre* gl);
+
+    /** This function returns the scale radius \f$r_{\text{s}}\f$. */
+    double scale_radius() const;
+
+    /** This function returns the total mass \f$M_{\text{tot}}\f$, the scale radius \f$r_{\text{s}}\f$ and the shape parameter \f$s\f$, in the order of the constructor. */
+    std::vector<double> parameters() const;
+
+    /** This function returns the stretched exponential tail of the member model, if it has one. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+
+    /** This function returns the breakpoints of the member model. */
+    std::vector<double> breakpoints() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the member model, if it has one. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the member model, if it has one. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the total mass \f$M_{\text{tot}}\f$. */
+    double total_mass() const;
+
+    /** This function returns the central potential \f$\Psi_0\f$, interpolated from the table, or calculated by the member model if the central potential of the family is not finite. */
+    double central_potential() const;
+
+    /** This function returns the density \f$\rho(r)\f$ at radius \f$r\f$. */
+    double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the derivative of the density \f$\rho'(r)\f$ at radius \f$r\f$, from the derivative of the expansion of \f$\ln\rho\f$. */
+    double derivative_density(double r) const;
+
+    /** This function stores the derivative of the density \f$\rho'(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the second derivative of the density \f$\rho''(r)\f$ at radius \f$r\f$, from the first and second derivatives of the expansion of \f$\ln\rho\f$. */
+    double second_derivative_density(double r) const;
+
+    /** This function stores the second derivative of the density \f$\rho''(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void second_derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the mass \f$M(r)\f$ at radius \f$r\f$. */
+    double mass(double r) const;
+
+    /** This function stores the mass \f$M(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void mass(const double* r, double* out, size_t n) const;
+
+    /** This function returns the potential \f$\Psi(r)\f$ at radius \f$r\f$. */
+    double potential(double r) const;
+
+    /** This function stores the potential \f$\Psi(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void potential(const double* r, double* out, size_t n) const;
+
+    /** This function returns the surface density \f$\Sigma(R)\f$ at projected radius \f$R\f$. */
+    double surface_density(double R) const;
+
+    /** This function stores the surface density \f$\Sigma(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ at projected radius \f$R\f$, from the derivative of the expansion of \f$\ln\Sigma\f$. */
+    double derivative_surface_density(double R) const;
+
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the isotropic velocity dispersion \f$\sigma^2_{\text{iso}}(r)\f$ at radius \f$r\f$. */
+    double isotropic_dispersion(double r) const;
+
+    /** This function returns the isotropic distribution function \f$f_{\text{iso}}({\cal{E}})\f$ at binding energy \f${\cal{E}}=\Psi(r)\f$. */
+    double isotropic_distribution_function(double r) const;
+
+    /** This function returns the shape parameter \f$s\f$. */
+    double shape_parameter() const;
+
+private:
+
+    /** The Chebyshev series of each panel: the logarithms of the tabulated profiles, in the order of FamilyTable::Profile, and the derivatives with respect to \f$x\f$ of the logarithms of the density and the surface density. */
+    enum Series { LogRho, LogMass, LogPsi, LogSigma, LogDisp, LogDF, DLogRho, D2LogRho, DLogSigma, NumSeries };
+
+    /** This function returns the index of the panel that contains radius \f$r\f$ and stores the corresponding value of \f$t\f$, or returns -1 if tabulated profile \f$k\f$ at that radius should be calculated by the member model. */
+    int locate(double r, int k, double& t) const;
+
+    /** This function returns the value of series \f$s\f$ of panel \f$p\f$ at \f$t\f$, using Clenshaw's recurrence. */
+    double evaluate(int p, int s, double t) const;
+
+    /** The table. */
+    const FamilyTable* _table;
+
+    /** The member model with the same parameters, for the profiles that are not tabulated. */
+    std::unique_ptr<Model> _model;
+
+    /** The total mass \f$M_{\text{tot}}\f$. */
+    double _Mtot;
+
+    /** The scale radius \f$r_{\text{s}}\f$. */
+    double _rs;
+
+    /** The shape parameter \f$s\f$. */
+    double _s;
+
+    /** The central potential. */
+    double _Psi0;
+
+    /** The factors that scale the tabulated profiles of the unit model, in the order of FamilyTable::Profile. */
+    double _scale[FamilyTable::NumProfiles];
+
+    /** The coefficients of all series of all panels, stored in _c[(p*NumSeries+s)*(N+1)+k]. */
+    std::vector<double> _c;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
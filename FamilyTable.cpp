@@ -0,0 +1,537 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "FamilyTable.hpp"
+#include "ChebyshevModel.hpp"
+#include "EinastoModel.hpp"
+#include "GammaModel.hpp"
+#include "HypervirialModel.hpp"
+#include "SersicModel.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+//////////////////////////////////////////////////////////////////////
+
+constexpr int FamilyTable::N;
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The approximate width in ln r of the panels
+    const double hpanel = 1.0;
+
+    // The tolerance of the Chebyshev model from which the distribution function is sampled
+    const double dftol = 1e-12;
+
+    // The factor by which the range of that Chebyshev model extends beyond the range of the table on either side
+    const double dfwiden = 100.0;
+
+    // The number of steps in which the outer limit of that Chebyshev model is widened, as long as the density of the
+    // unit model does not underflow
+    const int numwiden = 8;
+
+    // The initial number of shape nodes, which is refined to 2K-1 nodes until the tolerance is reached
+    const int initshapes = 17;
+
+    // The signature, version and byte order mark of the cache files; the version should be incremented whenever the
+    // layout of the file or the tabulation algorithm changes
+    const char cachemagic[8] = {'S','p','h','e','C','o','w','F'};
+    const uint32_t cacheversion = 2;
+    const uint32_t cachebyteorder = 0x01020304;
+
+    // The header of a cache file, followed by the key padded to a multiple of eight bytes, the central potentials,
+    // the flags of the direct panels, the samples and the error estimate
+    struct CacheHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteorder;
+        uint64_t keysize;
+        uint64_t numshapes;
+        uint64_t numpanels;
+    };
+
+    // This function returns the size rounded up to a multiple of eight bytes
+    size_t padded(size_t size)
+    {
+        return (size+7)/8*8;
+    }
+
+    // This function stores the Chebyshev coefficients of the function sampled at the n+1 Chebyshev-Lobatto points
+    // cos(j pi/n) in c, such that f(t) = sum_k c_k T_k(t)
+    void chebyshev_coefficients(const double* f, double* c, int n)
+    {
+        for (int k=0; k<=n; k++)
+        {
+            double sum = 0.0;
+            for (int j=0; j<=n; j++)
+            {
+                double w = (j==0 || j==n) ? 0.5 : 1.0;
+                sum += w * f[j] * cos(j*k*M_PI/n);
+            }
+            c[k] = 2.0/n * sum;
+        }
+        c[0] *= 0.5;
+        c[n] *= 0.5;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+FamilyTable::FamilyTable(Family family, double smin, double smax, const GaussLegendre* gl, double tol, int maxshapes, double xmin, double xmax)
+{
+    setup(family, smin, smax, tol, maxshapes, xmin, xmax);
+    tabulate(gl);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+FamilyTable::FamilyTable(Family family, double smin, double smax, const GaussLegendre* gl, std::string filename, double tol, int maxshapes, double xmin, double xmax)
+{
+    setup(family, smin, smax, tol, maxshapes, xmin, xmax);
+    std::string key = cache_key(gl);
+    if (load(filename,key))
+    {
+        _fromcache = true;
+        return;
+    }
+    tabulate(gl);
+    save(filename,key);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::setup(Family family, double smin, double smax, double tol, int maxshapes, double xmin, double xmax)
+{
+    _family = family;
+    _smin = smin;
+    _smax = smax;
+    _tol = tol;
+    _maxshapes = max(maxshapes,2);
+    set_shapes(min(initshapes,_maxshapes));
+
+    _x0 = log(xmin);
+    _P = max(1, static_cast<int>(ceil((log(xmax)-_x0)/hpanel - 1e-9)));
+    _h = (log(xmax)-_x0)/_P;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::set_shapes(int K)
+{
+    // The shape nodes are the Chebyshev-Lobatto points of the range, in decreasing order, with the barycentric
+    // weights (-1)^k, halved at the end points
+
+    _sv.resize(K);
+    _wv.resize(K);
+    for (int k=0; k<K; k++)
+    {
+        _sv[k] = 0.5*(_smin+_smax) + 0.5*(_smax-_smin)*cos(k*M_PI/(K-1));
+        _wv[k] = (k%2 ? -1.0 : 1.0) * ((k==0 || k==K-1) ? 0.5 : 1.0);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+Model* FamilyTable::create_model(Family family, double Mtot, double rs, double s, const GaussLegendre* gl)
+{
+    switch (family)
+    {
+    case Sersic: return new SersicModel(Mtot, rs, s, gl);
+    case Einasto: return new EinastoModel(Mtot, rs, s, gl);
+    case Gamma: return new GammaModel(Mtot, rs, s, gl);
+    case Hypervirial: return new HypervirialModel(Mtot, rs, s, gl);
+    }
+    return nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+size_t FamilyTable::index(int i, int p, int k, int j) const
+{
+    return ((static_cast<size_t>(i)*_P + p)*NumProfiles + k)*(N+1) + j;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::sample(double s, const GaussLegendre* gl, double* values, double& logPsi0) const
+{
+    size_t n = _P*(N+1);
+    std::vector<double> rv(n);
+    for (int p=0; p<_P; p++)
+        for (int j=0; j<=N; j++)
+            rv[p*(N+1)+j] = exp(_x0 + _h*(p + 0.5 + 0.5*cos(j*M_PI/N)));
+
+    std::vector<double> fv(NumProfiles*n);
+    std::unique_ptr<Model> unit(create_model(_family, 1.0, 1.0, s, gl));
+    unit->density(rv.data(), fv.data()+LogRho*n, n);
+    unit->mass(rv.data(), fv.data()+LogMass*n, n);
+    unit->potential(rv.data(), fv.data()+LogPsi*n, n);
+    unit->surface_density(rv.data(), fv.data()+LogSigma*n, n);
+    logPsi0 = log(unit->central_potential());
+
+    // The helper model does not extend into the region where the density underflows, since it would bisect its
+    // panels down to the minimum width there; the distribution function is not sampled in that region, where the
+    // table marks it as direct
+
+    int Ppos = 0;
+    while (Ppos<_P && std::all_of(fv.begin()+LogRho*n+Ppos*(N+1), fv.begin()+LogRho*n+(Ppos+1)*(N+1),
+                                  [](double f) { return f>0.0 && f<std::numeric_limits<double>::infinity(); }))
+        Ppos++;
+    double rmax = exp(_x0+Ppos*_h);
+    if (Ppos==_P)
+        for (int k=0; k<numwiden && unit->density(rmax*pow(dfwiden,1.0/numwiden))>0.0; k++)
+            rmax *= pow(dfwiden,1.0/numwiden);
+    ChebyshevModel helper(unit.get(), gl, dftol, exp(_x0)/dfwiden, rmax);
+    for (size_t m=0; m<n; m++)
+        fv[LogDF*n+m] = static_cast<int>(m/(N+1))<Ppos ? helper.isotropic_distribution_function(rv[m]) : 0.0;
+
+    // The dispersion follows from rho(r) sigma^2(r) = int_r^infty rho M / u^2 du, which is integrated from the
+    // outer edge of the table inwards with the antiderivative of the Chebyshev expansion of the integrand in ln u
+    // on each panel; the integral beyond the table is calculated by the helper model
+
+    const double* rho = fv.data()+LogRho*n;
+    const double* M = fv.data()+LogMass*n;
+    double* disp = fv.data()+LogDisp*n;
+    size_t last = (_P-1)*(N+1);
+    double I = rho[last]>0.0 ? helper.isotropic_dispersion(rv[last])*rho[last] : 0.0;
+    for (int p=_P-1; p>=0; p--)
+    {
+        double G[N+1], c[N+1], F[N+2];
+        for (int j=0; j<=N; j++)
+        {
+            size_t m = p*(N+1)+j;
+            G[j] = 0.5*_h * rho[m]*M[m]/rv[m];
+        }
+        chebyshev_coefficients(G,c,N);
+        std::fill(F, F+N+2, 0.0);
+        F[1] += c[0];
+        F[2] += 0.25*c[1];
+        for (int k=2; k<=N; k++)
+        {
+            F[k+1] += c[k]/(2.0*(k+1));
+            F[k-1] -= c[k]/(2.0*(k-1));
+        }
+        double Fplus = 0.0, Fminus = 0.0;
+        for (int k=0; k<=N+1; k++)
+        {
+            Fplus += F[k];
+            Fminus += (k%2 ? -F[k] : F[k]);
+        }
+        for (int j=0; j<=N; j++)
+        {
+            double Fj = 0.0;
+            for (int k=0; k<=N+1; k++) Fj += F[k]*cos(j*k*M_PI/N);
+            size_t m = p*(N+1)+j;
+            disp[m] = (I + Fplus - Fj) / rho[m];
+        }
+        I += Fplus - Fminus;
+    }
+
+    for (int k=0; k<NumProfiles; k++)
+        for (int p=0; p<_P; p++)
+            for (int j=0; j<=N; j++)
+                values[(p*NumProfiles+k)*(N+1)+j] = log(fv[k*n+p*(N+1)+j]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::flag_direct()
+{
+    int K = _sv.size();
+    _direct.assign(_P*NumProfiles, 0.0);
+    double c[N+1];
+    for (int p=0; p<_P; p++)
+        for (int k=0; k<NumProfiles; k++)
+            for (int i=0; i<K; i++)
+            {
+                const double* v = &_values[index(i,p,k,0)];
+                if (!std::all_of(v, v+N+1, [](double f) { return std::isfinite(f); }))
+                {
+                    _direct[p*NumProfiles+k] = 1.0;
+                    break;
+                }
+                chebyshev_coefficients(v, c, N);
+                if (fabs(c[N-1])+fabs(c[N]) > _tol)
+                {
+                    _direct[p*NumProfiles+k] = 1.0;
+                    break;
+                }
+            }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::tabulate(const GaussLegendre* gl)
+{
+    size_t block = static_cast<size_t>(_P)*NumProfiles*(N+1);
+    int K = _sv.size();
+    _values.resize(K*block);
+    _logPsi0.resize(K);
+    for (int i=0; i<K; i++) sample(_sv[i], gl, &_values[i*block], _logPsi0[i]);
+    flag_direct();
+
+    // Refine the shape nodes to the 2K-1 Chebyshev-Lobatto points, which contain the current nodes at the even
+    // indices, until the error budget in the shape parameter is within the tolerance
+
+    double errx, errs;
+    estimate_error(errx, errs);
+    while (errs > _tol && 2*K-1 <= _maxshapes)
+    {
+        std::vector<double> values((2*K-1)*block), logPsi0(2*K-1);
+        for (int i=0; i<K; i++)
+        {
+            std::copy(&_values[i*block], &_values[i*block]+block, &values[2*i*block]);
+            logPsi0[2*i] = _logPsi0[i];
+        }
+        K = 2*K-1;
+        set_shapes(K);
+        for (int i=1; i<K; i+=2) sample(_sv[i], gl, &values[i*block], logPsi0[i]);
+        _values.swap(values);
+        _logPsi0.swap(logPsi0);
+        flag_direct();
+        estimate_error(errx, errs);
+    }
+    _error = errx + errs;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::estimate_error(double& errx, double& errs) const
+{
+    // Estimate the error budget from the last Chebyshev coefficients in x and in s
+
+    int K = _sv.size();
+    errx = 0.0;
+    errs = 0.0;
+    std::vector<double> f(max(K,N+1)), c(max(K,N+1));
+    for (int p=0; p<_P; p++)
+        for (int k=0; k<NumProfiles; k++)
+        {
+            if (direct(p,k)) continue;
+            for (int i=0; i<K; i++)
+            {
+                chebyshev_coefficients(&_values[index(i,p,k,0)], c.data(), N);
+                errx = max(errx, fabs(c[N-1])+fabs(c[N]));
+            }
+            for (int j=0; j<=N; j++)
+            {
+                for (int i=0; i<K; i++) f[i] = _values[index(i,p,k,j)];
+                chebyshev_coefficients(f.data(), c.data(), K-1);
+                errs = max(errs, fabs(c[K-2])+fabs(c[K-1]));
+            }
+        }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::string FamilyTable::cache_key(const GaussLegendre* gl) const
+{
+    double smid = 0.5*(_smin+_smax);
+    std::unique_ptr<Model> unit(create_model(_family, 1.0, 1.0, smid, gl));
+    std::vector<double> values = {static_cast<double>(_family), _smin, _smax, _tol, static_cast<double>(_maxshapes),
+                                  static_cast<double>(N), _x0, _h, static_cast<double>(_P), dftol, dfwiden,
+                                  unit->density(1.0), unit->mass(1.0)};
+    std::string key = "FamilyTable";
+    key.push_back('\0');
+    key.append(reinterpret_cast<const char*>(values.data()), values.size()*sizeof(double));
+    return key;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool FamilyTable::load(const std::string& filename, const std::string& key)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) return false;
+
+    // Verify the header and the key
+
+    CacheHeader header;
+    memset(&header, 0, sizeof(header));
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || memcmp(header.magic,cachemagic,sizeof(cachemagic)) || header.version!=cacheversion
+            || header.byteorder!=cachebyteorder || header.keysize!=key.size()
+            || header.numshapes<2 || header.numshapes>static_cast<uint64_t>(_maxshapes)
+            || header.numpanels!=static_cast<uint64_t>(_P)) return false;
+    std::string filekey(padded(key.size()),'\0');
+    file.read(&filekey[0], filekey.size());
+    if (!file || filekey.compare(0,key.size(),key)) return false;
+
+    // Read the table
+
+    int K = header.numshapes;
+    std::vector<double> logPsi0(K), direct(_P*NumProfiles), values(static_cast<size_t>(K)*_P*NumProfiles*(N+1));
+    double error;
+    file.read(reinterpret_cast<char*>(logPsi0.data()), logPsi0.size()*sizeof(double));
+    file.read(reinterpret_cast<char*>(direct.data()), direct.size()*sizeof(double));
+    file.read(reinterpret_cast<char*>(values.data()), values.size()*sizeof(double));
+    file.read(reinterpret_cast<char*>(&error), sizeof(double));
+    if (!file || file.peek()!=std::ifstream::traits_type::eof()) return false;
+    set_shapes(K);
+    _logPsi0.swap(logPsi0);
+    _direct.swap(direct);
+    _values.swap(values);
+    _error = error;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::save(const std::string& filename, const std::string& key) const
+{
+    CacheHeader header;
+    memcpy(header.magic,cachemagic,sizeof(cachemagic));
+    header.version = cacheversion;
+    header.byteorder = cachebyteorder;
+    header.keysize = key.size();
+    header.numshapes = _sv.size();
+    header.numpanels = _P;
+
+    std::random_device random;
+    std::string tempname = filename + ".tmp" + std::to_string(random());
+    {
+        std::ofstream file(tempname, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(key.data(), key.size());
+        file.write(std::string(padded(key.size())-key.size(),'\0').data(), padded(key.size())-key.size());
+        file.write(reinterpret_cast<const char*>(_logPsi0.data()), _logPsi0.size()*sizeof(double));
+        file.write(reinterpret_cast<const char*>(_direct.data()), _direct.size()*sizeof(double));
+        file.write(reinterpret_cast<const char*>(_values.data()), _values.size()*sizeof(double));
+        file.write(reinterpret_cast<const char*>(&_error), sizeof(double));
+        if (!file)
+        {
+            file.close();
+            std::remove(tempname.c_str());
+            return;
+        }
+    }
+#ifdef _WIN32
+    std::remove(filename.c_str());
+#endif
+    if (std::rename(tempname.c_str(), filename.c_str())) std::remove(tempname.c_str());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+FamilyTable::Family FamilyTable::family() const
+{
+    return _family;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyTable::shape_min() const
+{
+    return _sv.back();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyTable::shape_max() const
+{
+    return _sv.front();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int FamilyTable::num_panels() const
+{
+    return _P;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyTable::panel_start() const
+{
+    return _x0;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyTable::panel_width() const
+{
+    return _h;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool FamilyTable::direct(int p, int k) const
+{
+    return _direct[p*NumProfiles+k]!=0.0;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void FamilyTable::interpolate(double s, int p, int k, double* v) const
+{
+    int K = _sv.size();
+    for (int i=0; i<K; i++)
+        if (s==_sv[i])
+        {
+            for (int j=0; j<=N; j++) v[j] = _values[index(i,p,k,j)];
+            return;
+        }
+
+    // The barycentric formula sum_i q_i v_i / sum_i q_i, with q_i = w_i / (s-s_i)
+
+    std::fill(v, v+N+1, 0.0);
+    double den = 0.0;
+    for (int i=0; i<K; i++)
+    {
+        double q = _wv[i]/(s-_sv[i]);
+        den += q;
+        const double* vi = &_values[index(i,p,k,0)];
+        for (int j=0; j<=N; j++) v[j] += q*vi[j];
+    }
+    for (int j=0; j<=N; j++) v[j] /= den;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyTable::central_potential(double s) const
+{
+    int K = _sv.size();
+    for (int i=0; i<K; i++)
+        if (!std::isfinite(_logPsi0[i])) return std::numeric_limits<double>::infinity();
+    double num = 0.0, den = 0.0;
+    for (int i=0; i<K; i++)
+    {
+        if (s==_sv[i]) return exp(_logPsi0[i]);
+        double q = _wv[i]/(s-_sv[i]);
+        num += q*_logPsi0[i];
+        den += q;
+    }
+    return exp(num/den);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int FamilyTable::num_shapes() const
+{
+    return _sv.size();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double FamilyTable::error_estimate() const
+{
+    return _error;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool FamilyTable::from_cache() const
+{
+    return _fromcache;
+}
+
+//////////////////////////////////////////////////////////////////////
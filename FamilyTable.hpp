@@ -0,0 +1,158 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef FAMILYTABLE_HPP
+#define FAMILYTABLE_HPP
+
+#include "Model.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** FamilyTable is the class that tabulates the dimensionless profiles of a one-parameter family of models. Once the total mass and the scale radius are scaled out, the Sérsic models (with Sérsic index \f$m\f$), the Einasto models (with Einasto index \f$n\f$), the gamma models (with inner slope \f$\gamma\f$) and the hypervirial models (with parameter \f$p\f$) only depend on a single shape parameter \f$s\f$. The table holds, for the unit model with \f$M_{\text{tot}}=1\f$ and scale radius 1, the density \f$\rho\f$, the mass \f$M\f$, the potential \f$\Psi\f$, the surface density \f$\Sigma\f$, the isotropic velocity dispersion \f$\sigma^2_{\text{iso}}\f$ and the isotropic distribution function \f$f_{\text{iso}}\f$ as a function of the shape parameter and of \f$x = \ln(r/r_{\text{s}})\f$. A FamilyModel object serves the profiles of any member of the family from the table, with any total mass and scale radius, using the exact scaling of each profile with these two parameters.
+
+    The range in \f$x\f$ is divided into panels of unit width, and the range of the shape parameter is sampled at the \f$K\f$ Chebyshev-Lobatto points \f$s_k\f$. The number of shape nodes is chosen from the tolerance of the table: starting from \f$K=17\f$, the number of intervals is doubled, which keeps the existing nodes, until the magnitude of the last two Chebyshev coefficients in the shape parameter is within the tolerance for all tabulated samples, or until the maximum number of shape nodes is reached. The logarithm of every profile is stored at the Chebyshev-Lobatto points of degree \f$N=16\f$ of every panel, for every shape node. A model with shape parameter \f$s\f$ interpolates these values in \f$s\f$ with the barycentric Lagrange formula, which is spectrally accurate on Chebyshev points, and converts them to Chebyshev expansions in \f$x\f$ on each panel, as in the ChebyshevModel class. The density, the mass, the potential and the surface density are sampled from the unit model directly. The distribution function is sampled from a ChebyshevModel that wraps the unit model with a tolerance of \f$10^{-12}\f$, over a range that extends beyond the table but stops where the density of the unit model underflows, and the dispersion is integrated panel by panel from the outer edge of the table inwards, using the Chebyshev antiderivative of the integrand \f$\rho\,M/r^2\f$. On panels where a profile is not strictly positive for some shape node, for example where the density of a Sérsic model with a small index underflows, and on panels where the last two Chebyshev coefficients in \f$x\f$ of a profile exceed the tolerance for some shape node, for example where the samples of the distribution function near the inner edge of the table are affected by the error of its quadrature, the profile is calculated by the member model directly.
+
+    The error budget of the table is estimated at construction as the sum of the largest magnitude of the last two Chebyshev coefficients in \f$x\f$, over all tabulated panels, profiles and shape nodes, and the largest magnitude of the last two Chebyshev coefficients in \f$s\f$, over all tabulated samples. Since the profiles are interpolated in logarithm, this is an estimate of the relative interpolation error; it does not include the error of the sampled values themselves, which is of the order of \f$10^{-9}\f$ for the distribution function. The interpolation error in the shape parameter is largest at the edges of the table in \f$x\f$, where the profiles depend most steeply on the shape parameter; for example, 33 shape nodes reproduce the density of the Sérsic models with \f$1\le m\le 6\f$ to a relative accuracy of \f$10^{-8}\f$ for \f$r\lesssim 10\,r_{\text{s}}\f$ but only to \f$10^{-6}\f$ further out, such that the default tolerance selects 65 shape nodes for this range. The construction of a table evaluates the distribution function at all samples and takes a fraction of a second per shape node, so a table can be stored in a cache file, such that it is generated once and then shipped with an application or shared by later runs. The file is a versioned binary file that starts with a key, which consists of the family, the parameters of the table, including its tolerance and maximum number of shape nodes, and the density and mass of the unit model at the central shape parameter, which identify the quadrature of the unit models. */
+
+class FamilyTable
+{
+public:
+
+    /** The supported families of models. */
+    enum Family { Sersic, Einasto, Gamma, Hypervirial };
+
+    /** The tabulated profiles, each stored in logarithm. */
+    enum Profile { LogRho, LogMass, LogPsi, LogSigma, LogDisp, LogDF, NumProfiles };
+
+    /** The degree of the Chebyshev expansions in \f$x\f$ on each panel. */
+    static constexpr int N = 16;
+
+    /** Constructor of the FamilyTable class. It reads in the family, the range \f$[s_{\text{min}},s_{\text{max}}]\f$ of the shape parameter, the Gauss-Legendre integrator for the unit models, the relative tolerance of the table, the maximum number of shape nodes, and the range of the table in units of the scale radius. */
+    FamilyTable(Family family, double smin, double smax, const GaussLegendre* gl, double tol = 1e-8, int maxshapes = 257, double xmin = 1e-4, double xmax = 1e4);
+
+    /** Constructor of the FamilyTable class that uses a cache file. It reads in the same arguments as the constructor above, and the name of the cache file. If the file holds a table with the same key, the table is read from the file; otherwise, the table is constructed and written to the file. Failures to write the file are ignored. */
+    FamilyTable(Family family, double smin, double smax, const GaussLegendre* gl, std::string filename, double tol = 1e-8, int maxshapes = 257, double xmin = 1e-4, double xmax = 1e4);
+
+    /** This function returns a new model of the family with total mass \f$M_{\text{tot}}\f$, scale radius \f$r_{\text{s}}\f$ and shape parameter \f$s\f$, i.e. a SersicModel with effective radius \f$r_{\text{s}}\f$ and Sérsic index \f$s\f$, an EinastoModel with half-mass radius \f$r_{\text{s}}\f$ and Einasto index \f$s\f$, a GammaModel with scale radius \f$r_{\text{s}}\f$ and inner slope \f$s\f$, or a HypervirialModel with scale radius \f$r_{\text{s}}\f$ and parameter \f$s\f$. The caller takes ownership of the model. */
+    static Model* create_model(Family family, double Mtot, double rs, double s, const GaussLegendre* gl);
+
+    /** This function returns the family of the table. */
+    Family family() const;
+
+    /** This function returns the lower limit \f$s_{\text{min}}\f$ of the shape parameter. */
+    double shape_min() const;
+
+    /** This function returns the upper limit \f$s_{\text{max}}\f$ of the shape parameter. */
+    double shape_max() const;
+
+    /** This function returns the number of panels in \f$x\f$. */
+    int num_panels() const;
+
+    /** This function returns the lower limit of the table in \f$x = \ln(r/r_{\text{s}})\f$. */
+    double panel_start() const;
+
+    /** This function returns the width of the panels in \f$x\f$. */
+    double panel_width() const;
+
+    /** This function returns true if profile \f$k\f$ on panel \f$p\f$ should be calculated by the member model directly. */
+    bool direct(int p, int k) const;
+
+    /** This function stores the logarithm of profile \f$k\f$ of the unit model with shape parameter \f$s\f$ at the \f$N+1\f$ Chebyshev-Lobatto points of panel \f$p\f$ in the array v, interpolated in the shape parameter. */
+    void interpolate(double s, int p, int k, double* v) const;
+
+    /** This function returns the central potential of the unit model with shape parameter \f$s\f$, interpolated in the shape parameter, or an infinite value if the central potential of the family is not finite over the range of the table. */
+    double central_potential(double s) const;
+
+    /** This function returns the number \f$K\f$ of shape nodes. */
+    int num_shapes() const;
+
+    /** This function returns the estimate of the relative interpolation error of the table. */
+    double error_estimate() const;
+
+    /** This function returns true if the table was read from a cache file. */
+    bool from_cache() const;
+
+private:
+
+    /** This function sets up the initial shape nodes and the panels, and stores the tolerance and the maximum number of shape nodes. */
+    void setup(Family family, double smin, double smax, double tol, int maxshapes, double xmin, double xmax);
+
+    /** This function sets up \f$K\f$ shape nodes and their barycentric weights over the range of the table. */
+    void set_shapes(int K);
+
+    /** This function stores the logarithms of the profiles of the unit model with shape parameter \f$s\f$ at all Chebyshev-Lobatto points of all panels in the array values, in the order of the function index() for a single shape node, and the logarithm of its central potential in logPsi0. */
+    void sample(double s, const GaussLegendre* gl, double* values, double& logPsi0) const;
+
+    /** This function marks the profiles on the panels that are not strictly positive for some shape node, or whose last two Chebyshev coefficients in \f$x\f$ exceed the tolerance for some shape node, as direct. */
+    void flag_direct();
+
+    /** This function samples the profiles of the unit models at the shape nodes, doubling the number of intervals in the shape parameter until the error budget in the shape parameter is within the tolerance, and stores the error budget. */
+    void tabulate(const GaussLegendre* gl);
+
+    /** This function stores the largest magnitude of the last two Chebyshev coefficients in \f$x\f$, over all tabulated panels, profiles and shape nodes, in errx, and the largest magnitude of the last two Chebyshev coefficients in \f$s\f$, over all tabulated samples, in errs. */
+    void estimate_error(double& errx, double& errs) const;
+
+    /** This function returns the key of the cache file: the family and the parameters of the table, including its tolerance and maximum number of shape nodes, followed by the density and mass of the unit model at the central shape parameter. */
+    std::string cache_key(const GaussLegendre* gl) const;
+
+    /** This function reads the table from the cache file, if the file holds a table with the given key. It returns true on success. */
+    bool load(const std::string& filename, const std::string& key);
+
+    /** This function writes the table to the cache file with the given key. The file is written under a temporary name and then renamed, such that other processes never see a partial file. */
+    void save(const std::string& filename, const std::string& key) const;
+
+    /** This function returns the index of the value of profile \f$k\f$ at Chebyshev-Lobatto point \f$j\f$ of panel \f$p\f$ for shape node \f$i\f$. */
+    size_t index(int i, int p, int k, int j) const;
+
+    /** The family. */
+    Family _family;
+
+    /** The lower limit \f$s_{\text{min}}\f$ of the shape parameter. */
+    double _smin;
+
+    /** The upper limit \f$s_{\text{max}}\f$ of the shape parameter. */
+    double _smax;
+
+    /** The relative tolerance of the table. */
+    double _tol;
+
+    /** The maximum number of shape nodes. */
+    int _maxshapes;
+
+    /** The shape nodes \f$s_k\f$. */
+    std::vector<double> _sv;
+
+    /** The barycentric weights of the shape nodes. */
+    std::vector<double> _wv;
+
+    /** The lower limit of the table in \f$x\f$. */
+    double _x0;
+
+    /** The width of the panels in \f$x\f$. */
+    double _h;
+
+    /** The number of panels. */
+    int _P;
+
+    /** The logarithms of the profiles at all samples. */
+    std::vector<double> _values;
+
+    /** The flags that mark the profiles on the panels that are calculated directly, stored as 0 or 1. */
+    std::vector<double> _direct;
+
+    /** The logarithms of the central potential at the shape nodes. */
+    std::vector<double> _logPsi0;
+
+    /** The estimate of the relative interpolation error. */
+    double _error;
+
+    /** True if the table was read from a cache file. */
+    bool _fromcache = false;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
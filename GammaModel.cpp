@@ -9,12 +9,27 @@
 //////////////////////////////////////////////////////////////////////
 
 GammaModel::GammaModel(double Mtot, double b, double gamma, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, b, gamma);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void GammaModel::set_parameters(double Mtot, double b, double gamma)
 {
     _Mtot = Mtot;
     _b = b;
     _gamma = gamma;
     _rhob = _Mtot/pow(_b,3) * (3.0-gamma)/(4.0*M_PI);
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> GammaModel::parameters() const
+{
+    return {_Mtot, _b, _gamma};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -26,6 +41,28 @@ double GammaModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool GammaModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = 10.0;
+    p = 4.0;
+    alpha = 1.0;
+    av = binomial_series(_rhob, 4.0-_gamma);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool GammaModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = 0.1;
+    p = _gamma;
+    alpha = 1.0;
+    av = binomial_series(_rhob, 4.0-_gamma);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double GammaModel::density(double r) const
 {
     double t = r/_b;
@@ -34,6 +71,13 @@ double GammaModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void GammaModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = GammaModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double GammaModel::derivative_density(double r) const
 {
     double t = r/_b;
@@ -19,12 +19,27 @@ public:
 
     /** Constructor of the GammaModel class. */
     GammaModel(double Mtot, double b, double gamma, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the GammaModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double b, double gamma);
+
+    /** This function returns the parameters of the GammaModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the scale radius \f$b\f$ of the \f$\gamma\f$-model. */
     double scale_radius() const;
 
+    /** This function returns the outer asymptotic expansion of the density of the Gamma model, which follows from the binomial series of \f$\rho(r) \propto x^{-4}\,(1+x^{-1})^{\gamma-4}\f$ in powers of \f$x^{-1}\f$. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the Gamma model, which follows from the binomial series of \f$\rho(r) \propto x^{-\gamma}\,(1+x)^{\gamma-4}\f$ in powers of \f$x^{1}\f$. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
     /** This function returns the density \f$\rho(r)\f$ of the \f$\gamma\f$-model at radius \f$r\f$. */
     double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the \f$\gamma\f$-model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
     
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the \f$\gamma\f$-model at radius \f$r\f$. */
     double derivative_density(double r) const;
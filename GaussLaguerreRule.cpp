@@ -0,0 +1,105 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "GaussLaguerreRule.hpp"
+#include <map>
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////
+
+const GaussLaguerreRule* GaussLaguerreRule::get(int num)
+{
+    static std::mutex mutex;
+    static std::map<int, std::unique_ptr<const GaussLaguerreRule>> registry;
+    num = max(num,1);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<const GaussLaguerreRule>& rule = registry[num];
+    if (!rule) rule.reset(new GaussLaguerreRule(num));
+    return rule.get();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+GaussLaguerreRule::GaussLaguerreRule(int num)
+{
+    _num = num;
+    _tv.resize(_num);
+    _wv.resize(_num);
+
+    // The recurrence loses a few digits close to the smallest zeros of L_N, so that the rule is generated
+    // in extended precision and rounded to double precision afterwards
+
+    typedef long double real;
+    real N = _num;
+    real t = 0.0;
+    for (int i=0; i<_num; i++)
+    {
+        // Initial approximation of the node, following Numerical Recipes
+
+        if (i==0) t = 3.0/(1.0+2.4*N);
+        else if (i==1) t += 15.0/(1.0+2.5*N);
+        else
+        {
+            real ai = i-1;
+            t += (1.0+2.55*ai)/(1.9*ai) * (t-_tv[i-2]);
+        }
+
+        // Newton iterations, with the recurrence for L_N and L_{N-1} rescaled by exp(-lnscale)
+
+        real L = 0.0, Lm1 = 0.0, lnscale = 0.0;
+        for (int iter=0; iter<100; iter++)
+        {
+            L = 1.0;
+            Lm1 = 0.0;
+            lnscale = 0.0;
+            for (int j=1; j<=_num; j++)
+            {
+                real Lm2 = Lm1;
+                Lm1 = L;
+                L = ((2.0*j-1.0-t)*Lm1 - (j-1.0)*Lm2) / j;
+                if (fabs(L) > 1e100)
+                {
+                    L *= 1e-100;
+                    Lm1 *= 1e-100;
+                    lnscale += 100.0*M_LN10;
+                }
+            }
+            real dL = N*(L-Lm1)/t;
+            real dt = L/dL;
+            t -= dt;
+            if (fabs(dt) <= 1e-17*t) break;
+        }
+
+        // The weight is w = -1/(N L_N'(t) L_{N-1}(t)); the scale factor appears squared
+
+        real dL = N*(L-Lm1)/t;
+        _tv[i] = t;
+        _wv[i] = exp(t-2.0*lnscale) / fabs(N*dL*Lm1);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int GaussLaguerreRule::num() const
+{
+    return _num;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLaguerreRule::nodes() const
+{
+    return _tv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLaguerreRule::scaled_weights() const
+{
+    return _wv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,51 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef GAUSSLAGUERRERULE_HPP
+#define GAUSSLAGUERRERULE_HPP
+
+#include "Basics.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** GaussLaguerreRule is the class that holds the nodes \f$t_i\f$ and weights \f$w_i\f$ of an \f$N\f$-point Gauss-Laguerre quadrature rule, \f[ \int_0^\infty {\text{e}}^{-t} f(t)\,{\text{d}}t \approx \sum_{i=1}^N w_i\,f(t_i). \f] The rule is used for the outer integration segment of models with an exponential or stretched exponential tail, for which the integrand decays as \f${\text{e}}^{-t}\f$ after a suitable substitution. Since such integrands are evaluated directly rather than divided by the weight function, the rule stores the scaled weights \f$w_i\,{\text{e}}^{t_i}\f$. As for the GaussLegendreRule class, rules are immutable, are shared by all threads, and can only be obtained through the static function get().
+
+    The nodes are calculated as the zeros of the Laguerre polynomial \f$L_N\f$ using Newton iterations, starting from the approximations in Numerical Recipes, with the polynomial evaluated by the three-term recurrence relation. Since \f$L_N(t)\f$ grows as \f${\text{e}}^{t/2}\f$ for the largest nodes, the recurrence is rescaled whenever it becomes large, and the scaled weights are calculated from the logarithm of the scale factor. */
+
+class GaussLaguerreRule
+{
+public:
+
+    /** This function returns the Gauss-Laguerre rule with \f$N\f$ nodes. The first time a given order is requested, the rule is generated and added to the registry; all subsequent calls return the same object. The function is thread-safe, and the returned pointer remains valid until the end of the program. */
+    static const GaussLaguerreRule* get(int num);
+
+    /** This function returns the number of nodes \f$N\f$. */
+    int num() const;
+
+    /** This function returns a pointer to the \f$N\f$ nodes \f$t_i\f$, in increasing order. */
+    const double* nodes() const;
+
+    /** This function returns a pointer to the \f$N\f$ scaled weights \f$w_i\,{\text{e}}^{t_i}\f$. */
+    const double* scaled_weights() const;
+
+private:
+
+    /** Constructor of the GaussLaguerreRule class. It generates the nodes and scaled weights of the rule with \f$N\f$ nodes. The constructor is private: rules are obtained through the function get(). */
+    GaussLaguerreRule(int num);
+
+    /** The number of nodes \f$N\f$. */
+    int _num;
+
+    /** A vector with the \f$N\f$ nodes \f$t_i\f$. */
+    std::vector<double> _tv;
+
+    /** A vector with the \f$N\f$ scaled weights \f$w_i\,{\text{e}}^{t_i}\f$. */
+    std::vector<double> _wv;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
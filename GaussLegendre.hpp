@@ -8,6 +8,8 @@
 #define GAUSSLEGENDRE_HPP
 
 #include "Basics.hpp"
+#include "GaussLegendreRule.hpp"
+#include "GaussLegendreTable.hpp"
 #include <functional>
 
 //////////////////////////////////////////////////////////////////////
@@ -18,30 +20,316 @@ class GaussLegendre
 {
 public:
     
-    /** Constructor for the GaussLegendre class. The constructor reads in a number \f$n\f$ and constructs a Gauss-Legendre integrator with \f$N\f$ nodes, where \f$N\f$ is the smallest power of 2 that is equal to or larger than \f$n\f$. The constructor just reads the appropriate list of nodes and weigths from a precalculated table. The minimum number of nodes is 8, the maximum number is 512. */
+    /** Constructor for the GaussLegendre class. The constructor reads in a number \f$N\f$ and constructs a Gauss-Legendre integrator with exactly \f$N\f$ nodes. The nodes and weights, and the corresponding mapped nodes and weights used in the integration routines, are obtained from the process-wide registry of Gauss-Legendre rules (see the GaussLegendreRule class): they are generated the first time a given number of nodes is requested, and shared by all integrators with the same number of nodes. Constructing a GaussLegendre object is hence cheap, and no trigonometric functions need to be evaluated on the integration segments anchored at the break radius. */
     GaussLegendre(int num);
+
+    /** This function returns the number of nodes \f$N\f$. */
+    int num() const;
     
     /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$. The integral is split at the break radius \f$r_{\text{b}}\f$, and converted to \f[ \int_0^\infty X(u)\, {\text{d}}u = r_{\text{b}} \int_0^{\pi/2} X(r_{\text{b}}\sin\theta) \cos\theta\, {\text{d}}\theta + r_{\text{b}} \int_0^{\pi/2} X(r_{\text{b}}\csc\theta) \cos\theta\, \csc^2\theta\, {\text{d}}\theta. \f] The resulting integrals are estimated as Gauss-Legendre quadratures. */
     double integrate_0_infty(std::function<double(double)> X, double rb) const;
     
-    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,r]\f$, with \f$r>0\f$ an arbitrary number. If \f$r\leq r_{\text{b}}\f$, the integral is converted to \f[ \int_0^r X(u)\, {\text{d}}u = r \int_0^{\pi/2} X(r \sin\theta) \cos\theta\, {\text{d}}\theta. \f] If \f$r>r_{\text{b}}\f$, the integral is split at the break radius \f$r_{\text{b}}\f$, and converted to \f[ \int_0^r X(u)\, {\text{d}}u = r_{\text{b}} \int_0^{\pi/2} X(r_{\text{b}}\sin\theta) \cos\theta\, {\text{d}}\theta + r \int_{\arcsin(r_{\text{b}}/r)}^{\pi/2} X(r\sin\theta) \cos\theta\, {\text{d}}\theta. \f] The resulting integrals are estimated as Gauss-Legendre quadratures. */
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,r]\f$, with \f$r>0\f$ an arbitrary number. If \f$r\leq r_{\text{b}}\f$, the integral is converted to \f[ \int_0^r X(u)\, {\text{d}}u = r \int_0^{\pi/2} X(r \sin\theta) \cos\theta\, {\text{d}}\theta. \f] If \f$r>r_{\text{b}}\f$, the integral is split at the break radius \f$r_{\text{b}}\f$, and converted to \f[ \int_0^r X(u)\, {\text{d}}u = r_{\text{b}} \int_0^{\pi/2} X(r_{\text{b}}\sin\theta) \cos\theta\, {\text{d}}\theta + r \int_{\arcsin(r_{\text{b}}/r)}^{\pi/2} X(r\sin\theta) \cos\theta\, {\text{d}}\theta. \f] Since the second segment depends on \f$r\f$, it is rewritten with the half-angle substitution \f$\theta = \pi/2 - 2\arctan\tau\f$ as \f[ r \int_{\arcsin(r_{\text{b}}/r)}^{\pi/2} X(r\sin\theta) \cos\theta\, {\text{d}}\theta = 4r \int_0^T X\!\left(r\,\frac{1-\tau^2}{1+\tau^2}\right) \frac{\tau\,{\text{d}}\tau}{(1+\tau^2)^2}, \qquad T = \sqrt{\frac{r-r_{\text{b}}}{r+r_{\text{b}}}}, \f] such that its nodes are mapped without evaluating trigonometric functions. The resulting integrals are estimated as Gauss-Legendre quadratures. */
     double integrate_0_r(std::function<double(double)> X, double r, double rb) const;
     
-    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, with \f$r>0\f$ an arbitrary number. If \f$r<r_{\text{b}}\f$, the integral is split at the break radius \f$r_{\text{b}}\f$, and converted to \f[ \int_r^\infty X(u)\, {\text{d}}u = r \int_{\arcsin(r/r_{\text{b}})}^{\pi/2} X(r \csc\theta) \cos\theta \csc^2\theta\, {\text{d}}\theta + r_{\text{b}} \int_0^{\pi/2} X(r_{\text{b}}\csc\theta) \cos\theta \csc^2\theta\, {\text{d}}\theta. \f] If \f$r\geq r_{\text{b}}\f$, the integral is converted to \f[ \int_0^r X(u)\, {\text{d}}u = r \int_0^{\pi/2} X(r \csc\theta) \cos\theta \csc^2\theta\, {\text{d}}\theta. \f] The resulting integrals are estimated as Gauss-Legendre quadratures. */
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, with \f$r>0\f$ an arbitrary number. If \f$r<r_{\text{b}}\f$, the integral is split at the break radius \f$r_{\text{b}}\f$, and converted to \f[ \int_r^\infty X(u)\, {\text{d}}u = r \int_{\arcsin(r/r_{\text{b}})}^{\pi/2} X(r \csc\theta) \cos\theta \csc^2\theta\, {\text{d}}\theta + r_{\text{b}} \int_0^{\pi/2} X(r_{\text{b}}\csc\theta) \cos\theta \csc^2\theta\, {\text{d}}\theta. \f] Since the first segment depends on \f$r\f$, it is rewritten with the half-angle substitution \f$\theta = \pi/2 - 2\arctan\tau\f$ as \f[ r \int_{\arcsin(r/r_{\text{b}})}^{\pi/2} X(r \csc\theta) \cos\theta \csc^2\theta\, {\text{d}}\theta = 4r \int_0^T X\!\left(r\,\frac{1+\tau^2}{1-\tau^2}\right) \frac{\tau\,{\text{d}}\tau}{(1-\tau^2)^2}, \qquad T = \sqrt{\frac{r_{\text{b}}-r}{r_{\text{b}}+r}}, \f] such that its nodes are mapped without evaluating trigonometric functions. If \f$r\geq r_{\text{b}}\f$, the integral is converted to \f[ \int_r^\infty X(u)\, {\text{d}}u = r \int_0^{\pi/2} X(r \csc\theta) \cos\theta \csc^2\theta\, {\text{d}}\theta. \f] The resulting integrals are estimated as Gauss-Legendre quadratures. */
     double integrate_r_infty(std::function<double(double)> X, double r, double rb) const;
-    
+
+    /** This function template is equivalent to the function integrate_0_infty() above, but accepts any callable object as integrand. Lambda functions passed directly to this function are not wrapped in a std::function object, such that the compiler can inline the integrand in the quadrature loop. For the common orders \f$N\f$ = 32, 64, 128 and 256, the quadrature loops are instantiated with a fixed number of nodes and read the nodes and weights from the constexpr arrays of the GaussLegendreTable class template, such that the compiler can also unroll and vectorize them. */
+    template<typename Function> double integrate_0_infty(const Function& X, double rb) const;
+
+    /** This function template is equivalent to the function integrate_0_r() above, but accepts any callable object as integrand, as in the function template integrate_0_infty(). */
+    template<typename Function> double integrate_0_r(const Function& X, double r, double rb) const;
+
+    /** This function template is equivalent to the function integrate_r_infty() above, but accepts any callable object as integrand, as in the function template integrate_0_infty(). */
+    template<typename Function> double integrate_r_infty(const Function& X, double r, double rb) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, using the same substitutions as the function integrate_0_infty(). Rather than evaluating the integrand node per node, the function \f$X\f$ is called only once with the array of all \f$n\f$ mapped nodes \f$u_i\f$, and should store the values \f$X(u_i)\f$ in the output array. This allows the integrand to use the batched versions of the profile functions of the Model class. */
+    double integrate_0_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double rb) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,r]\f$, using the same substitutions as the function integrate_0_r(). The function \f$X\f$ is called only once with the array of all mapped nodes, as in the function integrate_0_infty_batch(). */
+    double integrate_0_r_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, double rb) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, using the same substitutions as the function integrate_r_infty(). The function \f$X\f$ is called only once with the array of all mapped nodes, as in the function integrate_0_infty_batch(). */
+    double integrate_r_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, double rb) const;
+
+    /** This function returns an estimate of the Abel-type integral \f[ \int_r^\infty \frac{X(u)\,{\text{d}}u}{\sqrt{u^2-r^2}}, \f] with the kernel built into the quadrature rule, such that only the smooth function \f$X(u)\f$ is evaluated. If \f$r<r_{\text{b}}\f$, the integral is split at the break radius \f$r_{\text{b}}\f$. On the first segment, the substitution \f$u = r\cosh s\f$ absorbs the kernel exactly, \f[ \int_r^{r_{\text{b}}} \frac{X(u)\,{\text{d}}u}{\sqrt{u^2-r^2}} = \int_0^{\text{arccosh}(r_{\text{b}}/r)} X(r\cosh s)\,{\text{d}}s, \f] and spreads the nodes logarithmically between \f$r\f$ and \f$r_{\text{b}}\f$. On the second segment, the kernel is not singular, and the substitution \f$u = r_{\text{b}}\csc\theta\f$ gives \f[ \int_{r_{\text{b}}}^\infty \frac{X(u)\,{\text{d}}u}{\sqrt{u^2-r^2}} = \int_0^{\pi/2} \frac{X(r_{\text{b}}\csc\theta)\cos\theta\,{\text{d}}\theta}{\sin\theta\,\sqrt{1-(r/r_{\text{b}})^2\sin^2\theta}}. \f] If \f$r\geq r_{\text{b}}\f$, the substitution \f$u = r\csc\theta\f$ absorbs the kernel exactly, \f[ \int_r^\infty \frac{X(u)\,{\text{d}}u}{\sqrt{u^2-r^2}} = \int_0^{\pi/2} X(r\csc\theta)\csc\theta\,{\text{d}}\theta. \f] The resulting integrals are estimated as Gauss-Legendre quadratures. Contrary to the function integrate_r_infty(), no cancellation occurs in the kernel close to \f$u=r\f$, and the integrand is smooth, such that a few dozen nodes usually suffice for machine precision. */
+    template<typename Function> double integrate_abel(const Function& X, double r, double rb) const;
+
+    /** This function returns an estimate of the Abel-type integral of the function \f$X(u)\f$ as in the function integrate_abel(). The function \f$X\f$ is called only once with the array of all mapped nodes, as in the function integrate_0_infty_batch(). */
+    double integrate_abel_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, double rb) const;
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, for an integrand with a stretched exponential tail \f$\exp[-b\,(u/r_0)^{1/m}]\f$. The segment \f$[0,r_{\text{b}}]\f$ is treated as in the function integrate_0_infty_batch(). On the segment \f$[r_{\text{b}},+\infty[\f$, the substitution \f$t = b\,[(u/r_0)^{1/m}-(r_{\text{b}}/r_0)^{1/m}]\f$ turns the tail into \f${\text{e}}^{-t}\f$, \f[ \int_{r_{\text{b}}}^\infty X(u)\,{\text{d}}u = \frac{m\,r_0}{b} \int_0^\infty X(u)\,\left(\frac{u}{r_0}\right)^{(m-1)/m} {\text{d}}t, \f] and the integral is estimated using a Gauss-Laguerre rule with 32 nodes, independent of \f$N\f$, which is generated the first time a tail is integrated (see the GaussLaguerreRule class). Contrary to the substitution \f$u = r_{\text{b}}\csc\theta\f$, the nodes follow the decay of the integrand, such that no nodes are spent where the integrand has underflowed. */
+    double integrate_0_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double rb, double b, double r0, double m) const;
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, for an integrand with a stretched exponential tail. The segment \f$[r,u_0]\f$, with \f$u_0=\max(r_{\text{b}},2r)\f$, is treated as the first segment in the function integrate_r_infty(), such that a square-root behaviour of the integrand at \f$u=r\f$ remains harmless. The segment \f$[u_0,+\infty[\f$ is treated as in the function integrate_0_infty_batch() with a stretched exponential tail. */
+    double integrate_r_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, double rb, double b, double r0, double m) const;
+
+    /** This function returns an estimate of the Abel-type integral of the batched function \f$X(u)\f$ as in the function integrate_abel(), for an integrand with a stretched exponential tail. The segment next to \f$u=r\f$, which contains the singularity of the kernel, is integrated with the substitution \f$u = r\cosh s\f$ up to \f$u_0=\max(r_{\text{b}},2r)\f$, such that the singularity stays well away from the Gauss-Laguerre nodes. The remaining segment is integrated with the Gauss-Laguerre rule as in the function integrate_0_infty_batch() with a stretched exponential tail, with the regular kernel included in the weights. */
+    double integrate_abel_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, double rb, double b, double r0, double m) const;
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, split at all radii \f$s_1<\dots<s_K\f$ in the sorted vector rbv rather than at a single break radius. This allows the integration to follow an integrand that is not smooth at these radii. The segment \f$[0,s_1]\f$ is integrated with the substitution \f$u = s_1\sin\theta\f$, each segment \f$[s_k,s_{k+1}]\f$ with the substitution \f$u = s_{k+1}\sin\theta\f$, and the segment \f$[s_K,+\infty[\f$ with the substitution \f$u = s_K\csc\theta\f$; each segment uses \f$N\f$ nodes. If \f$b\f$ is positive, the last segment is integrated with a Gauss-Laguerre rule for a stretched exponential tail, as in the function integrate_0_infty_batch() with a stretched exponential tail. */
+    double integrate_0_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, const std::vector<double>& rbv, double b = 0.0, double r0 = 0.0, double m = 0.0) const;
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[0,r]\f$, split at all radii in the sorted vector rbv that are smaller than \f$r\f$, with the segments as in the function integrate_0_infty_batch() with split radii. The last segment \f$[s_K,r]\f$ is integrated with the substitution \f$u = r\sin\theta\f$, as in the function integrate_0_r(). */
+    double integrate_0_r_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const std::vector<double>& rbv) const;
+
+    /** This function returns an estimate of the integral of the batched function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, split at all radii in the sorted vector rbv that are sufficiently larger than \f$r\f$, with the segments as in the function integrate_0_infty_batch() with split radii. The first segment \f$[r,s_1]\f$ is integrated with the substitution \f$u = r\csc\theta\f$, as in the function integrate_r_infty(). If \f$b\f$ is positive, the last segment starts at \f$2r\f$ or beyond and is integrated with a Gauss-Laguerre rule for a stretched exponential tail. */
+    double integrate_r_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const std::vector<double>& rbv, double b = 0.0, double r0 = 0.0, double m = 0.0) const;
+
+    /** This function returns an estimate of the Abel-type integral of the batched function \f$X(u)\f$ as in the function integrate_abel(), split at all radii in the sorted vector rbv that are sufficiently larger than \f$r\f$. All segments up to the outermost split radius, which is extended to \f$2r\f$ if it is smaller, are integrated with the substitution \f$u = r\cosh s\f$, which absorbs the kernel exactly, \f[ \int_{s_{k-1}}^{s_k} \frac{X(u)\,{\text{d}}u}{\sqrt{u^2-r^2}} = \int_{\text{arccosh}(s_{k-1}/r)}^{\text{arccosh}(s_k/r)} X(r\cosh s)\,{\text{d}}s, \f] such that the kernel is harmless even on a segment that starts just beyond \f$r\f$. The outer segment is integrated as in the function integrate_r_infty_batch() with split radii, with the regular kernel included in the weights. */
+    double integrate_abel_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const std::vector<double>& rbv, double b = 0.0, double r0 = 0.0, double m = 0.0) const;
+
+    /** This function estimates the integrals of num batched functions \f$X_j(u)\f$ over the interval \f$[0,+\infty[\f$ at once, using the nodes of the function integrate_0_infty_batch() with split radii, and stores them in the array result. The function \f$X\f$ is called only once with the array of all \f$n\f$ mapped nodes \f$u_i\f$, and should store the value \f$X_j(u_i)\f$ in element \f$j\,n+i\f$ of the output array. Since related integrands typically share the same profile evaluations, this allows a caller to obtain several integrals for the cost of a single pass over the nodes. */
+    void integrate_0_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, const std::vector<double>& rbv, size_t num, double* result, double b = 0.0, double r0 = 0.0, double m = 0.0) const;
+
+    /** This function estimates the integrals of num batched functions \f$X_j(u)\f$ over the interval \f$[0,r]\f$ at once, using the nodes of the function integrate_0_r_batch() with split radii, as in the function integrate_0_infty_batch() with num integrands. */
+    void integrate_0_r_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const std::vector<double>& rbv, size_t num, double* result) const;
+
+    /** This function estimates the integrals of num batched functions \f$X_j(u)\f$ over the interval \f$[r,+\infty[\f$ at once, using the nodes of the function integrate_r_infty_batch() with split radii, as in the function integrate_0_infty_batch() with num integrands. */
+    void integrate_r_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const std::vector<double>& rbv, size_t num, double* result, double b = 0.0, double r0 = 0.0, double m = 0.0) const;
+
+    /** This function estimates the Abel-type integrals of num batched functions \f$X_j(u)\f$ at once, using the nodes of the function integrate_abel_batch() with split radii, as in the function integrate_0_infty_batch() with num integrands. */
+    void integrate_abel_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const std::vector<double>& rbv, size_t num, double* result, double b = 0.0, double r0 = 0.0, double m = 0.0) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, using the same substitutions as the function integrate_0_infty(), but with an adaptive Gauss-Kronrod scheme instead of a fixed number of nodes. Each of the integrals in \f$\theta\f$ is estimated with a 21-point Gauss-Kronrod rule, and the subinterval with the largest error estimate is bisected until the estimated absolute error is smaller than the relative tolerance reltol times the absolute value of the integral, or until the number of subintervals reaches 1000. If abserr is not a null pointer, the final error estimate is stored in it. This function is independent of the number of nodes of the integrator, and hence gives smooth integrands a much cheaper and difficult integrands a more accurate result. */
+    double integrate_0_infty_adaptive(std::function<double(double)> X, double rb, double reltol, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,r]\f$, using the same substitutions as the function integrate_0_r(), and the adaptive Gauss-Kronrod scheme of the function integrate_0_infty_adaptive(). */
+    double integrate_0_r_adaptive(std::function<double(double)> X, double r, double rb, double reltol, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, using the same substitutions as the function integrate_r_infty(), and the adaptive Gauss-Kronrod scheme of the function integrate_0_infty_adaptive(). */
+    double integrate_r_infty_adaptive(std::function<double(double)> X, double r, double rb, double reltol, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the Abel-type integral of the function \f$X(u)\f$ as in the function integrate_abel(), using the adaptive Gauss-Kronrod scheme of the function integrate_0_infty_adaptive(). The substitutions of the function integrate_r_infty() are used, with the kernel absorbed in their Jacobians. On the segment \f$u = r\csc\theta\f$, the kernel cancels analytically, \f[ \frac{r\cos\theta\csc^2\theta}{\sqrt{u^2-r^2}} = \csc\theta, \f] such that the integrand remains finite when the bisection places nodes arbitrarily close to \f$\theta=\pi/2\f$, where \f$u\f$ rounds to \f$r\f$. */
+    double integrate_abel_adaptive(std::function<double(double)> X, double r, double rb, double reltol, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, using the segments of the function integrate_0_infty_batch() with split radii, and the adaptive Gauss-Kronrod scheme of the function integrate_0_infty_adaptive(). */
+    double integrate_0_infty_adaptive(std::function<double(double)> X, const std::vector<double>& rbv, double reltol, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,r]\f$, using the segments of the function integrate_0_r_batch() with split radii, and the adaptive Gauss-Kronrod scheme of the function integrate_0_infty_adaptive(). */
+    double integrate_0_r_adaptive(std::function<double(double)> X, double r, const std::vector<double>& rbv, double reltol, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, using the segments of the function integrate_r_infty_batch() with split radii, and the adaptive Gauss-Kronrod scheme of the function integrate_0_infty_adaptive(). */
+    double integrate_r_infty_adaptive(std::function<double(double)> X, double r, const std::vector<double>& rbv, double reltol, double* abserr = nullptr) const;
+
+    /** This function returns an estimate of the Abel-type integral of the function \f$X(u)\f$ as in the function integrate_abel_adaptive(), using the segments of the function integrate_r_infty_batch() with split radii. */
+    double integrate_abel_adaptive(std::function<double(double)> X, double r, const std::vector<double>& rbv, double reltol, double* abserr = nullptr) const;
+
 private:
-    
+
+    /** This function stores the mapped nodes \f$u_i\f$ and the corresponding mapped weights for the integration over the interval \f$[0,+\infty[\f$ in the arrays uv and wv, which should have room for \f$2N\f$ values, and returns the number of nodes. */
+    int map_0_infty(double rb, double* uv, double* wv) const;
+
+    /** This function stores the mapped nodes \f$u_i\f$ and the corresponding mapped weights for the integration over the interval \f$[0,r]\f$ in the arrays uv and wv, which should have room for \f$2N\f$ values, and returns the number of nodes. */
+    int map_0_r(double r, double rb, double* uv, double* wv) const;
+
+    /** This function stores the mapped nodes \f$u_i\f$ and the corresponding mapped weights for the integration over the interval \f$[r,+\infty[\f$ in the arrays uv and wv, which should have room for \f$2N\f$ values, and returns the number of nodes. */
+    int map_r_infty(double r, double rb, double* uv, double* wv) const;
+
+    /** This function stores the mapped nodes \f$u_i\f$ and the corresponding mapped weights for the Abel-type integration over the interval \f$[r,+\infty[\f$ in the arrays uv and wv, which should have room for \f$2N\f$ values, and returns the number of nodes. */
+    int map_abel(double r, double rb, double* uv, double* wv) const;
+
+    /** This function stores the 32 mapped Gauss-Laguerre nodes \f$u_i\f$ and the corresponding mapped weights for the integration over the interval \f$[u_0,+\infty[\f$ of an integrand with a stretched exponential tail \f$\exp[-b\,(u/r_0)^{1/m}]\f$ in the arrays uv and wv, and returns the number of nodes. */
+    int map_tail(double u0, double b, double r0, double m, double* uv, double* wv) const;
+
+    /** This function stores the \f$N\f$ mapped nodes \f$u_i\f$ and the corresponding mapped weights for the integration over the segment \f$[a,\pi/2]\f$ in \f$\theta\f$, with the substitution \f$u = R\csc\theta\f$ if csc is true, or \f$u = R\sin\theta\f$ otherwise, in the arrays uv and wv, and returns the number of nodes. If \f$a=0\f$, the tabulated values of \f$\sin\theta_i\f$ are used; otherwise, the segment is rewritten with the half-angle substitution \f$\theta = \pi/2 - 2\arctan\tau\f$, with \f$\tau\f$ running linearly from 0 to \f$\tan(\pi/4-a/2)\f$, such that no trigonometric functions are evaluated at the nodes. */
+    int map_segment(double a, double R, bool csc, double* uv, double* wv) const;
+
+    /** This function stores the mapped nodes and the corresponding mapped weights for the integration over the interval \f$[0,+\infty[\f$, split at the radii in the vector rbv and with an optional stretched exponential tail, in the vectors uv and wv. */
+    void map_0_infty(const std::vector<double>& rbv, double b, double r0, double m, std::vector<double>& uv, std::vector<double>& wv) const;
+
+    /** This function stores the mapped nodes and the corresponding mapped weights for the integration over the interval \f$[0,r]\f$, split at the radii in the vector rbv, in the vectors uv and wv. */
+    void map_0_r(double r, const std::vector<double>& rbv, std::vector<double>& uv, std::vector<double>& wv) const;
+
+    /** This function stores the mapped nodes and the corresponding mapped weights for the integration over the interval \f$[r,+\infty[\f$, split at the radii in the vector rbv and with an optional stretched exponential tail, in the vectors uv and wv. */
+    void map_r_infty(double r, const std::vector<double>& rbv, double b, double r0, double m, std::vector<double>& uv, std::vector<double>& wv) const;
+
+    /** This function stores the mapped nodes and the corresponding mapped weights, including the kernel \f$(u^2-r^2)^{-1/2}\f$, for the Abel-type integration over the interval \f$[r,+\infty[\f$, split at the radii in the vector rbv and with an optional stretched exponential tail, in the vectors uv and wv. */
+    void map_abel(double r, const std::vector<double>& rbv, double b, double r0, double m, std::vector<double>& uv, std::vector<double>& wv) const;
+
+    /** The Rule structure holds the number of nodes and pointers to the nodes and weights of the integrator, with the same member names as the specializations of the GaussLegendreTable class template, such that the integration templates can read the rule from either of them. */
+    struct Rule
+    {
+        int num;
+        const double* xv;
+        const double* yv;
+        const double* wv;
+        const double* sv;
+        const double* cscv;
+        const double* wsinv;
+        const double* wcscv;
+    };
+
+    /** This function calls the function object kernel with the GaussLegendreTable specialization for the number of nodes \f$N\f$ if it is one of the orders 32, 64, 128 or 256, and with a Rule structure that points to the nodes and weights of the integrator otherwise. For the compiled orders, the integration templates hence see loops with a trip count that is known at compile time over constexpr arrays, which the compiler can unroll and vectorize. */
+    template<typename Kernel> double dispatch(const Kernel& kernel) const;
+
     /** The number of nodes \f$N\f$. */
     int _num;
 
-    /** A vector with the \f$N\f$ nodes \f$x_i\f$. */
-    std::vector<double> _xv;
+    /** A pointer to the \f$N\f$ nodes \f$x_i\f$. */
+    const double* _xv;
+
+    /** A pointer to the \f$N\f$ weights \f$w_i\f$. */
+    const double* _wv;
 
-    /** A vector with the \f$N\f$ weights \f$w_i\f$. */
-    std::vector<double> _wv;
+    /** A pointer to the \f$N\f$ complementary nodes \f$1-x_i\f$. */
+    const double* _yv;
+
+    /** A pointer to the \f$N\f$ values \f$\sin\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    const double* _sv;
+
+    /** A pointer to the \f$N\f$ values \f$\csc\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    const double* _cscv;
+
+    /** A pointer to the \f$N\f$ mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\sin\theta\f$. */
+    const double* _wsinv;
+
+    /** A pointer to the \f$N\f$ mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\csc^2\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\csc\theta\f$. */
+    const double* _wcscv;
 };
 
 //////////////////////////////////////////////////////////////////////
 
+template<typename Kernel> double GaussLegendre::dispatch(const Kernel& kernel) const
+{
+    switch (_num)
+    {
+        case 32: return kernel(GaussLegendreTable<32>());
+        case 64: return kernel(GaussLegendreTable<64>());
+        case 128: return kernel(GaussLegendreTable<128>());
+        case 256: return kernel(GaussLegendreTable<256>());
+        default: return kernel(Rule{_num, _xv, _yv, _wv, _sv, _cscv, _wsinv, _wcscv});
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Function> double GaussLegendre::integrate_0_infty(const Function& X, double rb) const
+{
+    return dispatch([&](const auto& t) -> double
+    {
+        double sum1 = 0.0;
+        for (int i=0; i<t.num; i++)
+            sum1 += t.wsinv[i] * X(rb*t.sv[i]);
+        double sum2 = 0.0;
+        for (int i=0; i<t.num; i++)
+            sum2 += t.wcscv[i] * X(rb*t.cscv[i]);
+        return rb*(sum1+sum2);
+    });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Function> double GaussLegendre::integrate_0_r(const Function& X, double r, double rb) const
+{
+    return dispatch([&](const auto& t) -> double
+    {
+        if (r<=rb)
+        {
+            double sum = 0.0;
+            for (int i=0; i<t.num; i++)
+                sum += t.wsinv[i] * X(r*t.sv[i]);
+            return r*sum;
+        }
+        else
+        {
+            double sum1 = 0.0;
+            for (int i=0; i<t.num; i++)
+                sum1 += t.wsinv[i] * X(rb*t.sv[i]);
+            sum1 *= rb;
+
+            // The remaining segment runs over theta between arcsin(rb/r) and pi/2. Writing theta = pi/2 - phi,
+            // with phi = 2 arctan(tau) and tau = (1-x) T, with T = tan(h/2) and h = arccos(rb/r), we have
+            // sin(theta) = (1-tau^2)/(1+tau^2) and cos(theta) d(theta) = 4 tau/(1+tau^2)^2 d(tau).
+
+            double sum2 = 0.0;
+            double q = rb/r;
+            double T = sqrt((1.0-q)/(1.0+q));
+            for (int i=0; i<t.num; i++)
+            {
+                double tau = t.yv[i]*T;
+                double p = 1.0/(1.0+tau*tau);
+                sum2 += t.wv[i] * X(r*(1.0-tau*tau)*p) * (tau*p*p);
+            }
+            sum2 *= 4.0*r*T;
+            return sum1+sum2;
+        }
+    });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Function> double GaussLegendre::integrate_r_infty(const Function& X, double r, double rb) const
+{
+    return dispatch([&](const auto& t) -> double
+    {
+        double eps = 1e-4;
+        if (r/rb >= 1.0-eps)
+        {
+            double sum = 0.0;
+            for (int i=0; i<t.num; i++)
+                sum += t.wcscv[i] * X(r*t.cscv[i]);
+            return r*sum;
+        }
+        else
+        {
+            // The first segment runs over theta between arcsin(r/rb) and pi/2. Writing theta = pi/2 - phi, with
+            // phi = 2 arctan(tau) and tau = (1-x) T, with T = tan(h/2) and h = arccos(r/rb), we have
+            // csc(theta) = (1+tau^2)/(1-tau^2) and cos(theta) csc^2(theta) d(theta) = 4 tau/(1-tau^2)^2 d(tau).
+
+            double sum1 = 0.0;
+            double q = r/rb;
+            double T = sqrt((1.0-q)/(1.0+q));
+            for (int i=0; i<t.num; i++)
+            {
+                double tau = t.yv[i]*T;
+                double p = 1.0/(1.0-tau*tau);
+                sum1 += t.wv[i] * X(r*(1.0+tau*tau)*p) * (tau*p*p);
+            }
+            sum1 *= 4.0*r*T;
+            double sum2 = 0.0;
+            for (int i=0; i<t.num; i++)
+                sum2 += t.wcscv[i] * X(rb*t.cscv[i]);
+            sum2 *= rb;
+            return sum1+sum2;
+        }
+    });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Function> double GaussLegendre::integrate_abel(const Function& X, double r, double rb) const
+{
+    return dispatch([&](const auto& t) -> double
+    {
+        double eps = 1e-4;
+        if (r/rb >= 1.0-eps)
+        {
+            double sum = 0.0;
+            for (int i=0; i<t.num; i++)
+                sum += t.wv[i] * X(r*t.cscv[i]) * t.cscv[i];
+            return 0.5*M_PI*sum;
+        }
+        else
+        {
+            double sum1 = 0.0;
+            double S = acosh(rb/r);
+            for (int i=0; i<t.num; i++)
+                sum1 += t.wv[i] * X(r*cosh(t.xv[i]*S));
+            sum1 *= S;
+            double sum2 = 0.0;
+            double q = r/rb;
+            for (int i=0; i<t.num; i++)
+            {
+                double qs = q*t.sv[i];
+                sum2 += t.wsinv[i] * X(rb*t.cscv[i]) * t.cscv[i] / sqrt((1.0-qs)*(1.0+qs));
+            }
+            return sum1+sum2;
+        }
+    });
+}
+
+//////////////////////////////////////////////////////////////////////
+
 #endif
@@ -0,0 +1,233 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "GaussLegendreRule.hpp"
+#include <map>
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The number of terms in the asymptotic expansion by Stieltjes
+    const int numterms = 30;
+
+    // This class accumulates a sum using the compensated summation algorithm by Neumaier
+    class CompensatedSum
+    {
+    public:
+        void add(double x)
+        {
+            double t = _sum + x;
+            if (fabs(_sum) >= fabs(x)) _c += (_sum - t) + x;
+            else _c += (x - t) + _sum;
+            _sum = t;
+        }
+        double value() const { return _sum + _c; }
+    private:
+        double _sum = 0.0;
+        double _c = 0.0;
+    };
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const GaussLegendreRule* GaussLegendreRule::get(int num)
+{
+    static std::mutex mutex;
+    static std::map<int, std::unique_ptr<const GaussLegendreRule>> registry;
+    num = max(num,1);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<const GaussLegendreRule>& rule = registry[num];
+    if (!rule) rule.reset(new GaussLegendreRule(num));
+    return rule.get();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+GaussLegendreRule::GaussLegendreRule(int num)
+{
+    _num = num;
+    _xv.resize(_num);
+    _yv.resize(_num);
+    _wv.resize(_num);
+
+    // Precalculate the constant C_N and the coefficients h_{N,m} of the asymptotic expansion.
+    // The logarithm of C_N = 4/pi prod_{j=1}^N j/(j+1/2) is accumulated with compensated summation.
+
+    CompensatedSum lnCN;
+    lnCN.add(log(4.0*M_1_PI));
+    for (int j=1; j<=_num; j++) lnCN.add(log1p(-1.0/(2.0*j+1.0)));
+    _CN = exp(lnCN.value());
+    _hv.resize(numterms);
+    _hv[0] = 1.0;
+    for (int m=1; m<numterms; m++)
+        _hv[m] = _hv[m-1] * (m-0.5)*(m-0.5) / (m*(_num+m+0.5));
+
+    // Determine the nodes in the first half of the interval, i.e. the zeros cos(theta_k) of P_N with
+    // theta_k <= pi/2, using Newton iterations in theta. The other half follows from symmetry.
+
+    double N = _num;
+    for (int k=1; 2*k<=_num+1; k++)
+    {
+        double phi = (4.0*k-1.0)*M_PI/(4.0*N+2.0);
+        double theta = acos((1.0-1.0/(8.0*N*N)+1.0/(8.0*N*N*N))*cos(phi));
+        double t = 0.5/sin(theta);
+        bool useasymptotic = (_hv[numterms-1]*pow(t,numterms-1) < 1e-17);
+        double P, dP;
+        if (2*k==_num+1)
+            theta = 0.5*M_PI;
+        else
+        {
+            for (int iter=0; iter<10; iter++)
+            {
+                if (useasymptotic) asymptotic(theta,P,dP);
+                else recurrence(theta,P,dP);
+                double dtheta = P/dP;
+                theta -= dtheta;
+                if (fabs(dtheta) <= 1e-15*theta) break;
+            }
+        }
+        if (useasymptotic) asymptotic(theta,P,dP);
+        else recurrence(theta,P,dP);
+        double s = sin(0.5*theta);
+        double c = cos(0.5*theta);
+        double w = 1.0/(dP*dP);
+        _xv[k-1] = s*s;
+        _yv[k-1] = c*c;
+        _wv[k-1] = w;
+        _xv[_num-k] = c*c;
+        _yv[_num-k] = s*s;
+        _wv[_num-k] = w;
+    }
+
+    // Normalize the weights such that they sum to unity
+
+    CompensatedSum sumw;
+    for (int i=0; i<_num; i++) sumw.add(_wv[i]);
+    double norm = sumw.value();
+    for (int i=0; i<_num; i++) _wv[i] /= norm;
+
+    // Precalculate the mapped nodes and weights of the substitutions u = R sin(theta) and u = R csc(theta),
+    // with theta = x pi/2, which are used for all integration segments anchored at the break radius.
+
+    _sv.resize(_num);
+    _cscv.resize(_num);
+    _wsinv.resize(_num);
+    _wcscv.resize(_num);
+    for (int i=0; i<_num; i++)
+    {
+        double theta = _xv[i]*0.5*M_PI;
+        double s = sin(theta);
+        double c = cos(theta);
+        _sv[i] = s;
+        _cscv[i] = 1.0/s;
+        _wsinv[i] = _wv[i]*0.5*M_PI*c;
+        _wcscv[i] = _wv[i]*0.5*M_PI*c/(s*s);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void GaussLegendreRule::recurrence(double theta, double& P, double& dP) const
+{
+    double x = cos(theta);
+    double Pm1 = 1.0;
+    P = x;
+    for (int n=2; n<=_num; n++)
+    {
+        double Pm2 = Pm1;
+        Pm1 = P;
+        P = ((2.0*n-1.0)*x*Pm1 - (n-1.0)*Pm2) / n;
+    }
+    dP = _num * (x*P-Pm1) / sin(theta);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void GaussLegendreRule::asymptotic(double theta, double& P, double& dP) const
+{
+    double s = sin(theta);
+    double c = cos(theta);
+    double t = 0.5/s;
+    double alpha = (_num+0.5)*theta - 0.25*M_PI;
+    double ca = cos(alpha);
+    double sa = sin(alpha);
+    double tm = sqrt(t);
+    P = 0.0;
+    dP = 0.0;
+    for (int m=0; m<numterms; m++)
+    {
+        P += _hv[m] * ca * tm;
+        dP -= _hv[m] * ((_num+m+0.5)*sa + (m+0.5)*(c/s)*ca) * tm;
+
+        // alpha_{m+1} = alpha_m + theta - pi/2
+        double ca1 = ca*s + sa*c;
+        sa = sa*s - ca*c;
+        ca = ca1;
+        tm *= t;
+    }
+    P *= _CN;
+    dP *= _CN;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int GaussLegendreRule::num() const
+{
+    return _num;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLegendreRule::nodes() const
+{
+    return _xv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLegendreRule::complementary_nodes() const
+{
+    return _yv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLegendreRule::weights() const
+{
+    return _wv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLegendreRule::sin_nodes() const
+{
+    return _sv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLegendreRule::csc_nodes() const
+{
+    return _cscv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLegendreRule::sin_weights() const
+{
+    return _wsinv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const double* GaussLegendreRule::csc_weights() const
+{
+    return _wcscv.data();
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,93 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef GAUSSLEGENDRERULE_HPP
+#define GAUSSLEGENDRERULE_HPP
+
+#include "Basics.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** GaussLegendreRule is the class that holds the nodes \f$x_i\f$ and weights \f$w_i\f$ of an \f$N\f$-point Gauss-Legendre quadrature rule on the interval \f$[0,1]\f$, together with the mapped nodes and weights that are used by the integration routines of the GaussLegendre class. Rules are immutable and are shared by all GaussLegendre objects and all threads: they can only be obtained through the static function get(), which generates a rule the first time a given order is requested and stores it in a process-wide registry.
+
+    The nodes are calculated as the zeros \f$\cos\vartheta_k\f$ of the Legendre polynomial \f$P_N\f$, using Newton iterations in \f$\vartheta\f$, starting from the approximation by Tricomi. For small \f$N\f$ and for the few nodes close to the end points of the interval, the Legendre polynomial is evaluated using the three-term recurrence relation. For all other nodes, it is evaluated using the asymptotic expansion by Stieltjes, \f[ P_N(\cos\vartheta) = C_N \sum_{m=0}^{M-1} h_{N,m}\,\frac{\cos\alpha_{N,m}}{(2\sin\vartheta)^{m+1/2}}, \f] with \f$\alpha_{N,m} = (N+m+\tfrac12)\,\vartheta - (m+\tfrac12)\,\tfrac{\pi}{2}\f$, which requires a fixed number of operations per node, so that the entire rule is generated in \f$O(N)\f$ time. The constant \f$C_N\f$ is evaluated as the exponential of a sum of logarithms with compensated summation, and the weights are normalized with compensated summation as well. For more details, see <a href="https://doi.org/10.1137/120889873">Hale & Townsend (2013)</a>. */
+
+class GaussLegendreRule
+{
+public:
+
+    /** This function returns the Gauss-Legendre rule with \f$N\f$ nodes. The first time a given order is requested, the rule is generated and added to the registry; all subsequent calls return the same object. The function is thread-safe, and the returned pointer remains valid until the end of the program. */
+    static const GaussLegendreRule* get(int num);
+
+    /** This function returns the number of nodes \f$N\f$. */
+    int num() const;
+
+    /** This function returns a pointer to the \f$N\f$ nodes \f$x_i\f$, in increasing order. */
+    const double* nodes() const;
+
+    /** This function returns a pointer to the \f$N\f$ complementary nodes \f$1-x_i\f$. */
+    const double* complementary_nodes() const;
+
+    /** This function returns a pointer to the \f$N\f$ weights \f$w_i\f$. */
+    const double* weights() const;
+
+    /** This function returns a pointer to the \f$N\f$ values \f$\sin\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    const double* sin_nodes() const;
+
+    /** This function returns a pointer to the \f$N\f$ values \f$\csc\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    const double* csc_nodes() const;
+
+    /** This function returns a pointer to the \f$N\f$ mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\sin\theta\f$. */
+    const double* sin_weights() const;
+
+    /** This function returns a pointer to the \f$N\f$ mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\csc^2\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\csc\theta\f$. */
+    const double* csc_weights() const;
+
+private:
+
+    /** Constructor of the GaussLegendreRule class. It generates the nodes and weights of the rule with \f$N\f$ nodes, and the corresponding mapped nodes and weights. The constructor is private: rules are obtained through the function get(). */
+    GaussLegendreRule(int num);
+
+    /** This function evaluates the Legendre polynomial \f$P_N(\cos\vartheta)\f$ and its derivative with respect to \f$\vartheta\f$ using the three-term recurrence relation. */
+    void recurrence(double theta, double& P, double& dP) const;
+
+    /** This function evaluates the Legendre polynomial \f$P_N(\cos\vartheta)\f$ and its derivative with respect to \f$\vartheta\f$ using the asymptotic expansion by Stieltjes. */
+    void asymptotic(double theta, double& P, double& dP) const;
+
+    /** The number of nodes \f$N\f$. */
+    int _num;
+
+    /** The constant \f$C_N\f$ in the asymptotic expansion by Stieltjes. */
+    double _CN;
+
+    /** A vector with the coefficients \f$h_{N,m}\f$ in the asymptotic expansion by Stieltjes. */
+    std::vector<double> _hv;
+
+    /** A vector with the \f$N\f$ nodes \f$x_i\f$. */
+    std::vector<double> _xv;
+
+    /** A vector with the \f$N\f$ complementary nodes \f$1-x_i\f$. */
+    std::vector<double> _yv;
+
+    /** A vector with the \f$N\f$ weights \f$w_i\f$. */
+    std::vector<double> _wv;
+
+    /** A vector with the \f$N\f$ values \f$\sin\theta_i\f$. */
+    std::vector<double> _sv;
+
+    /** A vector with the \f$N\f$ values \f$\csc\theta_i\f$. */
+    std::vector<double> _cscv;
+
+    /** A vector with the \f$N\f$ mapped weights for the substitution \f$u = r_{\text{b}}\sin\theta\f$. */
+    std::vector<double> _wsinv;
+
+    /** A vector with the \f$N\f$ mapped weights for the substitution \f$u = r_{\text{b}}\csc\theta\f$. */
+    std::vector<double> _wcscv;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
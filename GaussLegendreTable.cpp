@@ -0,0 +1,53 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "GaussLegendreTable.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+constexpr int GaussLegendreTable<32>::num;
+constexpr double GaussLegendreTable<32>::xv[];
+constexpr double GaussLegendreTable<32>::yv[];
+constexpr double GaussLegendreTable<32>::wv[];
+constexpr double GaussLegendreTable<32>::sv[];
+constexpr double GaussLegendreTable<32>::cscv[];
+constexpr double GaussLegendreTable<32>::wsinv[];
+constexpr double GaussLegendreTable<32>::wcscv[];
+
+//////////////////////////////////////////////////////////////////////
+
+constexpr int GaussLegendreTable<64>::num;
+constexpr double GaussLegendreTable<64>::xv[];
+constexpr double GaussLegendreTable<64>::yv[];
+constexpr double GaussLegendreTable<64>::wv[];
+constexpr double GaussLegendreTable<64>::sv[];
+constexpr double GaussLegendreTable<64>::cscv[];
+constexpr double GaussLegendreTable<64>::wsinv[];
+constexpr double GaussLegendreTable<64>::wcscv[];
+
+//////////////////////////////////////////////////////////////////////
+
+constexpr int GaussLegendreTable<128>::num;
+constexpr double GaussLegendreTable<128>::xv[];
+constexpr double GaussLegendreTable<128>::yv[];
+constexpr double GaussLegendreTable<128>::wv[];
+constexpr double GaussLegendreTable<128>::sv[];
+constexpr double GaussLegendreTable<128>::cscv[];
+constexpr double GaussLegendreTable<128>::wsinv[];
+constexpr double GaussLegendreTable<128>::wcscv[];
+
+//////////////////////////////////////////////////////////////////////
+
+constexpr int GaussLegendreTable<256>::num;
+constexpr double GaussLegendreTable<256>::xv[];
+constexpr double GaussLegendreTable<256>::yv[];
+constexpr double GaussLegendreTable<256>::wv[];
+constexpr double GaussLegendreTable<256>::sv[];
+constexpr double GaussLegendreTable<256>::cscv[];
+constexpr double GaussLegendreTable<256>::wsinv[];
+constexpr double GaussLegendreTable<256>::wcscv[];
+
+//////////////////////////////////////////////////////////////////////
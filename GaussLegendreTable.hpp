@@ -0,0 +1,1042 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef GAUSSLEGENDRETABLE_HPP
+#define GAUSSLEGENDRETABLE_HPP
+
+//////////////////////////////////////////////////////////////////////
+
+/** GaussLegendreTable is the class template that holds the nodes and weights of the \f$N\f$-point Gauss-Legendre rule on the interval \f$[0,1]\f$, together with the mapped nodes and weights that are used by the integration routines of the GaussLegendre class, as constexpr arrays. It is specialized for the orders \f$N\f$ = 32, 64, 128 and 256 only. The values are identical to those generated by the GaussLegendreRule class, and are listed with the shortest decimal representation that reproduces them exactly, such that the integrators give the same results whether they use the compiled tables or the generated rules. For these orders, the integration templates of the GaussLegendre class read the nodes and weights from these arrays, such that the compiler sees both the number of nodes and the tables themselves. */
+
+template<int N> class GaussLegendreTable;
+
+//////////////////////////////////////////////////////////////////////
+
+/** The 32-point Gauss-Legendre rule. */
+template<> class GaussLegendreTable<32>
+{
+public:
+
+    /** The number of nodes \f$N\f$. */
+    static constexpr int num = 32;
+
+    /** The nodes \f$x_i\f$, in increasing order. */
+    static constexpr double xv[num] =
+    {
+        0.001368069075259202, 0.007194244227365833, 0.017618872206246798, 0.03254696203113016,
+        0.051839422116973934, 0.07531619313371504, 0.10275810201602882, 0.1339089406298552,
+        0.1684778665348924, 0.20614212137961888, 0.24655004553388526, 0.28932436193468236,
+        0.33406569885893617, 0.3803563188739314, 0.42776401920860163, 0.4758461671561307,
+        0.5241538328438693, 0.5722359807913984, 0.6196436811260686, 0.6659343011410639,
+        0.7106756380653176, 0.7534499544661147, 0.793857878620381, 0.8315221334651075,
+        0.8660910593701449, 0.8972418979839712, 0.9246838068662849, 0.9481605778830261,
+        0.9674530379688697, 0.9823811277937533, 0.9928057557726342, 0.9986319309247409
+    };
+
+    /** The complementary nodes \f$1-x_i\f$. */
+    static constexpr double yv[num] =
+    {
+        0.9986319309247409, 0.9928057557726342, 0.9823811277937533, 0.9674530379688697,
+        0.9481605778830261, 0.9246838068662849, 0.8972418979839712, 0.8660910593701449,
+        0.8315221334651075, 0.793857878620381, 0.7534499544661147, 0.7106756380653176,
+        0.6659343011410639, 0.6196436811260686, 0.5722359807913984, 0.5241538328438693,
+        0.4758461671561307, 0.42776401920860163, 0.3803563188739314, 0.33406569885893617,
+        0.28932436193468236, 0.24655004553388526, 0.20614212137961888, 0.1684778665348924,
+        0.1339089406298552, 0.10275810201602882, 0.07531619313371504, 0.051839422116973934,
+        0.03254696203113016, 0.017618872206246798, 0.007194244227365833, 0.001368069075259202
+    };
+
+    /** The weights \f$w_i\f$. */
+    static constexpr double wv[num] =
+    {
+        0.003509305004735006, 0.00813719736545289, 0.012696032654631057, 0.017136931456510705,
+        0.021417949011113345, 0.02549902963118809, 0.029342046739267765, 0.03291111138818092,
+        0.036172897054424225, 0.03909694789353517, 0.04165596211347337, 0.04382604650220192,
+        0.045586939347881945, 0.04692219954040226, 0.04781936003963743, 0.0482700442573639,
+        0.0482700442573639, 0.04781936003963743, 0.04692219954040226, 0.045586939347881945,
+        0.04382604650220192, 0.04165596211347337, 0.03909694789353517, 0.036172897054424225,
+        0.03291111138818092, 0.029342046739267765, 0.02549902963118809, 0.021417949011113345,
+        0.017136931456510705, 0.012696032654631057, 0.00813719736545289, 0.003509305004735006
+    };
+
+    /** The values \f$\sin\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double sv[num] =
+    {
+        0.002148956224230831, 0.011300451880904738, 0.027672126886789987, 0.0511023803153949,
+        0.08133921479663775, 0.11803061522890512, 0.16071206081105963, 0.2087960094342721,
+        0.26156607811940774, 0.31817828372316787, 0.3776711720554457, 0.4389858547767736,
+        0.5009959420204748, 0.5625462104049774, 0.6224977228352488, 0.6797761750026091,
+        0.7334196287929728, 0.7826216103998979, 0.826765844214067, 0.8654496323178011,
+        0.898493972882348, 0.9259397851903037, 0.94803089599811, 0.9651855711609202,
+        0.9779592151231683, 0.9870013340973063, 0.9930099565808422, 0.9966864763486392,
+        0.998693419787124, 0.999617053372721, 0.9999361478550954, 0.9999976909909074
+    };
+
+    /** The values \f$\csc\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double cscv[num] =
+    {
+        465.34219204857317, 88.49203647243334, 36.13744632247173, 19.568560091099005,
+        12.294192936336731, 8.472378103432142, 6.222308362877913, 4.7893635645119685,
+        3.8231257171791566, 3.1428920550406056, 2.6478060121919778, 2.2779777277983246,
+        1.9960241513475807, 1.7776317420751964, 1.6064315792921566, 1.4710724452738606,
+        1.3634759157533765, 1.2777566920098562, 1.209532308329224, 1.1554687444049785,
+        1.112973520336506, 1.0799838347959907, 1.0548179434038125, 1.036070191970654,
+        1.022537529721069, 1.0131698564668934, 1.0070392480687969, 1.0033245395919286,
+        1.0013082895981777, 1.0003830933315783, 1.0000638562222612, 1.000002309014424
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\sin\theta\f$. */
+    static constexpr double wsinv[num] =
+    {
+        0.005512390682851097, 0.012781063581621706, 0.019935244399569667, 0.026883457636434134,
+        0.03353175797715521, 0.03977380440565328, 0.04549126579763384, 0.05055721807432755,
+        0.054842089139293476, 0.05822174577527626, 0.06058704785087053, 0.06185393597036063,
+        0.06197294147869825, 0.06093695734759914, 0.0587862114670621, 0.05560964248627694,
+        0.05154226663499153, 0.046758589701680855, 0.0414625914573049, 0.03587521565264124,
+        0.030220573284593526, 0.024712169991178024, 0.01954039179982689, 0.014862250950131876,
+        0.010794054822304996, 0.007407279831012494, 0.0047275725413244716, 0.0027365143696989865,
+        0.0013756060159309995, 0.0005518619462150861, 0.00014444101685963937, 1.1845913620627153e-05
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\csc^2\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\csc\theta\f$. */
+    static constexpr double wcscv[num] =
+    {
+        1193.6715763971392, 100.08647057137026, 26.033735222524946, 10.294443291452588,
+        5.068230657209825, 2.85501104000113, 1.7612908588316714, 1.1596816377110588,
+        0.8015878927410028, 0.5751010411097577, 0.4247683207786547, 0.3209713638467792,
+        0.24690716540070612, 0.19255923805547004, 0.1517050152368651, 0.12034227700430748,
+        0.09582050498949382, 0.0763409802468108, 0.060658461286991185, 0.04789728811184403,
+        0.037434528055032, 0.028823412213265724, 0.021741438995928265, 0.01595375610153199,
+        0.011286080219903093, 0.007603670211916002, 0.004794363909097925, 0.002754739915929713,
+        0.0013792077525317358, 0.0005522848564697152, 0.000144459464363967, 1.1845968325461143e-05
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+
+/** The 64-point Gauss-Legendre rule. */
+template<> class GaussLegendreTable<64>
+{
+public:
+
+    /** The number of nodes \f$N\f$. */
+    static constexpr int num = 64;
+
+    /** The nodes \f$x_i\f$, in increasing order. */
+    static constexpr double xv[num] =
+    {
+        0.00034747913211390883, 0.0018299416140223565, 0.004493314261627844, 0.008331873057687022,
+        0.013336586105044505, 0.019495600173973147, 0.0267943125707986, 0.03521541393403021,
+        0.0447389314607486, 0.05534227700244295, 0.06700030092295359, 0.07968535187370981,
+        0.0933673424386012, 0.10801382052832927, 0.12359004636973402, 0.14005907491419453,
+        0.15738184347288336, 0.17551726437267134, 0.19442232241380333, 0.21405217689868297,
+        0.23436026799005263, 0.25529842714647355, 0.276816991373268, 0.29886492101800416,
+        0.32138992083116585, 0.3443385640048946, 0.36765641889561623, 0.3912881781299964,
+        0.41517778978800357, 0.4392685903519398, 0.4635034391061005, 0.4878248536682878,
+        0.5121751463317122, 0.5364965608938995, 0.5607314096480602, 0.5848222102119964,
+        0.6087118218700037, 0.6323435811043837, 0.6556614359951054, 0.6786100791688341,
+        0.7011350789819959, 0.723183008626732, 0.7447015728535266, 0.7656397320099474,
+        0.7859478231013171, 0.8055776775861966, 0.8244827356273287, 0.8426181565271166,
+        0.8599409250858054, 0.876409953630266, 0.8919861794716706, 0.9066326575613988,
+        0.9203146481262902, 0.9329996990770465, 0.944657722997557, 0.9552610685392515,
+        0.9647845860659698, 0.9732056874292014, 0.9805043998260269, 0.9866634138949555,
+        0.9916681269423129, 0.9955066857383722, 0.9981700583859776, 0.9996525208678861
+    };
+
+    /** The complementary nodes \f$1-x_i\f$. */
+    static constexpr double yv[num] =
+    {
+        0.9996525208678861, 0.9981700583859776, 0.9955066857383722, 0.9916681269423129,
+        0.9866634138949555, 0.9805043998260269, 0.9732056874292014, 0.9647845860659698,
+        0.9552610685392515, 0.944657722997557, 0.9329996990770465, 0.9203146481262902,
+        0.9066326575613988, 0.8919861794716706, 0.876409953630266, 0.8599409250858054,
+        0.8426181565271166, 0.8244827356273287, 0.8055776775861966, 0.7859478231013171,
+        0.7656397320099474, 0.7447015728535266, 0.723183008626732, 0.7011350789819959,
+        0.6786100791688341, 0.6556614359951054, 0.6323435811043837, 0.6087118218700037,
+        0.5848222102119964, 0.5607314096480602, 0.5364965608938995, 0.5121751463317122,
+        0.4878248536682878, 0.4635034391061005, 0.4392685903519398, 0.41517778978800357,
+        0.3912881781299964, 0.36765641889561623, 0.3443385640048946, 0.32138992083116585,
+        0.29886492101800416, 0.276816991373268, 0.25529842714647355, 0.23436026799005263,
+        0.21405217689868297, 0.19442232241380333, 0.17551726437267134, 0.15738184347288336,
+        0.14005907491419453, 0.12359004636973402, 0.10801382052832927, 0.0933673424386012,
+        0.07968535187370981, 0.06700030092295359, 0.05534227700244295, 0.0447389314607486,
+        0.03521541393403021, 0.0267943125707986, 0.019495600173973147, 0.013336586105044505,
+        0.008331873057687022, 0.004493314261627844, 0.0018299416140223565, 0.00034747913211390883
+    };
+
+    /** The weights \f$w_i\f$. */
+    static constexpr double wv[num] =
+    {
+        0.0008916403608481513, 0.002073516630281201, 0.003252228984489172, 0.0044233799131819735,
+        0.005584069730065533, 0.006731523948359325, 0.007863015238012359, 0.008975857887848675,
+        0.010067411576765106, 0.011135086904191627, 0.012176351284355444, 0.013188734857527336,
+        0.01416983630712975, 0.01511732853620125, 0.016028964177425775, 0.016902580918570803,
+        0.0177361066284412, 0.018527564270120034, 0.019275076589307837, 0.019976870566360175,
+        0.020631281621311767, 0.02123675756182679, 0.021791862264661736, 0.022295279081878287,
+        0.022745813963709074, 0.02314239829065721, 0.023484091408105024, 0.02377008285741516,
+        0.023999694298229166, 0.024172381117401477, 0.024287733720751707, 0.02434547850456987,
+        0.02434547850456987, 0.024287733720751707, 0.024172381117401477, 0.023999694298229166,
+        0.02377008285741516, 0.023484091408105024, 0.02314239829065721, 0.022745813963709074,
+        0.022295279081878287, 0.021791862264661736, 0.02123675756182679, 0.020631281621311767,
+        0.019976870566360175, 0.019275076589307837, 0.018527564270120034, 0.0177361066284412,
+        0.016902580918570803, 0.016028964177425775, 0.01511732853620125, 0.01416983630712975,
+        0.013188734857527336, 0.012176351284355444, 0.011135086904191627, 0.010067411576765106,
+        0.008975857887848675, 0.007863015238012359, 0.006731523948359325, 0.005584069730065533,
+        0.0044233799131819735, 0.003252228984489172, 0.002073516630281201, 0.0008916403608481513
+    };
+
+    /** The values \f$\sin\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double sv[num] =
+    {
+        0.0005458189172608298, 0.002874461607153405, 0.007058022935941993, 0.013087301972203709,
+        0.02094752820435435, 0.030618830864764853, 0.042075982725864054, 0.05528803693031172,
+        0.07021791856844642, 0.08682199553652792, 0.1050496494353302, 0.12484286744904119,
+        0.14613587664481786, 0.16885484226322198, 0.192917651138194, 0.21823380031959108,
+        0.24470440924277972, 0.27222237139754624, 0.3006726584173973, 0.3299327858907421,
+        0.35987344606429417, 0.390359308068822, 0.42124998147443593, 0.45240113402383747,
+        0.4836657494599667, 0.5148955066316032, 0.5459422567015061, 0.5766595714660842,
+        0.606904332679253, 0.6365383299905075, 0.6654298337638347, 0.6934551087106656,
+        0.7204998349778291, 0.7464604050698438, 0.7712450677008547, 0.7947748932717681,
+        0.8169845400229752, 0.8378228048624999, 0.8572529482309084, 0.8752527879414773,
+        0.8918145625262831, 0.9069445700304883, 0.9206625932468585, 0.9330011269113289,
+        0.9440044262578294, 0.9537273994597277, 0.9622343688055922, 0.9695977269451193,
+        0.9758965152095117, 0.9812149509049085, 0.9856409296717858, 0.9892645275947433,
+        0.9921765258496601, 0.994466978412815, 0.9962238408565893, 0.9975316756433928,
+        0.9984704467195774, 0.9991144137072855, 0.9995311336804247, 0.9997805764577185,
+        0.9999143575962335, 0.9999750918459098, 0.9999958687267008, 0.9999998510408437
+    };
+
+    /** The values \f$\csc\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double cscv[num] =
+    {
+        1832.109456774528, 347.89123553134027, 141.68273595536792, 76.40994317422438,
+        47.73832932670933, 32.659640219991786, 23.766527487076402, 18.087095428265222,
+        14.241379129249305, 11.517818656670682, 9.519308302076837, 8.010069140779578,
+        6.8429465984625555, 5.922246508282745, 5.183558860996412, 4.5822416075582995,
+        4.0865630623266185, 3.6734673747280926, 3.325876071550837, 3.030920365492722,
+        2.7787546175922695, 2.5617424237868964, 2.3738873447539515, 2.2104277040722646,
+        2.06754354865223, 1.9421416328565453, 1.8316955460488378, 1.7341253826024707,
+        1.6477061476647865, 1.5709973035165261, 1.5027880465529388, 1.4420544133841486,
+        1.3879253699354026, 1.3396557851001265, 1.2966047264082774, 1.258217903541722,
+        1.2240133699125788, 1.193569802822586, 1.166516839707201, 1.1425270662112574,
+        1.1213093416721691, 1.1026032163866237, 1.0861742481285634, 1.0718100666292536,
+        1.0593170669380705, 1.0485176378139969, 1.0392478510628194, 1.0313555531433312,
+        1.024698812235551, 1.0191446829033406, 1.0145682569543817, 1.0108519734669539,
+        1.007885163523336, 1.005563806247258, 1.0037904725710678, 1.0024744320575234,
+        1.0015318963975828, 1.0008863712509446, 1.0004690862583228, 1.0002194716995394,
+        1.000085649739016, 1.0000249087745217, 1.0000041312903667, 1.0000001489591785
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\sin\theta\f$. */
+    static constexpr double wsinv[num] =
+    {
+        0.001400585195012332, 0.0032570588505379887, 0.005108462097200955, 0.0069476338566179735,
+        0.008769511560947098, 0.010568895368231817, 0.012340257404009942, 0.014077679054236186,
+        0.015774819406274516, 0.017424904983253678, 0.01902074015830958, 0.020554738792715733,
+        0.022018977463322938, 0.023405270146042337, 0.024705263614288396, 0.02591055215758489,
+        0.02701280955795298, 0.02800393560611917, 0.028876213821541947, 0.02962247648590953,
+        0.030236272635268662, 0.03071203430630664, 0.031045236119960806, 0.031232543228843,
+        0.03127194276686645, 0.031162854226187853, 0.030906214646794446, 0.03050453512832528,
+        0.02996192594441868, 0.029284088431700293, 0.028478272806382054, 0.02755320209387218,
+        0.026518963399791793, 0.02538686876185861, 0.024169288759508762, 0.022879462883164718,
+        0.021531291344114637, 0.020139113512362833, 0.018717478485192413, 0.017280913404433478,
+        0.015843695056011915, 0.014419630011085845, 0.013021848122356839, 0.011662613597708753,
+        0.01035315716762305, 0.009103532078108061, 0.007922495814221055, 0.0068174186275095795,
+        0.005794219138608952, 0.004857326544834006, 0.004009668307863505, 0.003252681648505807,
+        0.0025863467474713333, 0.0020092392497737463, 0.001518599496052672, 0.0011104158509926988,
+        0.0007795195561379317, 0.000519688686541117, 0.00032375901940714594, 0.00018373990762274092,
+        9.093357004338896e-05, 3.605654075130743e-05, 9.362329296452026e-06, 7.64466008547386e-07
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\csc^2\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\csc\theta\f$. */
+    static constexpr double wcscv[num] =
+    {
+        4701.239366488038, 394.19633398202353, 102.54725622524901, 40.56361726099198,
+        19.98526159491479, 11.273334431799167, 6.970367601413583, 4.605414454910089,
+        3.199399646704243, 2.3115904497080533, 1.723606796156973, 1.318816863666821,
+        1.031058836431269, 0.8208931265455597, 0.6638127064348399, 0.5440422610861558,
+        0.45111385647192315, 0.37789525998520634, 0.3194128428289939, 0.2721262363031857,
+        0.23346869051577898, 0.20154846977388668, 0.17495049586024888, 0.15260191372117904,
+        0.1336793097167781, 0.11754360993991282, 0.10369370573326894, 0.09173295869524778,
+        0.08134469786457561, 0.07227408279219684, 0.06431453143276625, 0.05729746047470806,
+        0.05108445595701214, 0.04556124527357805, 0.0406330171198718, 0.03622075894283756,
+        0.03225836865399945, 0.028690359828433543, 0.025470024798273354, 0.022557953045604383,
+        0.01992082661510446, 0.01753043234912787, 0.01536284432243989, 0.013397740149160023,
+        0.011617822733979316, 0.010008325183599665, 0.008556581449281904, 0.007251649177992315,
+        0.006083974454904603, 0.005045090799653518, 0.004127347052672574, 0.0033236607315195025,
+        0.0026272950897229556, 0.0020316594834435763, 0.0015301337342802405, 0.0011159179470201824,
+        0.0007819096718413839, 0.0005206103690589918, 0.0003240628324617254, 0.0001838205678926913,
+        9.094914758355055e-05, 3.6058337022165823e-05, 9.362406653613482e-06, 7.644662362958603e-07
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+
+/** The 128-point Gauss-Legendre rule. */
+template<> class GaussLegendreTable<128>
+{
+public:
+
+    /** The number of nodes \f$N\f$. */
+    static constexpr int num = 128;
+
+    /** The nodes \f$x_i\f$, in increasing order. */
+    static constexpr double xv[num] =
+    {
+        8.755602643402569e-05, 0.00046127001131205015, 0.0011333756872429809, 0.0021036207325094143,
+        0.003371443549893514, 0.004936090754132809, 0.006796628637706896, 0.008951945782140732,
+        0.011400754268046306, 0.014141590626431711, 0.01717281678401736, 0.020492621073150023,
+        0.024099019329367803, 0.0279898560848899, 0.03216280586104181, 0.036615374560526076,
+        0.04134490095951974, 0.04634855829912158, 0.05162335597542091, 0.057166141327301384,
+        0.0629736015209841, 0.06904226553022576, 0.0753685062110155, 0.0819485424695466,
+        0.08877844152217805, 0.09585412124604316, 0.10317135261890335, 0.110725762246794,
+        0.11851283497795263, 0.12652791660146903, 0.13476621662904562, 0.14322281115820631,
+        0.15189264581524278, 0.16077053877614036, 0.16985118386367695, 0.17912915371884622,
+        0.18859890304470756, 0.1982547719207257, 0.20809098918561847, 0.21810167588669097,
+        0.2282808487935949, 0.2386224239744122, 0.24912022043192777, 0.2597679637979139,
+        0.27055929008322394, 0.28148774948144784, 0.2925468102238625, 0.3037298624833663,
+        0.31503022232507055, 0.3264411357011822, 0.33795578248779345, 0.34956728056116126,
+        0.36126868991104777, 0.37305301678865294, 0.38491321788667004, 0.39684220454896035,
+        0.4088328470073313, 0.4208779786428875, 0.43297040026940614, 0.4451028844361782,
+        0.4572681797477422, 0.46945901519793026, 0.48166810451563313, 0.4938881505196921,
+        0.506111849480308, 0.5183318954843669, 0.5305409848020699, 0.5427318202522577,
+        0.5548971155638218, 0.5670295997305939, 0.5791220213571123, 0.5911671529926686,
+        0.6031577954510395, 0.61508678211333, 0.6269469832113471, 0.6387313100889521,
+        0.6504327194388385, 0.6620442175122067, 0.6735588642988177, 0.6849697776749294,
+        0.6962701375166338, 0.7074531897761376, 0.7185122505185522, 0.729440709916776,
+        0.7402320362020861, 0.7508797795680722, 0.7613775760255879, 0.7717191512064051,
+        0.781898324113309, 0.7919090108143815, 0.8017452280792744, 0.8114010969552925,
+        0.8208708462811537, 0.8301488161363231, 0.8392294612238597, 0.8481073541847571,
+        0.8567771888417937, 0.8652337833709544, 0.8734720833985311, 0.8814871650220473,
+        0.8892742377532059, 0.8968286473810967, 0.9041458787539568, 0.911221558477822,
+        0.9180514575304535, 0.9246314937889845, 0.9309577344697744, 0.9370263984790158,
+        0.9428338586726985, 0.948376644024579, 0.9536514417008785, 0.9586550990404803,
+        0.9633846254394739, 0.9678371941389583, 0.9720101439151101, 0.9759009806706322,
+        0.97950737892685, 0.9828271832159827, 0.9858584093735684, 0.9885992457319537,
+        0.9910480542178592, 0.9932033713622931, 0.9950639092458673, 0.9966285564501064,
+        0.9978963792674906, 0.998866624312757, 0.999538729988688, 0.9999124439735659
+    };
+
+    /** The complementary nodes \f$1-x_i\f$. */
+    static constexpr double yv[num] =
+    {
+        0.9999124439735659, 0.999538729988688, 0.998866624312757, 0.9978963792674906,
+        0.9966285564501064, 0.9950639092458673, 0.9932033713622931, 0.9910480542178592,
+        0.9885992457319537, 0.9858584093735684, 0.9828271832159827, 0.97950737892685,
+        0.9759009806706322, 0.9720101439151101, 0.9678371941389583, 0.9633846254394739,
+        0.9586550990404803, 0.9536514417008785, 0.948376644024579, 0.9428338586726985,
+        0.9370263984790158, 0.9309577344697744, 0.9246314937889845, 0.9180514575304535,
+        0.911221558477822, 0.9041458787539568, 0.8968286473810967, 0.8892742377532059,
+        0.8814871650220473, 0.8734720833985311, 0.8652337833709544, 0.8567771888417937,
+        0.8481073541847571, 0.8392294612238597, 0.8301488161363231, 0.8208708462811537,
+        0.8114010969552925, 0.8017452280792744, 0.7919090108143815, 0.781898324113309,
+        0.7717191512064051, 0.7613775760255879, 0.7508797795680722, 0.7402320362020861,
+        0.729440709916776, 0.7185122505185522, 0.7074531897761376, 0.6962701375166338,
+        0.6849697776749294, 0.6735588642988177, 0.6620442175122067, 0.6504327194388385,
+        0.6387313100889521, 0.6269469832113471, 0.61508678211333, 0.6031577954510395,
+        0.5911671529926686, 0.5791220213571123, 0.5670295997305939, 0.5548971155638218,
+        0.5427318202522577, 0.5305409848020699, 0.5183318954843669, 0.506111849480308,
+        0.4938881505196921, 0.48166810451563313, 0.46945901519793026, 0.4572681797477422,
+        0.4451028844361782, 0.43297040026940614, 0.4208779786428875, 0.4088328470073313,
+        0.39684220454896035, 0.38491321788667004, 0.37305301678865294, 0.36126868991104777,
+        0.34956728056116126, 0.33795578248779345, 0.3264411357011822, 0.31503022232507055,
+        0.3037298624833663, 0.2925468102238625, 0.28148774948144784, 0.27055929008322394,
+        0.2597679637979139, 0.24912022043192777, 0.2386224239744122, 0.2282808487935949,
+        0.21810167588669097, 0.20809098918561847, 0.1982547719207257, 0.18859890304470756,
+        0.17912915371884622, 0.16985118386367695, 0.16077053877614036, 0.15189264581524278,
+        0.14322281115820631, 0.13476621662904562, 0.12652791660146903, 0.11851283497795263,
+        0.110725762246794, 0.10317135261890335, 0.09585412124604316, 0.08877844152217805,
+        0.0819485424695466, 0.0753685062110155, 0.06904226553022576, 0.0629736015209841,
+        0.057166141327301384, 0.05162335597542091, 0.04634855829912158, 0.04134490095951974,
+        0.036615374560526076, 0.03216280586104181, 0.0279898560848899, 0.024099019329367803,
+        0.020492621073150023, 0.01717281678401736, 0.014141590626431711, 0.011400754268046306,
+        0.008951945782140732, 0.006796628637706896, 0.004936090754132809, 0.003371443549893514,
+        0.0021036207325094143, 0.0011333756872429809, 0.00046127001131205015, 8.755602643402569e-05
+    };
+
+    /** The weights \f$w_i\f$. */
+    static constexpr double wv[num] =
+    {
+        0.00022469048014600105, 0.0005229063396701551, 0.0008212515093344976, 0.001119144215481303,
+        0.0014163757357289948, 0.0017127630204551078, 0.002008127491869323, 0.0023022921283514784,
+        0.002595080916338166, 0.0028863187714328496, 0.003175831580853595, 0.0034634462834494057,
+        0.0037489909628173643, 0.0040322949452430285, 0.004313188899308377, 0.004591504935830436,
+        0.004867076707503406, 0.005139739507916082, 0.005409330369751539, 0.005675688162040208,
+        0.005938653686370143, 0.006198069771975463, 0.006453781369633675, 0.006705635644308169,
+        0.006953482066475991, 0.0071971725020834225, 0.007436561301073653, 0.007671505384432574,
+        0.007901864329699675, 0.008127500454892593, 0.008348278900794606, 0.008564067711555691,
+        0.008774737913558855, 0.00898016359250435, 0.009180221968665674, 0.009374793470272357,
+        0.009563761804975472, 0.009747014029353296, 0.00992444061641542, 0.010095935521065021,
+        0.01026139624348003, 0.010420723890375575, 0.010573823234110673, 0.01072060276960423,
+        0.010860974769026038, 0.010994855334230249, 0.011122164446899892, 0.011242826016372486,
+        0.01135676792511823, 0.011463922071843428, 0.011564224412193515, 0.01165761499703138,
+        0.011744038008267966, 0.011823441792223806, 0.011895778890501708, 0.011961006068351734,
+        0.01201908434051203, 0.012069978994509647, 0.01211365961140764, 0.012150100083985938,
+        0.012179278632345312, 0.012201177816924796, 0.012215784548925019, 0.012223090098131266,
+        0.012223090098131266, 0.012215784548925019, 0.012201177816924796, 0.012179278632345312,
+        0.012150100083985938, 0.01211365961140764, 0.012069978994509647, 0.01201908434051203,
+        0.011961006068351734, 0.011895778890501708, 0.011823441792223806, 0.011744038008267966,
+        0.01165761499703138, 0.011564224412193515, 0.011463922071843428, 0.01135676792511823,
+        0.011242826016372486, 0.011122164446899892, 0.010994855334230249, 0.010860974769026038,
+        0.01072060276960423, 0.010573823234110673, 0.010420723890375575, 0.01026139624348003,
+        0.010095935521065021, 0.00992444061641542, 0.009747014029353296, 0.009563761804975472,
+        0.009374793470272357, 0.009180221968665674, 0.00898016359250435, 0.008774737913558855,
+        0.008564067711555691, 0.008348278900794606, 0.008127500454892593, 0.007901864329699675,
+        0.007671505384432574, 0.007436561301073653, 0.0071971725020834225, 0.006953482066475991,
+        0.006705635644308169, 0.006453781369633675, 0.006198069771975463, 0.005938653686370143,
+        0.005675688162040208, 0.005409330369751539, 0.005139739507916082, 0.004867076707503406,
+        0.004591504935830436, 0.004313188899308377, 0.0040322949452430285, 0.0037489909628173643,
+        0.0034634462834494057, 0.003175831580853595, 0.0028863187714328496, 0.002595080916338166,
+        0.0023022921283514784, 0.002008127491869323, 0.0017127630204551078, 0.0014163757357289948,
+        0.001119144215481303, 0.0008212515093344976, 0.0005229063396701551, 0.00022469048014600105
+    };
+
+    /** The values \f$\sin\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double sv[num] =
+    {
+        0.00013753268427774715, 0.0007245611760318316, 0.0017803014259623082, 0.0033043537063286114,
+        0.005295826389595536, 0.007753515536863338, 0.01067591649002344, 0.014061220151840588,
+        0.017907305728080764, 0.022211731804953887, 0.026971726249041313, 0.032184175141889454,
+        0.037845610897395444, 0.043952199696932336, 0.05049972837828264, 0.057483590919825064,
+        0.06489877466785207, 0.07273984646122023, 0.08100093881326766, 0.08967573631583182,
+        0.09875746243413228, 0.10823886686414463, 0.11811221362581961, 0.12836927006602483,
+        0.1390012969443639, 0.14999903977301304, 0.16135272157837025, 0.173052037247627,
+        0.18508614961731135, 0.19744368745342875, 0.2101127454640378, 0.22308088647496474,
+        0.2363351458879116, 0.24986203852749686, 0.2636475679698286, 0.2776772384301387,
+        0.2919360692708606, 0.30640861217443327, 0.3210789710071529, 0.3359308243817015,
+        0.35094745090669255, 0.36611175709182386, 0.3814063078571903, 0.39681335957511255,
+        0.41231489555270623, 0.42789266384345154, 0.443528217256488, 0.4592029554133456,
+        0.47489816868359797, 0.49059508381358463, 0.5062749110461309, 0.5219188925142161,
+        0.5375083516780081, 0.5530247435626691, 0.5684497055440711, 0.5837651084210719,
+        0.598953107506434, 0.613996193463922, 0.6288772426166008, 0.6435795664509786,
+        0.6580869600433613, 0.6723837491386717, 0.6864548356179488, 0.7002857410988039,
+        0.7138626484231396, 0.7271724407984221, 0.7402027383725516, 0.752941932037848,
+        0.7653792142766684, 0.7775046068795611, 0.789308985386467, 0.8007841001221153,
+        0.8119225937182275, 0.8227180150372659, 0.8331648294349949, 0.8432584253219119,
+        0.8529951170063835, 0.8623721438249454, 0.8713876655874477, 0.8800407543863891,
+        0.888331382840688, 0.8962604088641212, 0.9038295570675673, 0.9110413969218747,
+        0.9178993178245163, 0.9244075012280818, 0.9305708900020123, 0.9363951552107126,
+        0.9418866605012677, 0.9470524243023656, 0.9519000800427205, 0.95643783460227,
+        0.9606744252127314, 0.9646190750257817, 0.9682814475672266, 0.9716716002941217,
+        0.9747999374689885, 0.9776771625611209, 0.9803142303796232, 0.9827222991363522,
+        0.9849126826295039, 0.9868968027302819, 0.9886861423460804, 0.9902921990239976,
+        0.9917264393484304, 0.9930002542761047, 0.9941249155412845, 0.9951115332532182,
+        0.9959710147972246, 0.9967140251402953, 0.9973509486318234, 0.997891852380112,
+        0.9983464512757895, 0.9987240747242051, 0.9990336351403796, 0.9992835982521693,
+        0.9994819552500366, 0.9996361968151948, 0.9997532890519665, 0.9998396513449349,
+        0.999901136156891, 0.9999430107796634, 0.9999699410466395, 0.9999859770131035,
+        0.9999945406083892, 0.9999984152621607, 0.9999997375055166, 0.9999999905423803
+    };
+
+    /** The values \f$\csc\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double cscv[num] =
+    {
+        7270.998928374733, 1380.1457117488003, 561.702633844417, 302.6310404012639,
+        188.8279423140935, 128.97375329237389, 93.66877316195682, 71.11758362371575,
+        55.84312990378459, 45.021253127906476, 37.07586198846075, 31.071170710180656,
+        26.42314329952646, 22.751989818379794, 19.802086706471258, 17.39626881338615,
+        15.40861141243326, 13.747623189349591, 12.345535924038002, 11.151288420739231,
+        10.125817081083513, 9.238825469737632, 8.466524919836043, 7.790026378475665,
+        7.194177478791842, 6.66670934369484, 6.197602310130805, 5.778608653818161,
+        5.402889422399377, 5.064735231081374, 4.759349547270356, 4.482678977126196,
+        4.231279254903024, 4.0022086023681895, 3.7929422512800817, 3.601303461722491,
+        3.425407495886341, 3.263615839331294, 3.1144985822747087, 2.976803339915451,
+        2.849429444255667, 2.7314064097351336, 2.6218758824891517, 2.520076443673038,
+        2.425330762449182, 2.337034692340178, 2.2546479820058662, 2.1776863328326423,
+        2.105714584606563, 2.03834084970158, 1.9752114477363105, 1.9160065181445063,
+        1.8604362088108453, 1.8082373558149474, 1.759170583161594, 1.7130177627517547,
+        1.669579784239216, 1.628674592196408, 1.5901354544795583, 1.5538094310770352,
+        1.5195560172383753, 1.487245938470415, 1.4567600781773165, 1.4279885214154449,
+        1.4008297005157966, 1.3751896302643403, 1.3509812219806863, 1.328123667244147,
+        1.3065418832219828, 1.286166012589176, 1.2669309719189032, 1.24877604319005,
+        1.2316445037210573, 1.2154832904135493, 1.2002426946876086, 1.1858760849240877,
+        1.1723396536073212, 1.1595921866917258, 1.1475948530047737, 1.1363110117522375,
+        1.125706036414272, 1.1157471535168597, 1.1064032949358873, 1.0976449625436218,
+        1.0894441041421274, 1.0817739997473983, 1.0746091573935195, 1.0679252177196226,
+        1.06169886668509, 1.0559077558316137, 1.0505304295752562, 1.0455462590685207,
+        1.040935382222297, 1.0366786495210794, 1.0327575753025788, 1.0291542942052678,
+        1.025851522514909, 1.0228325241641139, 1.020081081157777, 1.0175814682121613,
+        1.0153184314067478, 1.0132771706560075, 1.0114433258132582, 1.0098029662210508,
+        1.0083425835223323, 1.0070490875442908, 1.0059098050625928, 1.0049124812480068,
+        1.0040452835905025, 1.0032968080881999, 1.0026560874803505, 1.0021126012952803,
+        1.0016562874762538, 1.0012775553409456, 1.0009672996239858, 1.0007169153472386,
+        1.0005183132594262, 1.0003639355857303, 1.0002467718293455, 1.0001603743708798,
+        1.0000988736181349, 1.000056992468293, 1.0000300598569283, 1.0000140231835433,
+        1.0000054594214158, 1.0000015847403507, 1.0000002624945523, 1.0000000094576198
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\sin\theta\f$. */
+    static constexpr double wsinv[num] =
+    {
+        0.0003529429775411196, 0.000821379142004094, 0.0012900168098957017, 0.0017579380255072826,
+        0.0022248066041731652, 0.002690320990536949, 0.0031541795234876985, 0.003616074484055623,
+        0.004075689934910314, 0.004532700381360895, 0.004986769718765554, 0.005437550345650814,
+        0.005884682414444238, 0.006327793216542357, 0.006766496705800135, 0.007200393166637082,
+        0.007629069033253914, 0.00805209686604073, 0.008469035490521394, 0.00887943030326722,
+        0.009282813748190469, 0.009678705965523143, 0.010066615614615762, 0.010446040870464652,
+        0.010816470592604382, 0.011177385663691808, 0.011528260493768892, 0.011868564684832798,
+        0.012197764848972243, 0.012515326571961494, 0.012820716512846678, 0.013113404628727787,
+        0.013392866512644644, 0.013658585831229848, 0.013910056847610078, 0.01414678701393187,
+        0.014368299616872596, 0.01457413645858574, 0.014763860554733395, 0.014937058830591073,
+        0.015093344795681392, 0.015232361177014934, 0.015353782490795647, 0.015457317532395962,
+        0.015542711764524816, 0.0156097495838088, 0.01565825644648185, 0.015688100834535156,
+        0.015699196044513464, 0.01569150178215351, 0.01566502554723971, 0.015619823794392924,
+        0.015556002856999911, 0.015473719623123624, 0.015373181953991963, 0.015254648837529784,
+        0.015118430271360596, 0.014964886871737887, 0.014794429206955511, 0.014607516855908446,
+        0.014404657194609526, 0.014186403915591086, 0.013953355287212891, 0.01370615216193523,
+        0.013445475744578349, 0.01317204513345653, 0.01288661464902571, 0.012589970966301305,
+        0.012282930068770615, 0.011966334042825677, 0.011641047732867761, 0.011307955278170355,
+        0.010967956553326833, 0.010621963534645977, 0.010270896615189205, 0.009915680891267036,
+        0.009557242443130833, 0.009196504632313404, 0.008834384437593431, 0.008471788850895447,
+        0.008109611353596717, 0.007748728492709638, 0.00738999657525676, 0.0070342484978708625,
+        0.006682290727251598, 0.006334900445611887, 0.005992822873668615, 0.005656768782094165,
+        0.005327412200665394, 0.005005388332645707, 0.0046912916802314495, 0.00438567438520467,
+        0.004089044787278566, 0.00380186620101457, 0.0035245559106480053, 0.0032574843806951895,
+        0.0030009746788423088, 0.0027553021063452896, 0.002520694030010195, 0.00229732990878272,
+        0.0020853415070584166, 0.0018848132860375525, 0.0016957829637906838, 0.001518242234175315,
+        0.0013521376343484611, 0.0011973715503519995, 0.0010538033501042003, 0.0009212506331053559,
+        0.000799490586252368, 0.0006882614353485768, 0.0005872639821821563, 0.0004961632174205146,
+        0.00041459000001847237, 0.0003421427943546989, 0.0002783894568827841, 0.0002228690646992895,
+        0.00017509377908027086, 0.00013455073770844958, 0.00010070396999490814, 7.299633058073454e-05,
+        5.085144677521577e-05, 3.367567633783577e-05, 2.0860072631227774e-05, 1.178235474993334e-05,
+        5.808880743035575e-06, 2.2966224057173243e-06, 5.951395933193606e-07, 4.8541195557302115e-08
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\csc^2\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\csc\theta\f$. */
+    static constexpr double wcscv[num] =
+    {
+        18659.18654140664, 1564.5647849437862, 407.0130087270566, 161.0017149802381,
+        79.32768603181303, 44.75141554319725, 27.674263523300528, 18.289058611727086,
+        12.709856297692037, 9.187390385142944, 6.854911107803441, 5.2495070726550725,
+        4.108582290575853, 3.2756013994365083, 2.6532965378271025, 2.179056198204338,
+        1.8113340471167336, 1.5218233057102573, 1.2907848158552329, 1.1041681104781047,
+        0.9517870517849318, 0.8261346203911354, 0.7215955856145572, 0.6339128818735243,
+        0.5598193027542389, 0.496779056419143, 0.4428036488573832, 0.39631888585071184,
+        0.3560675653780149, 0.3210374372310757, 0.2904072820348831, 0.26350613975323406,
+        0.23978218739211765, 0.21877877100533077, 0.20011579375177801, 0.1834751502627805,
+        0.1685892439865389, 0.1552318724114011, 0.1432109447167572, 0.13236262762506745,
+        0.12254661192724295, 0.11364226400373185, 0.10554548047137763, 0.09816610468325677,
+        0.09142579465592977, 0.08525625559556346, 0.07959776836109342, 0.07439795927427233,
+        0.0696107676497583, 0.06519557600761058, 0.06111647469564275, 0.05734163800462602,
+        0.053842793119732835, 0.050594766656707826, 0.04757509626497052, 0.04476369698406194,
+        0.04214257382448376, 0.039695573494667305, 0.03740816937958449, 0.03526727484604836,
+        0.03326108074665803, 0.031378913651603245, 0.02961111188143641, 0.02794891686543069,
+        0.026384377726127815, 0.024910267304704754, 0.023520008104823506, 0.02220760685356665,
+        0.02096759656414501, 0.01979498514219775, 0.018685209710535958, 0.01763409594007951,
+        0.016637821770783764, 0.015692884988253743, 0.014796074191744729, 0.013944442749212329,
+        0.013135285386560235, 0.012366117102536689, 0.011634654138939347, 0.010938796768820662,
+        0.010276613694007843, 0.009646327868116839, 0.009046303582897508, 0.00847503467466485,
+        0.007931133724145164, 0.007413322137636249, 0.00692042101023353, 0.006451342683258646,
+        0.006005082918151336, 0.005580713618132564, 0.005177376037068081, 0.004794274422289247,
+        0.00443067004477335, 0.004085875576141059, 0.0037592497774739044, 0.0034501924700529128,
+        0.0031581397628239086, 0.0028825595157457385, 0.0026229470222063614, 0.002378820897420659,
+        0.002149719163166059, 0.0019351955223761532, 0.0017348158199971284, 0.0015481546891142949,
+        0.001374792383666281, 0.0012143118010704927, 0.0010662956997717476, 0.0009303241180801644,
+        0.0008059720016702767, 0.0006928070477569857, 0.0005903877742339804, 0.0004982618219503334,
+        0.00041596449780795025, 0.0003430175654908442, 0.0002789282893969757, 0.00022318873575258638,
+        0.00017527533297365632, 0.00013464869113265186, 0.0001007536779332069, 7.301974593938253e-05,
+        5.086150300539924e-05, 3.3679514967050984e-05, 2.086132675167445e-05, 1.17826852044968e-05,
+        5.808944169464572e-06, 2.2966296848234853e-06, 5.951399057612038e-07, 4.854119647547046e-08
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+
+/** The 256-point Gauss-Legendre rule. */
+template<> class GaussLegendreTable<256>
+{
+public:
+
+    /** The number of nodes \f$N\f$. */
+    static constexpr int num = 256;
+
+    /** The nodes \f$x_i\f$, in increasing order. */
+    static constexpr double xv[num] =
+    {
+        2.1974990503875182e-05, 0.00011578129536841418, 0.0002845312668692788, 0.0005282370782955498,
+        0.0008468667634967728, 0.0012403736216395824, 0.0017086989883092296, 0.002251772759451822,
+        0.002869513538795168, 0.0035618286955889423, 0.004328614396208456, 0.005169755627467392,
+        0.006085126217569695, 0.007074588856937019, 0.008137995119842251, 0.009275185487267796,
+        0.010485989371188978, 0.011770225140382921, 0.0131277001478148, 0.014558210759628485,
+        0.016061542385755266, 0.017637469512146783, 0.01928575573463392, 0.021006153794410936,
+        0.02279840561514188, 0.024662242341685854, 0.026597384380436247, 0.02860354144126878,
+        0.030680412581092602, 0.03282768624899845, 0.035045040332997185, 0.0373321422083419,
+        0.03968864878742674, 0.0421142065712548, 0.04460845170246749, 0.04717101001992766,
+        0.04980149711484822, 0.052499518388457705, 0.05526466911119455, 0.05809653448342085,
+        0.06099468969764674, 0.06395870000225588, 0.06698812076672275, 0.0700824975483118,
+        0.07324136616024851, 0.07646425274135187, 0.07975067382711865, 0.08310013642224758,
+        0.08651213807459374, 0.08998616695054146, 0.09352170191178423, 0.09711821259350069,
+        0.10077515948391466, 0.10449199400522698, 0.10826815859590812, 0.11210308679433713,
+        0.11599620332377719, 0.11994692417867225, 0.12395465671225395, 0.12801879972544422,
+        0.13213874355704108, 0.13631387017517396, 0.14054355327001425, 0.14482715834772833,
+        0.14916404282565746, 0.1535535561287115, 0.157995039786962, 0.16248782753441865,
+        0.1670312454089757, 0.1716246118535134, 0.17626723781813755, 0.18095842686354432,
+        0.18569747526549252, 0.19048367212036937, 0.19531629945183304, 0.20019463231851584,
+        0.20511793892277283, 0.21008548072045855, 0.2150965125317156, 0.2201502826527594,
+        0.22524603296864074, 0.23038299906697043, 0.23556041035258898, 0.2407774901631628,
+        0.24603345588569203, 0.2513275190739093, 0.2566588855665548, 0.2620267556065083,
+        0.26743032396076033, 0.272868780041205, 0.2783413080262363, 0.28384708698312944,
+        0.28938529099118815, 0.29495508926564173, 0.30055564628227044, 0.30618612190274236,
+        0.31184567150064185, 0.317533446088173, 0.32324859244351495, 0.32899025323881426,
+        0.33475756716879157, 0.340549669079947, 0.3463656901003405, 0.3522047577699323,
+        0.35806599617145907, 0.36394852606183165, 0.3698514650040288, 0.37577392749947164,
+        0.3817150251208581, 0.387673866645434, 0.393649558188687, 0.3996412033384367,
+        0.4056479032893056, 0.4116687569775491, 0.41770286121622313, 0.42374931083067185,
+        0.4298071987943122, 0.43587561636469646, 0.44195365321983354, 0.44804039759474534,
+        0.4541349364182404, 0.46023635544988345, 0.46634373941714186, 0.47245617215268304,
+        0.4785727367318104, 0.4846925156100106, 0.4908145907605932, 0.4969380438124052,
+        0.5030619561875947, 0.5091854092394067, 0.5153074843899894, 0.5214272632681896,
+        0.527543827847317, 0.5336562605828582, 0.5397636445501165, 0.5458650635817597,
+        0.5519596024052547, 0.5580463467801664, 0.5641243836353035, 0.5701928012056879,
+        0.5762506891693281, 0.5822971387837769, 0.5883312430224509, 0.5943520967106943,
+        0.6003587966615632, 0.606350441811313, 0.612326133354566, 0.6182849748791419,
+        0.6242260725005283, 0.6301485349959712, 0.6360514739381683, 0.6419340038285408,
+        0.6477952422300678, 0.6536343098996595, 0.659450330920053, 0.6652424328312084,
+        0.6710097467611857, 0.6767514075564849, 0.6824665539118271, 0.6881543284993582,
+        0.6938138780972577, 0.6994443537177296, 0.7050449107343584, 0.7106147090088119,
+        0.7161529130168706, 0.7216586919737636, 0.7271312199587949, 0.7325696760392395,
+        0.7379732443934917, 0.7433411144334451, 0.7486724809260907, 0.7539665441143081,
+        0.7592225098368373, 0.764439589647411, 0.7696170009330295, 0.7747539670313592,
+        0.7798497173472405, 0.7849034874682844, 0.7899145192795414, 0.7948820610772273,
+        0.7998053676814841, 0.804683700548167, 0.8095163278796306, 0.8143025247345076,
+        0.8190415731364558, 0.8237327621818623, 0.8283753881464867, 0.8329687545910244,
+        0.8375121724655813, 0.8420049602130381, 0.8464464438712885, 0.8508359571743427,
+        0.8551728416522717, 0.8594564467299857, 0.8636861298248262, 0.8678612564429589,
+        0.8719812002745557, 0.8760453432877461, 0.8800530758213277, 0.8840037966762229,
+        0.8878969132056628, 0.8917318414040919, 0.8955080059947731, 0.8992248405160854,
+        0.9028817874064993, 0.9064782980882157, 0.9100138330494586, 0.9134878619254062,
+        0.9168998635777524, 0.9202493261728814, 0.9235357472586482, 0.9267586338397515,
+        0.9299175024516881, 0.9330118792332773, 0.9360412999977442, 0.9390053103023531,
+        0.9419034655165792, 0.9447353308888055, 0.9475004816115423, 0.9501985028851518,
+        0.9528289899800724, 0.9553915482975325, 0.9578857934287452, 0.9603113512125733,
+        0.9626678577916582, 0.9649549596670028, 0.9671723137510014, 0.9693195874189073,
+        0.9713964585587311, 0.9734026156195638, 0.9753377576583141, 0.9772015943848582,
+        0.978993846205589, 0.9807142442653661, 0.9823625304878532, 0.9839384576142448,
+        0.9854417892403716, 0.9868722998521852, 0.988229774859617, 0.989514010628811,
+        0.9907248145127322, 0.9918620048801576, 0.992925411143063, 0.9939148737824304,
+        0.9948302443725326, 0.9956713856037915, 0.9964381713044111, 0.9971304864612048,
+        0.9977482272405482, 0.9982913010116907, 0.9987596263783605, 0.9991531332365032,
+        0.9994717629217046, 0.9997154687331308, 0.9998842187046315, 0.9999780250094962
+    };
+
+    /** The complementary nodes \f$1-x_i\f$. */
+    static constexpr double yv[num] =
+    {
+        0.9999780250094962, 0.9998842187046315, 0.9997154687331308, 0.9994717629217046,
+        0.9991531332365032, 0.9987596263783605, 0.9982913010116907, 0.9977482272405482,
+        0.9971304864612048, 0.9964381713044111, 0.9956713856037915, 0.9948302443725326,
+        0.9939148737824304, 0.992925411143063, 0.9918620048801576, 0.9907248145127322,
+        0.989514010628811, 0.988229774859617, 0.9868722998521852, 0.9854417892403716,
+        0.9839384576142448, 0.9823625304878532, 0.9807142442653661, 0.978993846205589,
+        0.9772015943848582, 0.9753377576583141, 0.9734026156195638, 0.9713964585587311,
+        0.9693195874189073, 0.9671723137510014, 0.9649549596670028, 0.9626678577916582,
+        0.9603113512125733, 0.9578857934287452, 0.9553915482975325, 0.9528289899800724,
+        0.9501985028851518, 0.9475004816115423, 0.9447353308888055, 0.9419034655165792,
+        0.9390053103023531, 0.9360412999977442, 0.9330118792332773, 0.9299175024516881,
+        0.9267586338397515, 0.9235357472586482, 0.9202493261728814, 0.9168998635777524,
+        0.9134878619254062, 0.9100138330494586, 0.9064782980882157, 0.9028817874064993,
+        0.8992248405160854, 0.8955080059947731, 0.8917318414040919, 0.8878969132056628,
+        0.8840037966762229, 0.8800530758213277, 0.8760453432877461, 0.8719812002745557,
+        0.8678612564429589, 0.8636861298248262, 0.8594564467299857, 0.8551728416522717,
+        0.8508359571743427, 0.8464464438712885, 0.8420049602130381, 0.8375121724655813,
+        0.8329687545910244, 0.8283753881464867, 0.8237327621818623, 0.8190415731364558,
+        0.8143025247345076, 0.8095163278796306, 0.804683700548167, 0.7998053676814841,
+        0.7948820610772273, 0.7899145192795414, 0.7849034874682844, 0.7798497173472405,
+        0.7747539670313592, 0.7696170009330295, 0.764439589647411, 0.7592225098368373,
+        0.7539665441143081, 0.7486724809260907, 0.7433411144334451, 0.7379732443934917,
+        0.7325696760392395, 0.7271312199587949, 0.7216586919737636, 0.7161529130168706,
+        0.7106147090088119, 0.7050449107343584, 0.6994443537177296, 0.6938138780972577,
+        0.6881543284993582, 0.6824665539118271, 0.6767514075564849, 0.6710097467611857,
+        0.6652424328312084, 0.659450330920053, 0.6536343098996595, 0.6477952422300678,
+        0.6419340038285408, 0.6360514739381683, 0.6301485349959712, 0.6242260725005283,
+        0.6182849748791419, 0.612326133354566, 0.606350441811313, 0.6003587966615632,
+        0.5943520967106943, 0.5883312430224509, 0.5822971387837769, 0.5762506891693281,
+        0.5701928012056879, 0.5641243836353035, 0.5580463467801664, 0.5519596024052547,
+        0.5458650635817597, 0.5397636445501165, 0.5336562605828582, 0.527543827847317,
+        0.5214272632681896, 0.5153074843899894, 0.5091854092394067, 0.5030619561875947,
+        0.4969380438124052, 0.4908145907605932, 0.4846925156100106, 0.4785727367318104,
+        0.47245617215268304, 0.46634373941714186, 0.46023635544988345, 0.4541349364182404,
+        0.44804039759474534, 0.44195365321983354, 0.43587561636469646, 0.4298071987943122,
+        0.42374931083067185, 0.41770286121622313, 0.4116687569775491, 0.4056479032893056,
+        0.3996412033384367, 0.393649558188687, 0.387673866645434, 0.3817150251208581,
+        0.37577392749947164, 0.3698514650040288, 0.36394852606183165, 0.35806599617145907,
+        0.3522047577699323, 0.3463656901003405, 0.340549669079947, 0.33475756716879157,
+        0.32899025323881426, 0.32324859244351495, 0.317533446088173, 0.31184567150064185,
+        0.30618612190274236, 0.30055564628227044, 0.29495508926564173, 0.28938529099118815,
+        0.28384708698312944, 0.2783413080262363, 0.272868780041205, 0.26743032396076033,
+        0.2620267556065083, 0.2566588855665548, 0.2513275190739093, 0.24603345588569203,
+        0.2407774901631628, 0.23556041035258898, 0.23038299906697043, 0.22524603296864074,
+        0.2201502826527594, 0.2150965125317156, 0.21008548072045855, 0.20511793892277283,
+        0.20019463231851584, 0.19531629945183304, 0.19048367212036937, 0.18569747526549252,
+        0.18095842686354432, 0.17626723781813755, 0.1716246118535134, 0.1670312454089757,
+        0.16248782753441865, 0.157995039786962, 0.1535535561287115, 0.14916404282565746,
+        0.14482715834772833, 0.14054355327001425, 0.13631387017517396, 0.13213874355704108,
+        0.12801879972544422, 0.12395465671225395, 0.11994692417867225, 0.11599620332377719,
+        0.11210308679433713, 0.10826815859590812, 0.10449199400522698, 0.10077515948391466,
+        0.09711821259350069, 0.09352170191178423, 0.08998616695054146, 0.08651213807459374,
+        0.08310013642224758, 0.07975067382711865, 0.07646425274135187, 0.07324136616024851,
+        0.0700824975483118, 0.06698812076672275, 0.06395870000225588, 0.06099468969764674,
+        0.05809653448342085, 0.05526466911119455, 0.052499518388457705, 0.04980149711484822,
+        0.04717101001992766, 0.04460845170246749, 0.0421142065712548, 0.03968864878742674,
+        0.0373321422083419, 0.035045040332997185, 0.03282768624899845, 0.030680412581092602,
+        0.02860354144126878, 0.026597384380436247, 0.024662242341685854, 0.02279840561514188,
+        0.021006153794410936, 0.01928575573463392, 0.017637469512146783, 0.016061542385755266,
+        0.014558210759628485, 0.0131277001478148, 0.011770225140382921, 0.010485989371188978,
+        0.009275185487267796, 0.008137995119842251, 0.007074588856937019, 0.006085126217569695,
+        0.005169755627467392, 0.004328614396208456, 0.0035618286955889423, 0.002869513538795168,
+        0.002251772759451822, 0.0017086989883092296, 0.0012403736216395824, 0.0008468667634967728,
+        0.0005282370782955498, 0.0002845312668692788, 0.00011578129536841418, 2.1974990503875182e-05
+    };
+
+    /** The weights \f$w_i\f$. */
+    static constexpr double wv[num] =
+    {
+        5.639450891111265e-05, 0.00013126747214822591, 0.00020623162721308054, 0.00028117447701571304,
+        0.0003560770817366548, 0.00043092685071005236, 0.00050571219660422, 0.0005804217787838628,
+        0.0006550443409512523, 0.0007295686666553671, 0.0008039835653746633, 0.0008782778681653655,
+        0.0009524404267498598, 0.0010264601139830713, 0.0011003258249199545, 0.0011740264781636561,
+        0.0012475510173518532, 0.0013208884127137454, 0.0013940276626638526, 0.0014669577954148593,
+        0.0015396678705996685, 0.001612146980897099, 0.0016843842536577755, 0.0017563688525281543,
+        0.0018280899790712516, 0.001899536874383129, 0.0019706988207044158, 0.002041565143026333,
+        0.00211212521069077, 0.0021823684389840276, 0.00225228429072395, 0.002321862277840028,
+        0.0023910919629463448, 0.002459962960906932, 0.0025284649403934214, 0.0025965876254346407,
+        0.002664320796957967, 0.002731654294322155, 0.002798578016841456, 0.002865081925300716,
+        0.0029311560434613273, 0.0029967904595576684, 0.003061975327783968, 0.003126700869771201,
+        0.0031909573760539383, 0.003254735207526831, 0.0033180247968905316, 0.0033808166500869,
+        0.0034431013477231602, 0.003504869546484912, 0.003566111980537697, 0.0036268194629169585,
+        0.0036869828869061745, 0.003746593227402941, 0.0038056415422728284, 0.0038641189736907788,
+        0.003922016749469857, 0.003979326184377172, 0.004036038681436751, 0.004092145733219135,
+        0.004147638923117613, 0.004202509926610767, 0.0042567505125112445, 0.004310352544200508,
+        0.004363307980849404, 0.004415608878624374, 0.004467247391879104, 0.004518215774331437,
+        0.0045685063802254015, 0.004618111665478152, 0.004667024188811634, 0.0047152366128688766,
+        0.004762741705314644, 0.004809532339920367, 0.004855601497633137, 0.004900942267628663,
+        0.004945547848347913, 0.004989411548517454, 0.005032526788153188, 0.005074887099547433,
+        0.005116486128239108, 0.005157317633967005, 0.005197375491605864, 0.005236653692085203,
+        0.005275146343290738, 0.005312847670948278, 0.00534975201948989, 0.005385853852902312,
+        0.005421147755557397, 0.0054556284330245204, 0.005489290712864788, 0.005522129545406952,
+        0.005554140004504926, 0.005585317288276724, 0.005615656719824835, 0.005645153747937754,
+        0.005673803947772744, 0.005701603021519594, 0.0057285467990453205, 0.00575463123851975,
+        0.005779852427021819, 0.005804206581126557, 0.005827690047472619, 0.005850299303310374,
+        0.005872030957030272, 0.005892881748671713, 0.005912848550411991, 0.00593192836703554,
+        0.005950118336383247, 0.005967415729781783, 0.005983817952452947, 0.005999322543902903,
+        0.006013927178291283, 0.0060276296647800735, 0.006040427947862272, 0.006052320107670232,
+        0.006063304360263662, 0.006073379057897231, 0.00608254268926775, 0.006090793879740888,
+        0.006098131391557357, 0.006104554124018617, 0.006110061113651986, 0.006114651534355141,
+        0.006118324697520083, 0.0061210800521364055, 0.00612291718487396, 0.0061238358201448784,
+        0.0061238358201448784, 0.00612291718487396, 0.0061210800521364055, 0.006118324697520083,
+        0.006114651534355141, 0.006110061113651986, 0.006104554124018617, 0.006098131391557357,
+        0.006090793879740888, 0.00608254268926775, 0.006073379057897231, 0.006063304360263662,
+        0.006052320107670232, 0.006040427947862272, 0.0060276296647800735, 0.006013927178291283,
+        0.005999322543902903, 0.005983817952452947, 0.005967415729781783, 0.005950118336383247,
+        0.00593192836703554, 0.005912848550411991, 0.005892881748671713, 0.005872030957030272,
+        0.005850299303310374, 0.005827690047472619, 0.005804206581126557, 0.005779852427021819,
+        0.00575463123851975, 0.0057285467990453205, 0.005701603021519594, 0.005673803947772744,
+        0.005645153747937754, 0.005615656719824835, 0.005585317288276724, 0.005554140004504926,
+        0.005522129545406952, 0.005489290712864788, 0.0054556284330245204, 0.005421147755557397,
+        0.005385853852902312, 0.00534975201948989, 0.005312847670948278, 0.005275146343290738,
+        0.005236653692085203, 0.005197375491605864, 0.005157317633967005, 0.005116486128239108,
+        0.005074887099547433, 0.005032526788153188, 0.004989411548517454, 0.004945547848347913,
+        0.004900942267628663, 0.004855601497633137, 0.004809532339920367, 0.004762741705314644,
+        0.0047152366128688766, 0.004667024188811634, 0.004618111665478152, 0.0045685063802254015,
+        0.004518215774331437, 0.004467247391879104, 0.004415608878624374, 0.004363307980849404,
+        0.004310352544200508, 0.0042567505125112445, 0.004202509926610767, 0.004147638923117613,
+        0.004092145733219135, 0.004036038681436751, 0.003979326184377172, 0.003922016749469857,
+        0.0038641189736907788, 0.0038056415422728284, 0.003746593227402941, 0.0036869828869061745,
+        0.0036268194629169585, 0.003566111980537697, 0.003504869546484912, 0.0034431013477231602,
+        0.0033808166500869, 0.0033180247968905316, 0.003254735207526831, 0.0031909573760539383,
+        0.003126700869771201, 0.003061975327783968, 0.0029967904595576684, 0.0029311560434613273,
+        0.002865081925300716, 0.002798578016841456, 0.002731654294322155, 0.002664320796957967,
+        0.0025965876254346407, 0.0025284649403934214, 0.002459962960906932, 0.0023910919629463448,
+        0.002321862277840028, 0.00225228429072395, 0.0021823684389840276, 0.00211212521069077,
+        0.002041565143026333, 0.0019706988207044158, 0.001899536874383129, 0.0018280899790712516,
+        0.0017563688525281543, 0.0016843842536577755, 0.001612146980897099, 0.0015396678705996685,
+        0.0014669577954148593, 0.0013940276626638526, 0.0013208884127137454, 0.0012475510173518532,
+        0.0011740264781636561, 0.0011003258249199545, 0.0010264601139830713, 0.0009524404267498598,
+        0.0008782778681653655, 0.0008039835653746633, 0.0007295686666553671, 0.0006550443409512523,
+        0.0005804217787838628, 0.00050571219660422, 0.00043092685071005236, 0.0003560770817366548,
+        0.00028117447701571304, 0.00020623162721308054, 0.00013126747214822591, 5.639450891111265e-05
+    };
+
+    /** The values \f$\sin\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double sv[num] =
+    {
+        3.4518234357985076e-05, 0.00018186883247366947, 0.00044694065397671794, 0.0008297527670507891,
+        0.001330254809053525, 0.0019483730960007041, 0.002684014871845362, 0.0035370690039880416,
+        0.00450740606367826, 0.005594878242194999, 0.0067993192029909355, 0.008120543898251165,
+        0.009558348359650002, 0.011112509467335968, 0.012782784699171752, 0.014568911861499332,
+        0.01647060880240404, 0.01848757310834007, 0.0206194817849487, 0.0228659909229054,
+        0.025226735349653914, 0.02770132826791556, 0.030289360881895728, 0.032990402012145224,
+        0.03580399770006897, 0.038729670803110544, 0.04176692058167448, 0.0449152222788818,
+        0.04817402669428565, 0.05154275975270478, 0.0550208220693603, 0.05860758851252884,
+        0.06230240776495065, 0.06610460188525347, 0.07001346587067564, 0.07402826722239075,
+        0.07814824551475358, 0.08237261196980225, 0.08670054903836533, 0.0911312099891323,
+        0.09566371850705553, 0.10029716830245734, 0.10503062273221991, 0.10986311443443753,
+        0.11479364497790845, 0.11982118452784093, 0.12494467152914247, 0.1301630124086498,
+        0.13547508129764918, 0.1408797197760201, 0.1463757366393187, 0.15196190769009896,
+        0.1576369755547474, 0.16339964952707964, 0.16924860543992404, 0.1751824855658809,
+        0.1811998985484204, 0.18729941936443875, 0.19347958931935946, 0.19973891607582175,
+        0.2060758737169566, 0.21248890284520344, 0.2189764107175712, 0.22553677141819772,
+        0.2321683260690048, 0.2388693830791934, 0.24563821843426298, 0.2524730760251767,
+        0.25937216801823554, 0.2663336752661564, 0.2733557477607819, 0.2804365051277843,
+        0.28757403716365115, 0.2947664044151734, 0.3020116388015777, 0.3093077442793743,
+        0.31665269754991365, 0.32404444880956884, 0.33148092254238115, 0.3389600183549304,
+        0.3464796118531087, 0.3540375555603991, 0.36163167987717987, 0.3692597940804926,
+        0.37691968736363757, 0.3846091299148718, 0.39232587403441305, 0.4000676552888716,
+        0.40783219370214857, 0.41561719498177113, 0.4234203517795508, 0.4312393449853811,
+        0.43907184505291214, 0.44691551335577673, 0.4547680035729601, 0.4626269631018501,
+        0.47049003449742804, 0.47835485693600754, 0.4862190677018544, 0.49408030369497696,
+        0.5019362029583071, 0.5097844062224524, 0.5176225584661373, 0.5254483104904178,
+        0.5332593205046989, 0.5410532557225571, 0.5488277939653228, 0.5565806252713538,
+        0.5643094535089013, 0.5720119979904378, 0.5796859950863116, 0.5873291998355572,
+        0.5949393875516957, 0.6025143554213415, 0.6100519240934272, 0.6175499392568695,
+        0.6250062732044882, 0.6324188263810108, 0.6397855289130072, 0.6471043421186093,
+        0.6543732599948983, 0.6615903106808677, 0.6687535578939001, 0.6758611023377203,
+        0.6829110830798449, 0.6899016788965701, 0.6968311095835956, 0.703697637230435,
+        0.7104995674568022, 0.7172352506092368, 0.7239030829162796, 0.7305015076005751,
+        0.7370290159463477, 0.7434841483207628, 0.7498654951477584, 0.756171697833005,
+        0.7624014496387331, 0.7685534965072395, 0.7746266378319718, 0.7806197271751699,
+        0.7865316729311265, 0.7923614389342197, 0.798108045010953, 0.8037705674753294,
+        0.8093481395669753, 0.8148399518315194, 0.8202452524428211, 0.8255633474667375,
+        0.8307936010662027, 0.835935435647489, 0.8409883319476086, 0.8459518290629005,
+        0.8508255244189408, 0.8556090736820001, 0.8603021906123578, 0.8649046468598703,
+        0.8694162717022722, 0.8738369517267733, 0.8781666304555941, 0.8824053079161576,
+        0.8865530401567406, 0.8906099387084473, 0.894576169994452, 0.8984519546875233,
+        0.9022375670169024, 0.9059333340256783, 0.9095396347798618, 0.9130568995304141,
+        0.9164856088295464, 0.9198262926026488, 0.9230795291772672, 0.9262459442705796,
+        0.9293262099368726, 0.9323210434765531, 0.9352312063082675, 0.9380575028057284,
+        0.9408007791008812, 0.9434619218550645, 0.9460418569998383, 0.9485415484491773,
+        0.9509619967847323, 0.9533042379158845, 0.9555693417163144, 0.9577584106388203,
+        0.9598725783101183, 0.9619130081073567, 0.9638808917180699, 0.9657774476852937,
+        0.9676039199395511, 0.9693615763194048, 0.9710517070822571, 0.9726756234070618,
+        0.9742346558905897, 0.9757301530388663, 0.9771634797553794, 0.9785360158276204,
+        0.9798491544135025, 0.9811043005291599, 0.982302869539606, 0.9834462856536915,
+        0.9845359804247684, 0.9855733912584292, 0.9865599599286541, 0.9874971311036564,
+        0.9883863508826828, 0.989229065344977, 0.9900267191120804, 0.9907807539245983,
+        0.9914926072345198, 0.9921637108141351, 0.9927954893825541, 0.9933893592507854,
+        0.9939467269862936, 0.9944689880979105, 0.9949575257419326, 0.9954137094501978,
+        0.9958388938808911, 0.9962344175927903, 0.9966016018436216, 0.9969417494131569,
+        0.9972561434516461, 0.9975460463541398, 0.9978126986612228, 0.9980573179866424,
+        0.9982810979722826, 0.9984852072708998, 0.9986707885570074, 0.9988389575662626,
+        0.9989908021636829, 0.9991273814409872, 0.999249724843336, 0.9993588313257122,
+        0.9994556685391689, 0.999541172047138, 0.9996162445719823, 0.9996817552719458,
+        0.9997385390486423, 0.9997873958852053, 0.9998290902152046, 0.9998643503224216,
+        0.999893867771561, 0.9999182968699666, 0.9999382541603948, 0.9999543179448928,
+        0.9999670278398166, 0.9999768843620216, 0.9999843485462435, 0.999989841593692,
+        0.9999937445518652, 0.9999963980255967, 0.999998101919338, 0.9999991152106801,
+        0.9999996557551135, 0.9999999001220209, 0.9999999834618637, 0.9999999994042458
+    };
+
+    /** The values \f$\csc\theta_i\f$, with \f$\theta_i = \tfrac{\pi}{2}\,x_i\f$. */
+    static constexpr double cscv[num] =
+    {
+        28970.19556762673, 5498.468244385841, 2237.433518527254, 1205.17826479124,
+        751.7356774011582, 513.2487212293341, 372.5761770136773, 282.7199579291501,
+        221.85709161156691, 178.73489944039912, 147.07354812230503, 123.1444608304327,
+        104.62058531173025, 89.98867473988598, 78.2302153665151, 68.63930604471972,
+        60.7142098993961, 54.09038785890628, 48.49782406898098, 43.73307080246745,
+        39.64048403963294, 36.09935199960168, 33.01489271758489, 30.31184644648634,
+        27.929842035434877, 25.819997414480625, 23.942392354363726, 22.264166784947186,
+        20.7580737717036, 19.40136703579446, 18.174937458029632, 17.062636859495164,
+        16.05074403821947, 15.12753986077751, 14.282966677397967, 13.508353464439024,
+        12.796192587730078, 12.139957397084839, 11.533952334690477, 10.973189098655151,
+        10.453283811315012, 9.970371217105432, 9.521032761555103, 9.102236042987522,
+        8.7112836271768, 8.345769606105387, 8.003542590183663, 7.682674067656615,
+        7.381431259693604, 7.098253755685106, 6.8317333388666635, 6.580596513958838,
+        6.343689331014217, 6.119964166962754, 5.908468181470227, 5.7083332090520535,
+        5.518766886797009, 5.339044848047528, 5.168503838145891, 5.0065356298438894,
+        4.852581633954352, 4.7061281159162105, 4.566701941652373, 4.433866786829927,
+        4.30721975271847, 4.1863883395573795, 4.071027734910955, 3.960818380096417,
+        3.855463782566268, 3.7546885462405966, 3.658236595321626, 3.5658695701700385,
+        3.477365376454082, 3.3925168710594216, 3.311130670222289, 3.2330260670640554,
+        3.1580340471988904, 3.0859963923889646, 3.01676486335996, 2.9502004538862288,
+        2.8861727091288523, 2.8245591019775276, 2.765244461822669, 2.7081204507794756,
+        2.653085082911147, 2.6000422824630736, 2.548901477531111, 2.4995772259518034,
+        2.4519888705263138, 2.4060602209777673, 2.36171926029819, 2.318897873369833,
+        2.2775315959498403, 2.2375593822896196, 2.198923389823678, 2.161568779508954,
+        2.125443530527035, 2.0904982681795494, 2.0566861039131275, 2.0239624865057464,
+        1.992285063532395, 1.9616135523055493, 1.9319096195561574, 1.9031367691841425,
+        1.8752602374648757, 1.848246895149972, 1.8220651559479588, 1.796684890913087,
+        1.7720773483094348, 1.7482150785528048, 1.7250718638650333, 1.7026226523046768,
+        1.680843495864707, 1.6597114923522358, 1.639204730787561, 1.619302240080135,
+        1.5999839407576988, 1.5812305995418519, 1.5630237865789112, 1.545345835149268,
+        1.528179803691545, 1.5115094399899267, 1.4953191473841148, 1.4795939528715636,
+        1.46431947698099, 1.449481905304828, 1.4350679615862278, 1.4210648822635408,
+        1.407460392382011, 1.3942426827886334, 1.3814003885319155, 1.3689225683936326,
+        1.3567986854845826, 1.3450185888409394, 1.3335724959620305, 1.3224509762342926,
+        1.3116449351897925, 1.3011455995510917, 1.2909445030173556, 1.2810334727495318,
+        1.271404616515127, 1.2620503104556278, 1.2529631874419662, 1.2441361259855954,
+        1.2355622396747943, 1.227234867107701, 1.219147562295351, 1.2112940855096412,
+        1.203668394552685, 1.1962646364254577, 1.1890771393749817, 1.1821004053005544,
+        1.1753291025006987, 1.1687580587436184, 1.162382254644971, 1.1561968173377353,
+        1.1501970144198608, 1.1443782481662261, 1.1387360499922419, 1.1332660751571724,
+        1.1279640976959509, 1.1228260055689352, 1.1178477960196522, 1.1130255711311738,
+        1.108355533572308, 1.1038339825253138, 1.0994573097873108, 1.0952219960380354,
+        1.091124607267004, 1.0871617913535605, 1.083330274793648, 1.0796268595675222,
+        1.076048420142942, 1.0725919006086972, 1.0692543119336242, 1.0660327293465504,
+        1.0629242898328541, 1.0599261897435865, 1.0570356825133276, 1.05425007648316,
+        1.0515667328253586, 1.0489830635665713, 1.0464965297064501, 1.0441046394288565,
+        1.0418049464029144, 1.0395950481713336, 1.037472584623552, 1.0354352365513695,
+        1.0334807242848632, 1.0316068064064672, 1.0298112785412061, 1.0280919722211472,
+        1.0264467538222166, 1.0248735235716004, 1.0233702146240027, 1.021934792205094,
+        1.0205652528205313, 1.019259623528965, 1.0180159612774913, 1.0168323522980265,
+        1.0157069115631099, 1.0146377822996522, 1.0136231355591583, 1.0126611698429644,
+        1.0117501107810176, 1.0108882108627357, 1.01007374921847, 1.0093050314500793,
+        1.008580389509115, 1.0078981816210901, 1.0072567922542905, 1.0066546321315544,
+        1.0060901382834273, 1.0055617741410605, 1.0050680296672034, 1.0046074215235947,
+        1.004178493273036, 1.0037798156143898, 1.0034099866487187, 1.0030676321747416,
+        1.0027514060117564, 1.002459990348144, 1.002192096113541, 1.0019464633727415,
+        1.0017218617393526, 1.0015170908072244, 1.0013309805976334, 1.0011623920201975,
+        1.0010102173454765, 1.0008733806872094, 1.0007508384921313, 1.0006415800353083,
+        1.0005446279189418, 1.0004590385725904, 1.000383902752783, 1.0003183460400031,
+        1.0002615293310655, 1.0002126493249162, 1.0001709389999431, 1.00013566808091,
+        1.0001061434936847, 1.0000817098059802, 1.0000617496523894, 1.0000456841420526,
+        1.0000329732473825, 1.0000231161723234, 1.0000156516987284, 1.0000101585095023,
+        1.0000062554872657, 1.0000036019873775, 1.0000018980842647, 1.0000008847901027,
+        1.000000344245005, 1.000000099877989, 1.0000000165381366, 1.0000000005957543
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\sin\theta\f$. */
+    static constexpr double wsinv[num] =
+    {
+        8.858428739620334e-05, 0.00020619445966801251, 0.0003239478501399815, 0.0004416676836428642,
+        0.0005593240771633758, 0.0006768970294050426, 0.0007943679995377797, 0.0009117186948607662,
+        0.0010289307922507806, 0.0011459858451017065, 0.001262865238683507, 0.001379550160970674,
+        0.0014960215793672978, 0.0016122602201379247, 0.0017282465493715937, 0.0018439607550226646,
+        0.0019593827298508004, 0.002074492055199387, 0.002189267985603655, 0.00230368943424408,
+        0.002417734959272018, 0.0025313827510401736, 0.0026446106202726092, 0.0027573959872099793,
+        0.002869715871765349, 0.0029815468847253315, 0.0030928652200302143, 0.0032036466481655075,
+        0.0033138665106959256, 0.003423499715971262, 0.003532520736032066, 0.0036409036047410728,
+        0.0037486219171649, 0.003855648830228184, 0.003961957064660838, 0.004067518908256706,
+        0.004172306220460068, 0.00427629043829412, 0.004379442583643526, 0.0044817332719006365,
+        0.00458313272198296, 0.004683610767726704, 0.004783136870659271, 0.0048816801341505746,
+        0.004979209318941047, 0.005075692860041267, 0.005171098884995716, 0.005265395233500656,
+        0.005358549478363122, 0.00545052894778579, 0.005541300748959383, 0.0056308317929418565,
+        0.005719088820800706, 0.005806038430992088, 0.0058916471079477105, 0.00597588125183768,
+        0.0060587072094748385, 0.0061400913063234305, 0.006219999879572198, 0.006298399312229369,
+        0.006375256068194573, 0.0064505367282598385, 0.006524208026989605, 0.006596236890427047,
+        0.0066665904745716684, 0.0067352362045708224, 0.006802141814565473, 0.006867275388128427,
+        0.0069306053992311545, 0.006992100753673318, 0.007051730830907199, 0.007109465526187601,
+        0.007165275292975909, 0.007219131185525624, 0.007271004901575221, 0.007320868825072923,
+        0.007368696068856673, 0.007414460517211951, 0.007458136868228828, 0.007499700675879239,
+        0.00753912839173472, 0.007576397406244745, 0.007611486089495194, 0.00764437383136687,
+        0.007675041081013774, 0.007703469385581423, 0.00772964142808566, 0.007753541064373471,
+        0.0077751533590877855, 0.0077944646205594945, 0.0078114624345510305, 0.007826135696777228,
+        0.00783847464413082, 0.007848470884541483, 0.007856117425399592, 0.007861408700477383,
+        0.007864340595283199, 0.007864910470786165, 0.00786311718545178, 0.007858961115531396,
+        0.007852444173551461, 0.007843569824951479, 0.007832343102822818, 0.007818770620703842,
+        0.007802860583390028, 0.0077846227957218544, 0.007764068669316078, 0.007741211227210661,
+        0.007716065106396801, 0.007688646558215784, 0.007658973446602353, 0.007627065244160311,
+        0.0075929430260602525, 0.007556629461753466, 0.007518148804500365, 0.007477526878715862,
+        0.007434791065138558, 0.007389970283834706, 0.007343094975052225, 0.0072941970779443,
+        0.007243310007186152, 0.007190468627512922, 0.007135709226210468, 0.0070790694835950844,
+        0.007020588441522071, 0.006960306469966827, 0.006898265231726113, 0.006834507645290618,
+        0.0067690778459436034, 0.00670202114514384, 0.006633383988254298, 0.006563213910681193,
+        0.0064915594924911035, 0.006418470311576533, 0.006343996895443132, 0.006268190671694285,
+        0.00619110391729091, 0.006112789706666802, 0.006033301858781487, 0.005952694883194445,
+        0.005871023925246235, 0.005788344710433222, 0.0057047134880639176, 0.005620186974285868,
+        0.00553482229457274, 0.005448676925761882, 0.005361808637732891, 0.00527427543481794,
+        0.005186135497034477, 0.005097447121230698, 0.005008268662233633, 0.004918658474089167,
+        0.004828674851482265, 0.00473837597142472, 0.004647819835296601, 0.00455706421132581,
+        0.004466166577589049, 0.0043751840656152665, 0.004284173404671024, 0.004193190866805034,
+        0.004102292212726852, 0.004011532638592401, 0.003920966723766493, 0.0038306483796298006,
+        0.003740630799495069, 0.0036509664096945503, 0.003561706821897498, 0.003472902786713762,
+        0.0033846041486362225, 0.003296859802371759, 0.003209717650607053, 0.003123224563252399,
+        0.0030374263382032243, 0.0029523676636557202, 0.0028680920820096096, 0.0027846419553876484,
+        0.0027020584327980502, 0.0026203814189626868, 0.0025396495448305185, 0.0024599001397922725,
+        0.002381169205609264, 0.0023034913920657474, 0.002226899974351183, 0.0021514268321754224,
+        0.002077102430616959, 0.0020039558027010913, 0.0019320145337021258, 0.0018613047471607938,
+        0.0017918510926052153, 0.001723676734961194, 0.00165680334563502, 0.0015912510952493953,
+        0.0015270386480108974, 0.0014641831576850364, 0.0014027002651529194, 0.0013426040975215,
+        0.0012839072687575105, 0.0012266208818134988, 0.0011707545322126823, 0.0011163163130579086,
+        0.0010633128214286407, 0.0010117491661286611, 0.0009616289767460978, 0.0009129544139863991,
+        0.0008657261812380797, 0.0008199435373303325, 0.0007756043104410578, 0.0007327049131133679,
+        0.0006912403583383268, 0.0006512042766614964, 0.0006125889342707325, 0.0005753852520227304,
+        0.0005395828253659524, 0.0005051699451178092, 0.0004721336190543354, 0.00044045959427102955,
+        0.0004101323802740604, 0.0003811352727617694, 0.0003534503780569376, 0.0003270586381513049,
+        0.0003019398563245398, 0.0002780727233008726, 0.0002554348439076272, 0.00023400276420092796,
+        0.00021375199902500018, 0.00019465705997266078, 0.00017669148371579537, 0.00015982786067590346,
+        0.00014403786400605154, 0.00012929227885689312, 0.0001155610319007661, 0.00010281322108920263,
+        9.101714562056957e-05, 8.014033609588372e-05, 7.014958484225992e-05, 6.101097638474906e-05,
+        5.26899180487181e-05, 4.5151170676199704e-05, 3.835887944099964e-05, 3.2276604748587064e-05,
+        2.686735320805725e-05, 2.2093608664685615e-05, 1.7917363282731508e-05, 1.4300148669325874e-05,
+        1.1203067031322512e-05, 8.586822358047687e-06, 6.411751623856963e-06, 4.637856005322092e-06,
+        3.2248321087184347e-06, 2.132103204258674e-06, 1.3188504641401902e-06, 7.440442017884018e-07,
+        3.664751087767313e-07, 1.4478547845680656e-07, 3.750034626260522e-08, 3.0577731946047435e-09
+    };
+
+    /** The mapped weights \f$\tfrac{\pi}{2}\,w_i\cos\theta_i\csc^2\theta_i\f$ that correspond to the substitution \f$u = r_{\text{b}}\csc\theta\f$. */
+    static constexpr double wcscv[num] =
+    {
+        74346.3325346246, 6233.908654013084, 1621.7181670741354, 641.502280828781,
+        316.07768765169703, 178.31109219234853, 110.2686112190962, 72.87419916423178,
+        50.64455915739256, 36.609852067846916, 27.316568895868706, 20.92026875168502,
+        16.37465463521952, 13.056021321962511, 10.576811152309915, 8.687552495456417,
+        7.222706565409383, 6.069486742169231, 5.149243550978147, 4.405993751784949,
+        3.799151286787486, 3.298804883712367, 2.882580991013015, 2.5335175887125096,
+        2.238596696838467, 1.9877146192675088, 1.7729483420336019, 1.5880256108257116,
+        1.427937214697557, 1.2886499453109128, 1.1668917517379083, 1.0599892885004714,
+        0.9657439101787341, 0.8823361718399281, 0.8082516702766699, 0.7422230074757413,
+        0.6831840379821683, 0.6302335508977608, 0.5826062530458286, 0.539649442689995,
+        0.500804148484769, 0.4655897946175943, 0.4335916674954531, 0.4044506210855538,
+        0.37785458092845364, 0.3535315008625698, 0.3312434988831134, 0.31078195462607494,
+        0.2919633946504283, 0.2746260259148839, 0.25862680480054206, 0.24383895036963948,
+        0.23014982752594115, 0.21745913930979097, 0.2056773784532978, 0.1947244971038384,
+        0.1845287607350017, 0.1750257580445637, 0.16615754335601726, 0.15787189190358106,
+        0.15012165155620288, 0.1428641771553062, 0.13606083580858822, 0.12967657328168608,
+        0.1236795331281555, 0.1180407214499815, 0.11273371122948583, 0.10773438105443937,
+        0.10302068380025765, 0.09857244145991588, 0.09437116284292577, 0.09039988131521466,
+        0.08664301013508072, 0.0830862132673427, 0.07971628983729266, 0.07652107062550409,
+        0.07348932521012827, 0.07061067854019303, 0.06787553587590121, 0.06527501516365183,
+        0.06280088602751076, 0.060445514657714534, 0.05820181396266286, 0.05606319842559248,
+        0.05402354317226975, 0.052077146812933864, 0.050218697671479726, 0.04844324305846758,
+        0.046746161282799424, 0.04512313613051864, 0.04357013356878027, 0.04208338045911758,
+        0.04065934508715368, 0.039294719336253066, 0.037986402350624136, 0.036731485549342836,
+        0.035527238866941785, 0.03437109810879411, 0.03326065332072845, 0.032193638082287736,
+        0.031167919641947088, 0.030181489820553166, 0.02923245661635439, 0.028319036451349592,
+        0.027439547004381643, 0.026592400581514075, 0.025776097978816838, 0.024989222796814443,
+        0.02423043616955979, 0.02349847187464179, 0.022792131793447752, 0.02211028169372291,
+        0.021451847308925555, 0.020815810691098228, 0.020201206815986538, 0.019607120420956827,
+        0.01903268305791638, 0.018477070344936977, 0.01793949940164294, 0.017419226454662085,
+        0.01691554460056182, 0.016427781714717146, 0.015955298495489805, 0.015497486633949075,
+        0.015053767100140057, 0.014623588537614727, 0.014206425758588706, 0.013801778332678656,
+        0.013409169262717966, 0.01302814374164442, 0.012658267984908735, 0.012299128133270183,
+        0.011950329221228457, 0.011611494206692347, 0.01128226305780935, 0.010962291893177205,
+        0.010651252171931533, 0.010348829930455983, 0.010054725062692501, 0.009768650641243371,
+        0.009490332276653857, 0.009219507512445846, 0.008955925253641127, 0.008699345226667987,
+        0.008449537468688244, 0.008206281844514638, 0.00796936758941118, 0.007738592876182849,
+        0.007513764405066412, 0.00729469701503179, 0.007081213315193926, 0.006873143335119483,
+        0.006670324192890426, 0.006472599779859333, 0.006279820461098888, 0.006091842790610242,
+        0.005908529240414108, 0.005729747942702136, 0.005555372444277348, 0.005385281472559498,
+        0.005219358712475324, 0.005057492593595053, 0.00489957608691494, 0.004745506510721572,
+        0.004595185345007583, 0.004448518053939995, 0.004305413915911781, 0.0041657858607354,
+        0.0040295503135628855, 0.0038966270451418336, 0.003766939028039485, 0.0036404122984891713,
+        0.0035169758235336535, 0.003396561373159424, 0.0032791033971343126, 0.003164538906278105,
+        0.0030528073579122444, 0.0029438505452503913, 0.002837612490506377, 0.0027340393415100786,
+        0.0026330792716353995, 0.002534682382857045, 0.002438800611765283, 0.0023453876383792913,
+        0.00225439879761117, 0.0021657909932430736, 0.0020795226142904916, 0.0019955534536344206,
+        0.0019138446288145992, 0.0018343585048852203, 0.0017570586192432462, 0.0016819096083477874,
+        0.0016088771362572838, 0.0015379278249189068, 0.0014690291861521917, 0.0014021495552760973,
+        0.0013372580263356201, 0.0012743243888908371, 0.001213319066337532, 0.001154213055734746,
+        0.0010969778691204152, 0.001041585476301816, 0.0009880082491128214, 0.0009362189071349513,
+        0.0008861904648839286, 0.000837896180467835, 0.0007913095057271025, 0.0007464040378703154,
+        0.0007031534726233077, 0.0006615315589122117, 0.0006215120551038789, 0.0005830686868296103,
+        0.0005461751064202453, 0.0005108048539824282, 0.0004769313201472957, 0.0004445277105238485,
+        0.0004135670118899266, 0.00038402196015408744, 0.0003558650101214125, 0.00032906830709601286,
+        0.00030360366035198094, 0.0002794425185033645, 0.00025655594680213165, 0.00023491460639107624,
+        0.00021448873553626732, 0.00019524813286093474, 0.00017716214259959662, 0.0001601996418878597,
+        0.00014432903009957006, 0.00012951822023896285, 0.00011573463239115634, 0.00010294518922972194,
+        9.111631357525089e-05, 8.02139279937445e-05, 7.020345641845363e-05, 6.104982777331534e-05,
+        5.271748157062391e-05, 4.5170375449850635e-05, 3.83719946188327e-05, 3.228536315271376e-05,
+        2.6873057100227824e-05, 2.209721934114822e-05, 1.7919576132959647e-05, 1.4301455279217237e-05,
+        1.1203805846504214e-05, 8.587219351566798e-06, 6.411952335037161e-06, 4.637950233209298e-06,
+        3.2248724546370065e-06, 2.1321185639039955e-06, 1.3188554707235686e-06, 7.440455184348759e-07,
+        3.66475361091226e-07, 1.4478550737857287e-07, 3.7500347502976925e-08, 3.057773198248106e-09
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
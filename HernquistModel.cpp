@@ -9,10 +9,25 @@
 //////////////////////////////////////////////////////////////////////
 
 HernquistModel::HernquistModel(double Mtot, double b, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, b);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void HernquistModel::set_parameters(double Mtot, double b)
 {
     _Mtot = Mtot;
     _b = b;
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> HernquistModel::parameters() const
+{
+    return {_Mtot, _b};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -24,6 +39,28 @@ double HernquistModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool HernquistModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = 10.0;
+    p = 4.0;
+    alpha = 1.0;
+    av = binomial_series(_Mtot/pow(_b,3)*0.5/M_PI, 3.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool HernquistModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = 0.1;
+    p = 1.0;
+    alpha = 1.0;
+    av = binomial_series(_Mtot/pow(_b,3)*0.5/M_PI, 3.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double HernquistModel::density(double r) const
 {
     double dimf = _Mtot/pow(_b,3);
@@ -34,6 +71,13 @@ double HernquistModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void HernquistModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = HernquistModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double HernquistModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_b,4);
@@ -20,11 +20,26 @@ public:
     /** Constructor of the HernquistModel class. */
     HernquistModel(double Mtot, double b, const GaussLegendre* gl);
 
+    /** This function changes the parameters of the HernquistModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double b);
+
+    /** This function returns the parameters of the HernquistModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
+
     /** This function returns the scale radius \f$b\f$ of the Hernquist model. */
     double scale_radius() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the Hernquist model, which follows from the binomial series of \f$\rho(r) \propto x^{-4}\,(1+x^{-1})^{-3}\f$ in powers of \f$x^{-1}\f$. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the Hernquist model, which follows from the binomial series of \f$\rho(r) \propto x^{-1}\,(1+x)^{-3}\f$ in powers of \f$x^{1}\f$. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
     
     /** This function returns the density \f$\rho(r)\f$ of the Hernquist model at radius \f$r\f$. */
     double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the Hernquist model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
     
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the Hernquist model at radius \f$r\f$. */
     double derivative_density(double r) const;
@@ -9,11 +9,26 @@
 //////////////////////////////////////////////////////////////////////
 
 HypervirialModel::HypervirialModel(double Mtot, double rs, double p, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, rs, p);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void HypervirialModel::set_parameters(double Mtot, double rs, double p)
 {
     _Mtot = Mtot;
     _rs = rs;
     _p = p;
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> HypervirialModel::parameters() const
+{
+    return {_Mtot, _rs, _p};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -25,6 +40,28 @@ double HypervirialModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool HypervirialModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = pow(10.0,1.0/_p);
+    p = _p+3.0;
+    alpha = _p;
+    av = binomial_series(_Mtot/pow(_rs,3)*(_p+1.0)/(4.0*M_PI), 2.0+1.0/_p);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool HypervirialModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = pow(10.0,-1.0/_p);
+    p = 2.0-_p;
+    alpha = _p;
+    av = binomial_series(_Mtot/pow(_rs,3)*(_p+1.0)/(4.0*M_PI), 2.0+1.0/_p);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double HypervirialModel::density(double r) const
 {
     double dimf = _Mtot/pow(_rs,3);
@@ -38,6 +75,13 @@ double HypervirialModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void HypervirialModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = HypervirialModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double HypervirialModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_rs,4);
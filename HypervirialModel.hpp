@@ -18,12 +18,27 @@ class HypervirialModel : public DensityModel
 public:
     /** Constructor of the HypervirialModel class. */
     HypervirialModel(double Mtot, double rs, double p, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the HypervirialModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double rs, double p);
+
+    /** This function returns the parameters of the HypervirialModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the scale radius \f$r_{\text{s}}\f$ of the hypervirial model. */
     double scale_radius() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the hypervirial model, which follows from the binomial series of \f$\rho(r) \propto x^{-p-3}\,(1+x^{-p})^{-2-1/p}\f$ in powers of \f$x^{-p}\f$. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the hypervirial model, which follows from the binomial series of \f$\rho(r) \propto x^{p-2}\,(1+x^{p})^{-2-1/p}\f$ in powers of \f$x^{p}\f$. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
     
     /** This function returns the density \f$\rho(r)\f$ of the hypervirial model at radius \f$r\f$. */
     double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the hypervirial model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
     
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the hypervirial model at radius \f$r\f$. */
     double derivative_density(double r) const;
@@ -0,0 +1,113 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "IncompleteGamma.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The shape parameter above which the prefactor of the series is evaluated with the Stirling correction factor
+    const double astirling = 10.0;
+
+    // The maximum number of terms of the power series and the continued fraction
+    const int maxterms = 100000;
+
+    // The maximum number of Halley iterations
+    const int maxiterations = 50;
+
+    // This function returns the Stirling correction factor Gamma*(a) = Gamma(a) / (sqrt(2 pi) a^(a-1/2) e^-a),
+    // from its asymptotic series, which is accurate to machine precision for a >= 10
+    double gammastar(double a)
+    {
+        double y = 1.0/(a*a);
+        double s = 1.0/12.0 + y*(-1.0/360.0 + y*(1.0/1260.0 + y*(-1.0/1680.0 + y*(1.0/1188.0
+                   + y*(-691.0/360360.0 + y*(1.0/156.0 + y*(-3617.0/122400.0)))))));
+        return exp(s/a);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double IncompleteGamma::prefactor(double a, double x)
+{
+    if (a<astirling) return pow(x,a) * exp(-x) / tgamma(a+1.0);
+    double t = x/a - 1.0;
+    return exp(-a*(t-log1p(t))) / (sqrt(2.0*M_PI*a) * gammastar(a));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double IncompleteGamma::regularized_lower(double a, double x)
+{
+    if (x<=0.0) return 0.0;
+
+    // Beyond x = a+1, the complement Q(a,x) = a x^-1 x^a e^-x / Gamma(a+1) / (x+1-a- 1(1-a)/(x+3-a- 2(2-a)/(x+5-a- ...)))
+    // is evaluated with the modified Lentz algorithm
+
+    if (x>a+1.0)
+    {
+        const double tiny = 1e-300;
+        double b = x+1.0-a, c = 1.0/tiny, d = 1.0/b, h = d;
+        for (int n=1; n<maxterms; n++)
+        {
+            double an = -n*(n-a);
+            b += 2.0;
+            d = an*d + b;
+            if (fabs(d)<tiny) d = tiny;
+            c = b + an/c;
+            if (fabs(c)<tiny) c = tiny;
+            d = 1.0/d;
+            double delta = d*c;
+            h *= delta;
+            if (fabs(delta-1.0)<DBL_EPSILON) break;
+        }
+        return 1.0 - a/x * prefactor(a,x) * h;
+    }
+
+    // The series P(a,x) = x^a e^-x / Gamma(a+1) sum_n x^n / ((a+1)...(a+n))
+
+    double term = 1.0, sum = 1.0;
+    for (int n=1; n<maxterms; n++)
+    {
+        term *= x/(a+n);
+        sum += term;
+        if (term<DBL_EPSILON*sum) break;
+    }
+    return min(prefactor(a,x) * sum, 1.0);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double IncompleteGamma::median(double a, double x0)
+{
+    double x = x0;
+    if (!(x>0.0))
+    {
+        if (a<1.0) x = pow(0.5*tgamma(a+1.0),1.0/a);
+        else x = a - 1.0/3.0 + 8.0/(405.0*a) + 184.0/(25515.0*a*a);
+    }
+
+    // Halley iterations on f(x) = P(a,x) - 1/2, with f'(x) = a x^(a-1) e^-x / Gamma(a+1) and
+    // f''(x)/f'(x) = (a-1)/x - 1, keeping the iterates within a bracket of the solution
+
+    double xlo = 0.0, xhi = std::numeric_limits<double>::infinity();
+    for (int k=0; k<maxiterations; k++)
+    {
+        double f = regularized_lower(a,x) - 0.5;
+        if (f==0.0) break;
+        if (f<0.0) xlo = x;
+        else xhi = x;
+        double u = f / (a/x * prefactor(a,x));
+        double xnew = x - u / (1.0 - 0.5*u*((a-1.0)/x - 1.0));
+        if (fabs(xnew-x)<=4.0*DBL_EPSILON*x) return xnew;
+        if (!(xnew>xlo && xnew<xhi)) xnew = (xhi<std::numeric_limits<double>::infinity()) ? 0.5*(xlo+xhi) : 2.0*x;
+        x = xnew;
+    }
+    return x;
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,36 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef INCOMPLETEGAMMA_HPP
+#define INCOMPLETEGAMMA_HPP
+
+#include "Basics.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** IncompleteGamma is the class that evaluates the regularized lower incomplete gamma function \f[ P(a,x) = \frac{\gamma(a,x)}{\Gamma(a)} = \frac{1}{\Gamma(a)} \int_0^x t^{a-1}\,{\text{e}}^{-t}\,{\text{d}}t \f] and solves the equation \f$P(a,x) = \tfrac12\f$, i.e. it finds the median of the gamma distribution with shape parameter \f$a\f$. This is the equation that defines the parameter \f$b\f$ of the Sérsic model, with \f$a=2m\f$, and the parameter \f$d\f$ of the Einasto model, with \f$a=3n\f$.
+
+    The function \f$P(a,x)\f$ is evaluated with its power series, whose terms are all positive, for \f$x\leq a+1\f$, and from the continued fraction of its complement \f$1-P(a,x)\f$ beyond. The prefactor \f$x^a\,{\text{e}}^{-x}/\Gamma(a+1)\f$ is evaluated directly for \f$a<10\f$, and in the form \f$\exp[-a\,(t-\ln(1+t))]/(\sqrt{2\pi a}\;\Gamma^*(a))\f$ with \f$t=x/a-1\f$ and \f$\Gamma^*(a)\f$ the Stirling correction factor for larger \f$a\f$, such that it remains accurate to a few units in the last place for all shape parameters. The median is found with Halley's method, which converges cubically from a good initial guess. For more information, see <a href="https://doi.org/10.1145/22721.23109">DiDonato & Morris (1986)</a> and <a href="https://ui.adsabs.harvard.edu/abs/1999A%26A...352..447C/abstract">Ciotti & Bertin (1999)</a>. */
+
+class IncompleteGamma
+{
+public:
+
+    /** This function returns the regularized lower incomplete gamma function \f$P(a,x)\f$ for \f$a>0\f$ and \f$x\geq0\f$. */
+    static double regularized_lower(double a, double x);
+
+    /** This function returns the solution \f$x\f$ of \f$P(a,x)=\tfrac12\f$ for \f$a>0\f$, to machine precision. The solution is refined from the initial guess \f$x_0\f$ with Halley iterations. If the initial guess is not positive, it is taken from the leading term of the power series for \f$a<1\f$ and from the asymptotic expansion \f$x \approx a - \tfrac13 + \tfrac{8}{405a} + \tfrac{184}{25515a^2}\f$ for larger \f$a\f$. */
+    static double median(double a, double x0 = 0.0);
+
+private:
+
+    /** This function returns the prefactor \f$x^a\,{\text{e}}^{-x}/\Gamma(a+1)\f$ of the power series of \f$P(a,x)\f$. */
+    static double prefactor(double a, double x);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
@@ -9,10 +9,25 @@
 //////////////////////////////////////////////////////////////////////
 
 IsochroneModel::IsochroneModel(double Mtot, double b, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, b);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void IsochroneModel::set_parameters(double Mtot, double b)
 {
     _Mtot = Mtot;
     _b = b;
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> IsochroneModel::parameters() const
+{
+    return {_Mtot, _b};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -37,6 +52,13 @@ double IsochroneModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void IsochroneModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = IsochroneModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double IsochroneModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_b,4);
@@ -19,12 +19,21 @@ public:
     
     /** Constructor of the IsochroneModel class. */
     IsochroneModel(double Mtot, double b, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the IsochroneModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double b);
+
+    /** This function returns the parameters of the IsochroneModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the scale radius \f$b\f$ of the isochrone model. */
     double scale_radius() const;
     
     /** This function returns the density \f$\rho(r)\f$ of the isochrone model at radius \f$r\f$. */
     double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the isochrone model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
     
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the isochrone model at radius \f$r\f$. */
     double derivative_density(double r) const;
@@ -9,10 +9,25 @@
 //////////////////////////////////////////////////////////////////////
 
 JaffeModel::JaffeModel(double Mtot, double b, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, b);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void JaffeModel::set_parameters(double Mtot, double b)
 {
     _Mtot = Mtot;
     _b = b;
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> JaffeModel::parameters() const
+{
+    return {_Mtot, _b};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -24,6 +39,28 @@ double JaffeModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool JaffeModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = 10.0;
+    p = 4.0;
+    alpha = 1.0;
+    av = binomial_series(_Mtot/pow(_b,3)/(4.0*M_PI), 2.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool JaffeModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = 0.1;
+    p = 2.0;
+    alpha = 1.0;
+    av = binomial_series(_Mtot/pow(_b,3)/(4.0*M_PI), 2.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double JaffeModel::density(double r) const
 {
     double dimf = _Mtot/pow(_b,3);
@@ -34,6 +71,13 @@ double JaffeModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void JaffeModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = JaffeModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double JaffeModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_b,4);
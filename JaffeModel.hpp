@@ -20,12 +20,27 @@ public:
     /** Constructor of the JaffeModel class. */
     JaffeModel(double Mtot, double b, const GaussLegendre* gl);
 
+    /** This function changes the parameters of the JaffeModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double b);
+
+    /** This function returns the parameters of the JaffeModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
+
     /** This function returns the scale radius \f$b\f$ of the Jaffe model. */
     double scale_radius() const;
 
+    /** This function returns the outer asymptotic expansion of the density of the Jaffe model, which follows from the binomial series of \f$\rho(r) \propto x^{-4}\,(1+x^{-1})^{-2}\f$ in powers of \f$x^{-1}\f$. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the Jaffe model, which follows from the binomial series of \f$\rho(r) \propto x^{-2}\,(1+x)^{-2}\f$ in powers of \f$x^{1}\f$. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
     /** This function returns the density \f$\rho(r)\f$ of the Jaffe model at radius \f$r\f$. */
     double density(double r) const;
 
+    /** This function stores the density \f$\rho(r_i)\f$ of the Jaffe model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the Jaffe model at radius \f$r\f$. */
     double derivative_density(double r) const;
 
@@ -5,18 +5,131 @@
 ///////////////////////////////////////////////////////////////// */
 
 #include "Model.hpp"
+#include "DistributionFunctionTable.hpp"
 #include "GaussLegendre.hpp"
 #include <functional>
 
 //////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // The number of terms in the binomial series of the asymptotic expansions
+    const int numterms = 30;
+
+    // The range in units of the scale radius and the step in ln r of the inverse potential table for rmax
+    const double rmaxtablemin = 1e-6;
+    const double rmaxtablemax = 1e6;
+    const double rmaxtablestep = 0.1;
+
+    // The number of Halley steps that polish the interpolated radii in the batched rmax
+    const int numhalley = 1;
+
+    // This function returns the integral of t^s (t^2-x^2)^nu t^(-p) sum_k a_k t^(-alpha k) over [x,inf[, which is
+    // a sum of beta functions B(a_k,nu+1) with a_k = (p+alpha k-s-1)/2-nu
+    double outer_series_integral(double p, double alpha, const std::vector<double>& av, double x, double s, double nu)
+    {
+        double y = pow(x,-alpha);
+        double yk = 1.0;
+        double sum = 0.0;
+        for (size_t k=0; k<av.size(); k++)
+        {
+            double a = 0.5*(p+alpha*k-s-1.0) - nu;
+            double B = (nu==0.0) ? 1.0/a : exp(lgamma(a)+lgamma(nu+1.0)-lgamma(a+nu+1.0));
+            sum += av[k]*yk*B;
+            yk *= y;
+        }
+        return 0.5*pow(x,s+1.0-p+2.0*nu)*sum;
+    }
+
+    // This function returns the integral of t^s t^(-p) sum_k a_k t^(alpha k) over [0,x]
+    double inner_series_integral(double p, double alpha, const std::vector<double>& av, double x, double s)
+    {
+        double y = pow(x,alpha);
+        double yk = 1.0;
+        double sum = 0.0;
+        for (size_t k=0; k<av.size(); k++)
+        {
+            sum += av[k]*yk/(s+1.0-p+alpha*k);
+            yk *= y;
+        }
+        return pow(x,s+1.0-p)*sum;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double Model::total_potential_energy() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    return _Wmemo.get([&]()
     {
-        return density(u) * mass(u) * u;
-    };
-    return -4.0*M_PI * _gl->integrate_0_infty(integrand,scale_radius());
+        std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+        {
+            std::vector<double> M(n);
+            density(u,X,n);
+            mass(u,M.data(),n);
+            for (size_t i=0; i<n; i++) X[i] *= M[i] * u[i];
+        };
+        return -4.0*M_PI * integrate_0_infty_batch(integrand);
+    });
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = derivative_density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::second_derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = second_derivative_density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::mass(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = mass(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::potential(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = potential(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    Mv.resize(rv.size());
+    Psiv.resize(rv.size());
+    mass(rv.data(),Mv.data(),rv.size());
+    potential(rv.data(),Psiv.data(),rv.size());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = derivative_surface_density(R[i]);
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -72,6 +185,69 @@ double Model::rmax(double E) const
 
 //////////////////////////////////////////////////////////////////////
 
+void Model::rmax(const double* E, double* out, size_t n) const
+{
+    // Tabulate the potential and the mass on a grid in x = ln r, once until the parameters or the integrators change
+
+    std::shared_ptr<const ProfileTable::Table> table = _rmaxmemo.get([&]()
+    {
+        auto table = std::make_shared<ProfileTable::Table>();
+        double rs = scale_radius();
+        int numx = static_cast<int>(ceil((log(rmaxtablemax)-log(rmaxtablemin))/rmaxtablestep));
+        table->rv.resize(numx+1);
+        for (int j=0; j<=numx; j++) table->rv[j] = rs*rmaxtablemin*exp(j*rmaxtablestep);
+        mass_and_potential_profiles(table->rv,table->Mv,table->Psiv);
+        return std::shared_ptr<const ProfileTable::Table>(table);
+    });
+    const std::vector<double>& rv = table->rv;
+    const std::vector<double>& Mv = table->Mv;
+    const std::vector<double>& Psiv = table->Psiv;
+
+    // Interpolate x from the table, or use the scalar function outside the range of the table
+
+    std::vector<double> xv(n), av(n), bv(n);
+    std::vector<size_t> iv;
+    double Psi0 = central_potential();
+    for (size_t i=0; i<n; i++)
+    {
+        if (E[i]>=Psi0) { out[i] = 0.0; continue; }
+        if (!(E[i]<Psiv.front() && E[i]>Psiv.back())) { out[i] = rmax(E[i]); continue; }
+        size_t j = std::upper_bound(Psiv.begin(),Psiv.end(),E[i],std::greater<double>()) - Psiv.begin() - 1;
+        double xa = log(rv[j]), xb = log(rv[j+1]);
+        double h = Psiv[j+1]-Psiv[j];
+        double t = (E[i]-Psiv[j])/h;
+        double da = -rv[j]/Mv[j]*h, db = -rv[j+1]/Mv[j+1]*h;
+        xv[i] = (1.0+2.0*t)*(1.0-t)*(1.0-t)*xa + t*(1.0-t)*(1.0-t)*da + t*t*(3.0-2.0*t)*xb - t*t*(1.0-t)*db;
+        av[i] = xa;
+        bv[i] = xb;
+        iv.push_back(i);
+    }
+
+    // Polish with Halley steps in x, with the profiles evaluated for all binding energies at once
+
+    size_t m = iv.size();
+    std::vector<double> ru(m), Mu(m), Psiu(m), rhou(m);
+    for (int step=0; step<numhalley; step++)
+    {
+        for (size_t k=0; k<m; k++) ru[k] = exp(xv[iv[k]]);
+        mass(ru.data(),Mu.data(),m);
+        potential(ru.data(),Psiu.data(),m);
+        density(ru.data(),rhou.data(),m);
+        for (size_t k=0; k<m; k++)
+        {
+            size_t i = iv[k];
+            double g = Psiu[k]-E[i];
+            double dg = -Mu[k]/ru[k];
+            double d2g = Mu[k]/ru[k] - 4.0*M_PI*rhou[k]*ru[k]*ru[k];
+            double x = xv[i] - 2.0*g*dg/(2.0*dg*dg-g*d2g);
+            if (x>=av[i] && x<=bv[i]) xv[i] = x;
+        }
+    }
+    for (size_t i : iv) out[i] = exp(xv[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double Model::surface_density_slope(double R) const
 {
     return -R * derivative_surface_density(R) / surface_density(R);
@@ -81,40 +257,51 @@ double Model::surface_density_slope(double R) const
 
 double Model::surface_mass(double R) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return surface_density(u) * u;
+        surface_density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i];
     };
-    return 2.0*M_PI*_gl->integrate_0_r(integrand,R,scale_radius());
+    return 2.0*M_PI*integrate_0_r_batch(integrand,R);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::isotropic_dispersion(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    double I;
+    if (outer_integral(r,-2.0,1,0.0,I)) return I / density(r);
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return density(u) * mass(u) / (u*u);
+        std::vector<double> M(n);
+        density(u,X,n);
+        mass(u,M.data(),n);
+        for (size_t i=0; i<n; i++) X[i] *= M[i] / (u[i]*u[i]);
     };
-    return _gl->integrate_r_infty(integrand,r,scale_radius()) / density(r);
+    return integrate_r_infty_batch(integrand,r) / density(r);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::isotropic_projected_dispersion(double R) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    double I;
+    if (outer_integral(R,-2.0,1,0.5,I)) return 2.0*I / surface_density(R);
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return density(u) * mass(u) / (u*u) * sqrt((u-R)*(u+R));
+        std::vector<double> M(n);
+        density(u,X,n);
+        mass(u,M.data(),n);
+        for (size_t i=0; i<n; i++) X[i] *= M[i] / (u[i]*u[i]) * ((u[i]-R)*(u[i]+R));
     };
-    return 2.0*_gl->integrate_r_infty(integrand,R,scale_radius()) / surface_density(R);
+    return 2.0*integrate_abel_batch(integrand,R) / surface_density(R);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::isotropic_distribution_function(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         double M = mass(u);
         double rho = density(u);
@@ -123,92 +310,131 @@ double Model::isotropic_distribution_function(double r) const
         double Delta = u*u/M * (d2rho + drho*(2.0/u-4.0*M_PI*rho*u*u/M));
         return Delta/sqrt(fabs(potential_difference(r,u)));
     };
-    return 1.0/(2.0*M_SQRT2*M_PI*M_PI) * _gl->integrate_r_infty(integrand,r,scale_radius());
+    return 1.0/(2.0*M_SQRT2*M_PI*M_PI) * integrate_r_infty(integrand,r,_eddingtonts);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::density_from_isotropic_distribution_function(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         double z = sqrt(fabs(potential_difference(r,u)));
-        return isotropic_distribution_function(u) * mass(u) * z / (u*u);
+        return moment_isotropic_distribution_function(u) * mass(u) * z / (u*u);
     };
-    return 4.0*M_SQRT2*M_PI * _gl->integrate_r_infty(integrand,r,scale_radius());
+    return 4.0*M_SQRT2*M_PI * integrate_r_infty(integrand,r,_eddingtonts);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::dispersion_from_isotropic_distribution_function(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         double z = sqrt(fabs(potential_difference(r,u)));
-        return isotropic_distribution_function(u) * mass(u) * (z*z*z) / (u*u);
+        return moment_isotropic_distribution_function(u) * mass(u) * (z*z*z) / (u*u);
     };
-    return 8.0*M_SQRT2*M_PI/3.0 * _gl->integrate_r_infty(integrand,r,scale_radius()) / density(r);
+    return 8.0*M_SQRT2*M_PI/3.0 * integrate_r_infty(integrand,r,_eddingtonts) / density(r);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::isotropic_density_of_states(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         return (u*u) * sqrt(fabs(potential_difference(u,r)));
     };
-    return 16.0*M_SQRT2*M_PI*M_PI * _gl->integrate_0_r(integrand,r,scale_radius());
+    return 16.0*M_SQRT2*M_PI*M_PI * integrate_0_r(integrand,r,_eddingtonts);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::total_mass_from_isotropic_differential_energy_distribution() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
-        double df = isotropic_distribution_function(u);
+        double df = moment_isotropic_distribution_function(u);
         double g = isotropic_density_of_states(u);
         return df * g * mass(u) / (u*u);
     };
-    return _gl->integrate_0_infty(integrand,scale_radius());
+    return integrate_0_infty(integrand);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::isotropic_total_integrated_binding_energy() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    return _Eisomemo.get([&]()
     {
-        double df = isotropic_distribution_function(u);
-        double g = isotropic_density_of_states(u);
-        return df * g * mass(u) * potential(u) / (u*u);
-    };
-    return _gl->integrate_0_infty(integrand,scale_radius());
+        auto integrand = [&](double u) -> double
+        {
+            double df = moment_isotropic_distribution_function(u);
+            double g = isotropic_density_of_states(u);
+            return df * g * mass(u) * potential(u) / (u*u);
+        };
+        return integrate_0_infty(integrand);
+    });
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::isotropic_total_kinetic_energy() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    return _Tisomemo.get([&]()
     {
-        return density(u) * isotropic_dispersion(u) * (u*u);
-    };
-    return 6.0*M_PI * _gl->integrate_0_infty(integrand,scale_radius());
+        auto integrand = [&](double u) -> double
+        {
+            return density(u) * isotropic_dispersion(u) * (u*u);
+        };
+        return 6.0*M_PI * integrate_0_infty(integrand);
+    });
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::osipkov_merritt_radial_dispersion(double r, double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    double I0, I2;
+    if (outer_integral(r,-2.0,1,0.0,I2) && outer_integral(r,0.0,1,0.0,I0))
+        return (I2+I0/(ra*ra)) / (1.0+r*r/(ra*ra)) / density(r);
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        
-        double rhoQ = density(u) * (1.0+u*u/(ra*ra));
-        return rhoQ * mass(u) / (u*u);
+        std::vector<double> M(n);
+        density(u,X,n);
+        mass(u,M.data(),n);
+        for (size_t i=0; i<n; i++)
+        {
+            double rhoQ = X[i] * (1.0+u[i]*u[i]/(ra*ra));
+            X[i] = rhoQ * M[i] / (u[i]*u[i]);
+        }
     };
-    return _gl->integrate_r_infty(integrand,r,scale_radius()) / (1.0+r*r/(ra*ra)) / density(r);
+    return integrate_r_infty_batch(integrand,r) / (1.0+r*r/(ra*ra)) / density(r);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::radial_dispersions(double r, double ra, double& disp_iso, double& dispr_om) const
+{
+    double I[2];
+    if (!outer_integral(r,-2.0,1,0.0,I[0]) || !outer_integral(r,0.0,1,0.0,I[1]))
+    {
+        std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+        {
+            std::vector<double> M(n);
+            density(u,X,n);
+            mass(u,M.data(),n);
+            for (size_t i=0; i<n; i++)
+            {
+                X[n+i] = X[i] * M[i];
+                X[i] = X[n+i] / (u[i]*u[i]);
+            }
+        };
+        integrate_r_infty_batch(integrand,r,2,I);
+    }
+    double rho = density(r);
+    disp_iso = I[0] / rho;
+    dispr_om = (I[0]+I[1]/(ra*ra)) / (1.0+r*r/(ra*ra)) / rho;
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -222,22 +448,28 @@ double Model::osipkov_merritt_tangential_dispersion(double r, double ra) const
 
 double Model::osipkov_merritt_projected_dispersion(double R, double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        double f = (u*u+ra*ra) / (R*R+ra*ra);
-        double t1 = (R*R+2.0*ra*ra) / sqrt(R*R+ra*ra) * atan(sqrt((u-R)*(u+R)/(R*R+ra*ra)));
-        double t2 = -R*R * sqrt((u-R)*(u+R))/(u*u+ra*ra);
-        double w = f * (t1+t2);
-        return w * density(u) * mass(u) / (u*u);
+        std::vector<double> M(n);
+        density(u,X,n);
+        mass(u,M.data(),n);
+        for (size_t i=0; i<n; i++)
+        {
+            double f = (u[i]*u[i]+ra*ra) / (R*R+ra*ra);
+            double t1 = (R*R+2.0*ra*ra) / sqrt(R*R+ra*ra) * atan(sqrt((u[i]-R)*(u[i]+R)/(R*R+ra*ra)));
+            double t2 = -R*R * sqrt((u[i]-R)*(u[i]+R))/(u[i]*u[i]+ra*ra);
+            double w = f * (t1+t2);
+            X[i] *= w * M[i] / (u[i]*u[i]);
+        }
     };
-    return _gl->integrate_r_infty(integrand,R,scale_radius()) / surface_density(R);
+    return integrate_r_infty_batch(integrand,R,_abelts) / surface_density(R);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::osipkov_merritt_distribution_function(double r, double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         double M = mass(u);
         double rho = density(u);
@@ -249,66 +481,392 @@ double Model::osipkov_merritt_distribution_function(double r, double ra) const
         double DeltaQ = u*u/M * (d2rhoQ + drhoQ*(2.0/u-4.0*M_PI*rho*u*u/M));
         return DeltaQ / sqrt(fabs(potential_difference(r,u)));
     };
-    return 1.0/(2.0*M_SQRT2*M_PI*M_PI) * _gl->integrate_r_infty(integrand,r,scale_radius());
+    return 1.0/(2.0*M_SQRT2*M_PI*M_PI) * integrate_r_infty(integrand,r,_eddingtonts);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::density_from_osipkov_merritt_distribution_function(double r, double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         double z = sqrt(fabs(potential_difference(r,u)));
-        return osipkov_merritt_distribution_function(u,ra) * mass(u) * z / (u*u);
+        return moment_osipkov_merritt_distribution_function(u,ra) * mass(u) * z / (u*u);
     };
-    return 4.0*M_SQRT2*M_PI / (1.0+r*r/(ra*ra)) * _gl->integrate_r_infty(integrand,r,scale_radius());
+    return 4.0*M_SQRT2*M_PI / (1.0+r*r/(ra*ra)) * integrate_r_infty(integrand,r,_eddingtonts);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::radial_dispersion_from_osipkov_merritt_distribution_function(double r, double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         double z = sqrt(fabs(potential_difference(r,u)));
-        return osipkov_merritt_distribution_function(u,ra) * mass(u) * (z*z*z) / (u*u);
+        return moment_osipkov_merritt_distribution_function(u,ra) * mass(u) * (z*z*z) / (u*u);
     };
-    return 8.0*M_SQRT2*M_PI/3.0 / (1.0+r*r/(ra*ra)) * _gl->integrate_r_infty(integrand,r,scale_radius()) / density(r);
+    return 8.0*M_SQRT2*M_PI/3.0 / (1.0+r*r/(ra*ra)) * integrate_r_infty(integrand,r,_eddingtonts) / density(r);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::osipkov_merritt_pseudo_density_of_states(double r, double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         return u*u/(1.0+u*u/(ra*ra)) * sqrt(fabs(potential_difference(u,r)));
     };
-    return 16.0*M_SQRT2*M_PI*M_PI * _gl->integrate_0_r(integrand,r,scale_radius());
+    return 16.0*M_SQRT2*M_PI*M_PI * integrate_0_r(integrand,r,_eddingtonts);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::total_mass_from_osipkov_merritt_pseudo_differential_energy_distribution(double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
-        double df = osipkov_merritt_distribution_function(u,ra);
+        double df = moment_osipkov_merritt_distribution_function(u,ra);
         double g = osipkov_merritt_pseudo_density_of_states(u,ra);
         return df * g * mass(u) / (u*u);
     };
-    return _gl->integrate_0_infty(integrand,scale_radius());
+    return integrate_0_infty(integrand);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double Model::osipkov_merritt_total_kinetic_energy(double ra) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    auto integrand = [&](double u) -> double
     {
         return (1.0+2.0*ra*ra/(u*u+ra*ra)) * density(u) * osipkov_merritt_radial_dispersion(u,ra) * (u*u);
     };
-    return 2.0*M_PI*_gl->integrate_0_infty(integrand,scale_radius());
+    return 2.0*M_PI*integrate_0_infty(integrand);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool Model::exponential_tail(double& /*b*/, double& /*r0*/, double& /*m*/) const
+{
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> Model::breakpoints() const
+{
+    return std::vector<double>();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> Model::parameters() const
+{
+    return std::vector<double>();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool Model::outer_expansion(double& /*xt*/, double& /*p*/, double& /*alpha*/, std::vector<double>& /*av*/) const
+{
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool Model::inner_expansion(double& /*xs*/, double& /*p*/, double& /*alpha*/, std::vector<double>& /*av*/) const
+{
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool Model::outer_integral(double r, double s, int e, double nu, double& result) const
+{
+    double xt, p, alpha;
+    std::vector<double> av;
+    if (!outer_expansion(xt,p,alpha,av)) return false;
+    double r0 = scale_radius();
+    double x = r/r0;
+    if (x<xt || p-s-1.0-2.0*nu<=0.0 || (e>0 && p<=3.0)) return false;
+    double dimf = pow(r0,s+1.0+2.0*nu);
+    result = dimf * outer_series_integral(p,alpha,av,x,s,nu);
+    if (e==0) return true;
+
+    // With M(u) = Mtot - 4 pi r0^3 t^(3-p) sum_k b_k t^(-alpha k) and b_k = a_k/(p+alpha k-3), the product rho(u) M(u)
+    // contains a second series t^(3-2p) sum_n c_n t^(-alpha n), with c_n the Cauchy product of a_k and b_k
+
+    std::vector<double> cv(av.size(), 0.0);
+    for (size_t n=0; n<av.size(); n++)
+        for (size_t k=0; k<=n; k++)
+            cv[n] += av[k]*av[n-k]/(p+alpha*(n-k)-3.0);
+    double Mtot = total_mass();
+    result = Mtot*result - 4.0*M_PI*pow(r0,3) * dimf * outer_series_integral(2.0*p-3.0,alpha,cv,x,s,nu);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool Model::inner_integral(double r, double s, double& result) const
+{
+    double xs, p, alpha;
+    std::vector<double> av;
+    if (!inner_expansion(xs,p,alpha,av)) return false;
+    double r0 = scale_radius();
+    double x = r/r0;
+    if (x>xs || s+1.0-p<=0.0) return false;
+    result = pow(r0,s+1.0) * inner_series_integral(p,alpha,av,x,s);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> Model::binomial_series(double A, double q)
+{
+    std::vector<double> av(numterms);
+    av[0] = A;
+    for (int k=1; k<numterms; k++) av[k] = -av[k-1]*(q+k-1.0)/k;
+    return av;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool Model::split_radii(std::vector<double>& sv) const
+{
+    sv = breakpoints();
+    sv.insert(sv.end(),_splitv.begin(),_splitv.end());
+    if (sv.empty()) return false;
+    sv.push_back(scale_radius());
+    std::sort(sv.begin(),sv.end());
+    sv.erase(std::unique(sv.begin(),sv.end()),sv.end());
+    return sv.size()>1;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::set_relative_tolerance(double reltol)
+{
+    _reltol = reltol;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double Model::relative_tolerance() const
+{
+    return _reltol;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+const GaussLegendre* Model::integrator() const
+{
+    return _gl;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::set_abel_integrator(const TanhSinh* ts)
+{
+    _abelts = ts;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::set_eddington_integrator(const TanhSinh* ts)
+{
+    _eddingtonts = ts;
+    _Eisomemo.reset();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::set_global_integrator(const ClenshawCurtis* cc)
+{
+    _globalcc = cc;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::set_split_radii(const std::vector<double>& rbv)
+{
+    _splitv = rbv;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::invalidate_invariants()
+{
+    _Mtotmemo.reset();
+    _Psi0memo.reset();
+    _Wmemo.reset();
+    _Eisomemo.reset();
+    _Tisomemo.reset();
+    _rmaxmemo.reset();
+    _isodf = nullptr;
+    _omdf = nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::set_isotropic_distribution_function_table(const DistributionFunctionTable* table)
+{
+    _isodf = table;
+    _Eisomemo.reset();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::set_osipkov_merritt_distribution_function_table(const DistributionFunctionTable* table)
+{
+    _omdf = table;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double Model::moment_isotropic_distribution_function(double r) const
+{
+    if (_isodf) return _isodf->value(r);
+    return isotropic_distribution_function(r);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double Model::moment_osipkov_merritt_distribution_function(double r, double ra) const
+{
+    if (_omdf && _omdf->anisotropy_radius()==ra) return _omdf->value(r);
+    return osipkov_merritt_distribution_function(r,ra);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double Model::integrate_0_infty_batch(std::function<void(const double*, double*, size_t)> X) const
+{
+    if (_globalcc) return _globalcc->integrate_0_infty(X,scale_radius());
+    std::vector<double> sv;
+    bool split = split_radii(sv);
+    if (_reltol>0.0)
+    {
+        auto scalar = [&](double u) -> double { double f; X(&u,&f,1); return f; };
+        if (split) return _gl->integrate_0_infty_adaptive(scalar,sv,_reltol);
+        return _gl->integrate_0_infty_adaptive(scalar,scale_radius(),_reltol);
+    }
+    double b, r0, m;
+    bool tail = exponential_tail(b,r0,m);
+    if (split) return tail ? _gl->integrate_0_infty_batch(X,sv,b,r0,m) : _gl->integrate_0_infty_batch(X,sv);
+    if (tail) return _gl->integrate_0_infty_batch(X,scale_radius(),b,r0,m);
+    return _gl->integrate_0_infty_batch(X,scale_radius());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double Model::integrate_0_r_batch(std::function<void(const double*, double*, size_t)> X, double r, const TanhSinh* ts) const
+{
+    std::vector<double> sv;
+    bool split = split_radii(sv);
+    if (ts || _reltol>0.0)
+    {
+        auto scalar = [&](double u) -> double { double f; X(&u,&f,1); return f; };
+        if (ts) return ts->integrate_0_r(scalar,r,scale_radius());
+        if (split) return _gl->integrate_0_r_adaptive(scalar,r,sv,_reltol);
+        return _gl->integrate_0_r_adaptive(scalar,r,scale_radius(),_reltol);
+    }
+    if (split) return _gl->integrate_0_r_batch(X,r,sv);
+    return _gl->integrate_0_r_batch(X,r,scale_radius());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double Model::integrate_r_infty_batch(std::function<void(const double*, double*, size_t)> X, double r, const TanhSinh* ts) const
+{
+    std::vector<double> sv;
+    bool split = split_radii(sv);
+    if (ts || _reltol>0.0)
+    {
+        auto scalar = [&](double u) -> double { double f; X(&u,&f,1); return f; };
+        if (ts) return ts->integrate_r_infty(scalar,r,scale_radius());
+        if (split) return _gl->integrate_r_infty_adaptive(scalar,r,sv,_reltol);
+        return _gl->integrate_r_infty_adaptive(scalar,r,scale_radius(),_reltol);
+    }
+    double b, r0, m;
+    bool tail = exponential_tail(b,r0,m);
+    if (split) return tail ? _gl->integrate_r_infty_batch(X,r,sv,b,r0,m) : _gl->integrate_r_infty_batch(X,r,sv);
+    if (tail) return _gl->integrate_r_infty_batch(X,r,scale_radius(),b,r0,m);
+    return _gl->integrate_r_infty_batch(X,r,scale_radius());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double Model::integrate_abel_batch(std::function<void(const double*, double*, size_t)> X, double r) const
+{
+    std::vector<double> sv;
+    bool split = split_radii(sv);
+    if (_abelts || _reltol>0.0)
+    {
+        auto scalar = [&](double u) -> double { double f; X(&u,&f,1); return f; };
+        if (_abelts)
+        {
+            auto integrand = [&](double u) -> double { return scalar(u)/sqrt((u-r)*(u+r)); };
+            return _abelts->integrate_r_infty(integrand,r,scale_radius());
+        }
+        if (split) return _gl->integrate_abel_adaptive(scalar,r,sv,_reltol);
+        return _gl->integrate_abel_adaptive(scalar,r,scale_radius(),_reltol);
+    }
+    double b, r0, m;
+    bool tail = exponential_tail(b,r0,m);
+    if (split) return tail ? _gl->integrate_abel_batch(X,r,sv,b,r0,m) : _gl->integrate_abel_batch(X,r,sv);
+    if (tail) return _gl->integrate_abel_batch(X,r,scale_radius(),b,r0,m);
+    return _gl->integrate_abel_batch(X,r,scale_radius());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::integrate_r_infty_batch(std::function<void(const double*, double*, size_t)> X, double r, size_t num, double* result, const TanhSinh* ts) const
+{
+    if (ts || _reltol>0.0)
+    {
+        std::vector<double> f(num);
+        for (size_t j=0; j<num; j++)
+        {
+            std::function<void(const double*, double*, size_t)> component = [&](const double* u, double* Xj, size_t n)
+            {
+                for (size_t i=0; i<n; i++) { X(u+i,f.data(),1); Xj[i] = f[j]; }
+            };
+            result[j] = integrate_r_infty_batch(component,r,ts);
+        }
+        return;
+    }
+    std::vector<double> sv;
+    if (!split_radii(sv)) sv.assign(1,scale_radius());
+    double b, r0, m;
+    if (exponential_tail(b,r0,m)) _gl->integrate_r_infty_batch(X,r,sv,num,result,b,r0,m);
+    else _gl->integrate_r_infty_batch(X,r,sv,num,result);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void Model::integrate_abel_batch(std::function<void(const double*, double*, size_t)> X, double r, size_t num, double* result) const
+{
+    if (_abelts || _reltol>0.0)
+    {
+        std::vector<double> f(num);
+        for (size_t j=0; j<num; j++)
+        {
+            std::function<void(const double*, double*, size_t)> component = [&](const double* u, double* Xj, size_t n)
+            {
+                for (size_t i=0; i<n; i++) { X(u+i,f.data(),1); Xj[i] = f[j]; }
+            };
+            result[j] = integrate_abel_batch(component,r);
+        }
+        return;
+    }
+    std::vector<double> sv;
+    if (!split_radii(sv)) sv.assign(1,scale_radius());
+    double b, r0, m;
+    if (exponential_tail(b,r0,m)) _gl->integrate_abel_batch(X,r,sv,num,result,b,r0,m);
+    else _gl->integrate_abel_batch(X,r,sv,num,result);
 }
 
 //////////////////////////////////////////////////////////////////////
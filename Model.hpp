@@ -8,7 +8,13 @@
 #define MODEL_HPP
 
 #include "Basics.hpp"
-class GaussLegendre;
+#include "GaussLegendre.hpp"
+#include "ClenshawCurtis.hpp"
+#include "TanhSinh.hpp"
+#include <atomic>
+#include <memory>
+
+class DistributionFunctionTable;
 
 //////////////////////////////////////////////////////////////////////
 
@@ -23,34 +29,67 @@ public:
     
     /** This pure virtual function returns the scale radius of the model. It is used in the numerical integration routines. */
     virtual double scale_radius() const = 0;
+
+    /** This function returns true if the density \f$\rho(r)\f$ of the model has a stretched exponential tail that decays as \f$\exp[-b\,(r/r_0)^{1/m}]\f$ at large radii, and stores the parameters \f$b\f$, \f$r_0\f$ and \f$m\f$ in that case. The default implementation returns false. If a model declares such a tail, the outer segment of the batched integrals over semi-infinite intervals, whose integrands all contain the density or the surface density as a factor, is integrated using a Gauss-Laguerre rule that follows the decay of the integrand. */
+    virtual bool exponential_tail(double& b, double& r0, double& m) const;
+
+    /** This function returns the radii at which the density \f$\rho(r)\f$ of the model or one of its derivatives is not smooth, such as the break radius of a broken power-law profile or the nodes of a piecewise profile. The default implementation returns an empty vector. All integrals of the model that are estimated with the GaussLegendre integrator are split at these radii in addition to the scale radius, such that the quadrature rules are only applied to smooth segments of the integrand. */
+    virtual std::vector<double> breakpoints() const;
+
+    /** This function returns the parameters of the model, in the order of the arguments of its function set_parameters(), or of its constructor if the model has no such function. A model that wraps another model also returns the parameters of the wrapped model. The parameters identify the model together with its class, for example in the key of a cache file. The default implementation returns an empty vector. */
+    virtual std::vector<double> parameters() const;
+
+    /** This function returns true if the density of the model has a known asymptotic expansion at large radii, \f[ \rho(r) = x^{-p} \sum_{k} a_k\, x^{-\alpha k}, \qquad x = \frac{r}{r_{\text{s}}} \geq x_{\text{t}}, \f] with \f$r_{\text{s}}\f$ the scale radius, where the truncated series is accurate to machine precision beyond the cutoff \f$x_{\text{t}}\f$. In that case, it stores the cutoff \f$x_{\text{t}}\f$, the power \f$p\f$, the step \f$\alpha\f$ and the coefficients \f$a_k\f$. The default implementation returns false. If a model declares such an expansion, the integrals over \f$[r,+\infty[\f$ in the mass, potential, surface density, isotropic dispersions and Osipkov-Merritt radial dispersion are evaluated analytically rather than numerically for radii beyond the cutoff. */
+    virtual bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns true if the density of the model has a known asymptotic expansion at small radii, \f[ \rho(r) = x^{-p} \sum_{k} a_k\, x^{\alpha k}, \qquad x = \frac{r}{r_{\text{s}}} \leq x_{\text{s}}, \f] with \f$r_{\text{s}}\f$ the scale radius, where the truncated series is accurate to machine precision within the cutoff \f$x_{\text{s}}\f$. In that case, it stores the cutoff \f$x_{\text{s}}\f$, the power \f$p\f$, the step \f$\alpha\f$ and the coefficients \f$a_k\f$. The default implementation returns false. If a model declares such an expansion, the integrals over \f$[0,r]\f$ in the mass and potential are evaluated analytically rather than numerically for radii within the cutoff. */
+    virtual bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
     
     /** This pure virtual function returns the total mass \f$M_{\text{tot}}\f$ . */
     virtual double total_mass() const = 0;
     
-    /** This function returns the total potential energy \f$W_{\text{tot}}\f$ . It is calculated as \f[ W_{\text{tot}} = -4\pi G \int_0^\infty \rho(u)\, M(u)\, u\, {\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature. */
-    double total_potential_energy() const;
+    /** This function returns the total potential energy \f$W_{\text{tot}}\f$ . It is calculated as \f[ W_{\text{tot}} = -4\pi G \int_0^\infty \rho(u)\, M(u)\, u\, {\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature, the first time the function is called after the construction of the model or a change of its parameters or integrators. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double total_potential_energy() const;
 
     /** This pure virtual function returns the density \f$\rho(r)\f$ at radius \f$r\f$. */
     virtual double density(double r) const = 0;
 
+    /** This function stores the density \f$\rho(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. The default implementation calls the scalar version of the function for each radius. Derived classes can reimplement it, such that integrands that need the profile at all quadrature nodes at once require only a single virtual function call, and the loop can be inlined and vectorized by the compiler. */
+    virtual void density(const double* r, double* out, size_t n) const;
+
     /** This pure virtual function returns the derivative of the density \f$\rho'(r)\f$ at radius \f$r\f$. */
     virtual double derivative_density(double r) const = 0;
 
+    /** This function stores the derivative of the density \f$\rho'(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void derivative_density(const double* r, double* out, size_t n) const;
+
     /** This pure virtual function returns the second derivative of the density \f$\rho''(r)\f$ at radius \f$r\f$. */
     virtual double second_derivative_density(double r) const = 0;
 
+    /** This function stores the second derivative of the density \f$\rho''(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void second_derivative_density(const double* r, double* out, size_t n) const;
+
     /** This function returns the density slope \f$\gamma(r)\f$ at radius \f$r\f$. It is calculated as \f[ \gamma(r) = -\frac{{\text{d}}\log\rho}{{\text{d}}\log r}(r) = -\frac{r\,\rho'(r)}{\rho(r)}.\f] */
     double density_slope(double r) const;
     
     /** This pure virtual function returns the mass \f$M(r)\f$ at radius \f$r\f$. */
     virtual double mass(double r) const = 0;
 
+    /** This function stores the mass \f$M(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void mass(const double* r, double* out, size_t n) const;
+
     /** This function returns the circular velocity \f$v_{\text{c}}(r)\f$ at radius \f$r\f$. It is calculated as \f[ v_{\text{c}}(r) = \sqrt{\frac{GM(r)}{r}}.\f]  */
     double circular_velocity(double r) const;
     
     /** This pure virtual function returns the potential \f$\Psi(r)\f$ at radius \f$r\f$. */
     virtual double potential(double r) const = 0;
 
+    /** This function stores the potential \f$\Psi(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void potential(const double* r, double* out, size_t n) const;
+
+    /** This function calculates the mass \f$M(r_i)\f$ and the potential \f$\Psi(r_i)\f$ at the radii \f$r_i\f$ in the vector rv, and stores them in the vectors Mv and Psiv. It is meant for evaluating both profiles on an entire grid of radii at once. The default implementation calls the batched functions mass() and potential(). This function is a virtual function that can be reimplemented by derived classes for which the mass and the potential are numerical integrals, such that the integrals for all radii are evaluated in a single sweep. */
+    virtual void mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
+
     /** This pure virtual function returns the central value of the potential \f$\Psi_0\f$. */
     virtual double central_potential() const = 0;
 
@@ -59,24 +98,33 @@ public:
 
     /** This function returns the maximum radius \f$r_{\text{max}}({\cal{E}})\f$ that can be reached by a particle with binding energy per unit mass \f${\cal{E}}\f$.  It is calculated by solving the equation \f$\Psi(r_{\text{max}}({\cal{E}})) = {\cal{E}})\f$. In the general case, this equation is solved using Newton's method. This function is a virtual function that can be reimplemented by derived classes. */
     virtual double rmax(double E) const;
+
+    /** This function stores the maximum radius \f$r_{\text{max}}({\cal{E}}_i)\f$ for the \f$n\f$ binding energies \f${\cal{E}}_i\f$ in the array out. It is the batched version of the function above. The potential and the mass are first calculated on a grid in \f$x = \ln r\f$ with the function mass_and_potential_profiles(), which yields a monotonic table of \f$x\f$ as a function of \f$\Psi\f$. For each binding energy, \f$x\f$ is interpolated from this table using a cubic Hermite polynomial with the exact slopes \f${\text{d}}x/{\text{d}}\Psi = -r/GM(r)\f$, and polished with a Halley step, \f[ x \leftarrow x - \frac{2\,g\,g'}{2\,g'^2-g\,g''}, \qquad g = \Psi(r)-{\cal{E}}, \quad g' = -\frac{GM(r)}{r}, \quad g'' = \frac{GM(r)}{r} - 4\pi G\,\rho(r)\,r^2, \f] in which the potential, the mass and the density are evaluated for all binding energies at once. Since the interpolated radii are already accurate to about \f$10^{-6}\f$, a single step suffices for close to machine precision. Steps that would leave the bracketing grid interval are rejected. Binding energies outside the range of the table are handled by the function above. The table is built once, the first time the function is called, and kept until the parameters or the integrators of the model change, such that its cost is shared by all binding energies of all calls. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual void rmax(const double* E, double* out, size_t n) const;
     
     /** This pure virtual function returns the surface density \f$\Sigma(R)\f$ at projected radius \f$R\f$. */
     virtual double surface_density(double R) const = 0;
 
+    /** This function stores the surface density \f$\Sigma(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void surface_density(const double* R, double* out, size_t n) const;
+
     /** This pure virtual function returns the derivative of the surface density \f$\Sigma'(R)\f$ at projected radius \f$R\f$. */
     virtual double derivative_surface_density(double R) const = 0;
 
-    /** This function returns the surface density slope \f$\gamma_{\text{p}}(R)\f$ at projected radius \f$R\f$. It is calculated as \f[ \gamma_{\text{p}}(R) = -\frac{{\text{d}}\log\Sigma}{{\text{d}}\log R}(R) = -\frac{R\,\Sigma'(R)}{\Sigma(R)}.\f] */
-    double surface_density_slope(double R) const;
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void derivative_surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the surface density slope \f$\gamma_{\text{p}}(R)\f$ at projected radius \f$R\f$. It is calculated as \f[ \gamma_{\text{p}}(R) = -\frac{{\text{d}}\log\Sigma}{{\text{d}}\log R}(R) = -\frac{R\,\Sigma'(R)}{\Sigma(R)}.\f] This function is a virtual function that can be reimplemented by derived classes that calculate the surface density and its derivative in a single pass. */
+    virtual double surface_density_slope(double R) const;
     
-    /** This function returns the surface mass \f$M_{\text{p}}(R)\f$ at projected radius \f$R\f$. It is calculated as \f[ M_{\text{p}}(R) = 2\pi \int_0^R \Sigma(u)\,u\, {\text{d}}u. \f] The integration is performed using Gauss-Legendre quadrature. */
-    double surface_mass(double R) const;
+    /** This function returns the surface mass \f$M_{\text{p}}(R)\f$ at projected radius \f$R\f$. It is calculated as \f[ M_{\text{p}}(R) = 2\pi \int_0^R \Sigma(u)\,u\, {\text{d}}u. \f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double surface_mass(double R) const;
 
-    /** This function returns the velocity dispersion \f$\sigma^2_{\text{iso}}(r)\f$ at radius \f$r\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ \sigma^2_{\text{iso}}(r) = \frac{G}{\rho(r)} \int_r^\infty \frac{\rho(u)\,M(u)\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature. */
-    double isotropic_dispersion(double r) const;
+    /** This function returns the velocity dispersion \f$\sigma^2_{\text{iso}}(r)\f$ at radius \f$r\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ \sigma^2_{\text{iso}}(r) = \frac{G}{\rho(r)} \int_r^\infty \frac{\rho(u)\,M(u)\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature, or analytically beyond the cutoff of the outer asymptotic expansion of the density, if the model declares one. This function is a virtual function that can be reimplemented by derived classes that tabulate the dispersion. */
+    virtual double isotropic_dispersion(double r) const;
     
-    /** This function returns the projected velocity dispersion \f$\sigma^2_{\text{p,iso}}(R)\f$ at projected radius \f$R\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ \sigma_{{\text{p}},{\text{iso}}}^2(R) = \frac{2G}{\Sigma(R)} \int_R^\infty \frac{\rho(u)\,M(u) \sqrt{u^2-R^2}\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature. */
-    double isotropic_projected_dispersion(double R) const;
+    /** This function returns the projected velocity dispersion \f$\sigma^2_{\text{p,iso}}(R)\f$ at projected radius \f$R\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ \sigma_{{\text{p}},{\text{iso}}}^2(R) = \frac{2G}{\Sigma(R)} \int_R^\infty \frac{\rho(u)\,M(u) \sqrt{u^2-R^2}\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature, or analytically beyond the cutoff of the outer asymptotic expansion of the density, if the model declares one. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double isotropic_projected_dispersion(double R) const;
     
     /** This function returns the distribution function \f$f_{\text{iso}}({\cal{E}})\f$ at binding energy \f${\cal{E}}=\Psi(r)\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ f_{\text{iso}}(\Psi(r)) = \frac{1}{2\sqrt2\,\pi^2} \int_r^\infty \frac{\Delta(u)\,{\text{d}}u}{\sqrt{\Psi(r)-\Psi(u)}},\f] with \f$\Delta(r)\f$ a function defined as \f[ \Delta(r) = \frac{r^2}{GM(r)}\left[\rho''(r) + \rho'(r) \left(\frac{2}{r} - \frac{4\pi\,\rho(r)\,r^2}{M(r)}\right) \right]. \f] The integration is performed using Gauss-Legendre quadrature. */
     virtual double isotropic_distribution_function(double r) const;
@@ -87,26 +135,29 @@ public:
     /** This function returns the velocity dispersion \f$\sigma^2_{\text{iso}}(r)\f$ at radius \f$r\f$ calculated from the distribution function under the assumption of an isotropic orbital structure. It is calculated as \f[ \sigma^2_{\text{iso}}(r) = \frac{8\sqrt2\,\pi}{3}\,\frac{G}{\rho(r)} \int_r^\infty \frac{f_{\text{iso}}(\Psi(u))\,M(u) [\Psi(r)-\Psi(u)]^{3/2}\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature. This function can be used to check the implementation of new subclasses of the Model base class.*/
     double dispersion_from_isotropic_distribution_function(double r) const;
 
-    /** This function returns the density-of-states function \f$g_{\text{iso}}({\cal{E}})\f$ at binding energy \f${\cal{E}}=\Psi(r)\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ g_{\text{iso}}(\Psi(r)) = 16\sqrt2\,\pi^2 \int_0^r u^2 \sqrt{\Psi(u)-\Psi(r)}\,{\text{d}} u.\f] The integration is performed using Gauss-Legendre quadrature. */
-    double isotropic_density_of_states(double r) const;
+    /** This function returns the density-of-states function \f$g_{\text{iso}}({\cal{E}})\f$ at binding energy \f${\cal{E}}=\Psi(r)\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ g_{\text{iso}}(\Psi(r)) = 16\sqrt2\,\pi^2 \int_0^r u^2 \sqrt{\Psi(u)-\Psi(r)}\,{\text{d}} u.\f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double isotropic_density_of_states(double r) const;
 
     /** This function returns the total mass \f$M_{\text{tot}}\f$ calculated from the differential energy distribution \f${\cal{N}}({\cal{E}})\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ M_{\text{tot}} = G\int_0^\infty \frac{f_{\text{iso}}(\Psi(u))\, g_{\text{iso}}(\Psi(u))\, M(u)\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature. This function can be used to check the implementation of new subclasses of the Model base class.*/
     double total_mass_from_isotropic_differential_energy_distribution() const;
 
-    /** This function returns the total integrated binding energy \f${\cal{E}}_{\text{tot}}\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ {\cal{E}}_{\text{tot}} = \int_0^\infty \frac{ f_{\text{iso}}(\Psi(u))\, g_{\text{iso}}(\Psi(u))\, M(u)\, \Psi(u)\,{\text{d}} u}{u^2}. \f] The integration is performed using Gauss-Legendre quadrature.  */
-    double isotropic_total_integrated_binding_energy() const;
+    /** This function returns the total integrated binding energy \f${\cal{E}}_{\text{tot}}\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ {\cal{E}}_{\text{tot}} = \int_0^\infty \frac{ f_{\text{iso}}(\Psi(u))\, g_{\text{iso}}(\Psi(u))\, M(u)\, \Psi(u)\,{\text{d}} u}{u^2}. \f] The integration is performed using Gauss-Legendre quadrature, the first time the function is called after the construction of the model or a change of its parameters, integrators or table of the distribution function. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double isotropic_total_integrated_binding_energy() const;
     
-    /** This function returns the total kinetic energy \f$T_{\text{tot}}\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ T_{\text{tot}} = 6\pi \int_0^\infty \rho(u)\,\sigma^2_{\text{iso}}(u)\,u^2\,{\text{d}} u,\f] with \f$\sigma^2_{\text{iso}}(r)\f$ the velocity dispersion. The integration is performed using Gauss-Legendre quadrature. */
-    double isotropic_total_kinetic_energy() const;
+    /** This function returns the total kinetic energy \f$T_{\text{tot}}\f$ under the assumption of an isotropic orbital structure. It is calculated as \f[ T_{\text{tot}} = 6\pi \int_0^\infty \rho(u)\,\sigma^2_{\text{iso}}(u)\,u^2\,{\text{d}} u,\f] with \f$\sigma^2_{\text{iso}}(r)\f$ the velocity dispersion. The integration is performed using Gauss-Legendre quadrature, the first time the function is called after the construction of the model or a change of its parameters or integrators. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double isotropic_total_kinetic_energy() const;
 
-    /** This function returns the radial velocity dispersion \f$\sigma^2_{r,\text{om}}(r)\f$ at radius \f$r\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ \sigma_{r,\text{om}}^2(r) = \frac{G}{\rho(r)}\, \int_r^\infty \left(\frac{u^2+r_{\text{a}}^2}{r^2+r_{\text{a}}^2}\right) \frac{\rho(u)\,M(u)\,{\text{d}}u}{u^2}. \f] The integration is performed using Gauss-Legendre quadrature. */
-    double osipkov_merritt_radial_dispersion(double r, double ra) const;
+    /** This function returns the radial velocity dispersion \f$\sigma^2_{r,\text{om}}(r)\f$ at radius \f$r\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ \sigma_{r,\text{om}}^2(r) = \frac{G}{\rho(r)}\, \int_r^\infty \left(\frac{u^2+r_{\text{a}}^2}{r^2+r_{\text{a}}^2}\right) \frac{\rho(u)\,M(u)\,{\text{d}}u}{u^2}. \f] The integration is performed using Gauss-Legendre quadrature, or analytically beyond the cutoff of the outer asymptotic expansion of the density, if the model declares one. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double osipkov_merritt_radial_dispersion(double r, double ra) const;
+
+    /** This function calculates both the isotropic velocity dispersion \f$\sigma^2_{\text{iso}}(r)\f$ and the Osipkov-Merritt radial velocity dispersion \f$\sigma^2_{r,\text{om}}(r)\f$ for an anisotropy radius \f$r_{\text{a}}\f$, and stores them in disp_iso and dispr_om. The results are the same as those of the functions isotropic_dispersion() and osipkov_merritt_radial_dispersion(), but both integrals are estimated in a single pass over the nodes, such that the density and the mass are evaluated only once per node. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual void radial_dispersions(double r, double ra, double& disp_iso, double& dispr_om) const;
     
-    /** This function returns the tangential velocity dispersion \f$\sigma^2_{\theta,\text{om}}(r) = \sigma_{\phi,{\text{om}}}^2(r)\f$ at radius \f$r\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ \sigma_{\theta,{\text{om}}}^2(r) = \sigma_{\phi,{\text{om}}}^2(r) = \left(\frac{r_{\text{a}}^2}{r^2+r_{\text{a}}^2}\right) \sigma_{r,{\text{om}}}^2(r), \f] with \f$\sigma^2_{r,\text{om}}(r)\f$  the radial velocity dispersion. */
-    double osipkov_merritt_tangential_dispersion(double r, double ra) const;
+    /** This function returns the tangential velocity dispersion \f$\sigma^2_{\theta,\text{om}}(r) = \sigma_{\phi,{\text{om}}}^2(r)\f$ at radius \f$r\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ \sigma_{\theta,{\text{om}}}^2(r) = \sigma_{\phi,{\text{om}}}^2(r) = \left(\frac{r_{\text{a}}^2}{r^2+r_{\text{a}}^2}\right) \sigma_{r,{\text{om}}}^2(r), \f] with \f$\sigma^2_{r,\text{om}}(r)\f$  the radial velocity dispersion. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double osipkov_merritt_tangential_dispersion(double r, double ra) const;
     
-    /** This function returns the projected velocity dispersion \f$\sigma^2_{\text{p,om}}(R)\f$ at projected radius \f$R\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ \sigma_{{\text{p}},{\text{om}}}^2(R) = \frac{G}{\Sigma(R)} \int_R^\infty \frac{w(u,R)\,\rho(u)\,M(u)\,{\text{d}}u}{u^2},\f] with \f[ w(u,R) = \left(\frac{u^2+r_{\text{a}}^2}{R^2+r_{\text{a}}^2}\right) \left( \frac{R^2+2r_{\text{a}}^2}{\sqrt{R^2+r_{\text{a}}^2}}\, \arctan \sqrt{\frac{u^2-R^2}{R^2+r_{\text{a}}^2}} - \frac{R^2\sqrt{u^2-R^2}}{u^2+r_{\text{a}}^2} \right). \f] The integration is performed using Gauss-Legendre quadrature. */
-    double osipkov_merritt_projected_dispersion(double R, double ra) const;
+    /** This function returns the projected velocity dispersion \f$\sigma^2_{\text{p,om}}(R)\f$ at projected radius \f$R\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ \sigma_{{\text{p}},{\text{om}}}^2(R) = \frac{G}{\Sigma(R)} \int_R^\infty \frac{w(u,R)\,\rho(u)\,M(u)\,{\text{d}}u}{u^2},\f] with \f[ w(u,R) = \left(\frac{u^2+r_{\text{a}}^2}{R^2+r_{\text{a}}^2}\right) \left( \frac{R^2+2r_{\text{a}}^2}{\sqrt{R^2+r_{\text{a}}^2}}\, \arctan \sqrt{\frac{u^2-R^2}{R^2+r_{\text{a}}^2}} - \frac{R^2\sqrt{u^2-R^2}}{u^2+r_{\text{a}}^2} \right). \f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double osipkov_merritt_projected_dispersion(double R, double ra) const;
     
     /** This function returns the distribution function \f$f_{\text{om}}(Q)\f$ at pseudo-binding energy \f$Q=\Psi(r)\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ f_{\text{om}}(\Psi(r)) = \frac{1}{2\sqrt2\,\pi^2} \int_r^\infty \frac{\Delta_Q(u)\,{\text{d}}u}{\sqrt{\Psi(r)-\Psi(u)}},\f] with \f$\Delta_Q(r)\f$ a function defined as \f[ \Delta_Q(r) = \frac{r^2}{GM(r)}\left[\rho_Q''(r) + \rho_Q'(r) \left(\frac{2}{r} - \frac{4\pi\,\rho_Q(r)\,r^2}{M(r)}\right) \right], \f] with \f[ \rho_Q(r) = \left(1+ \frac{r^2}{r_{\text{a}}^2}\right) \rho(r).\f] The integration is performed using Gauss-Legendre quadrature. */
     virtual double osipkov_merritt_distribution_function(double r, double ra) const;
@@ -117,19 +168,244 @@ public:
     /** This function returns the radial velocity dispersion \f$\sigma^2_{r,\text{om}}(r)\f$ at radius \f$r\f$ calculated from the distribution function under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ \sigma^2_{r,\text{om}}(r) = \frac{8\sqrt2\,\pi}{3}\,\frac{G}{\rho(r)} \left(1+\frac{r^2}{r_{\text{a}}^2}\right)^{-1} \int_r^\infty \frac{f_{\text{om}}(\Psi(u))\,M(u) [\Psi(r)-\Psi(u)]^{3/2}\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature. This function can be used to check the implementation of new subclasses of the Model base class.*/
     double radial_dispersion_from_osipkov_merritt_distribution_function(double r, double ra) const;
     
-    /** This function returns the pseudo-density-of-states function \f$g_{\text{om}}(Q)\f$ at pseudo-binding energy \f$Q=\Psi(r)\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ g_{\text{om}}(\Psi(r)) = 16\sqrt2\,\pi^2 \int_0^r u^2 \left(1+\frac{u^2}{r_{\text{a}}^2}\right)^{-1} \sqrt{\Psi(u)-\Psi(r)}\,{\text{d}} u.\f] The integration is performed using Gauss-Legendre quadrature. */
-    double osipkov_merritt_pseudo_density_of_states(double r, double ra) const;
+    /** This function returns the pseudo-density-of-states function \f$g_{\text{om}}(Q)\f$ at pseudo-binding energy \f$Q=\Psi(r)\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ g_{\text{om}}(\Psi(r)) = 16\sqrt2\,\pi^2 \int_0^r u^2 \left(1+\frac{u^2}{r_{\text{a}}^2}\right)^{-1} \sqrt{\Psi(u)-\Psi(r)}\,{\text{d}} u.\f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double osipkov_merritt_pseudo_density_of_states(double r, double ra) const;
     
     /** This function returns the total mass \f$M_{\text{tot}}\f$ calculated from the pseudo-differential energy distribution \f${\cal{N}}(Q)\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ M_{\text{tot}} = G\int_0^\infty \frac{f_{\text{om}}(\Psi(u))\,g_{\text{om}}(\Psi(u))\,M(u)\,{\text{d}} u}{u^2}.\f] The integration is performed using Gauss-Legendre quadrature. This function can be used to check the implementation of new subclasses of the Model base class.*/
     double total_mass_from_osipkov_merritt_pseudo_differential_energy_distribution(double ra) const;
     
-    /** This function returns the total kinetic energy \f$T_{\text{tot}}\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ T_{\text{tot}} = 2\pi \int_0^\infty \left(\frac{u^2+3\,r_{\text{a}}^2}{u^2+r_{\text{a}}^2}\right) \rho(u)\,\sigma^2_{r,\text{om}}(u)\,u^2\,{\text{d}} u,\f] with \f$\sigma^2_{r,\text{om}}(r)\f$ the radial velocity dispersion. The integration is performed using Gauss-Legendre quadrature. */
-    double osipkov_merritt_total_kinetic_energy(double ra) const;
+    /** This function returns the total kinetic energy \f$T_{\text{tot}}\f$ under the assumption of an Osipkov-Merritt orbital structure with anisotropy radius \f$r_{\text{a}}\f$. It is calculated as \f[ T_{\text{tot}} = 2\pi \int_0^\infty \left(\frac{u^2+3\,r_{\text{a}}^2}{u^2+r_{\text{a}}^2}\right) \rho(u)\,\sigma^2_{r,\text{om}}(u)\,u^2\,{\text{d}} u,\f] with \f$\sigma^2_{r,\text{om}}(r)\f$ the radial velocity dispersion. The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    virtual double osipkov_merritt_total_kinetic_energy(double ra) const;
+
+    /** This function sets the relative tolerance used in the numerical integrations of the model. If the tolerance is zero, which is the default, all integrals are estimated using Gauss-Legendre quadrature with the fixed number of nodes of the integrator. If the tolerance is positive, they are estimated using the adaptive Gauss-Kronrod variants of the integration routines, which stop as soon as the estimated relative error is smaller than the tolerance. */
+    void set_relative_tolerance(double reltol);
+
+    /** This function returns the relative tolerance used in the numerical integrations of the model. */
+    double relative_tolerance() const;
+
+    /** This function returns the Gauss-Legendre integrator of the model. */
+    const GaussLegendre* integrator() const;
+
+    /** This function selects a tanh-sinh integrator for the Abel-type projection and deprojection integrals of the model, i.e. the integrals with a kernel \f$(u^2-R^2)^{\pm1/2}\f$ such as the surface density, the density of a model defined by its surface density, and the projected dispersions. If the pointer is null, which is the default, these integrals are estimated in the same way as all other integrals. */
+    void set_abel_integrator(const TanhSinh* ts);
+
+    /** This function selects a tanh-sinh integrator for the Eddington-type integrals of the model, i.e. the integrals with a kernel \f$(\Psi(r)-\Psi(u))^{\pm1/2}\f$ such as the distribution function, its moments and the density of states. If the pointer is null, which is the default, these integrals are estimated in the same way as all other integrals. */
+    void set_eddington_integrator(const TanhSinh* ts);
+
+    /** This function selects a nested Clenshaw-Curtis integrator for the integrals of the model over the interval \f$[0,+\infty[\f$, i.e. the global properties such as the total mass, the total potential energy and the total kinetic energy. Such an integrator refines until successive levels agree to within its tolerance and splits the interval at the scale radius only. If the pointer is null, which is the default, these integrals are estimated in the same way as all other integrals. */
+    void set_global_integrator(const ClenshawCurtis* cc);
+
+    /** This function sets additional radii at which the integrals of the model are split, on top of the breakpoints of the model. They can be used for a density that is not smooth at radii that the model does not report, or to check the integration routines with split radii on a smooth model, whose properties should not depend on the split radii. By default, there are no additional split radii. */
+    void set_split_radii(const std::vector<double>& rbv);
+
+    /** This function selects a table of the isotropic distribution function, which should have been constructed for this model with an infinite anisotropy radius. The moments of the distribution function, i.e. the density and the dispersion calculated from the distribution function, the total mass calculated from the differential energy distribution and the total integrated binding energy, then interpolate the distribution function from the table rather than calculating it at every node of their integrals. If the pointer is null, which is the default, the distribution function is calculated directly. The table is deselected by the function invalidate_invariants(), i.e. whenever the parameters or the integrators of the model change, since it no longer represents the model; a new table should then be constructed and selected. */
+    void set_isotropic_distribution_function_table(const DistributionFunctionTable* table);
+
+    /** This function selects a table of the Osipkov-Merritt distribution function, as in the function set_isotropic_distribution_function_table(). The table is only used by the moments of the distribution function for the anisotropy radius for which it was constructed. */
+    void set_osipkov_merritt_distribution_function_table(const DistributionFunctionTable* table);
 
 protected:
+
+    /** Invariant is a class that holds a global property of the model, such as the total mass or the central potential, that is calculated lazily. The property is calculated the first time the function get() is called, and again after the function reset() has been called. The value is stored atomically, such that a model can be shared between threads; threads that find the property not yet calculated each calculate the same value. */
+    class Invariant
+    {
+    public:
+        Invariant() : _value(std::numeric_limits<double>::quiet_NaN()) {}
+        Invariant(const Invariant& other) : _value(other._value.load()) {}
+        Invariant& operator=(const Invariant& other) { _value.store(other._value.load()); return *this; }
+
+        /** This function returns the property, which is calculated with the function compute if it has not been calculated yet. */
+        template<typename Compute> double get(Compute compute) const
+        {
+            double value = _value.load(std::memory_order_acquire);
+            if (std::isnan(value))
+            {
+                value = compute();
+                _value.store(value, std::memory_order_release);
+            }
+            return value;
+        }
+
+        /** This function discards the property, such that it is calculated again at the next call of the function get(). */
+        void reset() { _value.store(std::numeric_limits<double>::quiet_NaN()); }
+
+    private:
+        mutable std::atomic<double> _value;
+    };
+
+    /** ProfileTable is a class that holds the mass \f$M(r_j)\f$ and the potential \f$\Psi(r_j)\f$ of the model on a grid of radii \f$r_j\f$, which is calculated lazily. The table is calculated the first time the function get() is called, and again after the function reset() has been called. It is held by a shared pointer that is loaded and stored atomically, such that a model can be shared between threads, and a thread that uses the table keeps it alive even if another thread discards it. */
+    class ProfileTable
+    {
+    public:
+        ProfileTable() {}
+        ProfileTable(const ProfileTable& other) : _table(std::atomic_load(&other._table)) {}
+        ProfileTable& operator=(const ProfileTable& other) { std::atomic_store(&_table, std::atomic_load(&other._table)); return *this; }
+
+        /** The radii \f$r_j\f$, the mass \f$M(r_j)\f$ and the potential \f$\Psi(r_j)\f$. */
+        struct Table { std::vector<double> rv, Mv, Psiv; };
+
+        /** This function returns the table, which is calculated with the function compute if it has not been calculated yet. */
+        template<typename Compute> std::shared_ptr<const Table> get(Compute compute) const
+        {
+            std::shared_ptr<const Table> table = std::atomic_load(&_table);
+            if (!table)
+            {
+                table = compute();
+                std::atomic_store(&_table, table);
+            }
+            return table;
+        }
+
+        /** This function discards the table, such that it is calculated again at the next call of the function get(). */
+        void reset() { std::atomic_store(&_table, std::shared_ptr<const Table>()); }
+
+    private:
+        mutable std::shared_ptr<const Table> _table;
+    };
+
+    /** This function discards the lazily calculated total mass, central potential, total potential energy, isotropic total integrated binding energy and isotropic total kinetic energy of the model, and the table of the batched function rmax(), and deselects the tables of the distribution function. It should be called by every function that changes the parameters of the model, and is called by the functions that change its integrators. */
+    void invalidate_invariants();
+
+    /** This function returns the integral of the function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, using the integrator and the split radii of the model. Depending on the relative tolerance, the integral is estimated using the fixed Gauss-Legendre or the adaptive Gauss-Kronrod routine. If a Clenshaw-Curtis integrator has been selected for the global properties, the integral is estimated using that integrator instead. */
+    template<typename Function> double integrate_0_infty(const Function& X) const;
+
+    /** This function returns the integral of the function \f$X(u)\f$ over the interval \f$[0,r]\f$, as in the function integrate_0_infty(). If a tanh-sinh integrator is given, the integral is estimated using that integrator instead, which splits the interval at the scale radius only. */
+    template<typename Function> double integrate_0_r(const Function& X, double r, const TanhSinh* ts = nullptr) const;
+
+    /** This function returns the integral of the function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, as in the function integrate_0_r(). */
+    template<typename Function> double integrate_r_infty(const Function& X, double r, const TanhSinh* ts = nullptr) const;
+
+    /** This function returns the integral of the batched function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, as in the function integrate_0_infty(). If the model has a stretched exponential tail, the outer segment is integrated using a Gauss-Laguerre rule. In adaptive mode, and with a tanh-sinh integrator, the integrand is called for one node at a time. */
+    double integrate_0_infty_batch(std::function<void(const double* u, double* X, size_t n)> X) const;
+
+    /** This function returns the integral of the batched function \f$X(u)\f$ over the interval \f$[0,r]\f$, as in the function integrate_0_infty_batch(). If a tanh-sinh integrator is given, the integral is estimated using that integrator instead. */
+    double integrate_0_r_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const TanhSinh* ts = nullptr) const;
+
+    /** This function returns the integral of the batched function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, as in the function integrate_0_r_batch(). */
+    double integrate_r_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, const TanhSinh* ts = nullptr) const;
+
+    /** This function returns the Abel-type integral of the batched function \f$X(u)\f$ with the kernel \f$(u^2-r^2)^{-1/2}\f$ over the interval \f$[r,+\infty[\f$. By default, the integral is estimated using the function GaussLegendre::integrate_abel(), which builds the kernel into the quadrature rule, with a Gauss-Laguerre rule on the outer segment if the model has a stretched exponential tail. In adaptive mode, or if a tanh-sinh integrator has been selected for the Abel-type integrals, the kernel is evaluated as part of the integrand. */
+    double integrate_abel_batch(std::function<void(const double* u, double* X, size_t n)> X, double r) const;
+
+    /** This function estimates the integrals of num batched functions \f$X_j(u)\f$ over the interval \f$[r,+\infty[\f$ at once and stores them in the array result, as in the function GaussLegendre::integrate_r_infty_batch() with num integrands. In adaptive mode, and with a tanh-sinh integrator, each integral is estimated separately as in the function integrate_r_infty_batch(). */
+    void integrate_r_infty_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, size_t num, double* result, const TanhSinh* ts = nullptr) const;
+
+    /** This function estimates the Abel-type integrals of num batched functions \f$X_j(u)\f$ at once and stores them in the array result, as in the function GaussLegendre::integrate_abel_batch() with num integrands. In adaptive mode, and with a tanh-sinh integrator, each integral is estimated separately as in the function integrate_abel_batch(). */
+    void integrate_abel_batch(std::function<void(const double* u, double* X, size_t n)> X, double r, size_t num, double* result) const;
+
+    /** This function returns true if the outer asymptotic expansion of the density applies at radius \f$r\f$, and stores the integral \f[ \int_r^\infty u^s\, \rho(u)\, [M(u)]^e\, (u^2-r^2)^\nu\, {\text{d}}u \f] with \f$e=0\f$ or \f$e=1\f$ in result in that case. The integral is calculated term by term from the expansion; the mass is expanded as \f$M(u) = M_{\text{tot}} - 4\pi\int_u^\infty \rho(v)\,v^2\,{\text{d}}v\f$. */
+    bool outer_integral(double r, double s, int e, double nu, double& result) const;
+
+    /** This function returns true if the inner asymptotic expansion of the density applies at radius \f$r\f$, and stores the integral \f[ \int_0^r u^s\, \rho(u)\, {\text{d}}u \f] in result in that case. */
+    bool inner_integral(double r, double s, double& result) const;
+
+    /** This function returns the first coefficients of the binomial series of \f$A\,(1+y)^{-q}\f$ in powers of \f$y\f$. Together with a cutoff where \f$y\leq 0.1\f$, the truncated series is accurate to machine precision for all profiles of the form \f$x^{-p}\,(1+x^{\mp\alpha})^{-q}\f$ with moderate \f$q\f$. */
+    static std::vector<double> binomial_series(double A, double q);
+
+    /** This function returns the isotropic distribution function at radius \f$r\f$ for the moments of the distribution function, interpolated from the table if one has been selected, or calculated directly otherwise. */
+    double moment_isotropic_distribution_function(double r) const;
+
+    /** This function returns the Osipkov-Merritt distribution function at radius \f$r\f$ for anisotropy radius \f$r_{\text{a}}\f$ for the moments of the distribution function, as in the function moment_isotropic_distribution_function(). */
+    double moment_osipkov_merritt_distribution_function(double r, double ra) const;
+
+    /** This function stores the sorted radii at which the integrals of the model are split, i.e. the scale radius together with the breakpoints and the additional split radii of the model, without duplicates, in the vector sv. It returns false if the model has no such radii other than the scale radius, in which case the integrals are split at the scale radius only, using the integration routines for a single break radius. Since most models have no breakpoints, that case is detected before any radii are stored or sorted, such that the innermost integrals do not pay for the splitting. */
+    bool split_radii(std::vector<double>& sv) const;
+
+    /** The Gauss-Legendre integrator. */
     const GaussLegendre* _gl;
+
+    /** The relative tolerance for the adaptive integration routines, or zero for fixed Gauss-Legendre quadrature. */
+    double _reltol = 0.0;
+
+    /** The tanh-sinh integrator for the Abel-type integrals, or a null pointer. */
+    const TanhSinh* _abelts = nullptr;
+
+    /** The tanh-sinh integrator for the Eddington-type integrals, or a null pointer. */
+    const TanhSinh* _eddingtonts = nullptr;
+
+    /** The nested Clenshaw-Curtis integrator for the integrals over the interval \f$[0,+\infty[\f$, or a null pointer. */
+    const ClenshawCurtis* _globalcc = nullptr;
+
+    /** The additional radii at which the integrals are split. */
+    std::vector<double> _splitv;
+
+    /** The table of the isotropic distribution function, or a null pointer. */
+    const DistributionFunctionTable* _isodf = nullptr;
+
+    /** The table of the Osipkov-Merritt distribution function, or a null pointer. */
+    const DistributionFunctionTable* _omdf = nullptr;
+
+    /** The lazily calculated total mass, for the subclasses that calculate it numerically. */
+    Invariant _Mtotmemo;
+
+    /** The lazily calculated central potential, for the subclasses that calculate it numerically. */
+    Invariant _Psi0memo;
+
+    /** The lazily calculated total potential energy. */
+    Invariant _Wmemo;
+
+    /** The lazily calculated isotropic total integrated binding energy. */
+    Invariant _Eisomemo;
+
+    /** The lazily calculated isotropic total kinetic energy. */
+    Invariant _Tisomemo;
+
+    /** The lazily calculated table of the mass and the potential for the batched function rmax(). */
+    ProfileTable _rmaxmemo;
 };
 
 //////////////////////////////////////////////////////////////////////
 
+template<typename Function> double Model::integrate_0_infty(const Function& X) const
+{
+    if (_globalcc)
+    {
+        auto batch = [&](const double* u, double* f, size_t n) { for (size_t i=0; i<n; i++) f[i] = X(u[i]); };
+        return _globalcc->integrate_0_infty(batch,scale_radius());
+    }
+    std::vector<double> sv;
+    if (split_radii(sv))
+    {
+        if (_reltol>0.0) return _gl->integrate_0_infty_adaptive(X,sv,_reltol);
+        auto batch = [&](const double* u, double* f, size_t n) { for (size_t i=0; i<n; i++) f[i] = X(u[i]); };
+        return _gl->integrate_0_infty_batch(batch,sv);
+    }
+    if (_reltol>0.0) return _gl->integrate_0_infty_adaptive(X,scale_radius(),_reltol);
+    return _gl->integrate_0_infty(X,scale_radius());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Function> double Model::integrate_0_r(const Function& X, double r, const TanhSinh* ts) const
+{
+    if (ts) return ts->integrate_0_r(X,r,scale_radius());
+    std::vector<double> sv;
+    if (split_radii(sv))
+    {
+        if (_reltol>0.0) return _gl->integrate_0_r_adaptive(X,r,sv,_reltol);
+        auto batch = [&](const double* u, double* f, size_t n) { for (size_t i=0; i<n; i++) f[i] = X(u[i]); };
+        return _gl->integrate_0_r_batch(batch,r,sv);
+    }
+    if (_reltol>0.0) return _gl->integrate_0_r_adaptive(X,r,scale_radius(),_reltol);
+    return _gl->integrate_0_r(X,r,scale_radius());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+template<typename Function> double Model::integrate_r_infty(const Function& X, double r, const TanhSinh* ts) const
+{
+    if (ts) return ts->integrate_r_infty(X,r,scale_radius());
+    std::vector<double> sv;
+    if (split_radii(sv))
+    {
+        if (_reltol>0.0) return _gl->integrate_r_infty_adaptive(X,r,sv,_reltol);
+        auto batch = [&](const double* u, double* f, size_t n) { for (size_t i=0; i<n; i++) f[i] = X(u[i]); };
+        return _gl->integrate_r_infty_batch(batch,r,sv);
+    }
+    if (_reltol>0.0) return _gl->integrate_r_infty_adaptive(X,r,scale_radius(),_reltol);
+    return _gl->integrate_r_infty(X,r,scale_radius());
+}
+
+//////////////////////////////////////////////////////////////////////
+
 #endif
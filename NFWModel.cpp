@@ -9,13 +9,28 @@
 //////////////////////////////////////////////////////////////////////
 
 NFWModel::NFWModel(double Mvir, double rs, double c, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mvir, rs, c);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void NFWModel::set_parameters(double Mvir, double rs, double c)
 {
     _Mvir = Mvir;
     _rs = rs;
     _c = c;
     _rvir = _rs*_c;
     _rhoff = 1.0 / (4.0*M_PI*(log(1.0+_c)-_c/(1.0+_c)));
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> NFWModel::parameters() const
+{
+    return {_Mvir, _rs, _c};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -27,6 +42,28 @@ double NFWModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool NFWModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = 10.0;
+    p = 3.0;
+    alpha = 1.0;
+    av = binomial_series(_Mvir/pow(_rs,3)*_rhoff, 2.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool NFWModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = 0.1;
+    p = 1.0;
+    alpha = 1.0;
+    av = binomial_series(_Mvir/pow(_rs,3)*_rhoff, 2.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double NFWModel::density(double r) const
 {
     double dimf = _Mvir/pow(_rs,3);
@@ -37,6 +74,13 @@ double NFWModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void NFWModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = NFWModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double NFWModel::derivative_density(double r) const
 {
     double dimf = _Mvir/pow(_rs,4);
@@ -9,6 +9,14 @@
 //////////////////////////////////////////////////////////////////////
 
 NukerModel::NukerModel(double Mtot, double Rb, double alpha, double beta, double gamma, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, Rb, alpha, beta, gamma);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void NukerModel::set_parameters(double Mtot, double Rb, double alpha, double beta, double gamma)
 {
     _Mtot = Mtot;
     _Rb = Rb;
@@ -19,7 +27,14 @@ NukerModel::NukerModel(double Mtot, double Rb, double alpha, double beta, double
     double lg2 = lgamma((_beta-2.0)/_alpha);
     double lg3 = lgamma((2.0-_gamma)/_alpha);
     _Sigmab = _Mtot/(_Rb*_Rb) * exp(lg1-lg2-lg3) * _alpha / pow(2.0,(_beta-_gamma)/_alpha) / (2.0*M_PI);
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> NukerModel::parameters() const
+{
+    return {_Mtot, _Rb, _alpha, _beta, _gamma};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -52,6 +67,13 @@ double NukerModel::derivative_surface_density(double R) const
 
 //////////////////////////////////////////////////////////////////////
 
+void NukerModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = NukerModel::derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double NukerModel::second_derivative_surface_density(double R) const
 {
     double t = R/_Rb;
@@ -9,10 +9,25 @@
 //////////////////////////////////////////////////////////////////////
 
 PerfectSphereModel::PerfectSphereModel(double Mtot, double c, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, c);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void PerfectSphereModel::set_parameters(double Mtot, double c)
 {
     _Mtot = Mtot;
     _c = c;
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> PerfectSphereModel::parameters() const
+{
+    return {_Mtot, _c};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -24,6 +39,28 @@ double PerfectSphereModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool PerfectSphereModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = sqrt(10.0);
+    p = 4.0;
+    alpha = 2.0;
+    av = binomial_series(_Mtot/pow(_c,3)/(M_PI*M_PI), 2.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool PerfectSphereModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = sqrt(0.1);
+    p = 0.0;
+    alpha = 2.0;
+    av = binomial_series(_Mtot/pow(_c,3)/(M_PI*M_PI), 2.0);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double PerfectSphereModel::density(double r) const
 {
     double dimf = _Mtot/pow(_c,3);
@@ -34,6 +71,13 @@ double PerfectSphereModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void PerfectSphereModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = PerfectSphereModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double PerfectSphereModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_c,4);
@@ -9,10 +9,25 @@
 //////////////////////////////////////////////////////////////////////
 
 PlummerModel::PlummerModel(double Mtot, double c, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, c);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void PlummerModel::set_parameters(double Mtot, double c)
 {
     _Mtot = Mtot;
     _c = c;
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> PlummerModel::parameters() const
+{
+    return {_Mtot, _c};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -24,6 +39,28 @@ double PlummerModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool PlummerModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = sqrt(10.0);
+    p = 5.0;
+    alpha = 2.0;
+    av = binomial_series(_Mtot/pow(_c,3)*3.0/(4.0*M_PI), 2.5);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool PlummerModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = sqrt(0.1);
+    p = 0.0;
+    alpha = 2.0;
+    av = binomial_series(_Mtot/pow(_c,3)*3.0/(4.0*M_PI), 2.5);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double PlummerModel::density(double r) const
 {
     double dimf = _Mtot/pow(_c,3);
@@ -34,6 +71,13 @@ double PlummerModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void PlummerModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = PlummerModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double PlummerModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_c,4);
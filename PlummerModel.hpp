@@ -20,12 +20,27 @@ public:
     /** Constructor of the PlummerModel class. */
     PlummerModel(double Mtot, double c, const GaussLegendre* gl);
 
+    /** This function changes the parameters of the PlummerModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double c);
+
+    /** This function returns the parameters of the PlummerModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
+
     /** This function returns the scale radius \f$c\f$ of the Plummer model. */
     double scale_radius() const;
 
+    /** This function returns the outer asymptotic expansion of the density of the Plummer model, which follows from the binomial series of \f$\rho(r) \propto x^{-5}\,(1+x^{-2})^{-5/2}\f$ in powers of \f$x^{-2}\f$. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the Plummer model, which follows from the binomial series of \f$\rho(r) \propto (1+x^2)^{-5/2}\f$ in powers of \f$x^{2}\f$. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
     /** This function returns the density \f$\rho(r)\f$ of the Plummer model at radius \f$r\f$. */
     double density(double r) const;
 
+    /** This function stores the density \f$\rho(r_i)\f$ of the Plummer model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the Plummer model at radius \f$r\f$. */
     double derivative_density(double r) const;
 
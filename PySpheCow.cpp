@@ -145,78 +145,78 @@ static PyObject *run_model(PyObject *self, PyObject *args, PyObject *kwargs)
         // std::cout << "radii:";
         // for (size_t i = 0; i < radius.size(); ++i) std::cout << " " << radii[i];
         // std::cout << std::endl;
-        GaussLegendre *gl = new GaussLegendre(128);
+        GaussLegendre gl(128);
         Model *model = nullptr;
         if (modelName == "BPLModel")
             model = new BPLModel(getDictElement(modelParameters, "Mtot"),
                                getDictElement(modelParameters, "rb"),
                                getDictElement(modelParameters, "beta"),
-                               getDictElement(modelParameters, "gamma"), gl);
+                               getDictElement(modelParameters, "gamma"), &gl);
         else if (modelName == "BurkertModel")
             model = new BurkertModel(getDictElement(modelParameters, "rhos"),
-                                     getDictElement(modelParameters, "rs"), gl);
+                                     getDictElement(modelParameters, "rs"), &gl);
         else if (modelName == "DeVaucouleursModel")
             model = new DeVaucouleursModel(getDictElement(modelParameters, "Mtot"),
-                                         getDictElement(modelParameters, "Reff"), gl);
+                                         getDictElement(modelParameters, "Reff"), &gl);
         else if (modelName == "EinastoModel")
             model = new EinastoModel(getDictElement(modelParameters, "Mtot"),
                                    getDictElement(modelParameters, "rh"),
-                                   getDictElement(modelParameters, "n"), gl);
+                                   getDictElement(modelParameters, "n"), &gl);
         else if (modelName == "GammaModel")
             model = new GammaModel(getDictElement(modelParameters, "Mtot"),
                                  getDictElement(modelParameters, "b"),
-                                 getDictElement(modelParameters, "gamma"), gl);
+                                 getDictElement(modelParameters, "gamma"), &gl);
         else if (modelName == "HernquistModel")
             model = new HernquistModel(getDictElement(modelParameters, "Mtot"),
-                                     getDictElement(modelParameters, "b"), gl);
+                                     getDictElement(modelParameters, "b"), &gl);
         else if (modelName == "HypervirialModel")
             model = new HypervirialModel(getDictElement(modelParameters, "Mtot"),
                                        getDictElement(modelParameters, "rs"),
-                                       getDictElement(modelParameters, "p"), gl);
+                                       getDictElement(modelParameters, "p"), &gl);
         else if (modelName == "IsochroneModel")
             model = new IsochroneModel(getDictElement(modelParameters, "Mtot"),
-                                     getDictElement(modelParameters, "b"), gl);
+                                     getDictElement(modelParameters, "b"), &gl);
         else if (modelName == "JaffeModel")
             model = new JaffeModel(getDictElement(modelParameters, "Mtot"),
-                                 getDictElement(modelParameters, "b"), gl);
+                                 getDictElement(modelParameters, "b"), &gl);
         else if (modelName == "NFWModel")
             model = new NFWModel(getDictElement(modelParameters, "Mvir"),
                                getDictElement(modelParameters, "rs"),
-                               getDictElement(modelParameters, "c"), gl);
+                               getDictElement(modelParameters, "c"), &gl);
         else if (modelName == "NukerModel")
             model = new NukerModel(getDictElement(modelParameters, "Mtot"),
                                  getDictElement(modelParameters, "Rb"),
                                  getDictElement(modelParameters, "alpha"),
                                  getDictElement(modelParameters, "beta"),
-                                 getDictElement(modelParameters, "gamma"), gl);
+                                 getDictElement(modelParameters, "gamma"), &gl);
         else if (modelName == "PerfectSphereModel")
             model = new PerfectSphereModel(getDictElement(modelParameters, "Mtot"),
-                                         getDictElement(modelParameters, "c"), gl);
+                                         getDictElement(modelParameters, "c"), &gl);
         else if (modelName == "PlummerModel")
             model = new PlummerModel(getDictElement(modelParameters, "Mtot"),
-                                   getDictElement(modelParameters, "c"), gl);
+                                   getDictElement(modelParameters, "c"), &gl);
         else if (modelName == "SersicModel")
             model = new SersicModel(getDictElement(modelParameters, "Mtot"),
                                   getDictElement(modelParameters, "Reff"),
-                                  getDictElement(modelParameters, "m"), gl);
+                                  getDictElement(modelParameters, "m"), &gl);
         else if (modelName == "SigmoidDensityModel")
             model = new SigmoidDensityModel(getDictElement(modelParameters, "Mtot"),
                                           getDictElement(modelParameters, "rb"),
                                           getDictElement(modelParameters, "alpha"),
                                           getDictElement(modelParameters, "beta"),
-                                          getDictElement(modelParameters, "gamma"), gl);
+                                          getDictElement(modelParameters, "gamma"), &gl);
         else if (modelName == "SigmoidSurfaceDensityModel")
             model = new SigmoidSurfaceDensityModel(getDictElement(modelParameters, "Mtot"),
                                                  getDictElement(modelParameters, "Rb"),
                                                  getDictElement(modelParameters, "alpha"),
                                                  getDictElement(modelParameters, "beta"),
-                                                 getDictElement(modelParameters, "gamma"), gl);
+                                                 getDictElement(modelParameters, "gamma"), &gl);
         else if (modelName == "ZhaoModel")
             model = new ZhaoModel(getDictElement(modelParameters, "Mtot"),
                                 getDictElement(modelParameters, "rb"),
                                 getDictElement(modelParameters, "alpha"),
                                 getDictElement(modelParameters, "beta"),
-                                getDictElement(modelParameters, "gamma"), gl);
+                                getDictElement(modelParameters, "gamma"), &gl);
         else
         {
             std::stringstream message;
@@ -238,23 +238,21 @@ static PyObject *run_model(PyObject *self, PyObject *args, PyObject *kwargs)
             osipkov_merritt_distribution_function(rsize),
             osipkov_merritt_pseudo_density_of_states(rsize),
             osipkov_merritt_pseudo_differential_energy_distribution(rsize);
+        model->mass_and_potential_profiles(radius, mass, potential);
         for (size_t i = 0; i < rsize; ++i)
         {
             const double r = radius[i];
             density[i] = model->density(r);
             density_slope[i] = model->density_slope(r);
-            mass[i] = model->mass(r);
-            circular_velocity[i] = model->circular_velocity(r);
+            circular_velocity[i] = mass[i] / r;
             surface_density[i] = model->surface_density(r);
             surface_density_slope[i] = model->surface_density_slope(r);
             surface_mass[i] = model->surface_mass(r);
-            potential[i] = model->potential(r);
-            isotropic_dispersion[i] = model->isotropic_dispersion(r);
+            model->radial_dispersions(r, ra, isotropic_dispersion[i], osipkov_merritt_radial_dispersion[i]);
             isotropic_projected_dispersion[i] = model->isotropic_projected_dispersion(r);
             isotropic_distribution_function[i] = model->isotropic_distribution_function(r);
             isotropic_density_of_states[i] = model->isotropic_density_of_states(r);
             isotropic_differential_energy_distribution[i] = isotropic_distribution_function[i] * isotropic_density_of_states[i];
-            osipkov_merritt_radial_dispersion[i] = model->osipkov_merritt_radial_dispersion(r, ra);
             osipkov_merritt_tangential_dispersion[i] = model->osipkov_merritt_tangential_dispersion(r, ra);
             osipkov_merritt_projected_dispersion[i] = model->osipkov_merritt_projected_dispersion(r, ra);
             osipkov_merritt_distribution_function[i] = model->osipkov_merritt_distribution_function(r, ra);
@@ -262,7 +260,6 @@ static PyObject *run_model(PyObject *self, PyObject *args, PyObject *kwargs)
             osipkov_merritt_pseudo_differential_energy_distribution[i] = osipkov_merritt_distribution_function[i] * osipkov_merritt_pseudo_density_of_states[i];
         }
         delete model;
-        delete gl;
         PyObject *outputDictionary = PyDict_New();
         PyDict_SetItemString(outputDictionary, "radius", packNumpyArray(radius));
         PyDict_SetItemString(outputDictionary, "density", packNumpyArray(density));
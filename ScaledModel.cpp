@@ -0,0 +1,384 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "ScaledModel.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+ScaledModel::ScaledModel(const Model* model, double mu, double lambda, const GaussLegendre* gl)
+{
+    _model = model;
+    _gl = gl;
+    _reltol = model->relative_tolerance();
+    set_parameters(mu, lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::set_parameters(double mu, double lambda)
+{
+    _mu = mu;
+    _lambda = lambda;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> ScaledModel::parameters() const
+{
+    std::vector<double> parameters = {_mu, _lambda};
+    std::vector<double> wrapped = _model->parameters();
+    parameters.insert(parameters.end(), wrapped.begin(), wrapped.end());
+    return parameters;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::mass_factor() const
+{
+    return _mu;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::length_factor() const
+{
+    return _lambda;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::unscale(const double* r, size_t n, std::vector<double>& u) const
+{
+    u.resize(n);
+    for (size_t i=0; i<n; i++) u[i] = r[i]/_lambda;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::scale_radius() const
+{
+    return _lambda * _model->scale_radius();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool ScaledModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    if (!_model->exponential_tail(b,r0,m)) return false;
+    r0 *= _lambda;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> ScaledModel::breakpoints() const
+{
+    std::vector<double> rbv = _model->breakpoints();
+    for (double& rbp : rbv) rbp *= _lambda;
+    return rbv;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool ScaledModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    if (!_model->outer_expansion(xt,p,alpha,av)) return false;
+    for (double& a : av) a *= _mu/(_lambda*_lambda*_lambda);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool ScaledModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    if (!_model->inner_expansion(xs,p,alpha,av)) return false;
+    for (double& a : av) a *= _mu/(_lambda*_lambda*_lambda);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::total_mass() const
+{
+    return _mu * _model->total_mass();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::total_potential_energy() const
+{
+    return _mu*_mu/_lambda * _model->total_potential_energy();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::density(double r) const
+{
+    return _mu/(_lambda*_lambda*_lambda) * _model->density(r/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::density(const double* r, double* out, size_t n) const
+{
+    std::vector<double> u;
+    unscale(r,n,u);
+    _model->density(u.data(),out,n);
+    double factor = _mu/(_lambda*_lambda*_lambda);
+    for (size_t i=0; i<n; i++) out[i] *= factor;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::derivative_density(double r) const
+{
+    return _mu/(_lambda*_lambda*_lambda*_lambda) * _model->derivative_density(r/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::derivative_density(const double* r, double* out, size_t n) const
+{
+    std::vector<double> u;
+    unscale(r,n,u);
+    _model->derivative_density(u.data(),out,n);
+    double factor = _mu/(_lambda*_lambda*_lambda*_lambda);
+    for (size_t i=0; i<n; i++) out[i] *= factor;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::second_derivative_density(double r) const
+{
+    return _mu/(_lambda*_lambda*_lambda*_lambda*_lambda) * _model->second_derivative_density(r/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::second_derivative_density(const double* r, double* out, size_t n) const
+{
+    std::vector<double> u;
+    unscale(r,n,u);
+    _model->second_derivative_density(u.data(),out,n);
+    double factor = _mu/(_lambda*_lambda*_lambda*_lambda*_lambda);
+    for (size_t i=0; i<n; i++) out[i] *= factor;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::mass(double r) const
+{
+    return _mu * _model->mass(r/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::mass(const double* r, double* out, size_t n) const
+{
+    std::vector<double> u;
+    unscale(r,n,u);
+    _model->mass(u.data(),out,n);
+    for (size_t i=0; i<n; i++) out[i] *= _mu;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::potential(double r) const
+{
+    return _mu/_lambda * _model->potential(r/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::potential(const double* r, double* out, size_t n) const
+{
+    std::vector<double> u;
+    unscale(r,n,u);
+    _model->potential(u.data(),out,n);
+    double factor = _mu/_lambda;
+    for (size_t i=0; i<n; i++) out[i] *= factor;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    std::vector<double> u;
+    unscale(rv.data(),rv.size(),u);
+    _model->mass_and_potential_profiles(u,Mv,Psiv);
+    for (double& M : Mv) M *= _mu;
+    for (double& Psi : Psiv) Psi *= _mu/_lambda;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::central_potential() const
+{
+    return _mu/_lambda * _model->central_potential();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::rmax(double E) const
+{
+    return _lambda * _model->rmax(E*_lambda/_mu);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::rmax(const double* E, double* out, size_t n) const
+{
+    std::vector<double> Ev(n);
+    for (size_t i=0; i<n; i++) Ev[i] = E[i]*_lambda/_mu;
+    _model->rmax(Ev.data(),out,n);
+    for (size_t i=0; i<n; i++) out[i] *= _lambda;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::surface_density(double R) const
+{
+    return _mu/(_lambda*_lambda) * _model->surface_density(R/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::surface_density(const double* R, double* out, size_t n) const
+{
+    std::vector<double> u;
+    unscale(R,n,u);
+    _model->surface_density(u.data(),out,n);
+    double factor = _mu/(_lambda*_lambda);
+    for (size_t i=0; i<n; i++) out[i] *= factor;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::derivative_surface_density(double R) const
+{
+    return _mu/(_lambda*_lambda*_lambda) * _model->derivative_surface_density(R/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    std::vector<double> u;
+    unscale(R,n,u);
+    _model->derivative_surface_density(u.data(),out,n);
+    double factor = _mu/(_lambda*_lambda*_lambda);
+    for (size_t i=0; i<n; i++) out[i] *= factor;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::surface_density_slope(double R) const
+{
+    return _model->surface_density_slope(R/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::surface_mass(double R) const
+{
+    return _mu * _model->surface_mass(R/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::isotropic_dispersion(double r) const
+{
+    return _mu/_lambda * _model->isotropic_dispersion(r/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::isotropic_projected_dispersion(double R) const
+{
+    return _mu/_lambda * _model->isotropic_projected_dispersion(R/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::isotropic_distribution_function(double r) const
+{
+    return _model->isotropic_distribution_function(r/_lambda) / sqrt(_mu*_lambda*_lambda*_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::isotropic_density_of_states(double r) const
+{
+    return sqrt(_mu*_lambda*_lambda*_lambda*_lambda*_lambda) * _model->isotropic_density_of_states(r/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::isotropic_total_integrated_binding_energy() const
+{
+    return _mu*_mu/_lambda * _model->isotropic_total_integrated_binding_energy();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::isotropic_total_kinetic_energy() const
+{
+    return _mu*_mu/_lambda * _model->isotropic_total_kinetic_energy();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::osipkov_merritt_radial_dispersion(double r, double ra) const
+{
+    return _mu/_lambda * _model->osipkov_merritt_radial_dispersion(r/_lambda, ra/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ScaledModel::radial_dispersions(double r, double ra, double& disp_iso, double& dispr_om) const
+{
+    _model->radial_dispersions(r/_lambda, ra/_lambda, disp_iso, dispr_om);
+    disp_iso *= _mu/_lambda;
+    dispr_om *= _mu/_lambda;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::osipkov_merritt_tangential_dispersion(double r, double ra) const
+{
+    return _mu/_lambda * _model->osipkov_merritt_tangential_dispersion(r/_lambda, ra/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::osipkov_merritt_projected_dispersion(double R, double ra) const
+{
+    return _mu/_lambda * _model->osipkov_merritt_projected_dispersion(R/_lambda, ra/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::osipkov_merritt_distribution_function(double r, double ra) const
+{
+    return _model->osipkov_merritt_distribution_function(r/_lambda, ra/_lambda) / sqrt(_mu*_lambda*_lambda*_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::osipkov_merritt_pseudo_density_of_states(double r, double ra) const
+{
+    return sqrt(_mu*_lambda*_lambda*_lambda*_lambda*_lambda) * _model->osipkov_merritt_pseudo_density_of_states(r/_lambda, ra/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double ScaledModel::osipkov_merritt_total_kinetic_energy(double ra) const
+{
+    return _mu*_mu/_lambda * _model->osipkov_merritt_total_kinetic_energy(ra/_lambda);
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,174 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef SCALEDMODEL_HPP
+#define SCALEDMODEL_HPP
+
+#include "Model.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** ScaledModel is a subclass of the Model class that represents a reference model with all masses multiplied by a factor \f$\mu\f$ and all lengths by a factor \f$\lambda\f$. In units with \f$G=1\f$, every property of a model then scales exactly with a power of these two factors, \f[ \rho(r) = \frac{\mu}{\lambda^3}\,\tilde\rho\left(\frac{r}{\lambda}\right), \quad M(r) = \mu\,\tilde M\left(\frac{r}{\lambda}\right), \quad \Psi(r) = \frac{\mu}{\lambda}\,\tilde\Psi\left(\frac{r}{\lambda}\right), \quad \Sigma(R) = \frac{\mu}{\lambda^2}\,\tilde\Sigma\left(\frac{R}{\lambda}\right), \quad \sigma^2(r) = \frac{\mu}{\lambda}\,\tilde\sigma^2\left(\frac{r}{\lambda}\right), \f] \f[ f({\cal{E}}) = \left(\mu\,\lambda^3\right)^{-1/2} \tilde f\left(\frac{\lambda}{\mu}\,{\cal{E}}\right), \quad g({\cal{E}}) = \left(\mu\,\lambda^5\right)^{1/2} \tilde g\left(\frac{\lambda}{\mu}\,{\cal{E}}\right), \quad W_{\text{tot}} = \frac{\mu^2}{\lambda}\,\tilde W_{\text{tot}}, \f] with the tilde denoting the properties of the reference model, and with the anisotropy radius of the Osipkov-Merritt orbital structure scaled as a length. The scaled model forwards every property for which such a scaling exists to the reference model at the scaled radius, anisotropy radius or binding energy, and rescales the result; only the consistency checks, such as the density calculated from the distribution function, are calculated by the Model base class from the scaled profiles.
+
+    If the reference model is the unit model of a family, with total mass 1 and scale radius 1, the factors \f$\mu\f$ and \f$\lambda\f$ are simply the total mass and the scale radius of the scaled model. All models of a catalogue that share the same dimensionless shape can then share a single reference model, such that the nested integrals are only calculated for the distinct shapes: the global properties are calculated once by the reference model, which memoizes them, and the profiles can be served from a ChebyshevModel, TabulatedModel or CachedModel that wraps the unit model. The factors can be changed in place with the function set_parameters(), which costs nothing beyond the assignment of two numbers. */
+
+class ScaledModel : public Model
+{
+public:
+
+    /** Constructor of the ScaledModel class. It reads in the reference model, which should remain alive as long as the scaled model is used, the mass factor \f$\mu\f$, the length factor \f$\lambda\f$, and the Gauss-Legendre integrator for the integrals that are calculated by the scaled model itself. The relative tolerance of the reference model is adopted. */
+    ScaledModel(const Model* model, double mu, double lambda, const GaussLegendre* gl);
+
+    /** This function changes the mass factor \f$\mu\f$ and the length factor \f$\lambda\f$ of the ScaledModel object. */
+    void set_parameters(double mu, double lambda);
+
+    /** This function returns the mass factor \f$\mu\f$ and the length factor \f$\lambda\f$, followed by the parameters of the wrapped model. */
+    std::vector<double> parameters() const;
+
+    /** This function returns the mass factor \f$\mu\f$. */
+    double mass_factor() const;
+
+    /** This function returns the length factor \f$\lambda\f$. */
+    double length_factor() const;
+
+    /** This function returns the scale radius of the reference model, multiplied by \f$\lambda\f$. */
+    double scale_radius() const;
+
+    /** This function returns the stretched exponential tail of the reference model, if it has one, with the radius \f$r_0\f$ multiplied by \f$\lambda\f$. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+
+    /** This function returns the breakpoints of the reference model, multiplied by \f$\lambda\f$. */
+    std::vector<double> breakpoints() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the reference model, if it has one, with the coefficients multiplied by \f$\mu/\lambda^3\f$. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the reference model, if it has one, with the coefficients multiplied by \f$\mu/\lambda^3\f$. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the total mass \f$M_{\text{tot}}\f$. */
+    double total_mass() const;
+
+    /** This function returns the total potential energy \f$W_{\text{tot}}\f$. */
+    double total_potential_energy() const;
+
+    /** This function returns the density \f$\rho(r)\f$ at radius \f$r\f$. */
+    double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the derivative of the density \f$\rho'(r)\f$ at radius \f$r\f$. */
+    double derivative_density(double r) const;
+
+    /** This function stores the derivative of the density \f$\rho'(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the second derivative of the density \f$\rho''(r)\f$ at radius \f$r\f$. */
+    double second_derivative_density(double r) const;
+
+    /** This function stores the second derivative of the density \f$\rho''(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void second_derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the mass \f$M(r)\f$ at radius \f$r\f$. */
+    double mass(double r) const;
+
+    /** This function stores the mass \f$M(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void mass(const double* r, double* out, size_t n) const;
+
+    /** This function returns the potential \f$\Psi(r)\f$ at radius \f$r\f$. */
+    double potential(double r) const;
+
+    /** This function stores the potential \f$\Psi(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void potential(const double* r, double* out, size_t n) const;
+
+    /** This function calculates the mass and the potential at the radii in the vector rv with the function mass_and_potential_profiles() of the reference model. */
+    void mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
+
+    /** This function returns the central potential \f$\Psi_0\f$. */
+    double central_potential() const;
+
+    /** This function returns the maximum radius \f$r_{\text{max}}({\cal{E}})\f$ that can be reached by a particle with binding energy \f${\cal{E}}\f$. */
+    double rmax(double E) const;
+
+    /** This function stores the maximum radius \f$r_{\text{max}}({\cal{E}}_i)\f$ for the \f$n\f$ binding energies \f${\cal{E}}_i\f$ in the array out. */
+    void rmax(const double* E, double* out, size_t n) const;
+
+    /** This function returns the surface density \f$\Sigma(R)\f$ at projected radius \f$R\f$. */
+    double surface_density(double R) const;
+
+    /** This function stores the surface density \f$\Sigma(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ at projected radius \f$R\f$. */
+    double derivative_surface_density(double R) const;
+
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the surface density slope \f$\gamma_{\text{p}}(R)\f$ at projected radius \f$R\f$. */
+    double surface_density_slope(double R) const;
+
+    /** This function returns the surface mass \f$M_{\text{p}}(R)\f$ at projected radius \f$R\f$. */
+    double surface_mass(double R) const;
+
+    /** This function returns the isotropic velocity dispersion \f$\sigma^2_{\text{iso}}(r)\f$ at radius \f$r\f$. */
+    double isotropic_dispersion(double r) const;
+
+    /** This function returns the isotropic projected velocity dispersion \f$\sigma^2_{\text{p,iso}}(R)\f$ at projected radius \f$R\f$. */
+    double isotropic_projected_dispersion(double R) const;
+
+    /** This function returns the isotropic distribution function \f$f_{\text{iso}}({\cal{E}})\f$ at binding energy \f${\cal{E}}=\Psi(r)\f$. */
+    double isotropic_distribution_function(double r) const;
+
+    /** This function returns the isotropic density-of-states function \f$g_{\text{iso}}({\cal{E}})\f$ at binding energy \f${\cal{E}}=\Psi(r)\f$. */
+    double isotropic_density_of_states(double r) const;
+
+    /** This function returns the isotropic total integrated binding energy \f${\cal{E}}_{\text{tot}}\f$. */
+    double isotropic_total_integrated_binding_energy() const;
+
+    /** This function returns the isotropic total kinetic energy \f$T_{\text{tot}}\f$. */
+    double isotropic_total_kinetic_energy() const;
+
+    /** This function returns the Osipkov-Merritt radial velocity dispersion \f$\sigma^2_{r,\text{om}}(r)\f$ at radius \f$r\f$ for anisotropy radius \f$r_{\text{a}}\f$. */
+    double osipkov_merritt_radial_dispersion(double r, double ra) const;
+
+    /** This function calculates both the isotropic velocity dispersion and the Osipkov-Merritt radial velocity dispersion at radius \f$r\f$ for anisotropy radius \f$r_{\text{a}}\f$, and stores them in disp_iso and dispr_om. */
+    void radial_dispersions(double r, double ra, double& disp_iso, double& dispr_om) const;
+
+    /** This function returns the Osipkov-Merritt tangential velocity dispersion \f$\sigma^2_{\theta,\text{om}}(r)\f$ at radius \f$r\f$ for anisotropy radius \f$r_{\text{a}}\f$. */
+    double osipkov_merritt_tangential_dispersion(double r, double ra) const;
+
+    /** This function returns the Osipkov-Merritt projected velocity dispersion \f$\sigma^2_{\text{p,om}}(R)\f$ at projected radius \f$R\f$ for anisotropy radius \f$r_{\text{a}}\f$. */
+    double osipkov_merritt_projected_dispersion(double R, double ra) const;
+
+    /** This function returns the Osipkov-Merritt distribution function \f$f_{\text{om}}(Q)\f$ at \f$Q=\Psi(r)\f$ for anisotropy radius \f$r_{\text{a}}\f$. */
+    double osipkov_merritt_distribution_function(double r, double ra) const;
+
+    /** This function returns the Osipkov-Merritt pseudo-density-of-states function \f$g_{\text{om}}(Q)\f$ at \f$Q=\Psi(r)\f$ for anisotropy radius \f$r_{\text{a}}\f$. */
+    double osipkov_merritt_pseudo_density_of_states(double r, double ra) const;
+
+    /** This function returns the Osipkov-Merritt total kinetic energy \f$T_{\text{tot}}\f$ for anisotropy radius \f$r_{\text{a}}\f$. */
+    double osipkov_merritt_total_kinetic_energy(double ra) const;
+
+private:
+
+    /** This function stores the \f$n\f$ radii \f$r_i\f$ divided by \f$\lambda\f$ in the vector u. */
+    void unscale(const double* r, size_t n, std::vector<double>& u) const;
+
+    /** The reference model. */
+    const Model* _model;
+
+    /** The mass factor \f$\mu\f$. */
+    double _mu;
+
+    /** The length factor \f$\lambda\f$. */
+    double _lambda;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
@@ -5,49 +5,67 @@
 ///////////////////////////////////////////////////////////////// */
 
 #include "SersicModel.hpp"
-#include <fstream>
+#include "SersicbTable.hpp"
+#include "IncompleteGamma.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // This function looks up the exact value of b for the Sérsic index m in the table, and returns false if m does not
+    // lie on the grid of the table
+    bool tabulated_b(double m, double& b)
+    {
+        double x = (m-SersicbTable::mmin)/SersicbTable::dm;
+        if (!(x>-0.5 && x<SersicbTable::num-0.5)) return false;
+        int j = static_cast<int>(lround(x));
+        if (fabs(m-(SersicbTable::mmin+j*SersicbTable::dm))>=1e-9) return false;
+        b = SersicbTable::b[j];
+        return true;
+    }
+
+    // This function returns an initial guess for b for the Sérsic index m, interpolated linearly in ln b from the table
+    // within its range, or zero beyond, which selects the default initial guess of the solver
+    double initial_b(double m)
+    {
+        double x = (m-SersicbTable::mmin)/SersicbTable::dm;
+        if (!(x>=0.0 && x<=SersicbTable::num-1)) return 0.0;
+        int j = min(static_cast<int>(x), SersicbTable::num-2);
+        double h = x-j;
+        return exp((1.0-h)*log(SersicbTable::b[j]) + h*log(SersicbTable::b[j+1]));
+    }
+}
 
 //////////////////////////////////////////////////////////////////////
 
 SersicModel::SersicModel(double Mtot, double Reff, double m, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, Reff, m);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void SersicModel::set_parameters(double Mtot, double Reff, double m)
 {
     _Mtot = Mtot;
     _Reff = Reff;
     _m = m;
 
-    // Determine the value of b. First search if from the file Sersicb.txt that
-    // lists exact values for all m between 0.01 and 10 with a spacing of 0.001.
-    
-    std::ifstream file("Sersicb.txt");
-    bool bset = false;
-    double mf, bf;
-    for (int j=0; j<9990; j++)
-    {
-        file >> mf >> bf;
-        if (fabs(_m-mf)<1e-9)
-        {
-            _b = bf;
-            bset = true;
-            break;
-        }
-    }
+    // Determine the value of b. First look it up in the table of exact values for
+    // all m between 0.01 and 10 with a spacing of 0.001. If m is not in the table,
+    // solve the equation P(2m,b) = 1/2 for b, starting from the table.
     
-    // If b is not yet set (it is not in the file), determine the value using the
-    // approximations from Ciotti & Bertin (1999) for m>1, or from
-    // Baes & Ciotti (2019) for m>1.
-    
-    if (!bset)
-    {
-        double m2 = m*m;
-        if (m<1)
-            _b = pow(1.0/sqrt(2.0)-0.45807*m+1.83247*m2
-                         -1.2556*m2*m+0.85239*m2*m2,1.0/m);
-        else
-            _b = 2.0*m - 1.0/3.0 + 4.0/(405.0*m) + 46.0/(25515*m2)
-                 + 131.0/(1148175*m*m2) - 2194697.0/(30690717750.0*m2*m2);
-    }
+    if (!tabulated_b(_m,_b)) _b = IncompleteGamma::median(2.0*_m, initial_b(_m));
     _Sigma0 = _Mtot/(_Reff*_Reff) * pow(_b,2.0*m)/(2.0*M_PI*m*tgamma(2.0*m));
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> SersicModel::parameters() const
+{
+    return {_Mtot, _Reff, _m};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -59,6 +77,16 @@ double SersicModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool SersicModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    b = _b;
+    r0 = _Reff;
+    m = _m;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double SersicModel::surface_density(double R) const
 {
     double t = R/_Reff;
@@ -79,6 +107,13 @@ double SersicModel::derivative_surface_density(double R) const
 
 //////////////////////////////////////////////////////////////////////
 
+void SersicModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = SersicModel::derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double SersicModel::second_derivative_surface_density(double R) const
 {
     double t = R/_Reff;
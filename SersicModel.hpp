@@ -19,16 +19,28 @@ public:
     
     /** Constructor of the SersicModel class. */
     SersicModel(double Mtot, double Reff, double m, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the SersicModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double Reff, double m);
+
+    /** This function returns the parameters of the SersicModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the effective radius \f$R_{\text{eff}}\f$ of the Sérsic model. */
     double scale_radius() const;
     
+    /** This function returns true, since the density of the Sérsic model decays as \f$\exp[-b\,(r/R_{\text{eff}})^{1/m}]\f$ at large radii, and stores the corresponding parameters. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+    
     /** This function returns the surface density \f$\Sigma(R)\f$ of the Sérsic model at projected radius \f$R\f$. */
     double surface_density(double R) const;
 
     /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ of the Sérsic model at projected radius \f$R\f$. */
     double derivative_surface_density(double R) const;
 
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ of the Sérsic model at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
+
     /** This function returns the second derivative of the surface density \f$\Sigma''(R)\f$ of the Sérsic model at projected radius \f$R\f$. */
     double second_derivative_surface_density(double R) const;
     
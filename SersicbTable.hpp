@@ -0,0 +1,2531 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef SERSICBTABLE_HPP
+#define SERSICBTABLE_HPP
+
+//////////////////////////////////////////////////////////////////////
+
+/** The SersicbTable namespace holds the exact values of the parameter \f$b\f$ of the Sérsic model for all Sérsic indices \f$m\f$ between 0.01 and 10 with a spacing of 0.001, as listed in the file Sersicb.txt, such that the values are compiled into the program and can be looked up by index rather than read from the file. */
+
+namespace SersicbTable
+{
+    /** The first Sérsic index of the table. */
+    constexpr double mmin = 0.01;
+
+    /** The spacing of the Sérsic indices in the table. */
+    constexpr double dm = 0.001;
+
+    /** The number of entries of the table. */
+    constexpr int num = 9991;
+
+    /** The values \f$b(m_j)\f$ at the Sérsic indices \f$m_j = m_{\text{min}} + j\,\Delta m\f$. */
+    constexpr double b[num] =
+    {
+        5.068667656480179e-16, 1.185528643625239e-14, 1.640121144316509e-13, 1.515001529792002e-12,
+        1.018860314662025e-11, 5.315541430882275e-11, 2.256247804921395e-10, 8.080587145762708e-10,
+        2.511960781545083e-9, 6.931141276049513e-9, 1.728164683942606e-8, 3.950400818203739e-8,
+        8.377547976683606e-8, 1.664415900749869e-7, 3.123324954801849e-7, 5.573878440746243e-7,
+        9.514803426678875e-7, 1.561306878819319e-6, 2.473208220389393e-6, 3.795783164619852e-6,
+        5.66217821782892e-6, 8.23195638452473e-6, 0.00001169247523043319, 0.0000162597321660866,
+        0.00002217866154482347, 0.00002972289200442855, 0.0000391939924656674, 0.00005092025084681645,
+        0.00006525504081071542, 0.00008257483899425781, 0.0001032769586467747, 0.0001277770659999994,
+        0.0001565065436218003, 0.0001899097610673379, 0.0002284413078845058, 0.000272563237936635,
+        0.0003227423674784072, 0.0003794476627866105, 0.0004431477466579149, 0.0005143085469271419,
+        0.0005933911044602259, 0.0006808495529170897, 0.0007771292780032761, 0.0008826652599474679,
+        0.0009978805995443014, 0.001123185225261011, 0.001258974776584131, 0.001405629656933503,
+        0.001563514248046367, 0.001732976276684551, 0.00191434632379367, 0.002107937465798117,
+        0.002314045037505696, 0.002532946506081062, 0.002764901445691529, 0.003010151602700153,
+        0.003268921041651156, 0.00354141636273719, 0.003827826981935736, 0.004128325465535333,
+        0.004443067911326483, 0.004772194369294731, 0.005115829295214653, 0.005474082031095299,
+        0.005847047306963862, 0.006234805758990218, 0.006637424459447037, 0.007054957454466026,
+        0.007487446305988891, 0.007934920634721157, 0.008397398661277634, 0.00887488774306047,
+        0.009367384904734926, 0.009874877360465091, 0.01039734302634294, 0.01093475102169059,
+        0.01148706215813859, 0.01205422941558436, 0.01263619840431533, 0.01323290781274285,
+        0.01384428984033687, 0.01447027061547869, 0.01511077059806175, 0.01576570496676916,
+        0.01643498399104281, 0.01711851338783412, 0.01781619466329058, 0.01852792543958775,
+        0.01925359976716327, 0.01999310842264831, 0.02074633919282484, 0.02151317714496321,
+        0.02229350488391584, 0.02308720279635898, 0.02389414928258678, 0.0247142209762702,
+        0.02554729295259852, 0.02639323892522352, 0.02725193143242636, 0.02812324201292481,
+        0.02900704137173457, 0.02990319953649283, 0.03081158600464504, 0.03173206988188836,
+        0.03266452001225578, 0.03360880510021585, 0.03456479382515236, 0.03553235494857779,
+        0.03651135741442357, 0.03750167044273865, 0.0385031636171169, 0.03951570696616227,
+        0.04053917103928929, 0.04157342697714534, 0.04261834657692969, 0.04367380235287341,
+        0.04473966759213348, 0.0458158164063436, 0.04690212377905397, 0.04799846560928221,
+        0.04910471875138756, 0.05022076105147123, 0.05134647138049619, 0.05248172966431111,
+        0.05362641691075409, 0.05478041523400388, 0.05594360787633794, 0.05711587922744917,
+        0.05829711484146565, 0.05948720145181046, 0.06068602698403207, 0.06189348056672903,
+        0.06310945254068639, 0.06433383446633556, 0.06556651912964307, 0.06680740054652881,
+        0.0680563739659085, 0.06931333587145059, 0.07057818398213278, 0.0718508172516788,
+        0.0731311358669519, 0.07441904124537723, 0.07571443603146138, 0.07701722409247376,
+        0.07832731051335066, 0.07964460159087971, 0.08096900482721916, 0.08230042892280318,
+        0.08363878376868185, 0.0849839804383413, 0.08633593117904721, 0.08769454940275227,
+        0.08905974967660569, 0.09043144771310092, 0.09180956035989542, 0.09319400558933425,
+        0.09458470248770762, 0.09598157124427046, 0.09738453314005046, 0.09879351053646954,
+        0.1002084268638019, 0.1016292066094909, 0.1030557753063443, 0.1044880595206286,
+        0.1059259868400792, 0.1073694858618433, 0.1088184861803719, 0.1102729183752754,
+        0.111732713999156, 0.11319780556543, 0.1146681265361522, 0.1161436113098527,
+        0.1176241952093979, 0.119109814469883, 0.120600406226567, 0.1220959085028573,
+        0.1235962601983516, 0.1251014010769447, 0.1266112717550061, 0.1281258136896338,
+        0.1296449691669917, 0.1311686812907338, 0.1326968939705198, 0.134229551910628,
+        0.1357666005986672, 0.1373079862943927, 0.1388536560186279, 0.1404035575422962,
+        0.1419576393755639, 0.1435158507570971, 0.1450781416434353, 0.1466444626984811,
+        0.1482147652831108, 0.1497890014449035, 0.1513671239079933, 0.152949086063042,
+        0.1545348419573363, 0.1561243462850075, 0.1577175543773753, 0.1593144221934155,
+        0.1609149063103519, 0.1625189639143729, 0.1641265527914705, 0.1657376313184049,
+        0.1673521584537911, 0.1689700937293088, 0.1705913972410347, 0.1722160296408965,
+        0.1738439521282482, 0.1754751264415651, 0.1771095148502587, 0.1787470801466107,
+        0.1803877856378233, 0.1820315951381878, 0.1836784729613681, 0.1853283839127984,
+        0.1869812932821958, 0.188637166836184, 0.1902959708110291, 0.1919576719054853,
+        0.1936222372737495, 0.1952896345185235, 0.1969598316841828, 0.1986327972500508,
+        0.2003085001237769, 0.2019869096348166, 0.2036679955280143, 0.205351727957285,
+        0.2070380774793956, 0.2087270150478436, 0.2104185120068316, 0.2121125400853373,
+        0.213809071391277, 0.2155080784057613, 0.217209533977442, 0.2189134113169483,
+        0.2206196839914128, 0.2223283259190829, 0.2240393113640197, 0.2257526149308808,
+        0.2274682115597864, 0.2291860765212684, 0.2309061854112996, 0.2326285141464032,
+        0.2343530389588401, 0.2360797363918746, 0.2378085832951154, 0.2395395568199317,
+        0.2412726344149431, 0.2430077938215821, 0.2447450130697285, 0.2464842704734133,
+        0.2482255446265926, 0.2499688143989893, 0.2517140589320017, 0.2534612576346781,
+        0.2552103901797571, 0.25696143649977, 0.2587143767832081, 0.26046919147075,
+        0.2622258612515506, 0.2639843670595902, 0.2657446900700811, 0.2675068116959335,
+        0.2692707135842775, 0.2710363776130408, 0.2728037858875824, 0.2745729207373793,
+        0.2763437647127672, 0.2781163005817334, 0.2798905113267604, 0.2816663801417213,
+        0.2834438904288243, 0.2852230257956055, 0.2870037700519716, 0.2887861072072876,
+        0.2905700214675129, 0.2923554972323823, 0.2941425190926318, 0.2959310718272688,
+        0.2977211404008862, 0.2995127099610185, 0.30130576583554, 0.3031002935301051,
+        0.3048962787256281, 0.3066937072758036, 0.3084925652046659, 0.3102928387041871,
+        0.3120945141319132, 0.3138975780086368, 0.3157020170161079, 0.3175078179947789,
+        0.3193149679415866, 0.3211234540077683, 0.3229332634967122, 0.3247443838618412,
+        0.3265568027045309, 0.3283705077720585, 0.3301854869555851, 0.3320017282881688,
+        0.3338192199428088, 0.3356379502305197, 0.3374579075984366, 0.3392790806279479,
+        0.3411014580328591, 0.3429250286575829, 0.3447497814753592, 0.3465757055865008,
+        0.3484027902166674, 0.3502310247151653, 0.352060398553274, 0.3538909013225976,
+        0.3557225227334421, 0.3575552526132173, 0.3593890809048627, 0.3612239976652983,
+        0.363059993063898, 0.3648970573809871, 0.3667351810063617, 0.3685743544378313,
+        0.3704145682797829, 0.3722558132417676, 0.3740980801371073, 0.3759413598815233,
+        0.3777856434917858, 0.3796309220843823, 0.3814771868742075, 0.3833244291732719,
+        0.3851726403894301, 0.3870218120251279, 0.388871935676168, 0.3907230030304943,
+        0.3925750058669942, 0.3944279360543185, 0.3962817855497192, 0.3981365463979034,
+        0.3999922107299061, 0.4018487707619771, 0.4037062187944865, 0.4055645472108453,
+        0.4074237484764413, 0.4092838151375918, 0.4111447398205108, 0.4130065152302913,
+        0.4148691341499029, 0.4167325894392035, 0.4185968740339655, 0.4204619809449165,
+        0.4223279032567932, 0.4241946341274094, 0.4260621667867375, 0.4279304945360031,
+        0.4297996107467926, 0.4316695088601737, 0.4335401823858284, 0.4354116249011986,
+        0.4372838300506436, 0.4391567915446099, 0.441030503158813, 0.4429049587334298,
+        0.4447801521723043, 0.4466560774421626, 0.4485327285718401, 0.4504100996515198,
+        0.4522881848319805, 0.4541669783238561, 0.4560464743969054, 0.4579266673792919,
+        0.4598075516568737, 0.4616891216725036, 0.4635713719253383, 0.4654542969701583,
+        0.4673378914166964, 0.4692221499289755, 0.4711070672246562, 0.4729926380743932,
+        0.4748788573012002, 0.4767657197798237, 0.4786532204361262, 0.4805413542464766,
+        0.4824301162371501, 0.4843195014837356, 0.4862095051105514, 0.4881001222900691,
+        0.4899913482423453, 0.4918831782344603, 0.4937756075799661, 0.4956686316383397,
+        0.4975622458144458, 0.4994564455580054, 0.5013512263630726, 0.5032465837675171,
+        0.5051425133525153, 0.5070390107420471, 0.5089360716023996, 0.510833691641678,
+        0.5127318666093222, 0.5146305922956308, 0.5165298645312903, 0.5184296791869119,
+        0.5203300321725731, 0.5222309194373664, 0.5241323369689534, 0.5260342807931253,
+        0.5279367469733682, 0.5298397316104354, 0.5317432308419244, 0.53364724084186,
+        0.5355517578202821, 0.53745677802284, 0.539362297730391, 0.5412683132586048,
+        0.5431748209575725, 0.5450818172114218, 0.5469892984379355, 0.5488972610881767,
+        0.5508057016461173, 0.5527146166282725, 0.5546240025833392, 0.5565338560918397,
+        0.5584441737657692, 0.5603549522482485, 0.5622661882131806, 0.5641778783649127,
+        0.5660900194379006, 0.5680026081963798, 0.5699156414340386, 0.5718291159736965,
+        0.5737430286669868, 0.5756573763940425, 0.5775721560631865, 0.579487364610626,
+        0.5814029990001501, 0.5833190562228319, 0.5852355332967339, 0.5871524272666169,
+        0.5890697352036534, 0.5909874542051433, 0.5929055813942346, 0.594824113919646,
+        0.5967430489553945, 0.5986623837005251, 0.6005821153788446, 0.6025022412386586,
+        0.6044227585525112, 0.6063436646169288, 0.608264956752166, 0.6101866323019559,
+        0.6121086886332619, 0.6140311231360342, 0.6159539332229677, 0.6178771163292643,
+        0.6198006699123966, 0.6217245914518762, 0.6236488784490229, 0.6255735284267386,
+        0.6274985389292821, 0.6294239075220483, 0.6313496317913488, 0.6332757093441959,
+        0.6352021378080885, 0.6371289148308016, 0.6390560380801773, 0.6409835052439187,
+        0.6429113140293863, 0.6448394621633971, 0.6467679473920253, 0.6486967674804062,
+        0.6506259202125418, 0.6525554033911093, 0.6544852148372713, 0.6564153523904885,
+        0.6583458139083348, 0.660276597266314, 0.6622077003576793, 0.6641391210932547,
+        0.6660708574012579, 0.6680029072271266, 0.6699352685333453, 0.6718679392992752,
+        0.6738009175209857, 0.6757342012110878, 0.6776677883985696, 0.6796016771286334,
+        0.681535865462535, 0.6834703514774251, 0.6854051332661916, 0.6873402089373047,
+        0.6892755766146631, 0.6912112344374425, 0.6931471805599453, 0.6950834131514527,
+        0.6970199303960775, 0.6989567304926197, 0.7008938116544229, 0.7028311721092326,
+        0.7047688100990563, 0.7067067238800251, 0.7086449117222564, 0.710583371909719,
+        0.7125221027400989, 0.7144611025246671, 0.716400369588149, 0.7183399022685945,
+        0.7202796989172505, 0.7222197578984343, 0.7241600775894084, 0.726100656380257,
+        0.7280414926737634, 0.7299825848852896, 0.7319239314426558, 0.7338655307860232,
+        0.735807381367776, 0.7377494816524064, 0.7396918301164001, 0.7416344252481228,
+        0.7435772655477087, 0.7455203495269495, 0.7474636757091853, 0.749407242629196,
+        0.7513510488330944, 0.7532950928782204, 0.7552393733330358, 0.7571838887770214,
+        0.7591286378005737, 0.7610736190049042, 0.7630188310019388, 0.7649642724142186,
+        0.7669099418748018, 0.7688558380271668, 0.7708019595251159, 0.7727483050326807,
+        0.7746948732240277, 0.7766416627833655, 0.778588672404853, 0.7805359007925084,
+        0.7824833466601188, 0.7844310087311516, 0.7863788857386662, 0.7883269764252269,
+        0.7902752795428165, 0.7922237938527512, 0.794172518125596, 0.7961214511410813,
+        0.7980705916880199, 0.8000199385642257, 0.8019694905764327, 0.8039192465402143,
+        0.805869205279905, 0.8078193656285212, 0.8097697264276842, 0.811720286527543,
+        0.8136710447866985, 0.8156220000721283, 0.8175731512591124, 0.8195244972311592,
+        0.8214760368799332, 0.8234277691051822, 0.8253796928146667, 0.8273318069240885,
+        0.8292841103570213, 0.8312366020448414, 0.833189280926659, 0.8351421459492508,
+        0.8370951960669925, 0.8390484302417928, 0.8410018474430273, 0.8429554466474739,
+        0.8449092268392479, 0.8468631870097387, 0.8488173261575463, 0.8507716432884195,
+        0.8527261374151931, 0.8546808075577279, 0.8566356527428489, 0.8585906720042865,
+        0.8605458643826163, 0.8625012289252005, 0.8644567646861302, 0.8664124707261673,
+        0.8683683461126874, 0.8703243899196241, 0.8722806012274123, 0.8742369791229332,
+        0.8761935226994597, 0.8781502310566019, 0.8801071033002535, 0.8820641385425386,
+        0.8840213359017594, 0.8859786945023434, 0.8879362134747926, 0.8898938919556318,
+        0.8918517290873581, 0.8938097240183913, 0.8957678759030237, 0.8977261839013713,
+        0.8996846471793251, 0.9016432649085028, 0.9036020362662015, 0.90556096043535,
+        0.9075200366044624, 0.9094792639675916, 0.9114386417242836, 0.9133981690795318,
+        0.9153578452437324, 0.9173176694326393, 0.9192776408673209, 0.9212377587741154,
+        0.9231980223845882, 0.9251584309354887, 0.9271189836687082, 0.9290796798312376,
+        0.9310405186751258, 0.9330014994574385, 0.9349626214402174, 0.9369238838904396,
+        0.9388852860799779, 0.9408468272855606, 0.9428085067887327, 0.9447703238758165,
+        0.9467322778378734, 0.9486943679706654, 0.9506565935746177, 0.9526189539547807,
+        0.9545814484207931, 0.9565440762868451, 0.958506836871642, 0.9604697294983683,
+        0.9624327534946513, 0.9643959081925264, 0.9663591929284016, 0.9683226070430228,
+        0.9702861498814394, 0.9722498207929704, 0.97421361913117, 0.9761775442537946,
+        0.9781415955227697, 0.9801057723041566, 0.9820700739681201, 0.9840344998888961,
+        0.9859990494447599, 0.9879637220179942, 0.9899285169948577, 0.9918934337655546,
+        0.9938584717242027, 0.995823630268804, 0.9977889088012138, 0.9997543067271107,
+        1.001719823455967, 1.00368545840102, 1.005651210979241, 1.007617080611309,
+        1.00958306672158, 1.011549168738058, 1.013515386092369, 1.015481718219734,
+        1.017448164558938, 1.019414724552302, 1.021381397645664, 1.02334818328834,
+        1.025315080933107, 1.027282090036173, 1.029249210057151, 1.031216440459033,
+        1.033183780708163, 1.035151230274215, 1.037118788630165, 1.039086455252267,
+        1.041054229620026, 1.04302211121618, 1.044990099526665, 1.046958194040601,
+        1.048926394250263, 1.050894699651057, 1.0528631097415, 1.054831624023192,
+        1.056800242000796, 1.058768963182016, 1.060737787077571, 1.062706713201174,
+        1.064675741069511, 1.066644870202217, 1.068614100121857, 1.070583430353899,
+        1.072552860426697, 1.074522389871469, 1.076492018222275, 1.078461745015996,
+        1.080431569792313, 1.082401492093687, 1.084371511465338, 1.086341627455227,
+        1.088311839614031, 1.090282147495128, 1.092252550654576, 1.094223048651091,
+        1.09619364104603, 1.098164327403372, 1.100135107289697, 1.102105980274169,
+        1.104076945928515, 1.106048003827011, 1.108019153546456, 1.109990394666162,
+        1.111961726767931, 1.113933149436035, 1.115904662257206, 1.117876264820611,
+        1.119847956717837, 1.121819737542874, 1.123791606892098, 1.125763564364252,
+        1.127735609560434, 1.129707742084071, 1.131679961540914, 1.133652267539011,
+        1.135624659688697, 1.137597137602577, 1.139569700895507, 1.14154234918458,
+        1.143515082089112, 1.145487899230623, 1.147460800232821, 1.149433784721591,
+        1.151406852324976, 1.153380002673164, 1.155353235398469, 1.157326550135322,
+        1.159299946520251, 1.161273424191868, 1.163246982790857, 1.165220621959955,
+        1.167194341343942, 1.169168140589623, 1.171142019345817, 1.17311597726334,
+        1.175090013994995, 1.177064129195554, 1.179038322521748, 1.181012593632252,
+        1.182986942187669, 1.184961367850523, 1.186935870285238, 1.188910449158131,
+        1.190885104137398, 1.192859834893097, 1.19483464109714, 1.196809522423278,
+        1.19878447854709, 1.200759509145967, 1.202734613899106, 1.204709792487489,
+        1.206685044593879, 1.208660369902803, 1.210635768100543, 1.212611238875121,
+        1.214586781916289, 1.216562396915519, 1.218538083565987, 1.220513841562566,
+        1.222489670601812, 1.224465570381952, 1.226441540602875, 1.228417580966122,
+        1.230393691174868, 1.23236987093392, 1.234346119949701, 1.236322437930238,
+        1.238298824585156, 1.240275279625663, 1.242251802764542, 1.24422839371614,
+        1.246205052196356, 1.248181777922634, 1.250158570613948, 1.252135429990798,
+        1.254112355775194, 1.25608934769065, 1.258066405462171, 1.260043528816246,
+        1.262020717480837, 1.26399797118537, 1.265975289660723, 1.26795267263922,
+        1.269930119854618, 1.271907631042101, 1.273885205938269, 1.275862844281126,
+        1.277840545810078, 1.279818310265916, 1.281796137390812, 1.283774026928309,
+        1.28575197862331, 1.287729992222071, 1.289708067472195, 1.291686204122615,
+        1.293664401923596, 1.295642660626718, 1.297620979984871, 1.299599359752247,
+        1.301577799684331, 1.303556299537892, 1.305534859070974, 1.307513478042891,
+        1.309492156214217, 1.311470893346776, 1.313449689203639, 1.315428543549109,
+        1.317407456148721, 1.319386426769227, 1.321365455178594, 1.323344541145993,
+        1.325323684441791, 1.327302884837547, 1.329282142105999, 1.331261456021063,
+        1.333240826357819, 1.335220252892508, 1.337199735402525, 1.339179273666408,
+        1.341158867463835, 1.343138516575612, 1.345118220783671, 1.347097979871061,
+        1.34907779362194, 1.351057661821568, 1.353037584256302, 1.355017560713588,
+        1.356997590981955, 1.358977674851005, 1.360957812111412, 1.36293800255491,
+        1.364918245974289, 1.366898542163389, 1.368878890917093, 1.370859292031317,
+        1.37283974530301, 1.374820250530144, 1.376800807511707, 1.378781416047698,
+        1.380762075939121, 1.382742786987978, 1.384723548997264, 1.38670436177096,
+        1.388685225114026, 1.390666138832398, 1.392647102732979, 1.394628116623635,
+        1.396609180313188, 1.398590293611412, 1.400571456329022, 1.402552668277677,
+        1.404533929269966, 1.406515239119408, 1.408496597640443, 1.410478004648426,
+        1.412459459959626, 1.414440963391216, 1.41642251476127, 1.418404113888753,
+        1.420385760593525, 1.422367454696326, 1.424349196018775, 1.426330984383365,
+        1.428312819613457, 1.430294701533275, 1.432276629967901, 1.434258604743268,
+        1.436240625686159, 1.438222692624198, 1.440204805385845, 1.442186963800396,
+        1.444169167697972, 1.446151416909517, 1.448133711266793, 1.450116050602375,
+        1.452098434749646, 1.454080863542792, 1.456063336816799, 1.458045854407444,
+        1.460028416151297, 1.462011021885708, 1.463993671448812, 1.465976364679515,
+        1.467959101417496, 1.4699418815032, 1.471924704777833, 1.47390757108336,
+        1.475890480262498, 1.477873432158712, 1.479856426616211, 1.481839463479946,
+        1.483822542595601, 1.485805663809592, 1.487788826969063, 1.489772031921881,
+        1.491755278516629, 1.493738566602606, 1.495721896029823, 1.497705266648996,
+        1.499688678311541, 1.501672130869575, 1.503655624175908, 1.505639158084041,
+        1.507622732448159, 1.509606347123132, 1.511590001964505, 1.513573696828501,
+        1.51555743157201, 1.517541206052592, 1.519525020128468, 1.521508873658518,
+        1.523492766502278, 1.525476698519936, 1.527460669572327, 1.529444679520931,
+        1.531428728227869, 1.533412815555897, 1.535396941368406, 1.537381105529416,
+        1.539365307903575, 1.541349548356152, 1.543333826753035, 1.545318142960729,
+        1.547302496846349, 1.549286888277622, 1.551271317122877, 1.553255783251048,
+        1.555240286531665, 1.557224826834856, 1.559209404031338, 1.561194017992418,
+        1.563178668589988, 1.565163355696524, 1.567148079185078, 1.569132838929278,
+        1.571117634803327, 1.573102466681994, 1.575087334440616, 1.577072237955091,
+        1.57905717710188, 1.581042151757999, 1.583027161801016, 1.585012207109051,
+        1.586997287560773, 1.588982403035394, 1.590967553412666, 1.592952738572883,
+        1.594937958396872, 1.596923212765993, 1.598908501562137, 1.600893824667721,
+        1.602879181965686, 1.604864573339494, 1.606849998673124, 1.608835457851073,
+        1.61082095075835, 1.612806477280471, 1.614792037303463, 1.616777630713854,
+        1.618763257398677, 1.620748917245459, 1.622734610142229, 1.624720335977504,
+        1.626706094640295, 1.6286918860201, 1.630677710006904, 1.632663566491172,
+        1.634649455363852, 1.636635376516368, 1.63862132984062, 1.640607315228981,
+        1.642593332574292, 1.644579381769863, 1.646565462709469, 1.648551575287348,
+        1.650537719398197, 1.652523894937172, 1.654510101799881, 1.656496339882388,
+        1.658482609081207, 1.660468909293299, 1.662455240416069, 1.664441602347369,
+        1.666427994985488, 1.668414418229157, 1.67040087197754, 1.672387356130236,
+        1.674373870587277, 1.676360415249123, 1.678346990016661, 1.680333594791202,
+        1.682320229474482, 1.684306893968655, 1.686293588176294, 1.688280312000388,
+        1.69026706534434, 1.692253848111964, 1.694240660207483, 1.69622750153553,
+        1.698214372001139, 1.70020127150975, 1.702188199967203, 1.704175157279738,
+        1.706162143353989, 1.708149158096988, 1.710136201416157, 1.712123273219311,
+        1.714110373414652, 1.716097501910769, 1.718084658616636, 1.720071843441609,
+        1.722059056295425, 1.724046297088199, 1.726033565730424, 1.728020862132967,
+        1.730008186207068, 1.731995537864338, 1.733982917016757, 1.735970323576672,
+        1.737957757456795, 1.739945218570202, 1.741932706830331, 1.743920222150978,
+        1.745907764446299, 1.747895333630804, 1.749882929619358, 1.751870552327179,
+        1.753858201669836, 1.755845877563244, 1.757833579923668, 1.759821308667718,
+        1.761809063712345, 1.763796844974847, 1.765784652372855, 1.767772485824345,
+        1.769760345247626, 1.771748230561343, 1.773736141684474, 1.775724078536328,
+        1.777712041036546, 1.779700029105095, 1.781688042662269, 1.783676081628689,
+        1.785664145925296, 1.787652235473357, 1.789640350194455, 1.791628490010494,
+        1.793616654843694, 1.795604844616591, 1.797593059252033, 1.799581298673184,
+        1.801569562803514, 1.803557851566805, 1.805546164887147, 1.807534502688935,
+        1.809522864896867, 1.811511251435947, 1.81349966223148, 1.815488097209068,
+        1.817476556294616, 1.819465039414322, 1.821453546494683, 1.823442077462489,
+        1.825430632244821, 1.827419210769054, 1.829407812962851, 1.831396438754165,
+        1.833385088071233, 1.835373760842582, 1.83736245699702, 1.839351176463639,
+        1.841339919171812, 1.843328685051193, 1.845317474031712, 1.84730628604358,
+        1.849295121017283, 1.851283978883579, 1.853272859573503, 1.855261763018359,
+        1.857250689149724, 1.859239637899444, 1.861228609199631, 1.863217602982665,
+        1.865206619181193, 1.867195657728124, 1.869184718556632, 1.871173801600149,
+        1.873162906792373, 1.875152034067255, 1.877141183359009, 1.879130354602103,
+        1.88111954773126, 1.883108762681459, 1.885097999387931, 1.887087257786158,
+        1.889076537811875, 1.891065839401065, 1.893055162489957, 1.89504450701503,
+        1.897033872913009, 1.89902326012086, 1.901012668575797, 1.903002098215274,
+        1.904991548976986, 1.906981020798868, 1.908970513619095, 1.910960027376079,
+        1.912949562008469, 1.914939117455149, 1.916928693655238, 1.918918290548087,
+        1.920907908073282, 1.922897546170636, 1.924887204780196, 1.926876883842236,
+        1.928866583297258, 1.930856303085991, 1.932846043149388, 1.934835803428631,
+        1.936825583865121, 1.938815384400484, 1.940805204976567, 1.942795045535437,
+        1.944784906019382, 1.946774786370906, 1.948764686532733, 1.950754606447802,
+        1.952744546059267, 1.954734505310498, 1.956724484145077, 1.958714482506798,
+        1.960704500339669, 1.962694537587905, 1.964684594195933, 1.966674670108388,
+        1.968664765270112, 1.970654879626154, 1.972645013121769, 1.974635165702414,
+        1.976625337313755, 1.978615527901656, 1.980605737412185, 1.98259596579161,
+        1.984586212986401, 1.986576478943224, 1.988566763608947, 1.990557066930631,
+        1.992547388855538, 1.994537729331121, 1.996528088305031, 1.998518465725111,
+        2.000508861539397, 2.002499275696118, 2.004489708143692, 2.00648015883073,
+        2.008470627706031, 2.010461114718581, 2.012451619817555, 2.014442142952316,
+        2.016432684072412, 2.018423243127574, 2.02041382006772, 2.022404414842951,
+        2.024395027403549, 2.026385657699981, 2.02837630568289, 2.030366971303104,
+        2.032357654511628, 2.034348355259646, 2.036339073498519, 2.038329809179785,
+        2.040320562255161, 2.042311332676535, 2.044302120395972, 2.04629292536571,
+        2.048283747538162, 2.05027458686591, 2.052265443301709, 2.054256316798487,
+        2.056247207309337, 2.058238114787526, 2.060229039186486, 2.062219980459819,
+        2.064210938561293, 2.066201913444841, 2.068192905064564, 2.070183913374726,
+        2.072174938329756, 2.074165979884245, 2.076157037992947, 2.078148112610779,
+        2.080139203692818, 2.082130311194301, 2.084121435070627, 2.086112575277351,
+        2.088103731770188, 2.090094904505011, 2.092086093437848, 2.094077298524886,
+        2.096068519722466, 2.098059756987083, 2.100051010275387, 2.102042279544183,
+        2.104033564750427, 2.106024865851228, 2.108016182803845, 2.110007515565691,
+        2.111998864094326, 2.113990228347461, 2.115981608282956, 2.11797300385882,
+        2.119964415033207, 2.121955841764421, 2.123947284010911, 2.125938741731271,
+        2.127930214884241, 2.129921703428705, 2.131913207323692, 2.133904726528372,
+        2.13589626100206, 2.137887810704212, 2.139879375594424, 2.141870955632435,
+        2.143862550778122, 2.145854160991505, 2.147845786232738, 2.149837426462117,
+        2.151829081640076, 2.153820751727183, 2.155812436684146, 2.157804136471807,
+        2.159795851051143, 2.161787580383269, 2.16377932442943, 2.165771083151008,
+        2.167762856509517, 2.169754644466602, 2.171746446984044, 2.17373826402375,
+        2.175730095547764, 2.177721941518255, 2.179713801897524, 2.181705676648002,
+        2.183697565732248, 2.185689469112948, 2.187681386752918, 2.189673318615098,
+        2.191665264662558, 2.193657224858491, 2.195649199166217, 2.19764118754918,
+        2.19963318997095, 2.20162520639522, 2.203617236785805, 2.205609281106645,
+        2.207601339321801, 2.209593411395457, 2.211585497291918, 2.213577596975608,
+        2.215569710411073, 2.217561837562979, 2.219553978396111, 2.221546132875373,
+        2.223538300965785, 2.225530482632489, 2.227522677840741, 2.229514886555915,
+        2.231507108743501, 2.233499344369106, 2.235491593398451, 2.237483855797373,
+        2.239476131531823, 2.241468420567865, 2.243460722871677, 2.245453038409553,
+        2.247445367147895, 2.249437709053219, 2.251430064092153, 2.253422432231437,
+        2.25541481343792, 2.257407207678561, 2.259399614920431, 2.261392035130708,
+        2.263384468276681, 2.265376914325747, 2.267369373245409, 2.269361845003279,
+        2.271354329567078, 2.273346826904631, 2.27533933698387, 2.277331859772833,
+        2.279324395239665, 2.281316943352612, 2.283309504080029, 2.285302077390372,
+        2.287294663252203, 2.289287261634185, 2.291279872505086, 2.293272495833774,
+        2.295265131589222, 2.297257779740503, 2.299250440256791, 2.30124311310736,
+        2.303235798261587, 2.305228495688948, 2.307221205359016, 2.309213927241467,
+        2.311206661306073, 2.313199407522707, 2.315192165861337, 2.31718493629203,
+        2.319177718784951, 2.321170513310361, 2.323163319838618, 2.325156138340174,
+        2.32714896878558, 2.32914181114548, 2.331134665390612, 2.333127531491812,
+        2.335120409420007, 2.337113299146219, 2.339106200641563, 2.341099113877248,
+        2.343092038824574, 2.345084975454935, 2.347077923739815, 2.349070883650792,
+        2.351063855159533, 2.353056838237797, 2.355049832857433, 2.35704283899038,
+        2.359035856608668, 2.361028885684414, 2.363021926189827, 2.365014978097203,
+        2.367008041378925, 2.369001116007467, 2.370994201955388, 2.372987299195337,
+        2.374980407700048, 2.376973527442341, 2.378966658395124, 2.38095980053139,
+        2.382952953824219, 2.384946118246774, 2.386939293772305, 2.388932480374146,
+        2.390925678025713, 2.39291888670051, 2.394912106372122, 2.396905337014218,
+        2.398898578600549, 2.400891831104951, 2.402885094501339, 2.404878368763713,
+        2.406871653866154, 2.408864949782823, 2.410858256487963, 2.412851573955899,
+        2.414844902161033, 2.41683824107785, 2.418831590680915, 2.420824950944871,
+        2.42281832184444, 2.424811703354425, 2.426805095449705, 2.428798498105239,
+        2.430791911296064, 2.432785334997293, 2.434778769184119, 2.436772213831809,
+        2.438765668915709, 2.440759134411242, 2.442752610293905, 2.444746096539272,
+        2.446739593122992, 2.448733100020792, 2.45072661720847, 2.452720144661902,
+        2.454713682357037, 2.456707230269898, 2.458700788376582, 2.460694356653261,
+        2.462687935076178, 2.464681523621651, 2.46667512226607, 2.468668730985898,
+        2.47066234975767, 2.472655978557992, 2.474649617363542, 2.476643266151072,
+        2.478636924897401, 2.480630593579421, 2.482624272174096, 2.484617960658458,
+        2.48661165900961, 2.488605367204725, 2.490599085221045, 2.492592813035882,
+        2.494586550626616, 2.496580297970696, 2.498574055045641, 2.500567821829037,
+        2.502561598298537, 2.504555384431864, 2.506549180206807, 2.508542985601222,
+        2.510536800593034, 2.512530625160232, 2.514524459280874, 2.516518302933081,
+        2.518512156095044, 2.520506018745017, 2.522499890861319, 2.524493772422338,
+        2.526487663406522, 2.528481563792388, 2.530475473558515, 2.532469392683548,
+        2.534463321146193, 2.536457258925224, 2.538451205999476, 2.540445162347847,
+        2.5424391279493, 2.544433102782859, 2.546427086827612, 2.548421080062708,
+        2.55041508246736, 2.552409094020842, 2.554403114702489, 2.556397144491699,
+        2.55839118336793, 2.560385231310701, 2.562379288299593, 2.564373354314247,
+        2.566367429334364, 2.568361513339706, 2.570355606310093, 2.572349708225407,
+        2.574343819065589, 2.576337938810637, 2.578332067440613, 2.580326204935632,
+        2.582320351275871, 2.584314506441566, 2.586308670413008, 2.58830284317055,
+        2.590297024694599, 2.592291214965623, 2.594285413964144, 2.596279621670744,
+        2.598273838066061, 2.600268063130788, 2.602262296845677, 2.604256539191536,
+        2.606250790149227, 2.60824504969967, 2.610239317823841, 2.612233594502769,
+        2.614227879717542, 2.616222173449299, 2.618216475679237, 2.620210786388607,
+        2.622205105558714, 2.624199433170917, 2.62619376920663, 2.628188113647321,
+        2.630182466474511, 2.632176827669775, 2.634171197214741, 2.636165575091091,
+        2.638159961280559, 2.640154355764933, 2.642148758526051, 2.644143169545807,
+        2.646137588806145, 2.648132016289061, 2.650126451976603, 2.652120895850872,
+        2.65411534789402, 2.656109808088248, 2.658104276415811, 2.660098752859013,
+        2.662093237400211, 2.66408773002181, 2.666082230706267, 2.668076739436089,
+        2.670071256193832, 2.672065780962104, 2.67406031372356, 2.676054854460907,
+        2.6780494031569, 2.680043959794342, 2.682038524356088, 2.68403309682504,
+        2.686027677184148, 2.688022265416412, 2.690016861504879, 2.692011465432646,
+        2.694006077182855, 2.696000696738698, 2.697995324083415, 2.699989959200292,
+        2.701984602072663, 2.703979252683909, 2.705973911017458, 2.707968577056784,
+        2.709963250785409, 2.711957932186901, 2.713952621244874, 2.715947317942989,
+        2.717942022264952, 2.719936734194514, 2.721931453715474, 2.723926180811675,
+        2.725920915467006, 2.7279156576654, 2.729910407390837, 2.73190516462734,
+        2.733899929358978, 2.735894701569864, 2.737889481244155, 2.739884268366053,
+        2.741879062919805, 2.743873864889699, 2.74586867426007, 2.747863491015295,
+        2.749858315139794, 2.751853146618032, 2.753847985434516, 2.755842831573797,
+        2.757837685020468, 2.759832545759164, 2.761827413774565, 2.763822289051392,
+        2.765817171574408, 2.767812061328419, 2.769806958298273, 2.771801862468859,
+        2.773796773825108, 2.775791692351994, 2.777786618034531, 2.779781550857774,
+        2.78177649080682, 2.783771437866808, 2.785766392022915, 2.787761353260363,
+        2.78975632156441, 2.791751296920358, 2.793746279313547, 2.795741268729359,
+        2.797736265153215, 2.799731268570576, 2.801726278966943, 2.803721296327858,
+        2.805716320638899, 2.807711351885687, 2.809706390053881, 2.811701435129178,
+        2.813696487097316, 2.81569154594407, 2.817686611655255, 2.819681684216724,
+        2.821676763614369, 2.82367184983412, 2.825666942861945, 2.82766204268385,
+        2.82965714928588, 2.831652262654117, 2.83364738277468, 2.835642509633727,
+        2.837637643217453, 2.83963278351209, 2.841627930503907, 2.84362308417921,
+        2.845618244524344, 2.847613411525688, 2.849608585169659, 2.851603765442711,
+        2.853598952331334, 2.855594145822053, 2.857589345901432, 2.859584552556069,
+        2.861579765772599, 2.863574985537692, 2.865570211838054, 2.867565444660428,
+        2.86956068399159, 2.871555929818354, 2.873551182127566, 2.875546440906111,
+        2.877541706140907, 2.879536977818906, 2.881532255927096, 2.883527540452501,
+        2.885522831382177, 2.887518128703216, 2.889513432402743, 2.891508742467919,
+        2.893504058885939, 2.89549938164403, 2.897494710729456, 2.89949004612951,
+        2.901485387831525, 2.903480735822862, 2.905476090090918, 2.907471450623124,
+        2.909466817406943, 2.911462190429871, 2.913457569679437, 2.915452955143204,
+        2.917448346808767, 2.919443744663753, 2.921439148695824, 2.923434558892672,
+        2.925429975242022, 2.927425397731632, 2.929420826349292, 2.931416261082822,
+        2.933411701920078, 2.935407148848944, 2.937402601857338, 2.939398060933209,
+        2.941393526064537, 2.943388997239335, 2.945384474445644, 2.947379957671541,
+        2.949375446905131, 2.95137094213455, 2.953366443347966, 2.955361950533577,
+        2.957357463679613, 2.959352982774333, 2.961348507806028, 2.963344038763019,
+        2.965339575633657, 2.967335118406322, 2.969330667069428, 2.971326221611414,
+        2.973321782020754, 2.975317348285947, 2.977312920395526, 2.979308498338052,
+        2.981304082102113, 2.983299671676331, 2.985295267049355, 2.987290868209863,
+        2.989286475146563, 2.991282087848192, 2.993277706303516, 2.995273330501328,
+        2.997268960430454, 2.999264596079745, 3.001260237438082, 3.003255884494375,
+        3.005251537237561, 3.007247195656608, 3.009242859740509, 3.011238529478287,
+        3.013234204858994, 3.015229885871707, 3.017225572505535, 3.019221264749611,
+        3.021216962593098, 3.023212666025186, 3.025208375035092, 3.027204089612063,
+        3.029199809745369, 3.031195535424311, 3.033191266638216, 3.035187003376439,
+        3.037182745628359, 3.039178493383386, 3.041174246630955, 3.043170005360527,
+        3.04516576956159, 3.047161539223661, 3.04915731433628, 3.051153094889017,
+        3.053148880871465, 3.055144672273245, 3.057140469084004, 3.059136271293417,
+        3.061132078891181, 3.063127891867022, 3.065123710210691, 3.067119533911965,
+        3.069115362960647, 3.071111197346565, 3.073107037059573, 3.075102882089549,
+        3.0770987324264, 3.079094588060054, 3.081090448980468, 3.083086315177621,
+        3.08508218664152, 3.087078063362194, 3.0890739453297, 3.091069832534117,
+        3.093065724965551, 3.095061622614132, 3.097057525470014, 3.099053433523377,
+        3.101049346764422, 3.10304526518338, 3.105041188770501, 3.107037117516063,
+        3.109033051410366, 3.111028990443735, 3.113024934606518, 3.115020883889088,
+        3.117016838281843, 3.119012797775202, 3.121008762359609, 3.123004732025533,
+        3.125000706763465, 3.126996686563919, 3.128992671417434, 3.130988661314572,
+        3.132984656245918, 3.13498065620208, 3.13697666117369, 3.138972671151402,
+        3.140968686125893, 3.142964706087864, 3.144960731028039, 3.146956760937163,
+        3.148952795806005, 3.150948835625358, 3.152944880386034, 3.154940930078872,
+        3.156936984694729, 3.158933044224488, 3.160929108659052, 3.162925177989347,
+        3.164921252206322, 3.166917331300948, 3.168913415264215, 3.17090950408714,
+        3.172905597760759, 3.174901696276129, 3.176897799624331, 3.178893907796466,
+        3.180890020783658, 3.182886138577052, 3.184882261167815, 3.186878388547134,
+        3.188874520706218, 3.1908706576363, 3.192866799328629, 3.194862945774481,
+        3.196859096965148, 3.198855252891947, 3.200851413546214, 3.202847578919306,
+        3.204843749002602, 3.2068399237875, 3.208836103265421, 3.210832287427805,
+        3.212828476266113, 3.214824669771827, 3.216820867936449, 3.218817070751502,
+        3.22081327820853, 3.222809490299095, 3.224805707014782, 3.226801928347194,
+        3.228798154287955, 3.230794384828711, 3.232790619961124, 3.234786859676879,
+        3.23678310396768, 3.238779352825252, 3.240775606241337, 3.2427718642077,
+        3.244768126716124, 3.246764393758411, 3.248760665326384, 3.250756941411885,
+        3.252753222006775, 3.254749507102934, 3.256745796692263, 3.258742090766682,
+        3.260738389318127, 3.262734692338558, 3.264730999819951, 3.266727311754302,
+        3.268723628133626, 3.270719948949956, 3.272716274195345, 3.274712603861865,
+        3.276708937941605, 3.278705276426675, 3.280701619309203, 3.282697966581334,
+        3.284694318235233, 3.286690674263084, 3.288687034657089, 3.290683399409467,
+        3.292679768512456, 3.294676141958314, 3.296672519739315, 3.298668901847753,
+        3.300665288275939, 3.302661679016202, 3.304658074060889, 3.306654473402365,
+        3.308650877033015, 3.310647284945238, 3.312643697131454, 3.314640113584099,
+        3.316636534295628, 3.318632959258512, 3.320629388465241, 3.322625821908322,
+        3.32462225958028, 3.326618701473657, 3.328615147581012, 3.330611597894922,
+        3.332608052407981, 3.334604511112801, 3.336600974002009, 3.338597441068252,
+        3.340593912304193, 3.34259038770251, 3.344586867255902, 3.346583350957081,
+        3.348579838798779, 3.350576330773743, 3.352572826874737, 3.354569327094543,
+        3.356565831425957, 3.358562339861796, 3.360558852394889, 3.362555369018084,
+        3.364551889724245, 3.366548414506254, 3.368544943357007, 3.370541476269417,
+        3.372538013236415, 3.374534554250945, 3.376531099305972, 3.378527648394472,
+        3.380524201509441, 3.382520758643889, 3.384517319790842, 3.386513884943345,
+        3.388510454094455, 3.390507027237247, 3.392503604364811, 3.394500185470254,
+        3.396496770546698, 3.398493359587281, 3.400489952585156, 3.402486549533492,
+        3.404483150425474, 3.406479755254303, 3.408476364013193, 3.410472976695378,
+        3.412469593294102, 3.414466213802629, 3.416462838214235, 3.418459466522214,
+        3.420456098719873, 3.422452734800536, 3.424449374757541, 3.426446018584241,
+        3.428442666274005, 3.430439317820217, 3.432435973216274, 3.434432632455591,
+        3.436429295531597, 3.438425962437734, 3.44042263316746, 3.442419307714249,
+        3.444415986071587, 3.446412668232979, 3.44840935419194, 3.450406043942001,
+        3.452402737476711, 3.454399434789628, 3.456396135874329, 3.458392840724403,
+        3.460389549333454, 3.462386261695102, 3.464382977802977, 3.466379697650729,
+        3.468376421232018, 3.470373148540519, 3.472369879569923, 3.474366614313934,
+        3.47636335276627, 3.478360094920662, 3.480356840770857, 3.482353590310614,
+        3.484350343533709, 3.486347100433929, 3.488343861005075, 3.490340625240964,
+        3.492337393135425, 3.4943341646823, 3.496330939875447, 3.498327718708737,
+        3.500324501176054, 3.502321287271295, 3.504318076988371, 3.506314870321209,
+        3.508311667263745, 3.510308467809932, 3.512305271953736, 3.514302079689134,
+        3.516298891010119, 3.518295705910695, 3.520292524384883, 3.522289346426712,
+        3.524286172030229, 3.526283001189491, 3.528279833898569, 3.530276670151548,
+        3.532273509942525, 3.534270353265611, 3.536267200114929, 3.538264050484615,
+        3.540260904368818, 3.542257761761701, 3.544254622657438, 3.546251487050217,
+        3.548248354934238, 3.550245226303716, 3.552242101152875, 3.554238979475954,
+        3.556235861267204, 3.558232746520889, 3.560229635231286, 3.562226527392684,
+        3.564223422999383, 3.566220322045698, 3.568217224525954, 3.570214130434491,
+        3.572211039765659, 3.574207952513822, 3.576204868673355, 3.578201788238647,
+        3.580198711204096, 3.582195637564116, 3.584192567313131, 3.586189500445578,
+        3.588186436955904, 3.590183376838572, 3.592180320088053, 3.594177266698832,
+        3.596174216665406, 3.598171169982284, 3.600168126643985, 3.602165086645043,
+        3.604162049980002, 3.606159016643417, 3.608155986629857, 3.6101529599339,
+        3.612149936550139, 3.614146916473176, 3.616143899697625, 3.618140886218113,
+        3.620137876029277, 3.622134869125767, 3.624131865502244, 3.626128865153379,
+        3.628125868073857, 3.630122874258372, 3.632119883701632, 3.634116896398354,
+        3.636113912343268, 3.638110931531114, 3.640107953956643, 3.64210497961462,
+        3.644102008499818, 3.646099040607023, 3.648096075931032, 3.650093114466651,
+        3.652090156208701, 3.654087201152012, 3.656084249291423, 3.658081300621788,
+        3.660078355137969, 3.66207541283484, 3.664072473707285, 3.666069537750202,
+        3.668066604958496, 3.670063675327084, 3.672060748850896, 3.67405782552487,
+        3.676054905343955, 3.678051988303113, 3.680049074397315, 3.682046163621542,
+        3.684043255970787, 3.686040351440053, 3.688037450024353, 3.690034551718713,
+        3.692031656518166, 3.694028764417758, 3.696025875412545, 3.698022989497594,
+        3.700020106667979, 3.702017226918789, 3.704014350245121, 3.706011476642083,
+        3.708008606104792, 3.710005738628377, 3.712002874207976, 3.714000012838738,
+        3.715997154515823, 3.717994299234398, 3.719991446989644, 3.72198859777675,
+        3.723985751590915, 3.725982908427348, 3.727980068281271, 3.729977231147911,
+        3.731974397022509, 3.733971565900314, 3.735968737776585, 3.737965912646593,
+        3.739963090505616, 3.741960271348943, 3.743957455171874, 3.745954641969717,
+        3.747951831737791, 3.749949024471425, 3.751946220165955, 3.75394341881673,
+        3.755940620419108, 3.757937824968455, 3.759935032460149, 3.761932242889575,
+        3.76392945625213, 3.765926672543219, 3.767923891758257, 3.769921113892668,
+        3.771918338941887, 3.773915566901357, 3.775912797766531, 3.777910031532872,
+        3.77990726819585, 3.781904507750948, 3.783901750193655, 3.785898995519471,
+        3.787896243723906, 3.789893494802477, 3.791890748750712, 3.793888005564147,
+        3.79588526523833, 3.797882527768814, 3.799879793151165, 3.801877061380955,
+        3.803874332453767, 3.805871606365192, 3.807868883110832, 3.809866162686295,
+        3.811863445087201, 3.813860730309177, 3.815858018347859, 3.817855309198895,
+        3.819852602857936, 3.821849899320648, 3.823847198582703, 3.82584450063978,
+        3.827841805487572, 3.829839113121775, 3.831836423538098, 3.833833736732257,
+        3.835831052699977, 3.837828371436991, 3.839825692939043, 3.841823017201883,
+        3.84382034422127, 3.845817673992974, 3.847815006512771, 3.849812341776447,
+        3.851809679779796, 3.853807020518621, 3.855804363988732, 3.85780171018595,
+        3.859799059106102, 3.861796410745026, 3.863793765098566, 3.865791122162576,
+        3.867788481932917, 3.86978584440546, 3.871783209576084, 3.873780577440675,
+        3.875777947995129, 3.877775321235349, 3.879772697157246, 3.881770075756742,
+        3.883767457029764, 3.885764840972248, 3.887762227580139, 3.889759616849391,
+        3.891757008775963, 3.893754403355825, 3.895751800584955, 3.897749200459336,
+        3.899746602974964, 3.901744008127838, 3.903741415913969, 3.905738826329374,
+        3.907736239370078, 3.909733655032114, 3.911731073311524, 3.913728494204357,
+        3.91572591770667, 3.917723343814528, 3.919720772524003, 3.921718203831177,
+        3.923715637732138, 3.925713074222982, 3.927710513299813, 3.929707954958744,
+        3.931705399195893, 3.933702846007388, 3.935700295389365, 3.937697747337965,
+        3.93969520184934, 3.941692658919647, 3.943690118545051, 3.945687580721728,
+        3.947685045445856, 3.949682512713625, 3.95167998252123, 3.953677454864876,
+        3.955674929740773, 3.95767240714514, 3.959669887074204, 3.961667369524196,
+        3.963664854491359, 3.965662341971941, 3.967659831962198, 3.969657324458392,
+        3.971654819456796, 3.973652316953685, 3.975649816945347, 3.977647319428072,
+        3.979644824398162, 3.981642331851924, 3.983639841785671, 3.985637354195726,
+        3.987634869078418, 3.989632386430082, 3.991629906247062, 3.993627428525709,
+        3.99562495326238, 3.997622480453441, 3.999620010095262, 4.001617542184223,
+        4.003615076716711, 4.005612613689118, 4.007610153097844, 4.009607694939298,
+        4.011605239209893, 4.013602785906051, 4.0156003350242, 4.017597886560775,
+        4.019595440512219, 4.021592996874981, 4.023590555645517, 4.025588116820289,
+        4.027585680395769, 4.029583246368432, 4.031580814734763, 4.033578385491251,
+        4.035575958634395, 4.037573534160697, 4.03957111206667, 4.04156869234883,
+        4.043566275003702, 4.045563860027818, 4.047561447417714, 4.049559037169937,
+        4.051556629281036, 4.05355422374757, 4.055551820566104, 4.057549419733208,
+        4.059547021245462, 4.061544625099448, 4.063542231291758, 4.06553983981899,
+        4.067537450677748, 4.069535063864643, 4.071532679376292, 4.073530297209319,
+        4.075527917360354, 4.077525539826034, 4.079523164603002, 4.081520791687908,
+        4.083518421077409, 4.085516052768166, 4.087513686756848, 4.089511323040132,
+        4.091508961614698, 4.093506602477236, 4.095504245624438, 4.097501891053007,
+        4.099499538759649, 4.101497188741078, 4.103494840994013, 4.10549249551518,
+        4.107490152301312, 4.109487811349147, 4.11148547265543, 4.113483136216911,
+        4.115480802030348, 4.117478470092504, 4.119476140400148, 4.121473812950056,
+        4.12347148773901, 4.125469164763798, 4.127466844021213, 4.129464525508056,
+        4.131462209221132, 4.133459895157255, 4.135457583313242, 4.137455273685918,
+        4.139452966272112, 4.141450661068662, 4.143448358072409, 4.145446057280203,
+        4.147443758688896, 4.14944146229535, 4.151439168096431, 4.15343687608901,
+        4.155434586269966, 4.157432298636183, 4.15943001318455, 4.161427729911963,
+        4.163425448815324, 4.165423169891539, 4.167420893137523, 4.169418618550194,
+        4.171416346126477, 4.173414075863302, 4.175411807757607, 4.177409541806332,
+        4.179407278006426, 4.181405016354843, 4.183402756848541, 4.185400499484487,
+        4.18739824425965, 4.189395991171007, 4.191393740215539, 4.193391491390236,
+        4.19538924469209, 4.1973870001181, 4.199384757665271, 4.201382517330612,
+        4.20338027911114, 4.205378043003877, 4.207375809005848, 4.209373577114087,
+        4.211371347325632, 4.213369119637525, 4.215366894046817, 4.217364670550561,
+        4.219362449145818, 4.221360229829654, 4.223358012599138, 4.225355797451348,
+        4.227353584383366, 4.229351373392278, 4.231349164475178, 4.233346957629163,
+        4.235344752851337, 4.237342550138809, 4.239340349488693, 4.241338150898109,
+        4.243335954364181, 4.24533375988404, 4.24733156745482, 4.249329377073664,
+        4.251327188737717, 4.25332500244413, 4.25532281819006, 4.257320635972669,
+        4.259318455789124, 4.261316277636598, 4.263314101512267, 4.265311927413316,
+        4.267309755336931, 4.269307585280305, 4.271305417240638, 4.273303251215132,
+        4.275301087200997, 4.277298925195445, 4.279296765195697, 4.281294607198974,
+        4.283292451202508, 4.285290297203531, 4.287288145199283, 4.289285995187009,
+        4.291283847163957, 4.293281701127383, 4.295279557074544, 4.297277415002707,
+        4.299275274909139, 4.301273136791116, 4.303271000645917, 4.305268866470826,
+        4.307266734263133, 4.309264604020131, 4.311262475739121, 4.313260349417405,
+        4.315258225052294, 4.3172561026411, 4.319253982181143, 4.321251863669747,
+        4.32324974710424, 4.325247632481955, 4.327245519800231, 4.329243409056411,
+        4.331241300247842, 4.333239193371879, 4.335237088425877, 4.337234985407199,
+        4.339232884313213, 4.34123078514129, 4.343228687888807, 4.345226592553146,
+        4.347224499131692, 4.349222407621837, 4.351220318020976, 4.353218230326509,
+        4.355216144535841, 4.357214060646382, 4.359211978655546, 4.361209898560753,
+        4.363207820359426, 4.365205744048992, 4.367203669626886, 4.369201597090545,
+        4.371199526437411, 4.37319745766493, 4.375195390770555, 4.377193325751741,
+        4.379191262605948, 4.381189201330641, 4.383187141923292, 4.385185084381372,
+        4.387183028702362, 4.389180974883744, 4.391178922923006, 4.39317687281764,
+        4.395174824565144, 4.397172778163018, 4.399170733608768, 4.401168690899904,
+        4.40316665003394, 4.405164611008397, 4.407162573820797, 4.409160538468667,
+        4.411158504949541, 4.413156473260956, 4.415154443400451, 4.417152415365573,
+        4.419150389153872, 4.421148364762901, 4.423146342190219, 4.42514432143339,
+        4.42714230248998, 4.429140285357561, 4.431138270033708, 4.433136256516003,
+        4.435134244802029, 4.437132234889375, 4.439130226775635, 4.441128220458405,
+        4.443126215935287, 4.445124213203887, 4.447122212261816, 4.449120213106686,
+        4.451118215736117, 4.453116220147731, 4.455114226339156, 4.457112234308023,
+        4.459110244051966, 4.461108255568625, 4.463106268855644, 4.465104283910671,
+        4.467102300731357, 4.469100319315359, 4.471098339660336, 4.473096361763954,
+        4.47509438562388, 4.477092411237787, 4.479090438603352, 4.481088467718255,
+        4.483086498580181, 4.485084531186819, 4.487082565535862, 4.489080601625007,
+        4.491078639451955, 4.49307667901441, 4.495074720310082, 4.497072763336684,
+        4.499070808091933, 4.50106885457355, 4.50306690277926, 4.505064952706792,
+        4.507063004353879, 4.509061057718258, 4.511059112797669, 4.513057169589859,
+        4.515055228092574, 4.517053288303569, 4.519051350220599, 4.521049413841426,
+        4.523047479163814, 4.52504554618553, 4.527043614904347, 4.529041685318042,
+        4.531039757424394, 4.533037831221187, 4.535035906706209, 4.537033983877251,
+        4.539032062732108, 4.54103014326858, 4.543028225484469, 4.545026309377583,
+        4.547024394945731, 4.549022482186729, 4.551020571098395, 4.55301866167855,
+        4.55501675392502, 4.557014847835634, 4.559012943408226, 4.561011040640633,
+        4.563009139530696, 4.565007240076258, 4.567005342275168, 4.569003446125278,
+        4.571001551624443, 4.572999658770523, 4.574997767561381, 4.576995877994883,
+        4.578993990068899, 4.580992103781303, 4.582990219129974, 4.584988336112792,
+        4.586986454727642, 4.588984574972413, 4.590982696844996, 4.592980820343289,
+        4.594978945465189, 4.596977072208601, 4.59897520057143, 4.600973330551586,
+        4.602971462146985, 4.604969595355542, 4.606967730175179, 4.60896586660382,
+        4.610964004639393, 4.61296214427983, 4.614960285523065, 4.616958428367038,
+        4.61895657280969, 4.620954718848968, 4.622952866482819, 4.624951015709197,
+        4.626949166526058, 4.628947318931362, 4.630945472923071, 4.632943628499153,
+        4.634941785657576, 4.636939944396315, 4.638938104713346, 4.64093626660665,
+        4.64293443007421, 4.644932595114014, 4.646930761724052, 4.648928929902318,
+        4.65092709964681, 4.652925270955529, 4.654923443826478, 4.656921618257665,
+        4.658919794247101, 4.6609179717928, 4.662916150892781, 4.664914331545064,
+        4.666912513747672, 4.668910697498636, 4.670908882795984, 4.672907069637751,
+        4.674905258021976, 4.676903447946699, 4.678901639409964, 4.680899832409819,
+        4.682898026944315, 4.684896223011506, 4.686894420609449, 4.688892619736205,
+        4.690890820389838, 4.692889022568415, 4.694887226270006, 4.696885431492686,
+        4.698883638234531, 4.700881846493622, 4.702880056268041, 4.704878267555875,
+        4.706876480355214, 4.708874694664152, 4.710872910480783, 4.712871127803209,
+        4.71486934662953, 4.716867566957853, 4.718865788786287, 4.720864012112944,
+        4.722862236935938, 4.724860463253389, 4.726858691063418, 4.728856920364149,
+        4.73085515115371, 4.732853383430233, 4.73485161719185, 4.7368498524367,
+        4.738848089162922, 4.74084632736866, 4.742844567052059, 4.74484280821127,
+        4.746841050844445, 4.74883929494974, 4.750837540525313, 4.752835787569326,
+        4.754834036079944, 4.756832286055335, 4.758830537493669, 4.760828790393121,
+        4.762827044751867, 4.764825300568087, 4.766823557839964, 4.768821816565685,
+        4.770820076743437, 4.772818338371414, 4.77481660144781, 4.776814865970823,
+        4.778813131938654, 4.780811399349507, 4.782809668201588, 4.784807938493108,
+        4.786806210222279, 4.788804483387316, 4.79080275798644, 4.79280103401787,
+        4.794799311479832, 4.796797590370553, 4.798795870688263, 4.800794152431196,
+        4.802792435597588, 4.804790720185677, 4.806789006193706, 4.80878729361992,
+        4.810785582462566, 4.812783872719895, 4.81478216439016, 4.816780457471617,
+        4.818778751962527, 4.82077704786115, 4.822775345165752, 4.8247736438746,
+        4.826771943985965, 4.82877024549812, 4.830768548409342, 4.832766852717909,
+        4.834765158422103, 4.836763465520209, 4.838761774010515, 4.84076008389131,
+        4.842758395160887, 4.844756707817543, 4.846755021859575, 4.848753337285286,
+        4.850751654092979, 4.852749972280961, 4.854748291847542, 4.856746612791034,
+        4.858744935109752, 4.860743258802013, 4.86274158386614, 4.864739910300454,
+        4.866738238103283, 4.868736567272953, 4.870734897807798, 4.872733229706151,
+        4.874731562966349, 4.876729897586732, 4.878728233565641, 4.880726570901422,
+        4.882724909592423, 4.884723249636993, 4.886721591033485, 4.888719933780255,
+        4.890718277875662, 4.892716623318066, 4.89471497010583, 4.896713318237321,
+        4.898711667710908, 4.900710018524963, 4.902708370677858, 4.904706724167971,
+        4.906705078993681, 4.90870343515337, 4.910701792645423, 4.912700151468227,
+        4.91469851162017, 4.916696873099647, 4.918695235905051, 4.92069360003478,
+        4.922691965487233, 4.924690332260815, 4.926688700353928, 4.928687069764983,
+        4.930685440492387, 4.932683812534556, 4.934682185889903, 4.936680560556846,
+        4.938678936533807, 4.940677313819207, 4.942675692411473, 4.944674072309032,
+        4.946672453510315, 4.948670836013755, 4.950669219817787, 4.952667604920849,
+        4.954665991321382, 4.956664379017829, 4.958662768008635, 4.960661158292247,
+        4.962659549867118, 4.964657942731698, 4.966656336884444, 4.968654732323814,
+        4.970653129048266, 4.972651527056266, 4.974649926346276, 4.976648326916766,
+        4.978646728766204, 4.980645131893064, 4.982643536295819, 4.984641941972948,
+        4.98664034892293, 4.988638757144247, 4.990637166635384, 4.992635577394827,
+        4.994633989421066, 4.996632402712592, 4.998630817267899, 5.000629233085485,
+        5.002627650163847, 5.004626068501486, 5.006624488096908, 5.008622908948616,
+        5.010621331055119, 5.012619754414929, 5.014618179026558, 5.016616604888521,
+        5.018615031999336, 5.020613460357523, 5.022611889961604, 5.024610320810104,
+        5.02660875290155, 5.02860718623447, 5.030605620807398, 5.032604056618866,
+        5.03460249366741, 5.03660093195157, 5.038599371469885, 5.040597812220899,
+        5.042596254203158, 5.044594697415209, 5.046593141855601, 5.048591587522887,
+        5.050590034415622, 5.052588482532362, 5.054586931871666, 5.056585382432095,
+        5.058583834212213, 5.060582287210585, 5.062580741425779, 5.064579196856366,
+        5.066577653500918, 5.06857611135801, 5.070574570426217, 5.072573030704121,
+        5.074571492190301, 5.076569954883341, 5.078568418781827, 5.080566883884347,
+        5.082565350189491, 5.084563817695852, 5.086562286402023, 5.088560756306601,
+        5.090559227408185, 5.092557699705377, 5.094556173196779, 5.096554647880998,
+        5.098553123756639, 5.100551600822313, 5.102550079076632, 5.10454855851821,
+        5.106547039145663, 5.10854552095761, 5.110544003952669, 5.112542488129465,
+        5.114540973486622, 5.116539460022767, 5.118537947736528, 5.120536436626537,
+        5.122534926691426, 5.124533417929832, 5.126531910340391, 5.128530403921743,
+        5.130528898672529, 5.132527394591393, 5.134525891676982, 5.136524389927942,
+        5.138522889342923, 5.140521389920579, 5.142519891659562, 5.144518394558529,
+        5.146516898616138, 5.148515403831049, 5.150513910201925, 5.152512417727429,
+        5.15451092640623, 5.156509436236994, 5.158507947218392, 5.160506459349098,
+        5.162504972627785, 5.16450348705313, 5.166502002623813, 5.168500519338512,
+        5.170499037195912, 5.172497556194697, 5.174496076333553, 5.176494597611169,
+        5.178493120026237, 5.180491643577448, 5.182490168263498, 5.184488694083083,
+        5.186487221034901, 5.188485749117655, 5.190484278330045, 5.192482808670777,
+        5.194481340138558, 5.196479872732096, 5.198478406450101, 5.200476941291286,
+        5.202475477254366, 5.204474014338057, 5.206472552541077, 5.208471091862147,
+        5.210469632299988, 5.212468173853326, 5.214466716520886, 5.216465260301396,
+        5.218463805193587, 5.220462351196189, 5.222460898307938, 5.224459446527569,
+        5.226457995853819, 5.228456546285428, 5.230455097821138, 5.232453650459691,
+        5.234452204199834, 5.236450759040314, 5.238449314979879, 5.24044787201728,
+        5.242446430151271, 5.244444989380605, 5.246443549704041, 5.248442111120336,
+        5.25044067362825, 5.252439237226546, 5.254437801913988, 5.256436367689342,
+        5.258434934551376, 5.260433502498859, 5.262432071530563, 5.264430641645261,
+        5.266429212841728, 5.268427785118742, 5.270426358475081, 5.272424932909527,
+        5.274423508420861, 5.276422085007868, 5.278420662669335, 5.280419241404048,
+        5.282417821210799, 5.284416402088378, 5.28641498403558, 5.288413567051199,
+        5.290412151134032, 5.292410736282879, 5.29440932249654, 5.296407909773817,
+        5.298406498113515, 5.30040508751444, 5.3024036779754, 5.304402269495203,
+        5.306400862072662, 5.30839945570659, 5.310398050395801, 5.312396646139113,
+        5.314395242935343, 5.316393840783312, 5.318392439681842, 5.320391039629756,
+        5.32238964062588, 5.324388242669042, 5.32638684575807, 5.328385449891794,
+        5.330384055069047, 5.332382661288664, 5.334381268549481, 5.336379876850334,
+        5.338378486190063, 5.34037709656751, 5.342375707981516, 5.344374320430927,
+        5.346372933914589, 5.34837154843135, 5.350370163980058, 5.352368780559566,
+        5.354367398168727, 5.356366016806395, 5.358364636471427, 5.360363257162681,
+        5.362361878879016, 5.364360501619294, 5.366359125382378, 5.368357750167133,
+        5.370356375972426, 5.372355002797124, 5.374353630640098, 5.376352259500218,
+        5.378350889376359, 5.380349520267395, 5.382348152172202, 5.384346785089658,
+        5.386345419018644, 5.38834405395804, 5.39034268990673, 5.392341326863599,
+        5.394339964827532, 5.396338603797419, 5.398337243772147, 5.400335884750609,
+        5.402334526731698, 5.404333169714308, 5.406331813697334, 5.408330458679675,
+        5.410329104660231, 5.412327751637901, 5.414326399611589, 5.416325048580199,
+        5.418323698542636, 5.420322349497809, 5.422321001444624, 5.424319654381995,
+        5.426318308308831, 5.428316963224048, 5.430315619126561, 5.432314276015286,
+        5.434312933889141, 5.436311592747048, 5.438310252587927, 5.440308913410702,
+        5.442307575214297, 5.444306237997639, 5.446304901759656, 5.448303566499276,
+        5.450302232215432, 5.452300898907056, 5.454299566573081, 5.456298235212444,
+        5.458296904824081, 5.460295575406931, 5.462294246959935, 5.464292919482035,
+        5.466291592972173, 5.468290267429294, 5.470288942852346, 5.472287619240276,
+        5.474286296592033, 5.476284974906568, 5.478283654182834, 5.480282334419785,
+        5.482281015616376, 5.484279697771565, 5.486278380884309, 5.48827706495357,
+        5.490275749978307, 5.492274435957486, 5.494273122890069, 5.496271810775023,
+        5.498270499611316, 5.500269189397916, 5.502267880133794, 5.504266571817922,
+        5.506265264449274, 5.508263958026824, 5.510262652549548, 5.512261348016425,
+        5.514260044426434, 5.516258741778555, 5.518257440071772, 5.520256139305067,
+        5.522254839477426, 5.524253540587835, 5.526252242635283, 5.528250945618759,
+        5.530249649537255, 5.532248354389761, 5.534247060175273, 5.536245766892786,
+        5.538244474541296, 5.540243183119802, 5.542241892627303, 5.544240603062801,
+        5.546239314425297, 5.548238026713796, 5.550236739927303, 5.552235454064824,
+        5.554234169125369, 5.556232885107946, 5.558231602011567, 5.560230319835243,
+        5.562229038577989, 5.56422775823882, 5.566226478816753, 5.568225200310805,
+        5.570223922719996, 5.572222646043347, 5.574221370279879, 5.576220095428617,
+        5.578218821488586, 5.580217548458812, 5.582216276338322, 5.584215005126146,
+        5.586213734821314, 5.588212465422858, 5.590211196929811, 5.592209929341209,
+        5.594208662656086, 5.59620739687348, 5.598206131992431, 5.600204868011978,
+        5.602203604931162, 5.604202342749026, 5.606201081464615, 5.608199821076974,
+        5.610198561585149, 5.61219730298819, 5.614196045285145, 5.616194788475065,
+        5.618193532557003, 5.620192277530012, 5.622191023393147, 5.624189770145464,
+        5.626188517786021, 5.628187266313876, 5.630186015728091, 5.632184766027725,
+        5.634183517211843, 5.636182269279508, 5.638181022229786, 5.640179776061744,
+        5.642178530774449, 5.644177286366972, 5.646176042838382, 5.648174800187752,
+        5.650173558414155, 5.652172317516667, 5.654171077494361, 5.656169838346317,
+        5.658168600071612, 5.660167362669327, 5.662166126138541, 5.664164890478339,
+        5.666163655687803, 5.668162421766018, 5.67016118871207, 5.672159956525048,
+        5.674158725204039, 5.676157494748134, 5.678156265156425, 5.680155036428003,
+        5.682153808561962, 5.684152581557399, 5.686151355413408, 5.688150130129088,
+        5.690148905703538, 5.692147682135857, 5.694146459425148, 5.696145237570512,
+        5.698144016571054, 5.700142796425879, 5.702141577134094, 5.704140358694805,
+        5.706139141107121, 5.708137924370154, 5.710136708483014, 5.712135493444813,
+        5.714134279254667, 5.716133065911689, 5.718131853414995, 5.720130641763705,
+        5.722129430956935, 5.724128220993806, 5.72612701187344, 5.728125803594958,
+        5.730124596157485, 5.732123389560144, 5.734122183802063, 5.736120978882367,
+        5.738119774800187, 5.740118571554651, 5.742117369144889, 5.744116167570035,
+        5.746114966829222, 5.748113766921583, 5.750112567846255, 5.752111369602374,
+        5.754110172189078, 5.756108975605506, 5.7581077798508, 5.7601065849241,
+        5.762105390824549, 5.764104197551291, 5.766103005103471, 5.768101813480236,
+        5.770100622680733, 5.77209943270411, 5.774098243549517, 5.776097055216106,
+        5.778095867703028, 5.780094681009437, 5.782093495134487, 5.784092310077333,
+        5.786091125837133, 5.788089942413045, 5.790088759804227, 5.79208757800984,
+        5.794086397029045, 5.796085216861004, 5.798084037504882, 5.800082858959843,
+        5.802081681225053, 5.804080504299679, 5.806079328182889, 5.808078152873853,
+        5.810076978371742, 5.812075804675726, 5.81407463178498, 5.816073459698675,
+        5.818072288415989, 5.820071117936096, 5.822069948258174, 5.824068779381401,
+        5.826067611304957, 5.828066444028023, 5.83006527754978, 5.832064111869412,
+        5.834062946986101, 5.836061782899033, 5.838060619607395, 5.840059457110374,
+        5.842058295407157, 5.844057134496935, 5.846055974378898, 5.848054815052238,
+        5.850053656516148, 5.852052498769821, 5.854051341812452, 5.856050185643238,
+        5.858049030261376, 5.860047875666063, 5.8620467218565, 5.864045568831886,
+        5.866044416591424, 5.868043265134315, 5.870042114459764, 5.872040964566974,
+        5.874039815455153, 5.876038667123506, 5.878037519571242, 5.88003637279757,
+        5.882035226801699, 5.884034081582841, 5.886032937140209, 5.888031793473015,
+        5.890030650580473, 5.8920295084618, 5.894028367116211, 5.896027226542925,
+        5.898026086741159, 5.900024947710133, 5.902023809449068, 5.904022671957185,
+        5.906021535233708, 5.90802039927786, 5.910019264088866, 5.912018129665952,
+        5.914016996008344, 5.916015863115271, 5.918014730985962, 5.920013599619646,
+        5.922012469015555, 5.924011339172921, 5.926010210090977, 5.928009081768956,
+        5.930007954206095, 5.93200682740163, 5.934005701354796, 5.936004576064834,
+        5.938003451530982, 5.940002327752479, 5.942001204728569, 5.944000082458492,
+        5.945998960941493, 5.947997840176815, 5.949996720163703, 5.951995600901405,
+        5.953994482389167, 5.955993364626238, 5.957992247611867, 5.959991131345304,
+        5.961990015825801, 5.963988901052611, 5.965987787024985, 5.967986673742179,
+        5.969985561203448, 5.971984449408049, 5.973983338355238, 5.975982228044274,
+        5.977981118474416, 5.979980009644924, 5.98197890155506, 5.983977794204085,
+        5.985976687591264, 5.987975581715859, 5.989974476577137, 5.991973372174363,
+        5.993972268506805, 5.99597116557373, 5.997970063374407, 5.999968961908107,
+        6.0019678611741, 6.003966761171658, 6.005965661900054, 6.007964563358563,
+        6.009963465546458, 6.011962368463016, 6.013961272107513, 6.015960176479227,
+        6.017959081577436, 6.01995798740142, 6.02195689395046, 6.023955801223837,
+        6.025954709220834, 6.027953617940733, 6.02995252738282, 6.031951437546378,
+        6.033950348430696, 6.035949260035059, 6.037948172358755, 6.039947085401074,
+        6.041945999161306, 6.043944913638742, 6.045943828832672, 6.047942744742391,
+        6.049941661367191, 6.051940578706368, 6.053939496759216, 6.055938415525032,
+        6.057937335003114, 6.05993625519276, 6.061935176093268, 6.06393409770394,
+        6.065933020024076, 6.067931943052977, 6.069930866789948, 6.071929791234291,
+        6.073928716385311, 6.075927642242315, 6.077926568804607, 6.079925496071496,
+        6.081924424042291, 6.083923352716299, 6.085922282092832, 6.0879212121712,
+        6.089920142950716, 6.091919074430691, 6.093918006610441, 6.095916939489278,
+        6.097915873066519, 6.099914807341481, 6.101913742313479, 6.103912677981834,
+        6.105911614345863, 6.107910551404886, 6.109909489158225, 6.1119084276052,
+        6.113907366745135, 6.115906306577354, 6.117905247101179, 6.119904188315937,
+        6.121903130220954, 6.123902072815556, 6.125901016099071, 6.127899960070829,
+        6.129898904730158, 6.131897850076389, 6.133896796108854, 6.135895742826884,
+        6.137894690229812, 6.139893638316973, 6.141892587087702, 6.143891536541333,
+        6.145890486677203, 6.14788943749465, 6.149888388993011, 6.151887341171627,
+        6.153886294029836, 6.15588524756698, 6.157884201782399, 6.159883156675437,
+        6.161882112245437, 6.163881068491743, 6.1658800254137, 6.167878983010653,
+        6.16987794128195, 6.171876900226937, 6.173875859844964, 6.17587482013538,
+        6.177873781097533, 6.179872742730776, 6.18187170503446, 6.183870668007938,
+        6.185869631650562, 6.187868595961687, 6.189867560940669, 6.191866526586862,
+        6.193865492899624, 6.195864459878312, 6.197863427522284, 6.1998623958309,
+        6.201861364803519, 6.203860334439503, 6.205859304738212, 6.20785827569901,
+        6.209857247321259, 6.211856219604324, 6.213855192547569, 6.21585416615036,
+        6.217853140412063, 6.219852115332047, 6.221851090909678, 6.223850067144326,
+        6.225849044035361, 6.227848021582152, 6.229846999784072, 6.231845978640493,
+        6.233844958150786, 6.235843938314327, 6.23784291913049, 6.239841900598649,
+        6.241840882718182, 6.243839865488464, 6.245838848908874, 6.24783783297879,
+        6.249836817697591, 6.251835803064658, 6.25383478907937, 6.255833775741111,
+        6.257832763049262, 6.259831751003207, 6.261830739602329, 6.263829728846013,
+        6.265828718733646, 6.267827709264612, 6.269826700438299, 6.271825692254096,
+        6.27382468471139, 6.275823677809572, 6.277822671548031, 6.279821665926158,
+        6.281820660943345, 6.283819656598985, 6.285818652892471, 6.287817649823197,
+        6.289816647390557, 6.291815645593948, 6.293814644432766, 6.295813643906407,
+        6.29781264401427, 6.299811644755753, 6.301810646130256, 6.303809648137179,
+        6.305808650775922, 6.307807654045887, 6.309806657946478, 6.311805662477096,
+        6.313804667637146, 6.315803673426032, 6.31780267984316, 6.319801686887936,
+        6.321800694559767, 6.32379970285806, 6.325798711782225, 6.327797721331669,
+        6.329796731505803, 6.331795742304038, 6.333794753725785, 6.335793765770455,
+        6.337792778437462, 6.33979179172622, 6.341790805636142, 6.343789820166644,
+        6.345788835317142, 6.347787851087051, 6.349786867475789, 6.351785884482775,
+        6.353784902107426, 6.355783920349162, 6.357782939207404, 6.359781958681572,
+        6.361780978771088, 6.363779999475374, 6.365779020793853, 6.367778042725948,
+        6.369777065271085, 6.371776088428689, 6.373775112198185, 6.375774136579,
+        6.377773161570561, 6.379772187172297, 6.381771213383636, 6.383770240204007,
+        6.385769267632841, 6.387768295669569, 6.389767324313622, 6.391766353564433,
+        6.393765383421434, 6.395764413884059, 6.397763444951744, 6.399762476623922,
+        6.401761508900029, 6.403760541779503, 6.40575957526178, 6.407758609346299,
+        6.409757644032497, 6.411756679319814, 6.413755715207691, 6.415754751695568,
+        6.417753788782885, 6.419752826469087, 6.421751864753614, 6.423750903635911,
+        6.425749943115422, 6.427748983191591, 6.429748023863864, 6.431747065131688,
+        6.433746106994509, 6.435745149451775, 6.437744192502934, 6.439743236147435,
+        6.441742280384727, 6.443741325214261, 6.445740370635488, 6.44773941664786,
+        6.449738463250829, 6.451737510443847, 6.453736558226369, 6.455735606597849,
+        6.457734655557742, 6.459733705105503, 6.461732755240589, 6.463731805962458,
+        6.465730857270566, 6.467729909164372, 6.469728961643335, 6.471728014706915,
+        6.473727068354572, 6.475726122585767, 6.477725177399963, 6.47972423279662,
+        6.481723288775202, 6.483722345335174, 6.485721402475998, 6.487720460197141,
+        6.489719518498067, 6.491718577378244, 6.493717636837137, 6.495716696874215,
+        6.497715757488946, 6.499714818680798, 6.501713880449242, 6.503712942793747,
+        6.505712005713785, 6.507711069208826, 6.509710133278343, 6.511709197921809,
+        6.513708263138697, 6.515707328928481, 6.517706395290636, 6.519705462224637,
+        6.52170452972996, 6.523703597806082, 6.52570266645248, 6.527701735668632,
+        6.529700805454016, 6.531699875808112, 6.533698946730399, 6.535698018220359,
+        6.537697090277471, 6.539696162901217, 6.541695236091081, 6.543694309846545,
+        6.545693384167092, 6.547692459052206, 6.549691534501374, 6.551690610514079,
+        6.553689687089808, 6.555688764228048, 6.557687841928286, 6.55968692019001,
+        6.561685999012709, 6.563685078395871, 6.565684158338987, 6.567683238841547,
+        6.569682319903042, 6.571681401522964, 6.573680483700805, 6.575679566436058,
+        6.577678649728216, 6.579677733576774, 6.581676817981226, 6.583675902941067,
+        6.585674988455794, 6.587674074524903, 6.589673161147891, 6.591672248324257,
+        6.593671336053497, 6.595670424335112, 6.597669513168601, 6.599668602553464,
+        6.601667692489202, 6.603666782975316, 6.605665874011308, 6.607664965596681,
+        6.609664057730939, 6.611663150413584, 6.613662243644121, 6.615661337422056,
+        6.617660431746893, 6.619659526618139, 6.621658622035301, 6.623657717997885,
+        6.625656814505401, 6.627655911557356, 6.62965500915326, 6.631654107292622,
+        6.633653205974953, 6.635652305199763, 6.637651404966564, 6.639650505274869,
+        6.641649606124189, 6.643648707514037, 6.645647809443929, 6.647646911913377,
+        6.649646014921898, 6.651645118469006, 6.653644222554218, 6.65564332717705,
+        6.65764243233702, 6.659641538033645, 6.661640644266445, 6.663639751034938,
+        6.665638858338643, 6.66763796617708, 6.669637074549772, 6.671636183456238,
+        6.673635292896001, 6.675634402868582, 6.677633513373506, 6.679632624410296,
+        6.681631735978475, 6.683630848077569, 6.685629960707103, 6.687629073866602,
+        6.689628187555593, 6.691627301773604, 6.693626416520161, 6.695625531794792,
+        6.697624647597027, 6.699623763926394, 6.701622880782424, 6.703621998164646,
+        6.705621116072591, 6.707620234505792, 6.709619353463779, 6.711618472946086,
+        6.713617592952245, 6.715616713481791, 6.717615834534257, 6.719614956109178,
+        6.721614078206089, 6.723613200824527, 6.725612323964028, 6.727611447624129,
+        6.729610571804366, 6.731609696504279, 6.733608821723406, 6.735607947461286,
+        6.737607073717458, 6.739606200491464, 6.741605327782843, 6.743604455591137,
+        6.745603583915888, 6.747602712756639, 6.749601842112931, 6.751600971984309,
+        6.753600102370317, 6.755599233270499, 6.757598364684401, 6.759597496611567,
+        6.761596629051545, 6.76359576200388, 6.76559489546812, 6.767594029443813,
+        6.769593163930507, 6.771592298927751, 6.773591434435094, 6.775590570452086,
+        6.777589706978278, 6.77958884401322, 6.781587981556464, 6.783587119607561,
+        6.785586258166065, 6.787585397231529, 6.789584536803505, 6.791583676881549,
+        6.793582817465214, 6.795581958554055, 6.797581100147629, 6.799580242245492,
+        6.8015793848472, 6.80357852795231, 6.805577671560381, 6.80757681567097,
+        6.809575960283636, 6.811575105397938, 6.813574251013436, 6.815573397129691,
+        6.817572543746264, 6.819571690862715, 6.821570838478606, 6.8235699865935,
+        6.82556913520696, 6.827568284318549, 6.82956743392783, 6.831566584034369,
+        6.83356573463773, 6.835564885737479, 6.837564037333181, 6.839563189424403,
+        6.841562342010711, 6.843561495091674, 6.845560648666859, 6.847559802735834,
+        6.849558957298169, 6.851558112353432, 6.853557267901195, 6.855556423941026,
+        6.857555580472497, 6.85955473749518, 6.861553895008647, 6.863553053012469,
+        6.86555221150622, 6.867551370489473, 6.869550529961802, 6.871549689922781,
+        6.873548850371986, 6.875548011308991, 6.877547172733373, 6.879546334644707,
+        6.881545497042572, 6.883544659926543, 6.885543823296199, 6.887542987151118,
+        6.889542151490879, 6.891541316315062, 6.893540481623245, 6.89553964741501,
+        6.897538813689936, 6.899537980447606, 6.901537147687601, 6.903536315409503,
+        6.905535483612894, 6.907534652297358, 6.909533821462479, 6.911532991107841,
+        6.913532161233027, 6.915531331837624, 6.917530502921217, 6.919529674483392,
+        6.921528846523734, 6.923528019041832, 6.925527192037273, 6.927526365509645,
+        6.929525539458535, 6.931524713883534, 6.933523888784229, 6.935523064160212,
+        6.937522240011072, 6.9395214163364, 6.941520593135787, 6.943519770408825,
+        6.945518948155106, 6.947518126374223, 6.949517305065769, 6.951516484229337,
+        6.953515663864521, 6.955514843970916, 6.957514024548117, 6.95951320559572,
+        6.961512387113319, 6.963511569100512, 6.965510751556894, 6.967509934482065,
+        6.96950911787562, 6.971508301737159, 6.97350748606628, 6.975506670862581,
+        6.977505856125664, 6.979505041855127, 6.981504228050571, 6.983503414711597,
+        6.985502601837806, 6.9875017894288, 6.989500977484182, 6.991500166003554,
+        6.99349935498652, 6.995498544432682, 6.997497734341645, 6.999496924713014,
+        7.001496115546394, 7.00349530684139, 7.005494498597607, 7.007493690814653,
+        7.009492883492134, 7.011492076629657, 7.013491270226829, 7.01549046428326,
+        7.017489658798558, 7.01948885377233, 7.021488049204188, 7.023487245093741,
+        7.025486441440599, 7.027485638244373, 7.029484835504674, 7.031484033221114,
+        7.033483231393305, 7.03548243002086, 7.037481629103391, 7.039480828640511,
+        7.041480028631836, 7.043479229076978, 7.045478429975553, 7.047477631327176,
+        7.049476833131462, 7.051476035388028, 7.053475238096489, 7.055474441256464,
+        7.057473644867568, 7.05947284892942, 7.061472053441639, 7.063471258403841,
+        7.065470463815648, 7.067469669676678, 7.06946887598655, 7.071468082744886,
+        7.073467289951306, 7.075466497605431, 7.077465705706884, 7.079464914255285,
+        7.081464123250257, 7.083463332691424, 7.085462542578408, 7.087461752910834,
+        7.089460963688324, 7.091460174910505, 7.093459386577001, 7.095458598687437,
+        7.09745781124144, 7.099457024238635, 7.101456237678649, 7.103455451561109,
+        7.105454665885643, 7.107453880651879, 7.109453095859444, 7.111452311507969,
+        7.113451527597081, 7.115450744126411, 7.117449961095589, 7.119449178504244,
+        7.121448396352008, 7.123447614638512, 7.125446833363388, 7.127446052526267,
+        7.129445272126783, 7.131444492164568, 7.133443712639255, 7.135442933550478,
+        7.137442154897871, 7.13944137668107, 7.141440598899707, 7.14343982155342,
+        7.145439044641844, 7.147438268164614, 7.149437492121368, 7.151436716511742,
+        7.153435941335374, 7.155435166591901, 7.157434392280962, 7.159433618402195,
+        7.16143284495524, 7.163432071939735, 7.16543129935532, 7.167430527201636,
+        7.169429755478323, 7.171428984185023, 7.173428213321375, 7.175427442887023,
+        7.177426672881608, 7.179425903304773, 7.181425134156162, 7.183424365435416,
+        7.18542359714218, 7.187422829276099, 7.189422061836816, 7.191421294823977,
+        7.193420528237227, 7.195419762076211, 7.197418996340577, 7.199418231029969,
+        7.201417466144036, 7.203416701682424, 7.205415937644782, 7.207415174030756,
+        7.209414410839996, 7.211413648072151, 7.21341288572687, 7.215412123803801,
+        7.217411362302596, 7.219410601222905, 7.221409840564379, 7.223409080326668,
+        7.225408320509424, 7.227407561112299, 7.229406802134946, 7.231406043577016,
+        7.233405285438164, 7.235404527718043, 7.237403770416306, 7.239403013532608,
+        7.241402257066603, 7.243401501017946, 7.245400745386293, 7.247399990171299,
+        7.249399235372621, 7.251398480989914, 7.253397727022837, 7.255396973471046,
+        7.257396220334198, 7.259395467611952, 7.261394715303966, 7.263393963409899,
+        7.265393211929409, 7.267392460862158, 7.269391710207803, 7.271390959966006,
+        7.273390210136427, 7.275389460718727, 7.277388711712568, 7.279387963117611,
+        7.281387214933518, 7.283386467159952, 7.285385719796576, 7.287384972843052,
+        7.289384226299045, 7.291383480164218, 7.293382734438235, 7.295381989120762,
+        7.297381244211463, 7.299380499710004, 7.30137975561605, 7.303379011929268,
+        7.305378268649324, 7.307377525775885, 7.309376783308618, 7.311376041247191,
+        7.313375299591271, 7.315374558340528, 7.317373817494629, 7.319373077053244,
+        7.321372337016041, 7.323371597382692, 7.325370858152866, 7.327370119326233,
+        7.329369380902464, 7.331368642881231, 7.333367905262205, 7.335367168045057,
+        7.337366431229461, 7.339365694815088, 7.341364958801612, 7.343364223188706,
+        7.345363487976044, 7.347362753163299, 7.349362018750146, 7.35136128473626,
+        7.353360551121316, 7.35535981790499, 7.357359085086956, 7.359358352666892,
+        7.361357620644473, 7.363356889019377, 7.36535615779128, 7.367355426959861,
+        7.369354696524797, 7.371353966485766, 7.373353236842447, 7.375352507594519,
+        7.377351778741662, 7.379351050283554, 7.381350322219876, 7.383349594550308,
+        7.38534886727453, 7.387348140392224, 7.389347413903072, 7.391346687806754,
+        7.393345962102953, 7.395345236791351, 7.397344511871631, 7.399343787343475,
+        7.401343063206568, 7.403342339460594, 7.405341616105235, 7.407340893140177,
+        7.409340170565104, 7.411339448379701, 7.413338726583654, 7.415338005176649,
+        7.417337284158372, 7.419336563528508, 7.421335843286746, 7.423335123432772,
+        7.425334403966273, 7.427333684886938, 7.429332966194454, 7.431332247888509,
+        7.433331529968794, 7.435330812434996, 7.437330095286806, 7.439329378523912,
+        7.441328662146006, 7.443327946152778, 7.445327230543917, 7.447326515319117,
+        7.449325800478067, 7.45132508602046, 7.453324371945988, 7.455323658254343,
+        7.457322944945219, 7.459322232018307, 7.461321519473302, 7.463320807309897,
+        7.465320095527787, 7.467319384126666, 7.469318673106228, 7.471317962466168,
+        7.473317252206183, 7.475316542325967, 7.477315832825217, 7.479315123703629,
+        7.481314414960899, 7.483313706596726, 7.485312998610805, 7.487312291002835,
+        7.489311583772513, 7.491310876919539, 7.49331017044361, 7.495309464344425,
+        7.497308758621684, 7.499308053275086, 7.501307348304332, 7.50330664370912,
+        7.505305939489153, 7.50730523564413, 7.509304532173753, 7.511303829077723,
+        7.513303126355742, 7.515302424007513, 7.517301722032737, 7.519301020431118,
+        7.521300319202357, 7.52329961834616, 7.525298917862229, 7.527298217750269,
+        7.529297518009983, 7.531296818641076, 7.533296119643254, 7.535295421016221,
+        7.537294722759684, 7.539294024873347, 7.541293327356918, 7.543292630210102,
+        7.545291933432606, 7.547291237024138, 7.549290540984405, 7.551289845313115,
+        7.553289150009975, 7.555288455074694, 7.557287760506981, 7.559287066306544,
+        7.561286372473094, 7.563285679006338, 7.565284985905989, 7.567284293171754,
+        7.569283600803346, 7.571282908800474, 7.57328221716285, 7.575281525890186,
+        7.577280834982192, 7.579280144438581, 7.581279454259066, 7.583278764443358,
+        7.585278074991172, 7.587277385902219, 7.589276697176214, 7.59127600881287,
+        7.593275320811901, 7.595274633173022, 7.597273945895948, 7.599273258980394,
+        7.601272572426074, 7.603271886232705, 7.605271200400002, 7.607270514927682,
+        7.60926982981546, 7.611269145063055, 7.613268460670183, 7.615267776636561,
+        7.617267092961907, 7.619266409645939, 7.621265726688376, 7.623265044088935,
+        7.625264361847336, 7.627263679963298, 7.629262998436541, 7.631262317266783,
+        7.633261636453746, 7.635260955997149, 7.637260275896714, 7.63925959615216,
+        7.641258916763209, 7.643258237729584, 7.645257559051004, 7.647256880727194,
+        7.649256202757874, 7.651255525142768, 7.653254847881598, 7.655254170974088,
+        7.657253494419962, 7.659252818218942, 7.661252142370754, 7.663251466875121,
+        7.665250791731768, 7.667250116940421, 7.669249442500804, 7.671248768412643,
+        7.673248094675664, 7.675247421289592, 7.677246748254155, 7.679246075569079,
+        7.68124540323409, 7.683244731248917, 7.685244059613286, 7.687243388326925,
+        7.689242717389563, 7.691242046800928, 7.693241376560748, 7.695240706668752,
+        7.69724003712467, 7.699239367928231, 7.701238699079165, 7.703238030577202,
+        7.705237362422072, 7.707236694613506, 7.709236027151234, 7.711235360034988,
+        7.713234693264499, 7.715234026839499, 7.717233360759721, 7.719232695024895,
+        7.721232029634755, 7.723231364589034, 7.725230699887464, 7.727230035529779,
+        7.729229371515713, 7.731228707845, 7.733228044517373, 7.735227381532567,
+        7.737226718890318, 7.739226056590359, 7.741225394632427, 7.743224733016256,
+        7.745224071741583, 7.747223410808144, 7.749222750215675, 7.751222089963913,
+        7.753221430052594, 7.755220770481456, 7.757220111250237, 7.759219452358673,
+        7.761218793806504, 7.763218135593467, 7.765217477719301, 7.767216820183744,
+        7.769216162986536, 7.771215506127416, 7.773214849606124, 7.775214193422399,
+        7.777213537575981, 7.779212882066612, 7.781212226894032, 7.783211572057981,
+        7.785210917558201, 7.787210263394433, 7.789209609566419, 7.791208956073902,
+        7.793208302916622, 7.795207650094324, 7.797206997606748, 7.79920634545364,
+        7.801205693634741, 7.803205042149796, 7.805204390998549, 7.807203740180742,
+        7.809203089696122, 7.811202439544432, 7.813201789725417, 7.815201140238822,
+        7.817200491084394, 7.819199842261876, 7.821199193771017, 7.82319854561156,
+        7.825197897783254, 7.827197250285844, 7.829196603119078, 7.831195956282703,
+        7.833195309776466, 7.835194663600115, 7.837194017753398, 7.839193372236063,
+        7.841192727047859, 7.843192082188534, 7.845191437657838, 7.84719079345552,
+        7.849190149581328, 7.851189506035014, 7.853188862816327, 7.855188219925017,
+        7.857187577360834, 7.859186935123531, 7.861186293212857, 7.863185651628563,
+        7.865185010370403, 7.867184369438126, 7.869183728831486, 7.871183088550234,
+        7.873182448594123, 7.875181808962906, 7.877181169656336, 7.879180530674166,
+        7.88117989201615, 7.883179253682041, 7.885178615671594, 7.887177977984563,
+        7.889177340620702, 7.891176703579766, 7.89317606686151, 7.89517543046569,
+        7.897174794392061, 7.899174158640379, 7.901173523210399, 7.903172888101879,
+        7.905172253314574, 7.907171618848241, 7.909170984702638, 7.911170350877521,
+        7.913169717372648, 7.915169084187777, 7.917168451322666, 7.919167818777072,
+        7.921167186550755, 7.923166554643474, 7.925165923054986, 7.927165291785052,
+        7.92916466083343, 7.931164030199881, 7.933163399884164, 7.935162769886039,
+        7.937162140205268, 7.93916151084161, 7.941160881794826, 7.943160253064678,
+        7.945159624650927, 7.947158996553334, 7.949158368771661, 7.951157741305671,
+        7.953157114155126, 7.955156487319788, 7.95715586079942, 7.959155234593785,
+        7.961154608702646, 7.963153983125768, 7.965153357862913, 7.967152732913845,
+        7.969152108278329, 7.97115148395613, 7.973150859947011, 7.975150236250738,
+        7.977149612867077, 7.979148989795791, 7.981148367036648, 7.983147744589413,
+        7.985147122453851, 7.98714650062973, 7.989145879116816, 7.991145257914875,
+        7.993144637023675, 7.995144016442983, 7.997143396172566, 7.999142776212193,
+        8.00114215656163, 8.003141537220647, 8.005140918189011, 8.007140299466492,
+        8.009139681052858, 8.011139062947879, 8.013138445151323, 8.01513782766296,
+        8.01713721048256, 8.019136593609893, 8.021135977044729, 8.02313536078684,
+        8.025134744835994, 8.027134129191964, 8.029133513854521, 8.031132898823435,
+        8.033132284098479, 8.035131669679425, 8.037131055566043, 8.039130441758108,
+        8.041129828255391, 8.043129215057665, 8.045128602164703, 8.047127989576278,
+        8.049127377292164, 8.051126765312134, 8.053126153635962, 8.055125542263422,
+        8.057124931194289, 8.059124320428337, 8.061123709965341, 8.063123099805075,
+        8.065122489947316, 8.067121880391838, 8.069121271138417, 8.07112066218683,
+        8.073120053536851, 8.075119445188258, 8.077118837140826, 8.079118229394334,
+        8.081117621948557, 8.083117014803272, 8.085116407958259, 8.087115801413293,
+        8.089115195168153, 8.091114589222616, 8.093113983576462, 8.095113378229469,
+        8.097112773181415, 8.099112168432079, 8.101111563981241, 8.103110959828679,
+        8.105110355974174, 8.107109752417506, 8.109109149158454, 8.111108546196798,
+        8.11310794353232, 8.115107341164799, 8.117106739094017, 8.119106137319754,
+        8.121105535841793, 8.123104934659914, 8.1251043337739, 8.127103733183532,
+        8.129103132888592, 8.131102532888863, 8.133101933184128, 8.135101333774169,
+        8.13710073465877, 8.139100135837713, 8.141099537310783, 8.143098939077762,
+        8.145098341138435, 8.147097743492585, 8.149097146139998, 8.151096549080457,
+        8.153095952313748, 8.155095355839654, 8.157094759657963, 8.159094163768458,
+        8.161093568170925, 8.16309297286515, 8.16509237785092, 8.167091783128019,
+        8.169091188696236, 8.171090594555356, 8.173090000705166, 8.175089407145453,
+        8.177088813876004, 8.179088220896608, 8.181087628207051, 8.183087035807121,
+        8.185086443696607, 8.187085851875296, 8.189085260342978, 8.19108466909944,
+        8.193084078144472, 8.195083487477863, 8.197082897099403, 8.19908230700888,
+        8.201081717206084, 8.203081127690806, 8.205080538462835, 8.207079949521961,
+        8.209079360867977, 8.211078772500671, 8.213078184419835, 8.21507759662526,
+        8.217077009116737, 8.219076421894059, 8.221075834957016, 8.223075248305401,
+        8.225074661939005, 8.227074075857622, 8.229073490061043, 8.231072904549062,
+        8.233072319321471, 8.235071734378064, 8.237071149718634, 8.239070565342974,
+        8.241069981250879, 8.243069397442141, 8.245068813916556, 8.247068230673918,
+        8.24906764771402, 8.251067065036659, 8.253066482641629, 8.255065900528724,
+        8.257065318697741, 8.259064737148475, 8.261064155880722, 8.263063574894277,
+        8.265062994188938, 8.267062413764499, 8.269061833620757, 8.27106125375751,
+        8.273060674174555, 8.275060094871687, 8.277059515848706, 8.279058937105407,
+        8.281058358641589, 8.28305778045705, 8.285057202551588, 8.287056624925001,
+        8.289056047577088, 8.291055470507647, 8.293054893716477, 8.295054317203377,
+        8.297053740968147, 8.299053165010585, 8.301052589330492, 8.303052013927667,
+        8.305051438801911, 8.307050863953024, 8.309050289380805, 8.311049715085056,
+        8.313049141065577, 8.315048567322169, 8.317047993854635, 8.319047420662774,
+        8.321046847746388, 8.323046275105279, 8.32504570273925, 8.327045130648102,
+        8.329044558831637, 8.331043987289659, 8.333043416021969, 8.33504284502837,
+        8.337042274308667, 8.339041703862661, 8.341041133690156, 8.343040563790957,
+        8.345039994164866, 8.347039424811688, 8.349038855731228, 8.351038286923288,
+        8.353037718387674, 8.355037150124191, 8.357036582132644, 8.359036014412838,
+        8.361035446964577, 8.363034879787668, 8.365034312881916, 8.367033746247128,
+        8.369033179883108, 8.371032613789664, 8.373032047966602, 8.375031482413728,
+        8.377030917130849, 8.379030352117773, 8.381029787374306, 8.383029222900255,
+        8.385028658695429, 8.387028094759634, 8.38902753109268, 8.391026967694373,
+        8.393026404564522, 8.395025841702936, 8.397025279109424, 8.399024716783793,
+        8.401024154725853, 8.403023592935413, 8.405023031412283, 8.407022470156271,
+        8.409021909167189, 8.411021348444845, 8.413020787989049, 8.415020227799613,
+        8.417019667876346, 8.419019108219059, 8.421018548827562, 8.423017989701667,
+        8.425017430841185, 8.427016872245928, 8.429016313915706, 8.431015755850331,
+        8.433015198049615, 8.435014640513371, 8.43701408324141, 8.439013526233545,
+        8.441012969489588, 8.443012413009352, 8.445011856792651, 8.447011300839297,
+        8.449010745149103, 8.451010189721883, 8.45300963455745, 8.455009079655619,
+        8.457008525016204, 8.459007970639017, 8.461007416523875, 8.46300686267059,
+        8.465006309078979, 8.467005755748856, 8.469005202680035, 8.471004649872332,
+        8.473004097325563, 8.475003545039543, 8.477002993014088, 8.479002441249013,
+        8.481001889744135, 8.48300133849927, 8.485000787514234, 8.487000236788844,
+        8.488999686322917, 8.490999136116269, 8.492998586168718, 8.494998036480081,
+        8.496997487050176, 8.498996937878819, 8.50099638896583, 8.502995840311025,
+        8.504995291914223, 8.506994743775243, 8.508994195893902, 8.51099364827002,
+        8.512993100903414, 8.514992553793905, 8.516992006941312, 8.518991460345453,
+        8.520990914006148, 8.522990367923217, 8.524989822096479, 8.526989276525755,
+        8.528988731210865, 8.530988186151629, 8.532987641347868, 8.534987096799402,
+        8.536986552506052, 8.53898600846764, 8.540985464683985, 8.54298492115491,
+        8.544984377880237, 8.546983834859786, 8.54898329209338, 8.550982749580841,
+        8.55298220732199, 8.554981665316651, 8.556981123564645, 8.558980582065796,
+        8.560980040819925, 8.562979499826857, 8.564978959086415, 8.566978418598421,
+        8.568977878362699, 8.570977338379073, 8.572976798647367, 8.574976259167404,
+        8.576975719939009, 8.578975180962006, 8.58097464223622, 8.582974103761475,
+        8.584973565537596, 8.586973027564408, 8.588972489841736, 8.590971952369406,
+        8.592971415147242, 8.594970878175071, 8.596970341452717, 8.598969804980009,
+        8.60096926875677, 8.602968732782828, 8.604968197058009, 8.606967661582139,
+        8.608967126355045, 8.610966591376555, 8.612966056646495, 8.614965522164693,
+        8.616964987930975, 8.61896445394517, 8.620963920207104, 8.622963386716607,
+        8.624962853473506, 8.626962320477629, 8.628961787728804, 8.63096125522686,
+        8.632960722971626, 8.63496019096293, 8.636959659200602, 8.63895912768447,
+        8.640958596414365, 8.642958065390114, 8.644957534611548, 8.646957004078497,
+        8.648956473790791, 8.650955943748259, 8.652955413950732, 8.654954884398041,
+        8.656954355090015, 8.658953826026486, 8.660953297207284, 8.66295276863224,
+        8.664952240301186, 8.666951712213953, 8.668951184370372, 8.670950656770275,
+        8.672950129413494, 8.674949602299861, 8.676949075429207, 8.678948548801366,
+        8.680948022416169, 8.682947496273449, 8.684946970373039, 8.686946444714771,
+        8.688945919298479, 8.690945394123996, 8.692944869191155, 8.694944344499789,
+        8.696943820049733, 8.69894329584082, 8.700942771872884, 8.702942248145758,
+        8.704941724659279, 8.706941201413278, 8.708940678407592, 8.710940155642055,
+        8.712939633116502, 8.714939110830768, 8.716938588784687, 8.718938066978096,
+        8.720937545410829, 8.722937024082723, 8.724936502993613, 8.726935982143335,
+        8.728935461531724, 8.730934941158618, 8.732934421023853, 8.734933901127264,
+        8.73693338146869, 8.738932862047965, 8.740932342864929, 8.742931823919417,
+        8.744931305211266, 8.746930786740315, 8.748930268506401, 8.750929750509361,
+        8.752929232749033, 8.754928715225256, 8.756928197937867, 8.758927680886704,
+        8.760927164071607, 8.762926647492414, 8.764926131148963, 8.766925615041093,
+        8.768925099168644, 8.770924583531454, 8.772924068129363, 8.77492355296221,
+        8.776923038029835, 8.778922523332077, 8.780922008868777, 8.782921494639775,
+        8.78492098064491, 8.786920466884023, 8.788919953356955, 8.790919440063546,
+        8.792918927003637, 8.794918414177069, 8.796917901583683, 8.798917389223319,
+        8.80091687709582, 8.802916365201027, 8.804915853538782, 8.806915342108926,
+        8.808914830911301, 8.810914319945749, 8.812913809212113, 8.814913298710234,
+        8.816912788439956, 8.818912278401121, 8.820911768593572, 8.822911259017151,
+        8.824910749671702, 8.826910240557067, 8.828909731673091, 8.830909223019617,
+        8.832908714596488, 8.834908206403548, 8.836907698440641, 8.838907190707611,
+        8.840906683204302, 8.842906175930559, 8.844905668886226, 8.846905162071147,
+        8.848904655485168, 8.850904149128133, 8.852903642999888, 8.854903137100277,
+        8.856902631429145, 8.858902125986339, 8.860901620771704, 8.862901115785085,
+        8.864900611026329, 8.866900106495281, 8.868899602191787, 8.870899098115695,
+        8.872898594266849, 8.874898090645098, 8.876897587250287, 8.878897084082263,
+        8.880896581140874, 8.882896078425965, 8.884895575937386, 8.886895073674983,
+        8.888894571638603, 8.890894069828094, 8.892893568243304, 8.894893066884081,
+        8.896892565750274, 8.898892064841729, 8.900891564158296, 8.902891063699823,
+        8.904890563466158, 8.906890063457151, 8.90888956367265, 8.910889064112504,
+        8.912888564776563, 8.914888065664675, 8.916887566776691, 8.918887068112459,
+        8.920886569671829, 8.922886071454652, 8.924885573460777, 8.926885075690054,
+        8.928884578142333, 8.930884080817465, 8.932883583715301, 8.93488308683569,
+        8.936882590178484, 8.938882093743534, 8.94088159753069, 8.942881101539805,
+        8.944880605770728, 8.946880110223311, 8.948879614897407, 8.950879119792867,
+        8.952878624909542, 8.954878130247284, 8.956877635805947, 8.958877141585381,
+        8.960876647585439, 8.962876153805974, 8.964875660246838, 8.966875166907884,
+        8.968874673788965, 8.970874180889934, 8.972873688210644, 8.974873195750948,
+        8.9768727035107, 8.978872211489753, 8.980871719687961, 8.982871228105178,
+        8.984870736741257, 8.986870245596053, 8.98886975466942, 8.990869263961212,
+        8.992868773471284, 8.994868283199489, 8.996867793145684, 8.998867303309722,
+        9.000866813691459, 9.002866324290749, 9.004865835107449, 9.006865346141412,
+        9.008864857392495, 9.010864368860554, 9.012863880545444, 9.01486339244702,
+        9.016862904565139, 9.018862416899657, 9.020861929450431, 9.022861442217316,
+        9.024860955200169, 9.026860468398846, 9.028859981813205, 9.030859495443102,
+        9.032859009288395, 9.03485852334894, 9.036858037624594, 9.038857552115215,
+        9.040857066820661, 9.042856581740789, 9.044856096875457, 9.046855612224522,
+        9.048855127787843, 9.050854643565278, 9.052854159556685, 9.054853675761923,
+        9.056853192180849, 9.058852708813323, 9.060852225659204, 9.062851742718349,
+        9.064851259990619, 9.066850777475872, 9.068850295173968, 9.070849813084765,
+        9.072849331208125, 9.074848849543905, 9.076848368091966, 9.078847886852167,
+        9.080847405824369, 9.082846925008432, 9.084846444404216, 9.086845964011581,
+        9.088845483830389, 9.090845003860498, 9.092844524101771, 9.094844044554067,
+        9.096843565217249, 9.098843086091177, 9.100842607175711, 9.102842128470715,
+        9.104841649976048, 9.106841171691573, 9.108840693617152, 9.110840215752645,
+        9.112839738097916, 9.114839260652826, 9.116838783417237, 9.118838306391011,
+        9.120837829574012, 9.122837352966101, 9.124836876567142, 9.126836400376996,
+        9.128835924395528, 9.130835448622599, 9.132834973058074, 9.134834497701814,
+        9.136834022553685, 9.138833547613549, 9.140833072881269, 9.142832598356711,
+        9.144832124039736, 9.14683164993021, 9.148831176027997, 9.15083070233296,
+        9.152830228844965, 9.154829755563875, 9.156829282489555, 9.158828809621869,
+        9.160828336960684, 9.162827864505863, 9.164827392257271, 9.166826920214774,
+        9.168826448378237, 9.170825976747526, 9.172825505322505, 9.174825034103041,
+        9.176824563088999, 9.178824092280245, 9.180823621676645, 9.182823151278065,
+        9.184822681084372, 9.186822211095432, 9.18882174131111, 9.190821271731275,
+        9.192820802355791, 9.194820333184527, 9.196819864217349, 9.198819395454124,
+        9.20081892689472, 9.202818458539002, 9.20481799038684, 9.2068175224381,
+        9.20881705469265, 9.210816587150357, 9.21281611981109, 9.214815652674717,
+        9.216815185741105, 9.218814719010122, 9.220814252481638, 9.222813786155519,
+        9.224813320031636, 9.226812854109856, 9.228812388390048, 9.230811922872081,
+        9.232811457555824, 9.234810992441146, 9.236810527527917, 9.238810062816005,
+        9.24080959830528, 9.242809133995612, 9.244808669886869, 9.246808205978923,
+        9.248807742271643, 9.250807278764898, 9.252806815458559, 9.254806352352496,
+        9.25680588944658, 9.25880542674068, 9.260804964234668, 9.262804501928413,
+        9.264804039821788, 9.266803577914662, 9.268803116206906, 9.270802654698393,
+        9.272802193388992, 9.274801732278576, 9.276801271367015, 9.278800810654181,
+        9.280800350139947, 9.282799889824183, 9.284799429706761, 9.286798969787554,
+        9.288798510066434, 9.290798050543272, 9.292797591217941, 9.294797132090314,
+        9.296796673160263, 9.29879621442766, 9.300795755892379, 9.302795297554292,
+        9.304794839413273, 9.306794381469193, 9.308793923721928, 9.310793466171349,
+        9.31279300881733, 9.314792551659745, 9.316792094698467, 9.31879163793337,
+        9.320791181364329, 9.322790724991216, 9.324790268813905, 9.326789812832272,
+        9.328789357046191, 9.330788901455534, 9.332788446060179, 9.334787990859997,
+        9.336787535854866, 9.338787081044658, 9.34078662642925, 9.342786172008516,
+        9.344785717782331, 9.346785263750571, 9.34878480991311, 9.350784356269825,
+        9.352783902820591, 9.354783449565283, 9.356782996503778, 9.35878254363595,
+        9.360782090961677, 9.362781638480834, 9.364781186193298, 9.366780734098944,
+        9.368780282197649, 9.37077983048929, 9.372779378973743, 9.374778927650885,
+        9.376778476520592, 9.378778025582743, 9.380777574837212, 9.382777124283879,
+        9.38477667392262, 9.386776223753312, 9.388775773775833, 9.39077532399006,
+        9.392774874395872, 9.394774424993145, 9.396773975781757, 9.398773526761588,
+        9.400773077932514, 9.402772629294414, 9.404772180847166, 9.406771732590648,
+        9.40877128452474, 9.410770836649319, 9.412770388964264, 9.414769941469454,
+        9.416769494164769, 9.418769047050086, 9.420768600125285, 9.422768153390245,
+        9.424767706844846, 9.426767260488967, 9.428766814322488, 9.430766368345287,
+        9.432765922557245, 9.434765476958242, 9.436765031548158, 9.438764586326871,
+        9.440764141294264, 9.442763696450215, 9.444763251794606, 9.446762807327316,
+        9.448762363048226, 9.450761918957217, 9.452761475054169, 9.454761031338964,
+        9.456760587811482, 9.458760144471604, 9.460759701319211, 9.462759258354185,
+        9.464758815576407, 9.466758372985759, 9.468757930582121, 9.470757488365376,
+        9.472757046335405, 9.47475660449209, 9.476756162835313, 9.478755721364956,
+        9.480755280080901, 9.482754838983031, 9.484754398071227, 9.486753957345373,
+        9.48875351680535, 9.490753076451041, 9.492752636282329, 9.494752196299097,
+        9.496751756501228, 9.498751316888604, 9.50075087746111, 9.502750438218627,
+        9.50474999916104, 9.506749560288231, 9.508749121600085, 9.510748683096484,
+        9.512748244777313, 9.514747806642456, 9.516747368691796, 9.518746930925217,
+        9.520746493342603, 9.522746055943839, 9.524745618728809, 9.526745181697397,
+        9.528744744849487, 9.530744308184965, 9.532743871703715, 9.534743435405621,
+        9.536742999290569, 9.538742563358444, 9.54074212760913, 9.542741692042513,
+        9.544741256658478, 9.54674082145691, 9.548740386437695, 9.550739951600718,
+        9.552739516945865, 9.554739082473022, 9.556738648182075, 9.558738214072908,
+        9.56073778014541, 9.562737346399464, 9.564736912834959, 9.56673647945178,
+        9.568736046249813, 9.570735613228945, 9.572735180389062, 9.574734747730052,
+        9.5767343152518, 9.578733882954195, 9.580733450837122, 9.582733018900469,
+        9.584732587144123, 9.586732155567972, 9.588731724171901, 9.5907312929558,
+        9.592730861919556, 9.594730431063056, 9.596730000386187, 9.598729569888838,
+        9.600729139570897, 9.602728709432252, 9.60472827947279, 9.6067278496924,
+        9.60872742009097, 9.610726990668388, 9.612726561424544, 9.614726132359325,
+        9.61672570347262, 9.618725274764318, 9.620724846234308, 9.622724417882478,
+        9.624723989708718, 9.626723561712916, 9.628723133894963, 9.630722706254747,
+        9.632722278792157, 9.634721851507083, 9.636721424399416, 9.638720997469043,
+        9.640720570715855, 9.642720144139743, 9.644719717740595, 9.646719291518301,
+        9.648718865472753, 9.65071843960384, 9.652718013911452, 9.654717588395481,
+        9.656717163055815, 9.658716737892346, 9.660716312904965, 9.662715888093562,
+        9.664715463458028, 9.666715038998254, 9.668714614714131, 9.67071419060555,
+        9.672713766672403, 9.67471334291458, 9.676712919331973, 9.678712495924474,
+        9.680712072691973, 9.682711649634363, 9.684711226751536, 9.686710804043383,
+        9.688710381509795, 9.690709959150666, 9.692709536965888, 9.694709114955351,
+        9.696708693118949, 9.698708271456574, 9.700707849968119, 9.702707428653476,
+        9.704707007512537, 9.706706586545195, 9.708706165751344, 9.710705745130875,
+        9.712705324683683, 9.714704904409659, 9.716704484308698, 9.718704064380692,
+        9.720703644625535, 9.72270322504312, 9.724702805633341, 9.726702386396091,
+        9.728701967331263, 9.730701548438753, 9.732701129718453, 9.734700711170258,
+        9.736700292794061, 9.738699874589756, 9.740699456557238, 9.742699038696402,
+        9.744698621007141, 9.74669820348935, 9.748697786142923, 9.750697368967755,
+        9.752696951963741, 9.754696535130776, 9.756696118468755, 9.758695701977571,
+        9.760695285657121, 9.7626948695073, 9.764694453528003, 9.766694037719125,
+        9.768693622080562, 9.770693206612209, 9.772692791313961, 9.774692376185715,
+        9.776691961227366, 9.77869154643881, 9.780691131819943, 9.78269071737066,
+        9.784690303090859, 9.786689888980434, 9.788689475039283, 9.790689061267302,
+        9.792688647664387, 9.794688234230434, 9.796687820965341, 9.798687407869003,
+        9.800686994941318, 9.802686582182183, 9.804686169591494, 9.806685757169149,
+        9.808685344915044, 9.810684932829076, 9.812684520911144, 9.814684109161144,
+        9.816683697578974, 9.818683286164531, 9.820682874917713, 9.822682463838418,
+        9.824682052926543, 9.826681642181986, 9.828681231604645, 9.830680821194418,
+        9.832680410951204, 9.8346800008749, 9.836679590965404, 9.838679181222616,
+        9.840678771646433, 9.842678362236754, 9.844677952993477, 9.846677543916502,
+        9.848677135005726, 9.85067672626105, 9.852676317682371, 9.854675909269589,
+        9.856675501022602, 9.858675092941311, 9.860674685025614, 9.86267427727541,
+        9.8646738696906, 9.866673462271081, 9.868673055016755, 9.870672647927521,
+        9.872672241003278, 9.874671834243926, 9.876671427649365, 9.878671021219495,
+        9.880670614954217, 9.88267020885343, 9.884669802917034, 9.88666939714493,
+        9.888668991537019, 9.8906685860932, 9.892668180813374, 9.894667775697442,
+        9.896667370745305, 9.898666965956863, 9.900666561332017, 9.902666156870669,
+        9.904665752572718, 9.906665348438067, 9.908664944466616, 9.910664540658267,
+        9.912664137012921, 9.914663733530479, 9.916663330210844, 9.918662927053916,
+        9.920662524059597, 9.922662121227789, 9.924661718558394, 9.926661316051314,
+        9.92866091370645, 9.930660511523705, 9.932660109502981, 9.934659707644179,
+        9.936659305947203, 9.938658904411955, 9.940658503038337, 9.942658101826252,
+        9.944657700775602, 9.94665729988629, 9.948656899158218, 9.950656498591291,
+        9.952656098185409, 9.954655697940477, 9.956655297856398, 9.958654897933074,
+        9.96065449817041, 9.962654098568307, 9.96465369912667, 9.966653299845403,
+        9.968652900724407, 9.970652501763588, 9.972652102962849, 9.974651704322094,
+        9.976651305841226, 9.97865090752015, 9.980650509358769, 9.982650111356987,
+        9.98464971351471, 9.98664931583184, 9.988648918308282, 9.990648520943941,
+        9.992648123738721, 9.994647726692527, 9.996647329805263, 9.998646933076834,
+        10.00064653650714, 10.0026461400961, 10.0046457438436, 10.00664534774956,
+        10.00864495181388, 10.01064455603646, 10.01264416041722, 10.01464376495604,
+        10.01664336965285, 10.01864297450755, 10.02064257952003, 10.02264218469022,
+        10.024641790018, 10.0266413955033, 10.028641001146, 10.03064060694603,
+        10.03264021290329, 10.03463981901768, 10.0366394252891, 10.03863903171747,
+        10.04063863830269, 10.04263824504467, 10.04463785194331, 10.04663745899852,
+        10.04863706621021, 10.05063667357828, 10.05263628110265, 10.0546358887832,
+        10.05663549661987, 10.05863510461254, 10.06063471276113, 10.06263432106555,
+        10.06463392952569, 10.06663353814148, 10.06863314691281, 10.0706327558396,
+        10.07263236492175, 10.07463197415916, 10.07663158355175, 10.07863119309943,
+        10.0806308028021, 10.08263041265967, 10.08463002267204, 10.08662963283914,
+        10.08862924316085, 10.0906288536371, 10.09262846426778, 10.09462807505282,
+        10.09662768599211, 10.09862729708557, 10.10062690833309, 10.10262651973461,
+        10.10462613129001, 10.10662574299921, 10.10862535486212, 10.11062496687864,
+        10.11262457904869, 10.11462419137218, 10.11662380384901, 10.11862341647909,
+        10.12062302926233, 10.12262264219865, 10.12462225528794, 10.12662186853013,
+        10.12862148192512, 10.13062109547281, 10.13262070917312, 10.13462032302597,
+        10.13661993703125, 10.13861955118887, 10.14061916549876, 10.14261877996081,
+        10.14461839457495, 10.14661800934107, 10.14861762425908, 10.15061723932891,
+        10.15261685455046, 10.15461646992363, 10.15661608544835, 10.15861570112451,
+        10.16061531695204, 10.16261493293083, 10.16461454906081, 10.16661416534189,
+        10.16861378177396, 10.17061339835696, 10.17261301509077, 10.17461263197533,
+        10.17661224901053, 10.1786118661963, 10.18061148353253, 10.18261110101915,
+        10.18461071865606, 10.18661033644317, 10.1886099543804, 10.19060957246766,
+        10.19260919070487, 10.19460880909192, 10.19660842762874, 10.19860804631523,
+        10.20060766515131, 10.20260728413689, 10.20460690327188, 10.2066065225562,
+        10.20860614198976, 10.21060576157246, 10.21260538130422, 10.21460500118496,
+        10.21660462121459, 10.21860424139301, 10.22060386172014, 10.2226034821959,
+        10.2246031028202, 10.22660272359295, 10.22860234451406, 10.23060196558345,
+        10.23260158680102, 10.2346012081667, 10.2366008296804, 10.23860045134202,
+        10.24060007315149, 10.24259969510871, 10.2445993172136, 10.24659893946607,
+        10.24859856186604, 10.25059818441343, 10.25259780710813, 10.25459742995007,
+        10.25659705293917, 10.25859667607533, 10.26059629935847, 10.26259592278851,
+        10.26459554636535, 10.26659517008891, 10.26859479395912, 10.27059441797587,
+        10.27259404213909, 10.27459366644869, 10.27659329090458, 10.27859291550668,
+        10.28059254025491, 10.28259216514917, 10.28459179018939, 10.28659141537548,
+        10.28859104070735, 10.29059066618492, 10.2925902918081, 10.29458991757682,
+        10.29658954349097, 10.29858916955049, 10.30058879575528, 10.30258842210526,
+        10.30458804860035, 10.30658767524045, 10.3085873020255, 10.31058692895539,
+        10.31258655603006, 10.31458618324941, 10.31658581061336, 10.31858543812182,
+        10.32058506577472, 10.32258469357197, 10.32458432151348, 10.32658394959917,
+        10.32858357782896, 10.33058320620276, 10.33258283472049, 10.33458246338206,
+        10.3365820921874, 10.33858172113642, 10.34058135022903, 10.34258097946516,
+        10.34458060884472, 10.34658023836762, 10.34857986803379, 10.35057949784313,
+        10.35257912779557, 10.35457875789103, 10.35657838812942, 10.35857801851066,
+        10.36057764903466, 10.36257727970135, 10.36457691051064, 10.36657654146245,
+        10.36857617255669, 10.37057580379328, 10.37257543517215, 10.37457506669321,
+        10.37657469835637, 10.37857433016156, 10.38057396210869, 10.38257359419769,
+        10.38457322642846, 10.38657285880093, 10.38857249131501, 10.39057212397063,
+        10.39257175676769, 10.39457138970613, 10.39657102278586, 10.3985706560068,
+        10.40057028936886, 10.40256992287196, 10.40456955651603, 10.40656919030098,
+        10.40856882422673, 10.4105684582932, 10.4125680925003, 10.41456772684797,
+        10.41656736133611, 10.41856699596465, 10.4205666307335, 10.42256626564259,
+        10.42456590069183, 10.42656553588114, 10.42856517121045, 10.43056480667966,
+        10.43256444228871, 10.43456407803751, 10.43656371392598, 10.43856334995404,
+        10.44056298612162, 10.44256262242862, 10.44456225887497, 10.44656189546059,
+        10.4485615321854, 10.45056116904932, 10.45256080605228, 10.45456044319418,
+        10.45656008047495, 10.45855971789452, 10.4605593554528, 10.46255899314971,
+        10.46455863098517, 10.4665582689591, 10.46855790707143, 10.47055754532208,
+        10.47255718371096, 10.474556822238, 10.47655646090311, 10.47855609970622,
+        10.48055573864726, 10.48255537772613, 10.48455501694276, 10.48655465629708,
+        10.488554295789, 10.49055393541845, 10.49255357518534, 10.4945532150896,
+        10.49655285513115, 10.49855249530992, 10.50055213562581, 10.50255177607876,
+        10.50455141666869, 10.50655105739552, 10.50855069825916, 10.51055033925955,
+        10.5125499803966, 10.51454962167024, 10.51654926308039, 10.51854890462696,
+        10.52054854630989, 10.5225481881291, 10.5245478300845, 10.52654747217602,
+        10.52854711440358, 10.53054675676711, 10.53254639926652, 10.53454604190175,
+        10.53654568467271, 10.53854532757932, 10.54054497062151, 10.5425446137992,
+        10.54454425711231, 10.54654390056078, 10.54854354414451, 10.55054318786343,
+        10.55254283171748, 10.55454247570656, 10.5565421198306, 10.55854176408953,
+        10.56054140848327, 10.56254105301174, 10.56454069767487, 10.56654034247258,
+        10.56853998740479, 10.57053963247143, 10.57253927767242, 10.57453892300768,
+        10.57653856847714, 10.57853821408073, 10.58053785981836, 10.58253750568996,
+        10.58453715169546, 10.58653679783478, 10.58853644410784, 10.59053609051456,
+        10.59253573705488, 10.59453538372872, 10.59653503053599, 10.59853467747663,
+        10.60053432455056, 10.6025339717577, 10.60453361909798, 10.60653326657133,
+        10.60853291417766, 10.61053256191691, 10.61253220978899, 10.61453185779384,
+        10.61653150593137, 10.61853115420152, 10.62053080260421, 10.62253045113936,
+        10.62453009980689, 10.62652974860674, 10.62852939753883, 10.63052904660309,
+        10.63252869579943, 10.63452834512779, 10.63652799458809, 10.63852764418025,
+        10.64052729390421, 10.64252694375989, 10.64452659374721, 10.6465262438661,
+        10.64852589411648, 10.65052554449829, 10.65252519501144, 10.65452484565587,
+        10.6565244964315, 10.65852414733825, 10.66052379837605, 10.66252344954484,
+        10.66452310084452, 10.66652275227504, 10.66852240383632, 10.67052205552827,
+        10.67252170735084, 10.67452135930395, 10.67652101138752, 10.67852066360148,
+        10.68052031594576, 10.68251996842028, 10.68451962102498, 10.68651927375977,
+        10.68851892662458, 10.69051857961935, 10.692518232744, 10.69451788599845,
+        10.69651753938263, 10.69851719289648, 10.70051684653992, 10.70251650031287,
+        10.70451615421526, 10.70651580824702, 10.70851546240808, 10.71051511669837,
+        10.71251477111781, 10.71451442566633, 10.71651408034386, 10.71851373515033,
+        10.72051339008566, 10.72251304514978, 10.72451270034262, 10.72651235566411,
+        10.72851201111417, 10.73051166669274, 10.73251132239975, 10.73451097823511,
+        10.73651063419876, 10.73851029029063, 10.74050994651065, 10.74250960285874,
+        10.74450925933483, 10.74650891593885, 10.74850857267074, 10.75050822953041,
+        10.7525078865178, 10.75450754363284, 10.75650720087545, 10.75850685824556,
+        10.76050651574311, 10.76250617336802, 10.76450583112022, 10.76650548899963,
+        10.7685051470062, 10.77050480513985, 10.7725044634005, 10.77450412178809,
+        10.77650378030255, 10.7785034389438, 10.78050309771178, 10.78250275660641,
+        10.78450241562762, 10.78650207477535, 10.78850173404952, 10.79050139345006,
+        10.79250105297691, 10.79450071262999, 10.79650037240923, 10.79850003231456,
+        10.80049969234592, 10.80249935250323, 10.80449901278642, 10.80649867319542,
+        10.80849833373017, 10.81049799439059, 10.81249765517661, 10.81449731608816,
+        10.81649697712518, 10.8184966382876, 10.82049629957534, 10.82249596098833,
+        10.82449562252651, 10.82649528418981, 10.82849494597815, 10.83049460789147,
+        10.8324942699297, 10.83449393209277, 10.83649359438061, 10.83849325679316,
+        10.84049291933033, 10.84249258199207, 10.8444922447783, 10.84649190768896,
+        10.84849157072398, 10.85049123388329, 10.85249089716681, 10.85449056057448,
+        10.85649022410624, 10.85848988776201, 10.86048955154173, 10.86248921544532,
+        10.86448887947273, 10.86648854362387, 10.86848820789868, 10.8704878722971,
+        10.87248753681906, 10.87448720146448, 10.8764868662333, 10.87848653112545,
+        10.88048619614086, 10.88248586127947, 10.88448552654121, 10.88648519192601,
+        10.88848485743379, 10.89048452306451, 10.89248418881808, 10.89448385469443,
+        10.89648352069351, 10.89848318681524, 10.90048285305956, 10.9024825194264,
+        10.90448218591569, 10.90648185252736, 10.90848151926135, 10.91048118611758,
+        10.912480853096, 10.91448052019654, 10.91648018741912, 10.91847985476368,
+        10.92047952223016, 10.92247918981848, 10.92447885752859, 10.9264785253604,
+        10.92847819331387, 10.93047786138891, 10.93247752958547, 10.93447719790347,
+        10.93647686634285, 10.93847653490354, 10.94047620358548, 10.9424758723886,
+        10.94447554131284, 10.94647521035812, 10.94847487952438, 10.95047454881156,
+        10.95247421821959, 10.95447388774839, 10.95647355739792, 10.95847322716809,
+        10.96047289705885, 10.96247256707013, 10.96447223720186, 10.96647190745397,
+        10.96847157782641, 10.9704712483191, 10.97247091893197, 10.97447058966498,
+        10.97647026051804, 10.97846993149109, 10.98046960258406, 10.9824692737969,
+        10.98446894512954, 10.9864686165819, 10.98846828815393, 10.99046795984556,
+        10.99246763165672, 10.99446730358735, 10.99646697563739, 10.99846664780676,
+        11.00046632009541, 11.00246599250326, 11.00446566503026, 11.00646533767634,
+        11.00846501044143, 11.01046468332547, 11.01246435632839, 11.01446402945014,
+        11.01646370269063, 11.01846337604982, 11.02046304952763, 11.02246272312401,
+        11.02446239683888, 11.02646207067218, 11.02846174462385, 11.03046141869382,
+        11.03246109288203, 11.03446076718842, 11.03646044161292, 11.03846011615546,
+        11.04045979081598, 11.04245946559442, 11.04445914049072, 11.0464588155048,
+        11.04845849063662, 11.05045816588609, 11.05245784125316, 11.05445751673777,
+        11.05645719233984, 11.05845686805932, 11.06045654389615, 11.06245621985025,
+        11.06445589592158, 11.06645557211005, 11.06845524841561, 11.0704549248382,
+        11.07245460137775, 11.0744542780342, 11.07645395480748, 11.07845363169753,
+        11.0804533087043, 11.08245298582771, 11.0844526630677, 11.08645234042421,
+        11.08845201789718, 11.09045169548654, 11.09245137319224, 11.0944510510142,
+        11.09645072895236, 11.09845040700667, 11.10045008517705, 11.10244976346346,
+        11.10444944186581, 11.10644912038406, 11.10844879901813, 11.11044847776798,
+        11.11244815663352, 11.11444783561471, 11.11644751471147, 11.11844719392376,
+        11.12044687325149, 11.12244655269462, 11.12444623225308, 11.1264459119268,
+        11.12844559171573, 11.1304452716198, 11.13244495163896, 11.13444463177313,
+        11.13644431202226, 11.13844399238628, 11.14044367286514, 11.14244335345877,
+        11.14444303416711, 11.1464427149901, 11.14844239592768, 11.15044207697977,
+        11.15244175814634, 11.1544414394273, 11.1564411208226, 11.15844080233219,
+        11.16044048395599, 11.16244016569394, 11.16443984754599, 11.16643952951207,
+        11.16843921159213, 11.17043889378609, 11.17243857609391, 11.17443825851551,
+        11.17643794105084, 11.17843762369984, 11.18043730646244, 11.18243698933859,
+        11.18443667232821, 11.18643635543127, 11.18843603864768, 11.1904357219774,
+        11.19243540542035, 11.19443508897649, 11.19643477264574, 11.19843445642805,
+        11.20043414032336, 11.20243382433161, 11.20443350845274, 11.20643319268668,
+        11.20843287703337, 11.21043256149277, 11.21243224606479, 11.2144319307494,
+        11.21643161554651, 11.21843130045609, 11.22043098547805, 11.22243067061236,
+        11.22443035585893, 11.22643004121772, 11.22842972668867, 11.23042941227171,
+        11.23242909796679, 11.23442878377384, 11.2364284696928, 11.23842815572362,
+        11.24042784186624, 11.24242752812059, 11.24442721448662, 11.24642690096427,
+        11.24842658755347, 11.25042627425417, 11.25242596106631, 11.25442564798983,
+        11.25642533502467, 11.25842502217077, 11.26042470942807, 11.26242439679651,
+        11.26442408427604, 11.26642377186659, 11.2684234595681, 11.27042314738052,
+        11.27242283530379, 11.27442252333784, 11.27642221148262, 11.27842189973807,
+        11.28042158810413, 11.28242127658075, 11.28442096516785, 11.28642065386539,
+        11.28842034267331, 11.29042003159154, 11.29241972062004, 11.29441940975873,
+        11.29641909900756, 11.29841878836648, 11.30041847783542, 11.30241816741433,
+        11.30441785710314, 11.3064175469018, 11.30841723681026, 11.31041692682845,
+        11.31241661695631, 11.31441630719379, 11.31641599754083, 11.31841568799737,
+        11.32041537856335, 11.32241506923871, 11.3244147600234, 11.32641445091736,
+        11.32841414192053, 11.33041383303286, 11.33241352425428, 11.33441321558473,
+        11.33641290702417, 11.33841259857252, 11.34041229022975, 11.34241198199577,
+        11.34441167387055, 11.34641136585402, 11.34841105794612, 11.3504107501468,
+        11.352410442456, 11.35441013487367, 11.35640982739973, 11.35840952003415,
+        11.36040921277685, 11.36240890562779, 11.3644085985869, 11.36640829165414,
+        11.36840798482943, 11.37040767811273, 11.37240737150398, 11.37440706500312,
+        11.37640675861009, 11.37840645232484, 11.38040614614731, 11.38240584007744,
+        11.38440553411518, 11.38640522826048, 11.38840492251326, 11.39040461687348,
+        11.39240431134108, 11.39440400591601, 11.3964037005982, 11.39840339538761,
+        11.40040309028417, 11.40240278528782, 11.40440248039852, 11.4064021756162,
+        11.40840187094082, 11.4104015663723, 11.41240126191061, 11.41440095755567,
+        11.41640065330744, 11.41840034916585, 11.42040004513086, 11.42239974120241,
+        11.42439943738043, 11.42639913366488, 11.4283988300557, 11.43039852655283,
+        11.43239822315622, 11.43439791986582, 11.43639761668155, 11.43839731360338,
+        11.44039701063124, 11.44239670776508, 11.44439640500484, 11.44639610235047,
+        11.44839579980191, 11.45039549735911, 11.45239519502202, 11.45439489279056,
+        11.4563945906647, 11.45839428864437, 11.46039398672953, 11.46239368492011,
+        11.46439338321605, 11.46639308161732, 11.46839278012384, 11.47039247873557,
+        11.47239217745244, 11.47439187627442, 11.47639157520143, 11.47839127423342,
+        11.48039097337035, 11.48239067261215, 11.48439037195877, 11.48639007141015,
+        11.48838977096625, 11.49038947062701, 11.49238917039236, 11.49438887026226,
+        11.49638857023666, 11.49838827031549, 11.5003879704987, 11.50238767078625,
+        11.50438737117806, 11.5063870716741, 11.50838677227431, 11.51038647297862,
+        11.512386173787, 11.51438587469937, 11.5163855757157, 11.51838527683592,
+        11.52038497805998, 11.52238467938782, 11.5243843808194, 11.52638408235466,
+        11.52838378399354, 11.530383485736, 11.53238318758197, 11.5343828895314,
+        11.53638259158424, 11.53838229374044, 11.54038199599994, 11.54238169836268,
+        11.54438140082863, 11.54638110339771, 11.54838080606988, 11.55038050884508,
+        11.55238021172326, 11.55437991470437, 11.55637961778835, 11.55837932097515,
+        11.56037902426472, 11.562378727657, 11.56437843115194, 11.56637813474949,
+        11.56837783844959, 11.57037754225219, 11.57237724615724, 11.57437695016468,
+        11.57637665427446, 11.57837635848653, 11.58037606280084, 11.58237576721733,
+        11.58437547173594, 11.58637517635663, 11.58837488107935, 11.59037458590404,
+        11.59237429083064, 11.59437399585911, 11.59637370098939, 11.59837340622143,
+        11.60037311155517, 11.60237281699057, 11.60437252252758, 11.60637222816613,
+        11.60837193390618, 11.61037163974767, 11.61237134569055, 11.61437105173478,
+        11.61637075788029, 11.61837046412703, 11.62037017047496, 11.62236987692402,
+        11.62436958347416, 11.62636929012532, 11.62836899687746, 11.63036870373052,
+        11.63236841068445, 11.63436811773919, 11.63636782489471, 11.63836753215093,
+        11.64036723950782, 11.64236694696532, 11.64436665452337, 11.64636636218194,
+        11.64836606994095, 11.65036577780037, 11.65236548576014, 11.65436519382022,
+        11.65636490198053, 11.65836461024105, 11.66036431860171, 11.66236402706246,
+        11.66436373562326, 11.66636344428404, 11.66836315304476, 11.67036286190538,
+        11.67236257086582, 11.67436227992606, 11.67636198908602, 11.67836169834567,
+        11.68036140770495, 11.68236111716381, 11.6843608267222, 11.68636053638007,
+        11.68836024613736, 11.69035995599403, 11.69235966595002, 11.69435937600529,
+        11.69635908615978, 11.69835879641344, 11.70035850676622, 11.70235821721808,
+        11.70435792776895, 11.70635763841879, 11.70835734916755, 11.71035706001518,
+        11.71235677096162, 11.71435648200683, 11.71635619315076, 11.71835590439335,
+        11.72035561573455, 11.72235532717432, 11.7243550387126, 11.72635475034935,
+        11.7283544620845, 11.73035417391802, 11.73235388584986, 11.73435359787995,
+        11.73635331000826, 11.73835302223472, 11.7403527345593, 11.74235244698194,
+        11.74435215950259, 11.74635187212121, 11.74835158483773, 11.75035129765211,
+        11.75235101056431, 11.75435072357427, 11.75635043668193, 11.75835014988726,
+        11.7603498631902, 11.7623495765907, 11.76434929008872, 11.76634900368419,
+        11.76834871737708, 11.77034843116733, 11.7723481450549, 11.77434785903973,
+        11.77634757312177, 11.77834728730098, 11.7803470015773, 11.78234671595069,
+        11.78434643042109, 11.78634614498847, 11.78834585965276, 11.79034557441391,
+        11.79234528927189, 11.79434500422663, 11.7963447192781, 11.79834443442624,
+        11.800344149671, 11.80234386501233, 11.80434358045019, 11.80634329598452,
+        11.80834301161528, 11.81034272734241, 11.81234244316587, 11.81434215908562,
+        11.81634187510159, 11.81834159121374, 11.82034130742203, 11.82234102372639,
+        11.8243407401268, 11.82634045662319, 11.82834017321552, 11.83033988990373,
+        11.83233960668779, 11.83433932356764, 11.83633904054323, 11.83833875761451,
+        11.84033847478145, 11.84233819204398, 11.84433790940205, 11.84633762685563,
+        11.84833734440467, 11.8503370620491, 11.85233677978889, 11.85433649762399,
+        11.85633621555435, 11.85833593357992, 11.86033565170065, 11.8623353699165,
+        11.86433508822742, 11.86633480663335, 11.86833452513425, 11.87033424373008,
+        11.87233396242078, 11.87433368120631, 11.87633340008661, 11.87833311906165,
+        11.88033283813137, 11.88233255729573, 11.88433227655467, 11.88633199590815,
+        11.88833171535613, 11.89033143489855, 11.89233115453536, 11.89433087426653,
+        11.89633059409199, 11.89833031401171, 11.90033003402564, 11.90232975413373,
+        11.90432947433593, 11.90632919463219, 11.90832891502246, 11.91032863550671,
+        11.91232835608488, 11.91432807675693, 11.9163277975228, 11.91832751838245,
+        11.92032723933583, 11.9223269603829, 11.92432668152361, 11.92632640275791,
+        11.92832612408576, 11.9303258455071, 11.9323255670219, 11.93432528863009,
+        11.93632501033165, 11.93832473212651, 11.94032445401463, 11.94232417599597,
+        11.94432389807048, 11.94632362023812, 11.94832334249882, 11.95032306485256,
+        11.95232278729928, 11.95432250983893, 11.95632223247148, 11.95832195519686,
+        11.96032167801504, 11.96232140092597, 11.9643211239296, 11.96632084702589,
+        11.96832057021479, 11.97032029349625, 11.97232001687023, 11.97431974033667,
+        11.97631946389555, 11.97831918754679, 11.98031891129038, 11.98231863512624,
+        11.98431835905435, 11.98631808307465, 11.98831780718709, 11.99031753139164,
+        11.99231725568824, 11.99431698007684, 11.99631670455742, 11.9983164291299,
+        12.00031615379426, 12.00231587855044, 12.00431560339841, 12.0063153283381,
+        12.00831505336948, 12.0103147784925, 12.01231450370712, 12.01431422901329,
+        12.01631395441096, 12.01831367990009, 12.02031340548063, 12.02231313115254,
+        12.02431285691577, 12.02631258277028, 12.02831230871602, 12.03031203475294,
+        12.032311760881, 12.03431148710016, 12.03631121341036, 12.03831093981157,
+        12.04031066630373, 12.04231039288681, 12.04431011956076, 12.04630984632552,
+        12.04830957318107, 12.05030930012734, 12.0523090271643, 12.05430875429191,
+        12.0563084815101, 12.05830820881885, 12.06030793621811, 12.06230766370782,
+        12.06430739128796, 12.06630711895846, 12.06830684671929, 12.0703065745704,
+        12.07230630251175, 12.07430603054328, 12.07630575866497, 12.07830548687676,
+        12.0803052151786, 12.08230494357046, 12.08430467205228, 12.08630440062403,
+        12.08830412928565, 12.09030385803711, 12.09230358687836, 12.09430331580935,
+        12.09630304483004, 12.09830277394039, 12.10030250314035, 12.10230223242988,
+        12.10430196180893, 12.10630169127746, 12.10830142083542, 12.11030115048277,
+        12.11230088021946, 12.11430061004546, 12.11630033996071, 12.11830006996517,
+        12.12029980005881, 12.12229953024156, 12.1242992605134, 12.12629899087427,
+        12.12829872132414, 12.13029845186295, 12.13229818249067, 12.13429791320724,
+        12.13629764401264, 12.1382973749068, 12.14029710588969, 12.14229683696127,
+        12.14429656812149, 12.1462962993703, 12.14829603070767, 12.15029576213355,
+        12.15229549364789, 12.15429522525065, 12.15629495694179, 12.15829468872127,
+        12.16029442058904, 12.16229415254505, 12.16429388458927, 12.16629361672165,
+        12.16829334894215, 12.17029308125072, 12.17229281364732, 12.17429254613191,
+        12.17629227870444, 12.17829201136487, 12.18029174411315, 12.18229147694926,
+        12.18429120987313, 12.18629094288472, 12.18829067598401, 12.19029040917093,
+        12.19229014244545, 12.19428987580752, 12.19628960925711, 12.19828934279416,
+        12.20028907641864, 12.2022888101305, 12.2042885439297, 12.2062882778162,
+        12.20828801178995, 12.21028774585091, 12.21228747999904, 12.21428721423429,
+        12.21628694855663, 12.218286682966, 12.22028641746238, 12.2222861520457,
+        12.22428588671594, 12.22628562147305, 12.22828535631698, 12.23028509124769,
+        12.23228482626515, 12.2342845613693, 12.23628429656011, 12.23828403183754,
+        12.24028376720153, 12.24228350265205, 12.24428323818906, 12.24628297381251,
+        12.24828270952237, 12.25028244531858, 12.25228218120111, 12.25428191716991,
+        12.25628165322494, 12.25828138936617, 12.26028112559354, 12.26228086190702,
+        12.26428059830656, 12.26628033479213, 12.26828007136367, 12.27027980802115,
+        12.27227954476452, 12.27427928159375, 12.27627901850879, 12.2782787555096,
+        12.28027849259614, 12.28227822976836, 12.28427796702622, 12.28627770436969,
+        12.28827744179872, 12.29027717931326, 12.29227691691329, 12.29427665459874,
+        12.29627639236959, 12.2982761302258, 12.30027586816731, 12.30227560619409,
+        12.30427534430609, 12.30627508250329, 12.30827482078562, 12.31027455915306,
+        12.31227429760556, 12.31427403614307, 12.31627377476557, 12.318273513473,
+        12.32027325226532, 12.3222729911425, 12.32427273010449, 12.32627246915126,
+        12.32827220828275, 12.33027194749893, 12.33227168679976, 12.33427142618519,
+        12.33627116565519, 12.33827090520972, 12.34027064484872, 12.34227038457217,
+        12.34427012438002, 12.34626986427223, 12.34826960424875, 12.35026934430956,
+        12.3522690844546, 12.35426882468384, 12.35626856499723, 12.35826830539473,
+        12.36026804587631, 12.36226778644192, 12.36426752709153, 12.36626726782508,
+        12.36826700864255, 12.37026674954388, 12.37226649052904, 12.37426623159799,
+        12.37626597275069, 12.37826571398709, 12.38026545530717, 12.38226519671086,
+        12.38426493819814, 12.38626467976897, 12.3882644214233, 12.3902641631611,
+        12.39226390498232, 12.39426364688692, 12.39626338887486, 12.39826313094611,
+        12.40026287310062, 12.40226261533835, 12.40426235765926, 12.40626210006331,
+        12.40826184255047, 12.41026158512068, 12.41226132777392, 12.41426107051014,
+        12.41626081332929, 12.41826055623135, 12.42026029921627, 12.42226004228401,
+        12.42425978543453, 12.42625952866779, 12.42825927198375, 12.43025901538237,
+        12.43225875886361, 12.43425850242743, 12.43625824607379, 12.43825798980265,
+        12.44025773361398, 12.44225747750772, 12.44425722148385, 12.44625696554232,
+        12.44825670968309, 12.45025645390613, 12.45225619821139, 12.45425594259883,
+        12.45625568706841, 12.4582554316201, 12.46025517625386, 12.46225492096964,
+        12.4642546657674, 12.46625441064712, 12.46825415560873, 12.47025390065222,
+        12.47225364577753, 12.47425339098464, 12.47625313627349, 12.47825288164405,
+        12.48025262709628, 12.48225237263015, 12.4842521182456, 12.48625186394261,
+        12.48825160972114, 12.49025135558113, 12.49225110152257, 12.4942508475454,
+        12.49625059364959, 12.49825033983509, 12.50025008610188, 12.5022498324499,
+        12.50424957887913, 12.50624932538952, 12.50824907198103, 12.51024881865362,
+        12.51224856540727, 12.51424831224192, 12.51624805915753, 12.51824780615408,
+        12.52024755323151, 12.5222473003898, 12.5242470476289, 12.52624679494877,
+        12.52824654234938, 12.53024628983069, 12.53224603739266, 12.53424578503524,
+        12.5362455327584, 12.53824528056211, 12.54024502844632, 12.542244776411,
+        12.5442445244561, 12.54624427258159, 12.54824402078743, 12.55024376907358,
+        12.55224351744001, 12.55424326588667, 12.55624301441352, 12.55824276302054,
+        12.56024251170767, 12.56224226047489, 12.56424200932215, 12.56624175824941,
+        12.56824150725664, 12.5702412563438, 12.57224100551085, 12.57424075475775,
+        12.57624050408446, 12.57824025349096, 12.58024000297719, 12.58223975254312,
+        12.58423950218871, 12.58623925191392, 12.58823900171873, 12.59023875160308,
+        12.59223850156694, 12.59423825161027, 12.59623800173304, 12.5982377519352,
+        12.60023750221672, 12.60223725257757, 12.60423700301769, 12.60623675353707,
+        12.60823650413565, 12.6102362548134, 12.61223600557028, 12.61423575640626,
+        12.6162355073213, 12.61823525831535, 12.62023500938839, 12.62223476054037,
+        12.62423451177126, 12.62623426308102, 12.62823401446961, 12.63023376593699,
+        12.63223351748314, 12.634233269108, 12.63623302081154, 12.63823277259373,
+        12.64023252445453, 12.64223227639389, 12.64423202841179, 12.64623178050819,
+        12.64823153268305, 12.65023128493632, 12.65223103726798, 12.65423078967799,
+        12.6562305421663, 12.65823029473289, 12.66023004737772, 12.66222980010074,
+        12.66422955290193, 12.66622930578124, 12.66822905873863, 12.67022881177408,
+        12.67222856488754, 12.67422831807898, 12.67622807134836, 12.67822782469564,
+        12.68022757812078, 12.68222733162376, 12.68422708520452, 12.68622683886304,
+        12.68822659259928, 12.69022634641321, 12.69222610030478, 12.69422585427395,
+        12.6962256083207, 12.69822536244498, 12.70022511664676, 12.70222487092601,
+        12.70422462528268, 12.70622437971673, 12.70822413422814, 12.71022388881687,
+        12.71222364348287, 12.71422339822612, 12.71622315304657, 12.7182229079442,
+        12.72022266291895, 12.72222241797081, 12.72422217309972, 12.72622192830566,
+        12.72822168358859, 12.73022143894847, 12.73222119438526, 12.73422094989893,
+        12.73622070548945, 12.73822046115677, 12.74022021690086, 12.74221997272169,
+        12.74421972861922, 12.74621948459341, 12.74821924064422, 12.75021899677162,
+        12.75221875297558, 12.75421850925606, 12.75621826561302, 12.75821802204642,
+        12.76021777855624, 12.76221753514242, 12.76421729180495, 12.76621704854378,
+        12.76821680535888, 12.7702165622502, 12.77221631921772, 12.7742160762614,
+        12.77621583338121, 12.7782155905771, 12.78021534784904, 12.782215105197,
+        12.78421486262094, 12.78621462012082, 12.78821437769662, 12.79021413534828,
+        12.79221389307579, 12.79421365087909, 12.79621340875817, 12.79821316671297,
+        12.80021292474347, 12.80221268284963, 12.80421244103142, 12.80621219928879,
+        12.80821195762172, 12.81021171603017, 12.8122114745141, 12.81421123307348,
+        12.81621099170827, 12.81821075041844, 12.82021050920395, 12.82221026806477,
+        12.82421002700086, 12.82620978601218, 12.82820954509871, 12.8302093042604,
+        12.83220906349722, 12.83420882280914, 12.83620858219612, 12.83820834165812,
+        12.84020810119511, 12.84220786080706, 12.84420762049393, 12.84620738025569,
+        12.84820714009229, 12.85020690000371, 12.85220665998991, 12.85420642005086,
+        12.85620618018651, 12.85820594039685, 12.86020570068182, 12.8622054610414,
+        12.86420522147555, 12.86620498198424, 12.86820474256743, 12.87020450322508,
+        12.87220426395717, 12.87420402476365, 12.8762037856445, 12.87820354659968,
+        12.88020330762915, 12.88220306873288, 12.88420282991083, 12.88620259116297,
+        12.88820235248927, 12.89020211388969, 12.8922018753642, 12.89420163691276,
+        12.89620139853533, 12.89820116023189, 12.90020092200239, 12.90220068384681,
+        12.90420044576511, 12.90620020775726, 12.90819996982322, 12.91019973196295,
+        12.91219949417642, 12.91419925646361, 12.91619901882447, 12.91819878125896,
+        12.92019854376707, 12.92219830634874, 12.92419806900395, 12.92619783173266,
+        12.92819759453485, 12.93019735741047, 12.93219712035948, 12.93419688338187,
+        12.93619664647759, 12.9381964096466, 12.94019617288888, 12.9421959362044,
+        12.9441956995931, 12.94619546305498, 12.94819522658997, 12.95019499019807,
+        12.95219475387923, 12.95419451763341, 12.95619428146059, 12.95819404536072,
+        12.96019380933378, 12.96219357337974, 12.96419333749855, 12.96619310169019,
+        12.96819286595462, 12.9701926302918, 12.97219239470171, 12.97419215918431,
+        12.97619192373956, 12.97819168836744, 12.98019145306791, 12.98219121784093,
+        12.98419098268648, 12.98619074760451, 12.988190512595, 12.99019027765791,
+        12.9921900427932, 12.99418980800086, 12.99618957328083, 12.99818933863309,
+        13.00018910405761, 13.00218886955435, 13.00418863512327, 13.00618840076435,
+        13.00818816647755, 13.01018793226284, 13.01218769812019, 13.01418746404955,
+        13.0161872300509, 13.01818699612421, 13.02018676226944, 13.02218652848656,
+        13.02418629477554, 13.02618606113634, 13.02818582756892, 13.03018559407327,
+        13.03218536064934, 13.03418512729709, 13.03618489401651, 13.03818466080755,
+        13.04018442767018, 13.04218419460437, 13.04418396161008, 13.04618372868729,
+        13.04818349583596, 13.05018326305605, 13.05218303034754, 13.05418279771039,
+        13.05618256514457, 13.05818233265004, 13.06018210022678, 13.06218186787474,
+        13.06418163559391, 13.06618140338424, 13.0681811712457, 13.07018093917826,
+        13.07218070718189, 13.07418047525655, 13.07618024340221, 13.07818001161884,
+        13.08017977990641, 13.08217954826488, 13.08417931669423, 13.08617908519441,
+        13.0881788537654, 13.09017862240716, 13.09217839111966, 13.09417815990288,
+        13.09617792875677, 13.0981776976813, 13.10017746667645, 13.10217723574217,
+        13.10417700487845, 13.10617677408523, 13.1081765433625, 13.11017631271022,
+        13.11217608212836, 13.11417585161689, 13.11617562117577, 13.11817539080497,
+        13.12017516050446, 13.1221749302742, 13.12417470011418, 13.12617447002434,
+        13.12817424000467, 13.13017401005512, 13.13217378017567, 13.13417355036629,
+        13.13617332062694, 13.13817309095759, 13.1401728613582, 13.14217263182876,
+        13.14417240236922, 13.14617217297955, 13.14817194365973, 13.15017171440971,
+        13.15217148522947, 13.15417125611898, 13.1561710270782, 13.1581707981071,
+        13.16017056920565, 13.16217034037382, 13.16417011161158, 13.16616988291889,
+        13.16816965429572, 13.17016942574205, 13.17216919725784, 13.17416896884305,
+        13.17616874049766, 13.17816851222164, 13.18016828401495, 13.18216805587756,
+        13.18416782780944, 13.18616759981056, 13.18816737188089, 13.1901671440204,
+        13.19216691622905, 13.19416668850681, 13.19616646085365, 13.19816623326954,
+        13.20016600575445, 13.20216577830835, 13.20416555093121, 13.20616532362299,
+        13.20816509638366, 13.21016486921319, 13.21216464211156, 13.21416441507872,
+        13.21616418811466, 13.21816396121933, 13.2201637343927, 13.22216350763475,
+        13.22416328094545, 13.22616305432475, 13.22816282777264, 13.23016260128908,
+        13.23216237487403, 13.23416214852748, 13.23616192224938, 13.2381616960397,
+        13.24016146989843, 13.24216124382551, 13.24416101782093, 13.24616079188465,
+        13.24816056601664, 13.25016034021687, 13.25216011448531, 13.25415988882193,
+        13.25615966322669, 13.25815943769957, 13.26015921224054, 13.26215898684956,
+        13.26415876152661, 13.26615853627165, 13.26815831108465, 13.27015808596559,
+        13.27215786091442, 13.27415763593113, 13.27615741101567, 13.27815718616803,
+        13.28015696138816, 13.28215673667604, 13.28415651203164, 13.28615628745492,
+        13.28815606294586, 13.29015583850442, 13.29215561413059, 13.29415538982431,
+        13.29615516558557, 13.29815494141433, 13.30015471731057, 13.30215449327424,
+        13.30415426930533, 13.3061540454038, 13.30815382156963, 13.31015359780277,
+        13.3121533741032, 13.3141531504709, 13.31615292690582, 13.31815270340795,
+        13.32015247997724, 13.32215225661367, 13.32415203331721, 13.32615181008783,
+        13.3281515869255, 13.33015136383019, 13.33215114080186, 13.3341509178405,
+        13.33615069494606, 13.33815047211852, 13.34015024935784, 13.342150026664,
+        13.34414980403698, 13.34614958147672, 13.34814935898322, 13.35014913655643,
+        13.35214891419633, 13.35414869190289, 13.35614846967608, 13.35814824751586,
+        13.36014802542221, 13.3621478033951, 13.36414758143449, 13.36614735954037,
+        13.36814713771269, 13.37014691595143, 13.37214669425656, 13.37414647262805,
+        13.37614625106587, 13.37814602956998, 13.38014580814037, 13.38214558677699,
+        13.38414536547983, 13.38614514424884, 13.38814492308401, 13.3901447019853,
+        13.39214448095268, 13.39414425998612, 13.39614403908559, 13.39814381825107,
+        13.40014359748251, 13.40214337677991, 13.40414315614321, 13.4061429355724,
+        13.40814271506745, 13.41014249462832, 13.41214227425499, 13.41414205394742,
+        13.41614183370559, 13.41814161352947, 13.42014139341903, 13.42214117337423,
+        13.42414095339506, 13.42614073348147, 13.42814051363345, 13.43014029385096,
+        13.43214007413397, 13.43413985448246, 13.43613963489639, 13.43813941537573,
+        13.44013919592046, 13.44213897653054, 13.44413875720596, 13.44613853794667,
+        13.44813831875265, 13.45013809962387, 13.4521378805603, 13.45413766156191,
+        13.45613744262867, 13.45813722376056, 13.46013700495754, 13.46213678621959,
+        13.46413656754667, 13.46613634893876, 13.46813613039583, 13.47013591191785,
+        13.47213569350479, 13.47413547515662, 13.47613525687331, 13.47813503865484,
+        13.48013482050117, 13.48213460241228, 13.48413438438814, 13.48613416642871,
+        13.48813394853398, 13.4901337307039, 13.49213351293846, 13.49413329523762,
+        13.49613307760135, 13.49813286002963, 13.50013264252243, 13.50213242507972,
+        13.50413220770147, 13.50613199038764, 13.50813177313822, 13.51013155595318,
+        13.51213133883248, 13.5141311217761, 13.516130904784, 13.51813068785617,
+        13.52013047099256, 13.52213025419316, 13.52413003745794, 13.52612982078685,
+        13.52812960417989, 13.53012938763702, 13.5321291711582, 13.53412895474342,
+        13.53612873839264, 13.53812852210584, 13.54012830588298, 13.54212808972404,
+        13.544127873629, 13.54612765759781, 13.54812744163046, 13.55012722572691,
+        13.55212700988714, 13.55412679411112, 13.55612657839882, 13.55812636275022,
+        13.56012614716527, 13.56212593164397, 13.56412571618627, 13.56612550079215,
+        13.56812528546158, 13.57012507019454, 13.57212485499099, 13.57412463985091,
+        13.57612442477427, 13.57812420976104, 13.58012399481119, 13.5821237799247,
+        13.58412356510153, 13.58612335034167, 13.58812313564507, 13.59012292101172,
+        13.59212270644159, 13.59412249193464, 13.59612227749085, 13.5981220631102,
+        13.60012184879265, 13.60212163453817, 13.60412142034674, 13.60612120621834,
+        13.60812099215292, 13.61012077815047, 13.61212056421096, 13.61412035033436,
+        13.61612013652064, 13.61811992276977, 13.62011970908173, 13.62211949545649,
+        13.62411928189402, 13.62611906839429, 13.62811885495727, 13.63011864158295,
+        13.63211842827129, 13.63411821502226, 13.63611800183583, 13.63811778871198,
+        13.64011757565068, 13.64211736265191, 13.64411714971563, 13.64611693684181,
+        13.64811672403044, 13.65011651128148, 13.65211629859491, 13.65411608597069,
+        13.65611587340881, 13.65811566090922, 13.66011544847192, 13.66211523609686,
+        13.66411502378402, 13.66611481153338, 13.6681145993449, 13.67011438721856,
+        13.67211417515433, 13.67411396315219, 13.67611375121211, 13.67811353933405,
+        13.680113327518, 13.68211311576393, 13.6841129040718, 13.68611269244159,
+        13.68811248087328, 13.69011226936683, 13.69211205792223, 13.69411184653944,
+        13.69611163521843, 13.69811142395918, 13.70011121276167, 13.70211100162585,
+        13.70411079055172, 13.70611057953924, 13.70811036858838, 13.71011015769911,
+        13.71210994687142, 13.71410973610527, 13.71610952540063, 13.71810931475749,
+        13.7201091041758, 13.72210889365555, 13.72410868319671, 13.72610847279925,
+        13.72810826246314, 13.73010805218837, 13.73210784197489, 13.73410763182269,
+        13.73610742173173, 13.738107211702, 13.74010700173345, 13.74210679182608,
+        13.74410658197985, 13.74610637219473, 13.74810616247069, 13.75010595280772,
+        13.75210574320578, 13.75410553366485, 13.7561053241849, 13.7581051147659,
+        13.76010490540783, 13.76210469611066, 13.76410448687436, 13.76610427769891,
+        13.76810406858429, 13.77010385953045, 13.77210365053739, 13.77410344160507,
+        13.77610323273346, 13.77810302392254, 13.78010281517228, 13.78210260648266,
+        13.78410239785365, 13.78610218928522, 13.78810198077735, 13.79010177233001,
+        13.79210156394317, 13.79410135561681, 13.7961011473509, 13.79810093914542,
+        13.80010073100033, 13.80210052291562, 13.80410031489125, 13.80610010692721,
+        13.80809989902345, 13.81009969117997, 13.81209948339673, 13.8140992756737,
+        13.81609906801086, 13.81809886040818, 13.82009865286564, 13.82209844538321,
+        13.82409823796087, 13.82609803059858, 13.82809782329633, 13.83009761605408,
+        13.83209740887182, 13.8340972017495, 13.83609699468712, 13.83809678768464,
+        13.84009658074203, 13.84209637385928, 13.84409616703635, 13.84609596027322,
+        13.84809575356986, 13.85009554692624, 13.85209534034235, 13.85409513381815,
+        13.85609492735363, 13.85809472094874, 13.86009451460347, 13.8620943083178,
+        13.86409410209169, 13.86609389592512, 13.86809368981806, 13.8700934837705,
+        13.87209327778239, 13.87409307185372, 13.87609286598447, 13.8780926601746,
+        13.88009245442409, 13.88209224873291, 13.88409204310104, 13.88609183752846,
+        13.88809163201513, 13.89009142656104, 13.89209122116615, 13.89409101583044,
+        13.89609081055389, 13.89809060533646, 13.90009040017814, 13.9020901950789,
+        13.90408999003871, 13.90608978505755, 13.90808958013539, 13.91008937527221,
+        13.91208917046798, 13.91408896572267, 13.91608876103626, 13.91808855640873,
+        13.92008835184005, 13.9220881473302, 13.92408794287914, 13.92608773848685,
+        13.92808753415331, 13.9300873298785, 13.93208712566238, 13.93408692150494,
+        13.93608671740614, 13.93808651336596, 13.94008630938438, 13.94208610546138,
+        13.94408590159691, 13.94608569779097, 13.94808549404353, 13.95008529035455,
+        13.95208508672402, 13.95408488315191, 13.95608467963819, 13.95808447618285,
+        13.96008427278585, 13.96208406944717, 13.96408386616678, 13.96608366294466,
+        13.96808345978079, 13.97008325667514, 13.97208305362768, 13.97408285063839,
+        13.97608264770725, 13.97808244483423, 13.9800822420193, 13.98208203926244,
+        13.98408183656362, 13.98608163392283, 13.98808143134003, 13.9900812288152,
+        13.99208102634831, 13.99408082393935, 13.99608062158828, 13.99808041929508,
+        14.00008021705973, 14.0020800148822, 14.00407981276246, 14.0060796107005,
+        14.00807940869628, 14.01007920674979, 14.01207900486099, 14.01407880302987,
+        14.01607860125639, 14.01807839954054, 14.02007819788228, 14.0220779962816,
+        14.02407779473847, 14.02607759325287, 14.02807739182476, 14.03007719045413,
+        14.03207698914095, 14.03407678788519, 14.03607658668684, 14.03807638554587,
+        14.04007618446224, 14.04207598343595, 14.04407578246696, 14.04607558155525,
+        14.04807538070079, 14.05007517990357, 14.05207497916355, 14.05407477848071,
+        14.05607457785503, 14.05807437728648, 14.06007417677504, 14.06207397632068,
+        14.06407377592338, 14.06607357558312, 14.06807337529986, 14.0700731750736,
+        14.0720729749043, 14.07407277479193, 14.07607257473648, 14.07807237473791,
+        14.08007217479622, 14.08207197491136, 14.08407177508332, 14.08607157531207,
+        14.08807137559759, 14.09007117593986, 14.09207097633884, 14.09407077679452,
+        14.09607057730687, 14.09807037787587, 14.10007017850149, 14.10206997918371,
+        14.10406977992251, 14.10606958071785, 14.10806938156973, 14.11006918247811,
+        14.11206898344296, 14.11406878446427, 14.11606858554201, 14.11806838667616,
+        14.12006818786669, 14.12206798911359, 14.12406779041681, 14.12606759177635,
+        14.12806739319217, 14.13006719466426, 14.13206699619258, 14.13406679777713,
+        14.13606659941786, 14.13806640111476, 14.14006620286781, 14.14206600467697,
+        14.14406580654223, 14.14606560846357, 14.14806541044095, 14.15006521247436,
+        14.15206501456376, 14.15406481670915, 14.15606461891049, 14.15806442116776,
+        14.16006422348093, 14.16206402584999, 14.16406382827491, 14.16606363075566,
+        14.16806343329222, 14.17006323588458, 14.17206303853269, 14.17406284123655,
+        14.17606264399612, 14.17806244681139, 14.18006224968233, 14.18206205260891,
+        14.18406185559111, 14.18606165862892, 14.1880614617223, 14.19006126487123,
+        14.1920610680757, 14.19406087133566, 14.19606067465111, 14.19806047802202,
+        14.20006028144836, 14.20206008493011, 14.20405988846726, 14.20605969205976,
+        14.20805949570761, 14.21005929941077, 14.21205910316923, 14.21405890698296,
+        14.21605871085194, 14.21805851477615, 14.22005831875555, 14.22205812279013,
+        14.22405792687987, 14.22605773102474, 14.22805753522471, 14.23005733947978,
+        14.2320571437899, 14.23405694815506, 14.23605675257524, 14.2380565570504,
+        14.24005636158054, 14.24205616616562, 14.24405597080563, 14.24605577550053,
+        14.24805558025031, 14.25005538505495, 14.25205518991441, 14.25405499482868,
+        14.25605479979774, 14.25805460482155, 14.26005440990011, 14.26205421503337,
+        14.26405402022133, 14.26605382546396, 14.26805363076124, 14.27005343611313,
+        14.27205324151963, 14.2740530469807, 14.27605285249633, 14.27805265806649,
+        14.28005246369115, 14.2820522693703, 14.28405207510392, 14.28605188089197,
+        14.28805168673444, 14.2900514926313, 14.29205129858253, 14.29405110458811,
+        14.29605091064802, 14.29805071676223, 14.30005052293071, 14.30205032915346,
+        14.30405013543044, 14.30604994176163, 14.308049748147, 14.31004955458655,
+        14.31204936108023, 14.31404916762804, 14.31604897422994, 14.31804878088592,
+        14.32004858759596, 14.32204839436002, 14.32404820117808, 14.32604800805014,
+        14.32804781497615, 14.3300476219561, 14.33204742898997, 14.33404723607774,
+        14.33604704321937, 14.33804685041486, 14.34004665766417, 14.34204646496728,
+        14.34404627232417, 14.34604607973483, 14.34804588719922, 14.35004569471732,
+        14.35204550228912, 14.35404530991458, 14.35604511759369, 14.35804492532643,
+        14.36004473311276, 14.36204454095268, 14.36404434884615, 14.36604415679315,
+        14.36804396479367, 14.37004377284768, 14.37204358095516, 14.37404338911608,
+        14.37604319733042, 14.37804300559816, 14.38004281391929, 14.38204262229376,
+        14.38404243072157, 14.3860422392027, 14.38804204773711, 14.39004185632479,
+        14.39204166496571, 14.39404147365986, 14.3960412824072, 14.39804109120773,
+        14.40004090006141, 14.40204070896822, 14.40404051792814, 14.40604032694116,
+        14.40804013600724, 14.41003994512637, 14.41203975429852, 14.41403956352367,
+        14.4160393728018, 14.41803918213289, 14.42003899151691, 14.42203880095385,
+        14.42403861044367, 14.42603841998637, 14.42803822958191, 14.43003803923028,
+        14.43203784893145, 14.4340376586854, 14.43603746849211, 14.43803727835156,
+        14.44003708826372, 14.44203689822858, 14.4440367082461, 14.44603651831628,
+        14.44803632843908, 14.45003613861449, 14.45203594884249, 14.45403575912304,
+        14.45603556945614, 14.45803537984175, 14.46003519027987, 14.46203500077045,
+        14.46403481131349, 14.46603462190896, 14.46803443255684, 14.47003424325711,
+        14.47203405400974, 14.47403386481472, 14.47603367567202, 14.47803348658162,
+        14.48003329754351, 14.48203310855764, 14.48403291962402, 14.48603273074261,
+        14.48803254191339, 14.49003235313634, 14.49203216441145, 14.49403197573868,
+        14.49603178711801, 14.49803159854943, 14.50003141003292, 14.50203122156845,
+        14.50403103315599, 14.50603084479554, 14.50803065648706, 14.51003046823054,
+        14.51203028002595, 14.51403009187327, 14.51602990377249, 14.51802971572357,
+        14.5200295277265, 14.52202933978126, 14.52402915188783, 14.52602896404618,
+        14.52802877625629, 14.53002858851814, 14.53202840083171, 14.53402821319699,
+        14.53602802561393, 14.53802783808254, 14.54002765060278, 14.54202746317463,
+        14.54402727579807, 14.54602708847308, 14.54802690119965, 14.55002671397774,
+        14.55202652680734, 14.55402633968842, 14.55602615262097, 14.55802596560496,
+        14.56002577864037, 14.56202559172718, 14.56402540486538, 14.56602521805493,
+        14.56802503129582, 14.57002484458802, 14.57202465793152, 14.57402447132629,
+        14.57602428477232, 14.57802409826957, 14.58002391181804, 14.5820237254177,
+        14.58402353906852, 14.58602335277049, 14.58802316652359, 14.5900229803278,
+        14.59202279418308, 14.59402260808943, 14.59602242204683, 14.59802223605524,
+        14.60002205011465, 14.60202186422505, 14.6040216783864, 14.60602149259869,
+        14.60802130686189, 14.61002112117599, 14.61202093554097, 14.61402074995679,
+        14.61602056442345, 14.61802037894093, 14.62002019350919, 14.62202000812823,
+        14.62401982279801, 14.62601963751852, 14.62801945228974, 14.63001926711165,
+        14.63201908198422, 14.63401889690744, 14.63601871188128, 14.63801852690573,
+        14.64001834198076, 14.64201815710635, 14.64401797228248, 14.64601778750914,
+        14.64801760278629, 14.65001741811392, 14.65201723349202, 14.65401704892055,
+        14.65601686439949, 14.65801667992884, 14.66001649550856, 14.66201631113864,
+        14.66401612681905, 14.66601594254977, 14.66801575833079, 14.67001557416209,
+        14.67201539004363, 14.67401520597541, 14.6760150219574, 14.67801483798958,
+        14.68001465407193, 14.68201447020443, 14.68401428638706, 14.6860141026198,
+        14.68801391890262, 14.69001373523552, 14.69201355161846, 14.69401336805143,
+        14.69601318453441, 14.69801300106737, 14.7000128176503, 14.70201263428317,
+        14.70401245096597, 14.70601226769867, 14.70801208448126, 14.71001190131371,
+        14.71201171819601, 14.71401153512813, 14.71601135211005, 14.71801116914176,
+        14.72001098622322, 14.72201080335443, 14.72401062053536, 14.72601043776599,
+        14.72801025504631, 14.73001007237628, 14.7320098897559, 14.73400970718513,
+        14.73600952466397, 14.73800934219239, 14.74000915977036, 14.74200897739788,
+        14.74400879507491, 14.74600861280145, 14.74800843057746, 14.75000824840294,
+        14.75200806627785, 14.75400788420218, 14.75600770217591, 14.75800752019902,
+        14.76000733827149, 14.76200715639329, 14.76400697456442, 14.76600679278484,
+        14.76800661105454, 14.7700064293735, 14.7720062477417, 14.77400606615912,
+        14.77600588462574, 14.77800570314153, 14.78000552170648, 14.78200534032057,
+        14.78400515898378, 14.78600497769609, 14.78800479645748, 14.79000461526792,
+        14.79200443412741, 14.79400425303591, 14.79600407199341, 14.79800389099989,
+        14.80000371005533, 14.80200352915971, 14.80400334831301, 14.80600316751521,
+        14.80800298676629, 14.81000280606623, 14.81200262541501, 14.81400244481261,
+        14.81600226425901, 14.81800208375419, 14.82000190329814, 14.82200172289082,
+        14.82400154253223, 14.82600136222234, 14.82800118196113, 14.83000100174858,
+        14.83200082158468, 14.8340006414694, 14.83600046140273, 14.83800028138463,
+        14.8400001014151, 14.84199992149412, 14.84399974162166, 14.84599956179771,
+        14.84799938202224, 14.84999920229524, 14.85199902261669, 14.85399884298656,
+        14.85599866340484, 14.85799848387151, 14.85999830438654, 14.86199812494993,
+        14.86399794556164, 14.86599776622167, 14.86799758692998, 14.86999740768657,
+        14.8719972284914, 14.87399704934447, 14.87599687024575, 14.87799669119522,
+        14.87999651219287, 14.88199633323867, 14.88399615433261, 14.88599597547466,
+        14.88799579666481, 14.88999561790303, 14.89199543918931, 14.89399526052363,
+        14.89599508190596, 14.8979949033363, 14.89999472481461, 14.90199454634089,
+        14.9039943679151, 14.90599418953724, 14.90799401120728, 14.9099938329252,
+        14.91199365469099, 14.91399347650462, 14.91599329836608, 14.91799312027534,
+        14.91999294223239, 14.92199276423721, 14.92399258628977, 14.92599240839007,
+        14.92799223053807, 14.92999205273377, 14.93199187497714, 14.93399169726816,
+        14.93599151960681, 14.93799134199308, 14.93999116442694, 14.94199098690838,
+        14.94399080943737, 14.94599063201391, 14.94799045463796, 14.94999027730951,
+        14.95199010002854, 14.95398992279504, 14.95598974560897, 14.95798956847033,
+        14.95998939137909, 14.96198921433524, 14.96398903733876, 14.96598886038962,
+        14.96798868348781, 14.96998850663331, 14.9719883298261, 14.97398815306616,
+        14.97598797635348, 14.97798779968802, 14.97998762306979, 14.98198744649875,
+        14.98398726997488, 14.98598709349817, 14.98798691706861, 14.98998674068616,
+        14.99198656435081, 14.99398638806255, 14.99598621182135, 14.99798603562719,
+        14.99998585948006, 15.00198568337994, 15.0039855073268, 15.00598533132064,
+        15.00798515536142, 15.00998497944914, 15.01198480358377, 15.01398462776529,
+        15.01598445199369, 15.01798427626895, 15.01998410059105, 15.02198392495996,
+        15.02398374937568, 15.02598357383818, 15.02798339834744, 15.02998322290344,
+        15.03198304750618, 15.03398287215562, 15.03598269685174, 15.03798252159454,
+        15.03998234638399, 15.04198217122007, 15.04398199610277, 15.04598182103206,
+        15.04798164600793, 15.04998147103036, 15.05198129609933, 15.05398112121482,
+        15.05598094637681, 15.05798077158529, 15.05998059684023, 15.06198042214162,
+        15.06398024748944, 15.06598007288367, 15.06797989832429, 15.06997972381128,
+        15.07197954934463, 15.07397937492432, 15.07597920055032, 15.07797902622262,
+        15.0799788519412, 15.08197867770605, 15.08397850351714, 15.08597832937446,
+        15.08797815527798, 15.08997798122769, 15.09197780722357, 15.09397763326561,
+        15.09597745935378, 15.09797728548806, 15.09997711166845, 15.10197693789491,
+        15.10397676416743, 15.10597659048599, 15.10797641685058, 15.10997624326117,
+        15.11197606971776, 15.11397589622031, 15.11597572276881, 15.11797554936324,
+        15.11997537600359, 15.12197520268983, 15.12397502942196, 15.12597485619994,
+        15.12797468302376, 15.12997450989341, 15.13197433680887, 15.13397416377011,
+        15.13597399077712, 15.13797381782988, 15.13997364492837, 15.14197347207258,
+        15.14397329926248, 15.14597312649806, 15.1479729537793, 15.14997278110619,
+        15.1519726084787, 15.15397243589681, 15.15597226336051, 15.15797209086978,
+        15.15997191842461, 15.16197174602496, 15.16397157367084, 15.16597140136221,
+        15.16797122909906, 15.16997105688137, 15.17197088470913, 15.17397071258231,
+        15.1759705405009, 15.17797036846488, 15.17997019647423, 15.18197002452894,
+        15.18396985262898, 15.18596968077434, 15.187969508965, 15.18996933720094,
+        15.19196916548215, 15.1939689938086, 15.19596882218028, 15.19796865059717,
+        15.19996847905926, 15.20196830756652, 15.20396813611893, 15.20596796471649,
+        15.20796779335917, 15.20996762204695, 15.21196745077982, 15.21396727955776,
+        15.21596710838074, 15.21796693724876, 15.2199667661618, 15.22196659511983,
+        15.22396642412284, 15.22596625317081, 15.22796608226373, 15.22996591140157,
+        15.23196574058432, 15.23396556981197, 15.23596539908448, 15.23796522840185,
+        15.23996505776406, 15.24196488717109, 15.24396471662292, 15.24596454611954,
+        15.24796437566092, 15.24996420524705, 15.25196403487792, 15.2539638645535,
+        15.25596369427377, 15.25796352403873, 15.25996335384835, 15.26196318370261,
+        15.2639630136015, 15.26596284354499, 15.26796267353308, 15.26996250356574,
+        15.27196233364296, 15.27396216376472, 15.275961993931, 15.27796182414178,
+        15.27996165439705, 15.28196148469678, 15.28396131504097, 15.2859611454296,
+        15.28796097586264, 15.28996080634008, 15.2919606368619, 15.29396046742808,
+        15.29596029803861, 15.29796012869347, 15.29995995939265, 15.30195979013611,
+        15.30395962092386, 15.30595945175586, 15.30795928263211, 15.30995911355258,
+        15.31195894451727, 15.31395877552614, 15.31595860657918, 15.31795843767638,
+        15.31995826881772, 15.32195810000318, 15.32395793123275, 15.3259577625064,
+        15.32795759382412, 15.32995742518589, 15.3319572565917, 15.33395708804153,
+        15.33595691953535, 15.33795675107316, 15.33995658265494, 15.34195641428066,
+        15.34395624595032, 15.34595607766389, 15.34795590942136, 15.34995574122271,
+        15.35195557306792, 15.35395540495698, 15.35595523688986, 15.35795506886656,
+        15.35995490088705, 15.36195473295132, 15.36395456505935, 15.36595439721113,
+        15.36795422940663, 15.36995406164584, 15.37195389392874, 15.37395372625531,
+        15.37595355862555, 15.37795339103942, 15.37995322349692, 15.38195305599802,
+        15.38395288854272, 15.38595272113098, 15.38795255376281, 15.38995238643817,
+        15.39195221915705, 15.39395205191944, 15.39595188472532, 15.39795171757466,
+        15.39995155046746, 15.4019513834037, 15.40395121638336, 15.40595104940642,
+        15.40795088247287, 15.40995071558268, 15.41195054873585, 15.41395038193236,
+        15.41595021517218, 15.41795004845531, 15.41994988178172, 15.4219497151514,
+        15.42394954856433, 15.42594938202049, 15.42794921551987, 15.42994904906245,
+        15.43194888264822, 15.43394871627715, 15.43594854994924, 15.43794838366446,
+        15.43994821742279, 15.44194805122423, 15.44394788506874, 15.44594771895633,
+        15.44794755288696, 15.44994738686063, 15.45194722087732, 15.453947054937,
+        15.45594688903967, 15.4579467231853, 15.45994655737388, 15.4619463916054,
+        15.46394622587983, 15.46594606019717, 15.46794589455738, 15.46994572896046,
+        15.47194556340639, 15.47394539789516, 15.47594523242674, 15.47794506700112,
+        15.47994490161829, 15.48194473627822, 15.4839445709809, 15.48594440572631,
+        15.48794424051444, 15.48994407534528, 15.49194391021879, 15.49394374513498,
+        15.49594358009381, 15.49794341509528, 15.49994325013937, 15.50194308522605,
+        15.50394292035533, 15.50594275552717, 15.50794259074156, 15.50994242599849,
+        15.51194226129794, 15.51394209663988, 15.51594193202432, 15.51794176745123,
+        15.51994160292058, 15.52194143843238, 15.5239412739866, 15.52594110958321,
+        15.52794094522222, 15.5299407809036, 15.53194061662733, 15.5339404523934,
+        15.5359402882018, 15.5379401240525, 15.53993995994549, 15.54193979588075,
+        15.54393963185827, 15.54593946787802, 15.54793930394001, 15.5499391400442,
+        15.55193897619058, 15.55393881237914, 15.55593864860985, 15.55793848488271,
+        15.5599383211977, 15.56193815755479, 15.56393799395398, 15.56593783039525,
+        15.56793766687858, 15.56993750340395, 15.57193733997136, 15.57393717658077,
+        15.57593701323218, 15.57793684992558, 15.57993668666093, 15.58193652343824,
+        15.58393636025748, 15.58593619711863, 15.58793603402168, 15.58993587096662,
+        15.59193570795342, 15.59393554498208, 15.59593538205257, 15.59793521916488,
+        15.59993505631899, 15.60193489351489, 15.60393473075256, 15.60593456803199,
+        15.60793440535315, 15.60993424271604, 15.61193408012063, 15.61393391756691,
+        15.61593375505487, 15.61793359258449, 15.61993343015575, 15.62193326776863,
+        15.62393310542313, 15.62593294311922, 15.62793278085689, 15.62993261863612,
+        15.6319324564569, 15.63393229431921, 15.63593213222303, 15.63793197016836,
+        15.63993180815516, 15.64193164618344, 15.64393148425316, 15.64593132236432,
+        15.6479311605169, 15.64993099871088, 15.65193083694625, 15.65393067522299,
+        15.65593051354109, 15.65793035190052, 15.65993019030128, 15.66193002874335,
+        15.66392986722671, 15.66592970575135, 15.66792954431725, 15.66992938292439,
+        15.67192922157277, 15.67392906026235, 15.67592889899314, 15.6779287377651,
+        15.67992857657823, 15.68192841543251, 15.68392825432793, 15.68592809326447,
+        15.6879279322421, 15.68992777126083, 15.69192761032063, 15.69392744942148,
+        15.69592728856337, 15.69792712774629, 15.69992696697022, 15.70192680623514,
+        15.70392664554103, 15.70592648488789, 15.7079263242757, 15.70992616370443,
+        15.71192600317408, 15.71392584268463, 15.71592568223607, 15.71792552182837,
+        15.71992536146152, 15.72192520113551, 15.72392504085033, 15.72592488060594,
+        15.72792472040235, 15.72992456023953, 15.73192440011747, 15.73392424003616,
+        15.73592407999557, 15.7379239199957, 15.73992376003652, 15.74192360011802,
+        15.74392344024019, 15.74592328040301, 15.74792312060646, 15.74992296085053,
+        15.75192280113521, 15.75392264146047, 15.75592248182631, 15.75792232223271,
+        15.75992216267964, 15.76192200316711, 15.76392184369508, 15.76592168426355,
+        15.7679215248725, 15.76992136552192, 15.77192120621178, 15.77392104694208,
+        15.7759208877128, 15.77792072852392, 15.77992056937543, 15.78192041026731,
+        15.78392025119955, 15.78592009217213, 15.78791993318503, 15.78991977423825,
+        15.79191961533176, 15.79391945646556, 15.79591929763962, 15.79791913885393,
+        15.79991898010847, 15.80191882140323, 15.8039186627382, 15.80591850411336,
+        15.80791834552869, 15.80991818698417, 15.8119180284798, 15.81391787001556,
+        15.81591771159143, 15.8179175532074, 15.81991739486345, 15.82191723655957,
+        15.82391707829574, 15.82591692007195, 15.82791676188817, 15.82991660374441,
+        15.83191644564063, 15.83391628757683, 15.83591612955299, 15.8379159715691,
+        15.83991581362514, 15.84191565572109, 15.84391549785694, 15.84591534003268,
+        15.84791518224829, 15.84991502450375, 15.85191486679905, 15.85391470913418,
+        15.85591455150911, 15.85791439392384, 15.85991423637835, 15.86191407887263,
+        15.86391392140665, 15.86591376398041, 15.86791360659389, 15.86991344924707,
+        15.87191329193994, 15.87391313467248, 15.87591297744469, 15.87791282025653,
+        15.87991266310801, 15.8819125059991, 15.8839123489298, 15.88591219190007,
+        15.88791203490992, 15.88991187795931, 15.89191172104825, 15.89391156417672,
+        15.89591140734469, 15.89791125055216, 15.8999110937991, 15.90191093708552,
+        15.90391078041138, 15.90591062377668, 15.90791046718139, 15.90991031062552,
+        15.91191015410903, 15.91390999763192, 15.91590984119417, 15.91790968479576,
+        15.91990952843669, 15.92190937211693, 15.92390921583648, 15.92590905959531,
+        15.92790890339341, 15.92990874723077, 15.93190859110737, 15.9339084350232,
+        15.93590827897825, 15.93790812297249, 15.93990796700591, 15.9419078110785,
+        15.94390765519025, 15.94590749934113, 15.94790734353114, 15.94990718776026,
+        15.95190703202847, 15.95390687633576, 15.95590672068212, 15.95790656506753,
+        15.95990640949197, 15.96190625395544, 15.96390609845791, 15.96590594299937,
+        15.96790578757982, 15.96990563219922, 15.97190547685757, 15.97390532155486,
+        15.97590516629106, 15.97790501106617, 15.97990485588017, 15.98190470073304,
+        15.98390454562477, 15.98590439055535, 15.98790423552476, 15.98990408053298,
+        15.99190392558001, 15.99390377066582, 15.99590361579041, 15.99790346095376,
+        15.99990330615585, 16.00190315139667, 16.0039029966762, 16.00590284199443,
+        16.00790268735135, 16.00990253274694, 16.01190237818119, 16.01390222365408,
+        16.0159020691656, 16.01790191471573, 16.01990176030445, 16.02190160593177,
+        16.02390145159765, 16.02590129730209, 16.02790114304507, 16.02990098882657,
+        16.03190083464659, 16.0339006805051, 16.0359005264021, 16.03790037233757,
+        16.03990021831149, 16.04190006432385, 16.04389991037464, 16.04589975646383,
+        16.04789960259143, 16.04989944875741, 16.05189929496175, 16.05389914120445,
+        16.05589898748549, 16.05789883380485, 16.05989868016253, 16.0618985265585,
+        16.06389837299275, 16.06589821946527, 16.06789806597605, 16.06989791252506,
+        16.0718977591123, 16.07389760573775, 16.0758974524014, 16.07789729910323,
+        16.07989714584322, 16.08189699262137, 16.08389683943766, 16.08589668629208,
+        16.0878965331846, 16.08989638011523, 16.09189622708393, 16.09389607409071,
+        16.09589592113553, 16.0978957682184, 16.09989561533929, 16.1018954624982,
+        16.1038953096951, 16.10589515692999, 16.10789500420284, 16.10989485151365,
+        16.1118946988624, 16.11389454624908, 16.11589439367367, 16.11789424113616,
+        16.11989408863653, 16.12189393617478, 16.12389378375088, 16.12589363136482,
+        16.12789347901659, 16.12989332670617, 16.13189317443355, 16.13389302219872,
+        16.13589287000166, 16.13789271784236, 16.1398925657208, 16.14189241363698,
+        16.14389226159086, 16.14589210958245, 16.14789195761173, 16.14989180567868,
+        16.15189165378329, 16.15389150192554, 16.15589135010543, 16.15789119832293,
+        16.15989104657804, 16.16189089487073, 16.16389074320101, 16.16589059156884,
+        16.16789043997422, 16.16989028841714, 16.17189013689757, 16.17388998541551,
+        16.17588983397095, 16.17788968256386, 16.17988953119423, 16.18188937986206,
+        16.18388922856732, 16.18588907731, 16.1878889260901, 16.18988877490759,
+        16.19188862376245, 16.19388847265469, 16.19588832158428, 16.19788817055121,
+        16.19988801955546, 16.20188786859703, 16.20388771767589, 16.20588756679204,
+        16.20788741594546, 16.20988726513613, 16.21188711436405, 16.21388696362919,
+        16.21588681293156, 16.21788666227112, 16.21988651164787, 16.22188636106179,
+        16.22388621051287, 16.2258860600011, 16.22788590952647, 16.22988575908895,
+        16.23188560868853, 16.23388545832521, 16.23588530799897, 16.23788515770978,
+        16.23988500745765, 16.24188485724256, 16.24388470706449, 16.24588455692343,
+        16.24788440681936, 16.24988425675227, 16.25188410672216, 16.25388395672899,
+        16.25588380677277, 16.25788365685348, 16.2598835069711, 16.26188335712562,
+        16.26388320731702, 16.2658830575453, 16.26788290781044, 16.26988275811242,
+        16.27188260845124, 16.27388245882687, 16.27588230923931, 16.27788215968854,
+        16.27988201017454, 16.28188186069731, 16.28388171125683, 16.28588156185309,
+        16.28788141248607, 16.28988126315577, 16.29188111386215, 16.29388096460522,
+        16.29588081538496, 16.29788066620136, 16.2998805170544, 16.30188036794406,
+        16.30388021887035, 16.30588006983323, 16.3078799208327, 16.30987977186875,
+        16.31187962294136, 16.31387947405052, 16.31587932519621, 16.31787917637842,
+        16.31987902759714, 16.32187887885236, 16.32387873014405, 16.32587858147221,
+        16.32787843283683, 16.32987828423789, 16.33187813567537, 16.33387798714927,
+        16.33587783865957, 16.33787769020626, 16.33987754178931, 16.34187739340873,
+        16.3438772450645, 16.3458770967566, 16.34787694848502, 16.34987680024975,
+        16.35187665205077, 16.35387650388807, 16.35587635576164, 16.35787620767147,
+        16.35987605961753, 16.36187591159982, 16.36387576361832, 16.36587561567303,
+        16.36787546776392, 16.36987531989098, 16.37187517205421, 16.37387502425358,
+        16.37587487648909, 16.37787472876072, 16.37987458106845, 16.38187443341229,
+        16.3838742857922, 16.38587413820818, 16.38787399066021, 16.38987384314829,
+        16.39187369567239, 16.39387354823251, 16.39587340082864, 16.39787325346075,
+        16.39987310612883, 16.40187295883288, 16.40387281157288, 16.40587266434882,
+        16.40787251716068, 16.40987237000844, 16.41187222289211, 16.41387207581166,
+        16.41587192876707, 16.41787178175835, 16.41987163478547, 16.42187148784842,
+        16.42387134094719, 16.42587119408177, 16.42787104725213, 16.42987090045828,
+        16.43187075370019, 16.43387060697785, 16.43587046029126, 16.43787031364039,
+        16.43987016702523, 16.44187002044578, 16.44386987390201, 16.44586972739391,
+        16.44786958092148, 16.4498694344847, 16.45186928808355, 16.45386914171802,
+        16.45586899538811, 16.45786884909379, 16.45986870283505, 16.46186855661188,
+        16.46386841042428, 16.46586826427221, 16.46786811815568, 16.46986797207466,
+        16.47186782602916, 16.47386768001914, 16.4758675340446, 16.47786738810554,
+        16.47986724220192, 16.48186709633375, 16.483866950501, 16.48586680470367,
+        16.48786665894174, 16.4898665132152, 16.49186636752404, 16.49386622186824,
+        16.4958660762478, 16.49786593066269, 16.4998657851129, 16.50186563959843,
+        16.50386549411926, 16.50586534867537, 16.50786520326676, 16.50986505789341,
+        16.5118649125553, 16.51386476725243, 16.51586462198479, 16.51786447675235,
+        16.51986433155511, 16.52186418639306, 16.52386404126617, 16.52586389617445,
+        16.52786375111787, 16.52986360609642, 16.5318634611101, 16.53386331615888,
+        16.53586317124276, 16.53786302636171, 16.53986288151574, 16.54186273670482,
+        16.54386259192895, 16.54586244718811, 16.54786230248229, 16.54986215781147,
+        16.55186201317565, 16.5538618685748, 16.55586172400893, 16.55786157947801,
+        16.55986143498203, 16.56186129052098, 16.56386114609485, 16.56586100170362,
+        16.56786085734728, 16.56986071302583, 16.57186056873924, 16.5738604244875,
+        16.5758602802706, 16.57786013608853, 16.57985999194128, 16.58185984782884,
+        16.58385970375118, 16.5858595597083, 16.58785941570018, 16.58985927172682,
+        16.5918591277882, 16.59385898388431, 16.59585884001513, 16.59785869618066,
+        16.59985855238087, 16.60185840861577, 16.60385826488532, 16.60585812118953,
+        16.60785797752839, 16.60985783390186, 16.61185769030996, 16.61385754675265,
+        16.61585740322994, 16.6178572597418, 16.61985711628823, 16.62185697286921,
+        16.62385682948473, 16.62585668613478, 16.62785654281934, 16.6298563995384,
+        16.63185625629196, 16.63385611307999, 16.63585596990249, 16.63785582675944,
+        16.63985568365084, 16.64185554057666, 16.64385539753689, 16.64585525453153,
+        16.64785511156056, 16.64985496862397, 16.65185482572174, 16.65385468285387,
+        16.65585454002034, 16.65785439722113, 16.65985425445625, 16.66185411172566,
+        16.66385396902937, 16.66585382636736, 16.66785368373962, 16.66985354114613,
+        16.67185339858688, 16.67385325606186, 16.67585311357106, 16.67785297111447,
+        16.67985282869207, 16.68185268630385, 16.6838525439498, 16.6858524016299,
+        16.68785225934415, 16.68985211709253, 16.69185197487503, 16.69385183269163,
+        16.69585169054234, 16.69785154842712, 16.69985140634597, 16.70185126429888,
+        16.70385112228584, 16.70585098030683, 16.70785083836185, 16.70985069645087,
+        16.71185055457389, 16.71385041273089, 16.71585027092186, 16.7178501291468,
+        16.71984998740568, 16.7218498456985, 16.72384970402525, 16.7258495623859,
+        16.72784942078046, 16.7298492792089, 16.73184913767122, 16.7338489961674,
+        16.73584885469743, 16.73784871326129, 16.73984857185899, 16.7418484304905,
+        16.74384828915581, 16.74584814785491, 16.74784800658779, 16.74984786535444,
+        16.75184772415484, 16.75384758298898, 16.75584744185685, 16.75784730075844,
+        16.75984715969373, 16.76184701866272, 16.76384687766539, 16.76584673670173,
+        16.76784659577172, 16.76984645487536, 16.77184631401264, 16.77384617318353,
+        16.77584603238803, 16.77784589162614, 16.77984575089782, 16.78184561020308,
+        16.7838454695419, 16.78584532891427, 16.78784518832017, 16.7898450477596,
+        16.79184490723254, 16.79384476673899, 16.79584462627892, 16.79784448585233,
+        16.79984434545921, 16.80184420509954, 16.80384406477331, 16.8058439244805,
+        16.80784378422112, 16.80984364399514, 16.81184350380256, 16.81384336364335,
+        16.81584322351752, 16.81784308342504, 16.81984294336591, 16.82184280334012,
+        16.82384266334764, 16.82584252338848, 16.82784238346261, 16.82984224357003,
+        16.83184210371073, 16.83384196388468, 16.83584182409189, 16.83784168433234,
+        16.83984154460601, 16.8418414049129, 16.84384126525299, 16.84584112562628,
+        16.84784098603274, 16.84984084647237, 16.85184070694516, 16.85384056745109,
+        16.85584042799016, 16.85784028856234, 16.85984014916763, 16.86184000980603,
+        16.8638398704775, 16.86583973118205, 16.86783959191966, 16.86983945269032,
+        16.87183931349402, 16.87383917433075, 16.87583903520049, 16.87783889610323,
+        16.87983875703897, 16.88183861800768, 16.88383847900937, 16.885838340044,
+        16.88783820111159, 16.8898380622121, 16.89183792334554, 16.89383778451188,
+        16.89583764571112, 16.89783750694325, 16.89983736820826, 16.90183722950612,
+        16.90383709083684, 16.90583695220039, 16.90783681359678, 16.90983667502597,
+        16.91183653648798, 16.91383639798277, 16.91583625951035, 16.91783612107069,
+        16.9198359826638, 16.92183584428965, 16.92383570594823, 16.92583556763954,
+        16.92783542936355, 16.92983529112027, 16.93183515290968, 16.93383501473176,
+        16.9358348765865, 16.9378347384739, 16.93983460039394, 16.94183446234662,
+        16.9438343243319, 16.9458341863498, 16.94783404840029, 16.94983391048337,
+        16.95183377259902, 16.95383363474723, 16.95583349692799, 16.95783335914128,
+        16.95983322138711, 16.96183308366544, 16.96383294597628, 16.96583280831962,
+        16.96783267069543, 16.96983253310371, 16.97183239554445, 16.97383225801763,
+        16.97583212052325, 16.9778319830613, 16.97983184563175, 16.9818317082346,
+        16.98383157086984, 16.98583143353746, 16.98783129623745, 16.98983115896978,
+        16.99183102173446, 16.99383088453148, 16.99583074736081, 16.99783061022245,
+        16.99983047311639, 17.00183033604261, 17.00383019900111, 17.00583006199187,
+        17.00782992501488, 17.00982978807013, 17.01182965115761, 17.01382951427731,
+        17.01582937742921, 17.01782924061331, 17.01982910382959, 17.02182896707805,
+        17.02382883035866, 17.02582869367143, 17.02782855701633, 17.02982842039335,
+        17.0318282838025, 17.03382814724374, 17.03582801071708, 17.0378278742225,
+        17.03982773776, 17.04182760132955, 17.04382746493114, 17.04582732856478,
+        17.04782719223043, 17.0498270559281, 17.05182691965778, 17.05382678341944,
+        17.05582664721309, 17.0578265110387, 17.05982637489627, 17.06182623878579,
+        17.06382610270724, 17.06582596666061, 17.0678258306459, 17.06982569466309,
+        17.07182555871216, 17.07382542279312, 17.07582528690594, 17.07782515105062,
+        17.07982501522715, 17.08182487943551, 17.08382474367569, 17.08582460794768,
+        17.08782447225148, 17.08982433658706, 17.09182420095442, 17.09382406535355,
+        17.09582392978443, 17.09782379424706, 17.09982365874142, 17.1018235232675,
+        17.1038233878253, 17.10582325241479, 17.10782311703597, 17.10982298168883,
+        17.11182284637336, 17.11382271108954, 17.11582257583737, 17.11782244061683,
+        17.11982230542791, 17.12182217027061, 17.1238220351449, 17.12582190005078,
+        17.12782176498824, 17.12982162995727, 17.13182149495786, 17.13382135998998,
+        17.13582122505364, 17.13782109014883, 17.13982095527552, 17.14182082043372,
+        17.14382068562341, 17.14582055084457, 17.1478204160972, 17.14982028138129,
+        17.15182014669682, 17.15382001204379, 17.15581987742218, 17.15781974283199,
+        17.15981960827319, 17.16181947374579, 17.16381933924976, 17.16581920478511,
+        17.16781907035181, 17.16981893594985, 17.17181880157924, 17.17381866723995,
+        17.17581853293197, 17.17781839865529, 17.17981826440991, 17.1818181301958,
+        17.18381799601297, 17.1858178618614, 17.18781772774107, 17.18981759365198,
+        17.19181745959412, 17.19381732556747, 17.19581719157203, 17.19781705760778,
+        17.19981692367472, 17.20181678977282, 17.20381665590209, 17.2058165220625,
+        17.20781638825406, 17.20981625447674, 17.21181612073055, 17.21381598701546,
+        17.21581585333146, 17.21781571967855, 17.21981558605671, 17.22181545246594,
+        17.22381531890622, 17.22581518537754, 17.22781505187989, 17.22981491841326,
+        17.23181478497764, 17.23381465157302, 17.23581451819939, 17.23781438485673,
+        17.23981425154504, 17.2418141182643, 17.24381398501451, 17.24581385179566,
+        17.24781371860772, 17.2498135854507, 17.25181345232458, 17.25381331922935,
+        17.255813186165, 17.25781305313152, 17.2598129201289, 17.26181278715712,
+        17.26381265421618, 17.26581252130607, 17.26781238842677, 17.26981225557828,
+        17.27181212276059, 17.27381198997367, 17.27581185721753, 17.27781172449215,
+        17.27981159179752, 17.28181145913364, 17.28381132650048, 17.28581119389804,
+        17.28781106132631, 17.28981092878528, 17.29181079627494, 17.29381066379527,
+        17.29581053134627, 17.29781039892792, 17.29981026654022, 17.30181013418315,
+        17.30381000185671, 17.30580986956088, 17.30780973729565, 17.30980960506101,
+        17.31180947285696, 17.31380934068347, 17.31580920854055, 17.31780907642817,
+        17.31980894434633, 17.32180881229502, 17.32380868027423, 17.32580854828394,
+        17.32780841632415, 17.32980828439485, 17.33180815249602, 17.33380802062766,
+        17.33580788878975, 17.33780775698228, 17.33980762520525, 17.34180749345864,
+        17.34380736174244, 17.34580723005664, 17.34780709840124, 17.34980696677621,
+        17.35180683518155, 17.35380670361726, 17.35580657208331, 17.3578064405797,
+        17.35980630910642, 17.36180617766345, 17.3638060462508, 17.36580591486843,
+        17.36780578351636, 17.36980565219456, 17.37180552090302, 17.37380538964174,
+        17.37580525841071, 17.37780512720991, 17.37980499603933, 17.38180486489896,
+        17.3838047337888, 17.38580460270882, 17.38780447165903, 17.38980434063941,
+        17.39180420964995, 17.39380407869065, 17.39580394776148, 17.39780381686244,
+        17.39980368599352, 17.40180355515471, 17.40380342434599, 17.40580329356737,
+        17.40780316281882, 17.40980303210034, 17.41180290141191, 17.41380277075353,
+        17.41580264012519, 17.41780250952688, 17.41980237895858, 17.42180224842028,
+        17.42380211791198, 17.42580198743366, 17.42780185698532, 17.42980172656694,
+        17.43180159617852, 17.43380146582003, 17.43580133549148, 17.43780120519285,
+        17.43980107492414, 17.44180094468533, 17.4438008144764, 17.44580068429736,
+        17.44780055414819, 17.44980042402888, 17.45180029393943, 17.45380016387981,
+        17.45580003385002, 17.45779990385005, 17.45979977387989, 17.46179964393953,
+        17.46379951402896, 17.46579938414817, 17.46779925429714, 17.46979912447587,
+        17.47179899468436, 17.47379886492258, 17.47579873519052, 17.47779860548819,
+        17.47979847581556, 17.48179834617263, 17.48379821655938, 17.48579808697581,
+        17.48779795742191, 17.48979782789767, 17.49179769840307, 17.4937975689381,
+        17.49579743950276, 17.49779731009704, 17.49979718072092, 17.5017970513744,
+        17.50379692205746, 17.5057967927701, 17.5077966635123, 17.50979653428406,
+        17.51179640508536, 17.51379627591619, 17.51579614677655, 17.51779601766643,
+        17.5197958885858, 17.52179575953468, 17.52379563051303, 17.52579550152086,
+        17.52779537255815, 17.5297952436249, 17.53179511472109, 17.53379498584671,
+        17.53579485700176, 17.53779472818621, 17.53979459940008, 17.54179447064333,
+        17.54379434191597, 17.54579421321798, 17.54779408454935, 17.54979395591008,
+        17.55179382730015, 17.55379369871955, 17.55579357016828, 17.55779344164631,
+        17.55979331315365, 17.56179318469029, 17.5637930562562, 17.56579292785139,
+        17.56779279947584, 17.56979267112954, 17.57179254281249, 17.57379241452467,
+        17.57579228626607, 17.57779215803668, 17.5797920298365, 17.58179190166551,
+        17.5837917735237, 17.58579164541106, 17.58779151732759, 17.58979138927327,
+        17.5917912612481, 17.59379113325205, 17.59579100528513, 17.59779087734732,
+        17.59979074943862, 17.60179062155901, 17.60379049370848, 17.60579036588703,
+        17.60779023809464, 17.6097901103313, 17.61178998259701, 17.61378985489175,
+        17.61578972721551, 17.61778959956829, 17.61978947195007, 17.62178934436085,
+        17.62378921680061, 17.62578908926934, 17.62778896176704, 17.6297888342937,
+        17.6317887068493, 17.63378857943383, 17.63578845204729, 17.63778832468967,
+        17.63978819736095, 17.64178807006113, 17.64378794279019, 17.64578781554813,
+        17.64778768833493, 17.64978756115059, 17.6517874339951, 17.65378730686844,
+        17.65578717977062, 17.6577870527016, 17.6597869256614, 17.66178679864999,
+        17.66378667166737, 17.66578654471353, 17.66778641778846, 17.66978629089215,
+        17.67178616402458, 17.67378603718575, 17.67578591037566, 17.67778578359428,
+        17.67978565684161, 17.68178553011764, 17.68378540342236, 17.68578527675577,
+        17.68778515011784, 17.68978502350857, 17.69178489692796, 17.69378477037598,
+        17.69578464385264, 17.69778451735792, 17.69978439089181, 17.70178426445431,
+        17.7037841380454, 17.70578401166507, 17.70778388531331, 17.70978375899012,
+        17.71178363269548, 17.71378350642939, 17.71578338019183, 17.7177832539828,
+        17.71978312780228, 17.72178300165027, 17.72378287552676, 17.72578274943173,
+        17.72778262336518, 17.72978249732709, 17.73178237131747, 17.73378224533629,
+        17.73578211938355, 17.73778199345923, 17.73978186756334, 17.74178174169586,
+        17.74378161585678, 17.74578149004608, 17.74778136426377, 17.74978123850983,
+        17.75178111278425, 17.75378098708702, 17.75578086141814, 17.75778073577758,
+        17.75978061016535, 17.76178048458144, 17.76378035902583, 17.76578023349851,
+        17.76778010799948, 17.76977998252872, 17.77177985708623, 17.77377973167199,
+        17.775779606286, 17.77777948092825, 17.77977935559873, 17.78177923029742,
+        17.78377910502432, 17.78577897977942, 17.78777885456272, 17.78977872937419,
+        17.79177860421383, 17.79377847908163, 17.79577835397758, 17.79777822890168,
+        17.79977810385391, 17.80177797883426, 17.80377785384272, 17.80577772887929,
+        17.80777760394396, 17.80977747903671, 17.81177735415753, 17.81377722930642,
+        17.81577710448337, 17.81777697968836, 17.81977685492139, 17.82177673018246,
+        17.82377660547153, 17.82577648078862, 17.82777635613371, 17.82977623150679,
+        17.83177610690785, 17.83377598233689, 17.83577585779388, 17.83777573327883,
+        17.83977560879172, 17.84177548433255, 17.8437753599013, 17.84577523549796,
+        17.84777511112253, 17.849774986775, 17.85177486245536, 17.85377473816359,
+        17.85577461389969, 17.85777448966365, 17.85977436545547, 17.86177424127512,
+        17.8637741171226, 17.8657739929979, 17.86777386890102, 17.86977374483194,
+        17.87177362079065, 17.87377349677715, 17.87577337279142, 17.87777324883345,
+        17.87977312490325, 17.88177300100079, 17.88377287712607, 17.88577275327907,
+        17.8877726294598, 17.88977250566823, 17.89177238190437, 17.8937722581682,
+        17.89577213445971, 17.89777201077889, 17.89977188712573, 17.90177176350023,
+        17.90377163990237, 17.90577151633215, 17.90777139278956, 17.90977126927458,
+        17.91177114578721, 17.91377102232744, 17.91577089889526, 17.91777077549065,
+        17.91977065211362, 17.92177052876415, 17.92377040544223, 17.92577028214786,
+        17.92777015888102, 17.9297700356417, 17.9317699124299, 17.9337697892456,
+        17.93576966608881, 17.9377695429595, 17.93976941985766, 17.9417692967833,
+        17.9437691737364, 17.94576905071695, 17.94776892772494, 17.94976880476036,
+        17.95176868182321, 17.95376855891347, 17.95576843603113, 17.95776831317619,
+        17.95976819034864, 17.96176806754847, 17.96376794477566, 17.96576782203022,
+        17.96776769931212, 17.96976757662137, 17.97176745395794, 17.97376733132184,
+        17.97576720871306, 17.97776708613157, 17.97976696357739, 17.98176684105049,
+        17.98376671855086, 17.98576659607851, 17.98776647363341, 17.98976635121557,
+        17.99176622882496, 17.99376610646159, 17.99576598412544, 17.9977658618165,
+        17.99976573953477, 18.00176561728023, 18.00376549505288, 18.0057653728527,
+        18.0077652506797, 18.00976512853385, 18.01176500641515, 18.0137648843236,
+        18.01576476225918, 18.01776464022187, 18.01976451821169, 18.02176439622861,
+        18.02376427427262, 18.02576415234372, 18.0277640304419, 18.02976390856715,
+        18.03176378671946, 18.03376366489881, 18.03576354310521, 18.03776342133865,
+        18.0397632995991, 18.04176317788658, 18.04376305620105, 18.04576293454253,
+        18.04776281291099, 18.04976269130643, 18.05176256972884, 18.05376244817821,
+        18.05576232665454, 18.0577622051578, 18.059762083688, 18.06176196224513,
+        18.06376184082917, 18.06576171944012, 18.06776159807797, 18.0697614767427,
+        18.07176135543432, 18.07376123415281, 18.07576111289816, 18.07776099167037,
+        18.07976087046941, 18.0817607492953, 18.08376062814801, 18.08576050702754,
+        18.08776038593388, 18.08976026486702, 18.09176014382695, 18.09376002281366,
+        18.09575990182715, 18.0977597808674, 18.09975965993441, 18.10175953902816,
+        18.10375941814865, 18.10575929729587, 18.10775917646981, 18.10975905567047,
+        18.11175893489782, 18.11375881415187, 18.1157586934326, 18.11775857274001,
+        18.11975845207409, 18.12175833143483, 18.12375821082221, 18.12575809023624,
+        18.12775796967689, 18.12975784914417, 18.13175772863807, 18.13375760815857,
+        18.13575748770566, 18.13775736727935, 18.13975724687961, 18.14175712650645,
+        18.14375700615984, 18.14575688583979, 18.14775676554628, 18.14975664527931,
+        18.15175652503886, 18.15375640482493, 18.15575628463751, 18.15775616447659,
+        18.15975604434216, 18.16175592423421, 18.16375580415274, 18.16575568409773,
+        18.16775556406918, 18.16975544406707, 18.17175532409141, 18.17375520414217,
+        18.17575508421935, 18.17775496432295, 18.17975484445295, 18.18175472460935,
+        18.18375460479213, 18.1857544850013, 18.18775436523683, 18.18975424549872,
+        18.19175412578696, 18.19375400610154, 18.19575388644246, 18.1977537668097,
+        18.19975364720327, 18.20175352762313, 18.2037534080693, 18.20575328854176,
+        18.2077531690405, 18.20975304956552, 18.2117529301168, 18.21375281069434,
+        18.21575269129812, 18.21775257192814, 18.21975245258439, 18.22175233326687,
+        18.22375221397556, 18.22575209471045, 18.22775197547153, 18.22975185625881,
+        18.23175173707226, 18.23375161791188, 18.23575149877767, 18.2377513796696,
+        18.23975126058768, 18.2417511415319, 18.24375102250224, 18.2457509034987,
+        18.24775078452127, 18.24975066556994, 18.2517505466447, 18.25375042774555,
+        18.25575030887247, 18.25775019002546, 18.2597500712045, 18.2617499524096,
+        18.26374983364074, 18.26574971489791, 18.2677495961811, 18.26974947749031,
+        18.27174935882552, 18.27374924018674, 18.27574912157394, 18.27774900298712,
+        18.27974888442628, 18.2817487658914, 18.28374864738248, 18.2857485288995,
+        18.28774841044246, 18.28974829201136, 18.29174817360617, 18.29374805522689,
+        18.29574793687353, 18.29774781854605, 18.29974770024447, 18.30174758196876,
+        18.30374746371892, 18.30574734549495, 18.30774722729683, 18.30974710912455,
+        18.31174699097811, 18.3137468728575, 18.31574675476271, 18.31774663669373,
+        18.31974651865055, 18.32174640063316, 18.32374628264157, 18.32574616467575,
+        18.32774604673569, 18.3297459288214, 18.33174581093286, 18.33374569307007,
+        18.33574557523301, 18.33774545742167, 18.33974533963606, 18.34174522187615,
+        18.34374510414195, 18.34574498643344, 18.34774486875061, 18.34974475109346,
+        18.35174463346198, 18.35374451585616, 18.35574439827598, 18.35774428072145,
+        18.35974416319256, 18.36174404568929, 18.36374392821164, 18.3657438107596,
+        18.36774369333316, 18.36974357593231, 18.37174345855704, 18.37374334120735,
+        18.37574322388323, 18.37774310658467, 18.37974298931166, 18.38174287206419,
+        18.38374275484225, 18.38574263764584, 18.38774252047495, 18.38974240332956,
+        18.39174228620968, 18.39374216911529, 18.39574205204638, 18.39774193500295,
+        18.39974181798499, 18.40174170099248, 18.40374158402543, 18.40574146708381,
+        18.40774135016764, 18.40974123327688, 18.41174111641155, 18.41374099957163,
+        18.4157408827571, 18.41774076596797, 18.41974064920422, 18.42174053246585,
+        18.42374041575285, 18.42574029906521, 18.42774018240291, 18.42974006576597,
+        18.43173994915435, 18.43373983256806, 18.4357397160071, 18.43773959947144,
+        18.43973948296108, 18.44173936647602, 18.44373925001624, 18.44573913358174,
+        18.44773901717251, 18.44973890078853, 18.45173878442982, 18.45373866809634,
+        18.4557385517881, 18.45773843550509, 18.4597383192473, 18.46173820301472,
+        18.46373808680735, 18.46573797062517, 18.46773785446817, 18.46973773833636,
+        18.47173762222971, 18.47373750614823, 18.4757373900919, 18.47773727406072,
+        18.47973715805467, 18.48173704207376, 18.48373692611796, 18.48573681018728,
+        18.48773669428171, 18.48973657840123, 18.49173646254584, 18.49373634671553,
+        18.4957362309103, 18.49773611513013, 18.49973599937501, 18.50173588364494,
+        18.50373576793992, 18.50573565225992, 18.50773553660495, 18.509735420975,
+        18.51173530537005, 18.5137351897901, 18.51573507423514, 18.51773495870517,
+        18.51973484320017, 18.52173472772014, 18.52373461226507, 18.52573449683494,
+        18.52773438142977, 18.52973426604952, 18.5317341506942, 18.5337340353638,
+        18.53573392005832, 18.53773380477773, 18.53973368952204, 18.54173357429123,
+        18.54373345908531, 18.54573334390425, 18.54773322874805, 18.54973311361671,
+        18.55173299851022, 18.55373288342856, 18.55573276837174, 18.55773265333973,
+        18.55973253833254, 18.56173242335015, 18.56373230839257, 18.56573219345977,
+        18.56773207855176, 18.56973196366851, 18.57173184881004, 18.57373173397632,
+        18.57573161916735, 18.57773150438313, 18.57973138962363, 18.58173127488887,
+        18.58373116017882, 18.58573104549348, 18.58773093083284, 18.5897308161969,
+        18.59173070158564, 18.59373058699906, 18.59573047243715, 18.5977303578999,
+        18.59973024338731, 18.60173012889936, 18.60373001443605, 18.60572989999738,
+        18.60772978558332, 18.60972967119388, 18.61172955682904, 18.6137294424888,
+        18.61572932817316, 18.61772921388209, 18.6197290996156, 18.62172898537368,
+        18.62372887115631, 18.6257287569635, 18.62772864279523, 18.6297285286515,
+        18.63172841453229, 18.6337283004376, 18.63572818636742, 18.63772807232175,
+        18.63972795830057, 18.64172784430388, 18.64372773033166, 18.64572761638393,
+        18.64772750246065, 18.64972738856183, 18.65172727468746, 18.65372716083753,
+        18.65572704701203, 18.65772693321096, 18.6597268194343, 18.66172670568205,
+        18.66372659195421, 18.66572647825076, 18.66772636457169, 18.669726250917,
+        18.67172613728668, 18.67372602368072, 18.67572591009912, 18.67772579654186,
+        18.67972568300894, 18.68172556950035, 18.68372545601608, 18.68572534255613,
+        18.68772522912049, 18.68972511570914, 18.69172500232209, 18.69372488895932,
+        18.69572477562083, 18.6977246623066, 18.69972454901664, 18.70172443575092,
+        18.70372432250946, 18.70572420929223, 18.70772409609922, 18.70972398293044,
+        18.71172386978588, 18.71372375666552, 18.71572364356936, 18.71772353049738,
+        18.71972341744959, 18.72172330442598, 18.72372319142653, 18.72572307845124,
+        18.72772296550011, 18.72972285257312, 18.73172273967026, 18.73372262679153,
+        18.73572251393693, 18.73772240110643, 18.73972228830004, 18.74172217551775,
+        18.74372206275955, 18.74572195002543, 18.74772183731539, 18.74972172462941,
+        18.75172161196749, 18.75372149932962, 18.75572138671579, 18.75772127412601,
+        18.75972116156025, 18.76172104901851, 18.76372093650078, 18.76572082400706,
+        18.76772071153733, 18.7697205990916, 18.77172048666984, 18.77372037427206,
+        18.77572026189825, 18.7777201495484, 18.7797200372225, 18.78171992492054,
+        18.78371981264252, 18.78571970038843, 18.78771958815825, 18.78971947595199,
+        18.79171936376964, 18.79371925161118, 18.79571913947662, 18.79771902736594,
+        18.79971891527913, 18.80171880321619, 18.80371869117711, 18.80571857916188,
+        18.8077184671705, 18.80971835520295, 18.81171824325923, 18.81371813133933,
+        18.81571801944325, 18.81771790757098, 18.8197177957225, 18.82171768389782,
+        18.82371757209691, 18.82571746031979, 18.82771734856643, 18.82971723683684,
+        18.83171712513099, 18.8337170134489, 18.83571690179054, 18.83771679015591,
+        18.83971667854501, 18.84171656695782, 18.84371645539434, 18.84571634385456,
+        18.84771623233847, 18.84971612084607, 18.85171600937735, 18.85371589793229,
+        18.8557157865109, 18.85771567511317, 18.85971556373908, 18.86171545238863,
+        18.86371534106181, 18.86571522975862, 18.86771511847905, 18.86971500722309,
+        18.87171489599073, 18.87371478478196, 18.87571467359679, 18.87771456243519,
+        18.87971445129717, 18.88171434018271, 18.8837142290918, 18.88571411802445,
+        18.88771400698064, 18.88971389596037, 18.89171378496362, 18.8937136739904,
+        18.89571356304068, 18.89771345211448, 18.89971334121176, 18.90171323033254,
+        18.90371311947681, 18.90571300864455, 18.90771289783575, 18.90971278705042,
+        18.91171267628854, 18.9137125655501, 18.91571245483511, 18.91771234414354,
+        18.9197122334754, 18.92171212283067, 18.92371201220935, 18.92571190161143,
+        18.92771179103691, 18.92971168048577, 18.93171156995801, 18.93371145945362,
+        18.9357113489726, 18.93771123851493, 18.93971112808061, 18.94171101766964,
+        18.943710907282, 18.94571079691768, 18.94771068657668, 18.949710576259,
+        18.95171046596462, 18.95371035569354, 18.95571024544575, 18.95771013522124,
+        18.95971002502, 18.96170991484204, 18.96370980468733, 18.96570969455588,
+        18.96770958444767, 18.96970947436271, 18.97170936430097, 18.97370925426245,
+        18.97570914424716, 18.97770903425507, 18.97970892428618, 18.98170881434049,
+        18.98370870441799, 18.98570859451866, 18.98770848464251, 18.98970837478952,
+        18.99170826495969, 18.99370815515301, 18.99570804536947, 18.99770793560907,
+        18.9997078258718, 19.00170771615765, 19.00370760646661, 19.00570749679868,
+        19.00770738715384, 19.0097072775321, 19.01170716793345, 19.01370705835787,
+        19.01570694880536, 19.01770683927592, 19.01970672976953, 19.02170662028618,
+        19.02370651082588, 19.02570640138862, 19.02770629197438, 19.02970618258315,
+        19.03170607321494, 19.03370596386974, 19.03570585454753, 19.03770574524831,
+        19.03970563597208, 19.04170552671882, 19.04370541748853, 19.0457053082812,
+        19.04770519909682, 19.04970508993539, 19.05170498079691, 19.05370487168135,
+        19.05570476258872, 19.057704653519, 19.0597045444722, 19.0617044354483,
+        19.06370432644729, 19.06570421746917, 19.06770410851394, 19.06970399958158,
+        19.07170389067209, 19.07370378178546, 19.07570367292168, 19.07770356408074,
+        19.07970345526265, 19.08170334646738, 19.08370323769494, 19.08570312894532,
+        19.08770302021851, 19.0897029115145, 19.09170280283328, 19.09370269417486,
+        19.09570258553921, 19.09770247692634, 19.09970236833623, 19.10170225976889,
+        19.10370215122429, 19.10570204270245, 19.10770193420334, 19.10970182572696,
+        19.11170171727331, 19.11370160884237, 19.11570150043414, 19.11770139204861,
+        19.11970128368578, 19.12170117534564, 19.12370106702818, 19.1257009587334,
+        19.12770085046128, 19.12970074221182, 19.13170063398501, 19.13370052578085,
+        19.13570041759932, 19.13770030944043, 19.13970020130416, 19.14170009319051,
+        19.14369998509947, 19.14569987703103, 19.14769976898519, 19.14969966096194,
+        19.15169955296127, 19.15369944498317, 19.15569933702764, 19.15769922909467,
+        19.15969912118426, 19.16169901329639, 19.16369890543106, 19.16569879758826,
+        19.16769868976799, 19.16969858197024, 19.17169847419499, 19.17369836644225,
+        19.17569825871201, 19.17769815100426, 19.17969804331899, 19.1816979356562,
+        19.18369782801587, 19.18569772039801, 19.1876976128026, 19.18969750522964,
+        19.19169739767912, 19.19369729015104, 19.19569718264538, 19.19769707516214,
+        19.19969696770131, 19.20169686026289, 19.20369675284687, 19.20569664545324,
+        19.20769653808199, 19.20969643073312, 19.21169632340662, 19.21369621610249,
+        19.21569610882071, 19.21769600156128, 19.2196958943242, 19.22169578710945,
+        19.22369567991703, 19.22569557274693, 19.22769546559914, 19.22969535847367,
+        19.23169525137049, 19.23369514428961, 19.23569503723102, 19.2376949301947,
+        19.23969482318066, 19.24169471618888, 19.24369460921937, 19.2456945022721,
+        19.24769439534708, 19.2496942884443, 19.25169418156375, 19.25369407470543,
+        19.25569396786932, 19.25769386105543, 19.25969375426373, 19.26169364749424,
+        19.26369354074693, 19.26569343402181, 19.26769332731886, 19.26969322063808,
+        19.27169311397947, 19.273693007343, 19.27569290072869, 19.27769279413652,
+        19.27969268756648, 19.28169258101858, 19.28369247449279, 19.28569236798911,
+        19.28769226150755, 19.28969215504808, 19.29169204861071, 19.29369194219542,
+        19.29569183580221, 19.29769172943108, 19.29969162308201, 19.301691516755,
+        19.30369141045004, 19.30569130416713, 19.30769119790626, 19.30969109166741,
+        19.3116909854506, 19.3136908792558, 19.31569077308301, 19.31769066693222,
+        19.31969056080343, 19.32169045469664, 19.32369034861182, 19.32569024254899,
+        19.32769013650812, 19.32969003048922, 19.33168992449227, 19.33368981851727,
+        19.33568971256422, 19.3376896066331, 19.33968950072391, 19.34168939483664,
+        19.34368928897129, 19.34568918312784, 19.3476890773063, 19.34968897150665,
+        19.35168886572889, 19.35368875997302, 19.35568865423902, 19.35768854852688,
+        19.35968844283661, 19.36168833716819, 19.36368823152162, 19.36568812589689,
+        19.36768802029399, 19.36968791471292, 19.37168780915367, 19.37368770361624,
+        19.37568759810061, 19.37768749260678, 19.37968738713475, 19.3816872816845,
+        19.38368717625603, 19.38568707084934, 19.38768696546441, 19.38968686010124,
+        19.39168675475983, 19.39368664944016, 19.39568654414223, 19.39768643886603,
+        19.39968633361156, 19.40168622837881, 19.40368612316777, 19.40568601797844,
+        19.40768591281081, 19.40968580766487, 19.41168570254061, 19.41368559743804,
+        19.41568549235713, 19.4176853872979, 19.41968528226032, 19.42168517724439,
+        19.42368507225011, 19.42568496727747, 19.42768486232646, 19.42968475739708,
+        19.43168465248931, 19.43368454760316, 19.43568444273861, 19.43768433789566,
+        19.43968423307431, 19.44168412827453, 19.44368402349634, 19.44568391873972,
+        19.44768381400467, 19.44968370929117, 19.45168360459923, 19.45368349992883,
+        19.45568339527997, 19.45768329065264, 19.45968318604684, 19.46168308146256,
+        19.46368297689979, 19.46568287235853, 19.46768276783876, 19.46968266334049,
+        19.4716825588637, 19.47368245440839, 19.47568234997456, 19.47768224556219,
+        19.47968214117128, 19.48168203680182, 19.48368193245381, 19.48568182812724,
+        19.4876817238221, 19.48968161953839, 19.4916815152761, 19.49368141103522,
+        19.49568130681574, 19.49768120261767, 19.49968109844099, 19.5016809942857,
+        19.50368089015178, 19.50568078603924, 19.50768068194807, 19.50968057787826,
+        19.5116804738298, 19.51368036980269, 19.51568026579692, 19.51768016181248,
+        19.51968005784937, 19.52167995390759, 19.52367984998711, 19.52567974608795,
+        19.52767964221008, 19.52967953835352, 19.53167943451823, 19.53367933070424,
+        19.53567922691151, 19.53767912314006, 19.53967901938986, 19.54167891566093,
+        19.54367881195324, 19.54567870826679, 19.54767860460158, 19.5496785009576,
+        19.55167839733484, 19.5536782937333, 19.55567819015297, 19.55767808659384,
+        19.55967798305591, 19.56167787953917, 19.56367777604361, 19.56567767256923,
+        19.56767756911603, 19.56967746568398, 19.5716773622731, 19.57367725888336,
+        19.57567715551477, 19.57767705216732, 19.579676948841, 19.58167684553581,
+        19.58367674225173, 19.58567663898877, 19.58767653574691, 19.58967643252616,
+        19.59167632932649, 19.59367622614792, 19.59567612299042, 19.597676019854,
+        19.59967591673864, 19.60167581364434, 19.6036757105711, 19.60567560751891,
+        19.60767550448776, 19.60967540147764, 19.61167529848856, 19.61367519552049,
+        19.61567509257344, 19.6176749896474, 19.61967488674237, 19.62167478385832,
+        19.62367468099527, 19.62567457815321, 19.62767447533212, 19.629674372532,
+        19.63167426975284, 19.63367416699465, 19.6356740642574, 19.6376739615411,
+        19.63967385884574, 19.64167375617131, 19.64367365351781, 19.64567355088522,
+        19.64767344827355, 19.64967334568279, 19.65167324311293, 19.65367314056396,
+        19.65567303803587, 19.65767293552867, 19.65967283304235, 19.66167273057689,
+        19.6636726281323, 19.66567252570856, 19.66767242330567
+    };
+}
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
@@ -9,15 +9,34 @@
 //////////////////////////////////////////////////////////////////////
 
 SigmoidDensityModel::SigmoidDensityModel(double Mtot, double rb, double alpha, double beta, double gamma, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, rb, alpha, beta, gamma);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void SigmoidDensityModel::set_parameters(double Mtot, double rb, double alpha, double beta, double gamma)
 {
     _Mtot = Mtot;
     _rb = rb;
     _alpha = alpha;
     _beta = beta;
     _gamma = gamma;
+
+    // The normalization follows from the total mass of the unnormalized model, which is discarded afterwards
+
     _rhoc = 1.0;
-    _gl = gl;
+    invalidate_invariants();
     _rhoc = _Mtot / total_mass();
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> SigmoidDensityModel::parameters() const
+{
+    return {_Mtot, _rb, _alpha, _beta, _gamma};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -42,6 +61,13 @@ double SigmoidDensityModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void SigmoidDensityModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = SigmoidDensityModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double SigmoidDensityModel::derivative_density(double r) const
 {
     double t = r/_rb;
@@ -73,3 +99,10 @@ double SigmoidDensityModel::second_derivative_density(double r) const
 }
 
 //////////////////////////////////////////////////////////////////////
+
+void SigmoidDensityModel::mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    cumulative_mass_and_potential(rv,Mv,Psiv);
+}
+
+//////////////////////////////////////////////////////////////////////
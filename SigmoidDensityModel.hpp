@@ -19,6 +19,12 @@ public:
 
     /** Constructor of the SigmoidDensityModel class. */
     SigmoidDensityModel(double Mtot, double rb, double alpha, double beta, double gamma, const GaussLegendre* gl);
+
+    /** This function changes the parameters of the SigmoidDensityModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double rb, double alpha, double beta, double gamma);
+
+    /** This function returns the parameters of the SigmoidDensityModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
     
     /** This function returns the break radius \f$r_{\text{b}}\f$ of the sigmoid density model. */
     double scale_radius() const;
@@ -26,12 +32,18 @@ public:
     /** This function returns the density \f$\rho(r)\f$ of the sigmoid density model at radius \f$r\f$. */
     double density(double r) const;
 
+    /** This function stores the density \f$\rho(r_i)\f$ of the sigmoid density model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the sigmoid density model at radius \f$r\f$. */
     double derivative_density(double r) const;
 
     /** This function returns the second derivative of the density \f$\rho''(r)\f$ of the sigmoid density model at radius \f$r\f$. */
     double second_derivative_density(double r) const;
 
+    /** This function calculates the mass \f$M(r_i)\f$ and the potential \f$\Psi(r_i)\f$ of the sigmoid density model at the radii \f$r_i\f$ in the vector rv, in a single cumulative sweep over the radii. */
+    void mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
+
 private:
 
     /** The total mass \f$M_{\text{tot}}\f$. */
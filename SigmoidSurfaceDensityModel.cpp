@@ -9,15 +9,34 @@
 //////////////////////////////////////////////////////////////////////
 
 SigmoidSurfaceDensityModel::SigmoidSurfaceDensityModel(double Mtot, double Rb, double alpha, double beta, double gamma, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, Rb, alpha, beta, gamma);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void SigmoidSurfaceDensityModel::set_parameters(double Mtot, double Rb, double alpha, double beta, double gamma)
 {
     _Mtot = Mtot;
     _Rb = Rb;
     _alpha = alpha;
     _beta = beta;
     _gamma = gamma;
+
+    // The normalization follows from the total mass of the unnormalized model, which is discarded afterwards
+
     _Sigmac = 1.0;
-    _gl = gl;
+    invalidate_invariants();
     _Sigmac = _Mtot / total_mass();
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> SigmoidSurfaceDensityModel::parameters() const
+{
+    return {_Mtot, _Rb, _alpha, _beta, _gamma};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -56,6 +75,13 @@ double SigmoidSurfaceDensityModel::derivative_surface_density(double R) const
 
 //////////////////////////////////////////////////////////////////////
 
+void SigmoidSurfaceDensityModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = SigmoidSurfaceDensityModel::derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double SigmoidSurfaceDensityModel::second_derivative_surface_density(double R) const
 {
     double t = R/_Rb;
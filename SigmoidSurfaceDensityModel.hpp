@@ -20,6 +20,12 @@ public:
     /** Constructor of the SigmoidSurfaceDensityModel class. */
     SigmoidSurfaceDensityModel(double Mtot, double Rb, double alpha, double beta, double gamma, const GaussLegendre* gl);
 
+    /** This function changes the parameters of the SigmoidSurfaceDensityModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double Rb, double alpha, double beta, double gamma);
+
+    /** This function returns the parameters of the SigmoidSurfaceDensityModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
+
     /** This function returns the break radius \f$R_{\text{b}}\f$ of the sigmoid surface density model. */
     double scale_radius() const;
     
@@ -28,6 +34,9 @@ public:
 
     /** This function returns the derivative of the surface density \f$\Sigma'(R)\f$ of the sigmoid surface density model at projected radius \f$R\f$. */
     double derivative_surface_density(double R) const;
+
+    /** This function stores the derivative of the surface density \f$\Sigma'(R_i)\f$ of the sigmoid surface density model at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
     
     /** This function returns the second derivative of the surface density \f$\Sigma''(R)\f$ of the sigmoid surface density model at projected radius \f$R\f$. */
     double second_derivative_surface_density(double R) const;
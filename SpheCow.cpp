@@ -68,6 +68,8 @@ void run_model(const Model* model, double ra, std::string filename, std::vector<
          << "# column 18: osipkov-merritt pseudo density of states for ra = " << ra << std::endl
          << "# column 19: osipkov-merritt pseudo differential energy distribution for ra = " << ra << std::endl << std::endl;
     file << std::scientific << std::setprecision(16);
+    std::vector<double> Mv, Psiv;
+    model->mass_and_potential_profiles(rv,Mv,Psiv);
     int numr = rv.size();
     for (int i=0; i<numr; ++i)
     {
@@ -75,18 +77,18 @@ void run_model(const Model* model, double ra, std::string filename, std::vector<
         std::cout << "Calculating properties for r = " << r << std::endl;
         double rho = model->density(r);
         double gamma = model->density_slope(r);
-        double M = model->mass(r);
-        double vc = model->circular_velocity(r);
+        double M = Mv[i];
+        double vc = M/r;
         double Sigma = model->surface_density(r);
         double gammap = model->surface_density_slope(r);
         double Mp = model->surface_mass(r);
-        double Psi = model->potential(r);
-        double disp_iso = model->isotropic_dispersion(r);
+        double Psi = Psiv[i];
+        double disp_iso, dispr_om;
+        model->radial_dispersions(r,ra,disp_iso,dispr_om);
         double dispp_iso = model->isotropic_projected_dispersion(r);
         double df_iso = model->isotropic_distribution_function(r);
         double g_iso = model->isotropic_density_of_states(r);
         double ded_iso = df_iso * g_iso;
-        double dispr_om = model->osipkov_merritt_radial_dispersion(r,ra);
         double dispt_om = model->osipkov_merritt_tangential_dispersion(r,ra);
         double dispp_om = model->osipkov_merritt_projected_dispersion(r,ra);
         double df_om = model->osipkov_merritt_distribution_function(r,ra);
@@ -141,6 +143,30 @@ void validate_model(const Model* model, double r, double ra)
 
 //////////////////////////////////////////////////////////////////////
 
+void validate_split_radii(Model* model, double rs, double r)
+{
+    double v[2][5];
+    for (int k=0; k<2; k++)
+    {
+        model->set_split_radii(k ? std::vector<double>(1,rs) : std::vector<double>());
+        v[k][0] = model->density(r);
+        v[k][1] = model->surface_density(r);
+        v[k][2] = model->surface_mass(r);
+        v[k][3] = model->isotropic_dispersion(r);
+        v[k][4] = model->isotropic_projected_dispersion(r);
+    }
+    model->set_split_radii(std::vector<double>());
+    std::cout << std::setprecision(12) << std::endl;
+    std::cout << "Relative differences at r = " << r << " with the integrals split at rs = " << rs << std::endl;
+    std::cout << std::setprecision(3);
+    const char* names[5] = {"rho", "Sigma", "Mp", "disp_iso", "dispp_iso"};
+    for (int j=0; j<5; j++) std::cout << names[j] << " : " << fabs(v[1][j]/v[0][j]-1.0) << std::endl;
+    std::cout << std::endl;
+    return;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 void calculate_energy_model(const Model* model, double ra)
 {
     std::cout << std::setprecision(12);
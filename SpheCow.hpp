@@ -19,6 +19,9 @@ void run_model(const Model* model, double ra, std::string filename, std::vector<
 /** This routine can be used to test and validate the implementation of new models (subclasses of the DensityModel or SurfaceDensityModel classes). It reads in a radius \f$r\f$ and calculates the density and its derivatives, the mass, and the potential at that radius. These values can be checked against values calculated in other ways. The routine also calculates the density by integrating the isotropic and the Osipkov-Merritt distribution function (with anisotropy radius \f$r_{\text{a}}\f$) over velocity space. */
 void validate_model(const Model* model, double r, double ra);
 
+/** This routine can be used to validate the integration routines of a model with split radii. It calculates the density, the surface density, the surface mass, the isotropic dispersion and the isotropic projected dispersion at radius \f$r\f$, once with the integrals split only at the breakpoints of the model, and once with the integrals also split at the radius \f$r_{\text{s}}\f$ (see the function Model::set_split_radii()), and prints their relative differences. For a smooth model, these properties do not depend on the split radii, such that the differences should be at the level of the accuracy of the quadrature, also for radii \f$r\f$ just below \f$r_{\text{s}}\f$. The additional split radius is removed afterwards. */
+void validate_split_radii(Model* model, double rs, double r);
+
 /** This routine calculates the mass and the different energies for a model, that is the total potential energy, the total kinetic energy, and the total integrated binding energy. This routine also serves for validation purposes. */
 void calculate_energy_model(const Model* model, double ra);
 
@@ -10,63 +10,88 @@
 
 //////////////////////////////////////////////////////////////////////
 
+void SurfaceDensityModel::second_derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = second_derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void SurfaceDensityModel::third_derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = third_derivative_surface_density(R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double SurfaceDensityModel::total_mass() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    return _Mtotmemo.get([&]()
     {
-        return surface_density(u) * u;
-    };
-    return 2.0*M_PI*_gl->integrate_0_infty(integrand,scale_radius());
+        std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+        {
+            surface_density(u,X,n);
+            for (size_t i=0; i<n; i++) X[i] *= u[i];
+        };
+        return 2.0*M_PI*integrate_0_infty_batch(integrand);
+    });
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double SurfaceDensityModel::density(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return derivative_surface_density(u) / sqrt((u-r)*(u+r));
+        derivative_surface_density(u,X,n);
     };
-    return -M_1_PI * _gl->integrate_r_infty(integrand,r,scale_radius());
+    return -M_1_PI * integrate_abel_batch(integrand,r);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double SurfaceDensityModel::derivative_density(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return second_derivative_surface_density(u) * u/sqrt((u-r)*(u+r));
+        second_derivative_surface_density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i];
     };
-    return -M_1_PI * _gl->integrate_r_infty(integrand,r,scale_radius())/r;
+    return -M_1_PI * integrate_abel_batch(integrand,r)/r;
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double SurfaceDensityModel::second_derivative_density(double r) const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
     {
-        return third_derivative_surface_density(u) * u*u/sqrt((u-r)*(u+r));
+        third_derivative_surface_density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i]*u[i];
     };
-    return -M_1_PI * _gl->integrate_r_infty(integrand,r,scale_radius())/(r*r);
+    return -M_1_PI * integrate_abel_batch(integrand,r)/(r*r);
 }
 
 //////////////////////////////////////////////////////////////////////
 
 double SurfaceDensityModel::mass(double r) const
 {
-    std::function<double(double)> integrand1 = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand1 = [&](const double* u, double* X, size_t n)
     {
-        return derivative_surface_density(u) * u*u;
+        derivative_surface_density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i]*u[i];
     };
-    double ans1 = -M_PI * _gl->integrate_0_r(integrand1,r,scale_radius());
-    std::function<double(double)> integrand2 = [&](double u) -> double
+    double ans1 = -M_PI * integrate_0_r_batch(integrand1,r);
+    std::function<void(const double*, double*, size_t)> integrand2 = [&](const double* u, double* X, size_t n)
     {
-        double t = sqrt((u-r)*(u+r));
-        return derivative_surface_density(u) * (u*u*atan(r/t)-r*t);
+        derivative_surface_density(u,X,n);
+        for (size_t i=0; i<n; i++)
+        {
+            double t = sqrt((u[i]-r)*(u[i]+r));
+            X[i] *= u[i]*u[i]*atan(r/t)-r*t;
+        }
     };
-    double ans2 = -2.0 * _gl->integrate_r_infty(integrand2,r,scale_radius());
+    double ans2 = -2.0 * integrate_r_infty_batch(integrand2,r,_abelts);
     return ans1 + ans2;
 }
 
@@ -74,29 +99,76 @@ double SurfaceDensityModel::mass(double r) const
 
 double SurfaceDensityModel::potential(double r) const
 {
-    std::function<double(double)> integrand1 = [&](double u) -> double
+    std::function<void(const double*, double*, size_t)> integrand1 = [&](const double* u, double* X, size_t n)
     {
-        return derivative_surface_density(u) * u*u;
+        derivative_surface_density(u,X,n);
+        for (size_t i=0; i<n; i++) X[i] *= u[i]*u[i];
     };
-    double ans1 = -M_PI/r * _gl->integrate_0_r(integrand1,r,scale_radius());
-    std::function<double(double)> integrand2 = [&](double u) -> double
+    double ans1 = -M_PI/r * integrate_0_r_batch(integrand1,r);
+    std::function<void(const double*, double*, size_t)> integrand2 = [&](const double* u, double* X, size_t n)
     {
-        double t = sqrt((u-r)*(u+r));
-        return derivative_surface_density(u) * (u*u*atan(r/t)+r*t);
+        derivative_surface_density(u,X,n);
+        for (size_t i=0; i<n; i++)
+        {
+            double t = sqrt((u[i]-r)*(u[i]+r));
+            X[i] *= u[i]*u[i]*atan(r/t)+r*t;
+        }
     };
-    double ans2 = -2.0/r * _gl->integrate_r_infty(integrand2,r,scale_radius());
+    double ans2 = -2.0/r * integrate_r_infty_batch(integrand2,r,_abelts);
     return ans1 + ans2;
 }
 
 //////////////////////////////////////////////////////////////////////
 
+void SurfaceDensityModel::mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    if (_abelts || _reltol>0.0)
+    {
+        Model::mass_and_potential_profiles(rv,Mv,Psiv);
+        return;
+    }
+    Mv.resize(rv.size());
+    Psiv.resize(rv.size());
+    for (size_t k=0; k<rv.size(); k++)
+    {
+        double r = rv[k];
+        std::function<void(const double*, double*, size_t)> integrand1 = [&](const double* u, double* X, size_t n)
+        {
+            derivative_surface_density(u,X,n);
+            for (size_t i=0; i<n; i++) X[i] *= u[i]*u[i];
+        };
+        double ans1 = -M_PI * integrate_0_r_batch(integrand1,r);
+        std::function<void(const double*, double*, size_t)> integrand2 = [&](const double* u, double* X, size_t n)
+        {
+            derivative_surface_density(u,X,n);
+            for (size_t i=0; i<n; i++)
+            {
+                double t = sqrt((u[i]-r)*(u[i]+r));
+                double a = u[i]*u[i]*atan(r/t);
+                X[n+i] = X[i] * (a+r*t);
+                X[i] *= a-r*t;
+            }
+        };
+        double I[2];
+        integrate_r_infty_batch(integrand2,r,2,I);
+        Mv[k] = ans1 - 2.0*I[0];
+        Psiv[k] = (ans1 - 2.0*I[1])/r;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double SurfaceDensityModel::central_potential() const
 {
-    std::function<double(double)> integrand = [&](double u) -> double
+    return _Psi0memo.get([&]()
     {
-        return derivative_surface_density(u) * u;
-    };
-    return -4.0 * _gl->integrate_0_infty(integrand,scale_radius());
+        std::function<void(const double*, double*, size_t)> integrand = [&](const double* u, double* X, size_t n)
+        {
+            derivative_surface_density(u,X,n);
+            for (size_t i=0; i<n; i++) X[i] *= u[i];
+        };
+        return -4.0 * integrate_0_infty_batch(integrand);
+    });
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -22,9 +22,15 @@ public:
     
     /** This pure virtual function returns the second derivative of the surface density \f$\Sigma''(R)\f$ at projected radius \f$R\f$. */
     virtual double second_derivative_surface_density(double R) const = 0;
+
+    /** This function stores the second derivative of the surface density \f$\Sigma''(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void second_derivative_surface_density(const double* R, double* out, size_t n) const;
     
     /** This pure virtual function returns the third derivative of the surface density \f$\Sigma'''(R)\f$ at projected radius \f$R\f$. */
     virtual double third_derivative_surface_density(double R) const = 0;
+
+    /** This function stores the third derivative of the surface density \f$\Sigma'''(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. It is the batched version of the function above, with a default implementation that calls the scalar version for each radius. */
+    virtual void third_derivative_surface_density(const double* R, double* out, size_t n) const;
     
     /** This function returns the density \f$\rho(r)\f$ at radius \f$r\f$. It is calculated as \f[ \rho(r) = -\frac{1}{\pi} \int_r^\infty \frac{\Sigma'(u)\,{\text{d}} u}{\sqrt{u^2-r^2}}. \f] The integration is performed using Gauss-Legendre quadrature. */
     double density(double r) const;
@@ -38,13 +44,16 @@ public:
     /** This function returns the mass \f$M(r)\f$ at radius \f$r\f$. It is calculated as \f[ M(r) = -\pi \left[ \int_0^r \Sigma'(u)\,u^2\, {\text{d}} u + \int_r^\infty \Sigma'(u)\,w_-(u,r)\, {\text{d}} u \right],\f] with \f[ w_-(u,r) = \frac{2}{\pi}\left[u^2\arctan\left(\frac{r}{\sqrt{u^2-r^2}}\right)-r\sqrt{u^2-r^2}\right]. \f] The integration is performed using Gauss-Legendre quadrature. */
     double mass(double r) const;
     
-    /** This function returns the total mass \f$M_{\text{tot}}\f$. It is calculated as \f[ M_{\text{tot}} = 2\pi \int_0^\infty \Sigma(u)\, u\, {\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature.  This function is a virtual function that can be reimplemented by derived classes. */
+    /** This function returns the total mass \f$M_{\text{tot}}\f$. It is calculated as \f[ M_{\text{tot}} = 2\pi \int_0^\infty \Sigma(u)\, u\, {\text{d}} u. \f] The integration is performed using Gauss-Legendre quadrature, once until the parameters or the integrators of the model change.  This function is a virtual function that can be reimplemented by derived classes. */
     virtual double total_mass() const;
     
     /** This function returns the potential \f$\Psi(r)\f$ at radius \f$r\f$. It is calculated as \f[ \Psi(r) = -\frac{\pi\,G}{r} \left[ \int_0^r \Sigma'(u)\,u^2\, {\text{d}} u + \int_r^\infty \Sigma'(u)\,w_+(u,r)\,{\text{d}} u \right], \f] with \f[ w_+(u,r) = \frac{2}{\pi}\left[u^2\arctan\left(\frac{r}{\sqrt{u^2-r^2}}\right)+r\sqrt{u^2-r^2}\right]. \f] The integration is performed using Gauss-Legendre quadrature. */
     double potential(double r) const;
 
-    /** This function returns the central potential \f$\Psi_0\f$. It is calculated as \f[ \Psi_0 = -4\,G \int_0^\infty \Sigma'(u)\,u\,{\text{d}} u \right]. \f] The integration is performed using Gauss-Legendre quadrature. This function is a virtual function that can be reimplemented by derived classes. */
+    /** This function calculates the mass \f$M(r_i)\f$ and the potential \f$\Psi(r_i)\f$ at the radii \f$r_i\f$ in the vector rv, as in the functions mass() and potential(), and stores them in the vectors Mv and Psiv. The integral over \f$[0,r_i]\f$ is the same for both profiles, and the integrals over \f$[r_i,\infty[\f$ with the kernels \f$w_-(u,r_i)\f$ and \f$w_+(u,r_i)\f$ are estimated in a single pass over the nodes, such that \f$\Sigma'(u)\f$ is evaluated twice per radius rather than four times. The cumulative sweep of the function DensityModel::cumulative_mass_and_potential() does not apply, since the kernels depend on both \f$u\f$ and \f$r_i\f$, such that the integrals over \f$[r_i,\infty[\f$ cannot be accumulated from one radius to the next. In adaptive mode, or with a tanh-sinh integrator for the Abel integrals, the function falls back to the batched functions mass() and potential(). */
+    void mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
+
+    /** This function returns the central potential \f$\Psi_0\f$. It is calculated as \f[ \Psi_0 = -4\,G \int_0^\infty \Sigma'(u)\,u\,{\text{d}} u \right]. \f] The integration is performed using Gauss-Legendre quadrature, once until the parameters or the integrators of the model change. This function is a virtual function that can be reimplemented by derived classes. */
     virtual double central_potential() const;
 };
 
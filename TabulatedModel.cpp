@@ -0,0 +1,735 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "TabulatedModel.hpp"
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <typeinfo>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The spacing in ln r of the initial grid
+    const double hinit = 0.5;
+
+    // The spacing in ln r below which grid intervals are no longer split
+    const double hmin = 1e-5;
+
+    // The largest rate of change of the logarithmic slope of a profile with ln r, relative to the slope itself, for
+    // which the logarithm of the profile is interpolated; this rate vanishes for power laws and is 1/m for exponential
+    // tails, but diverges close to a zero or an extremum of the profile, where the profile itself is interpolated
+    const double maxlograte = 4.0;
+
+    // The relative offset from a breakpoint at which the limits of the profiles on either side of it are sampled
+    const double bpoffset = 1e-12;
+
+    // The number of test points in the interior of each grid interval; an interval that fails the test is split at
+    // these points, such that they become nodes
+    const int numtest = 3;
+
+    // The factor by which a split should at least reduce the interpolation error, compared to the parent interval, or
+    // the square of this factor, compared to the grandparent interval; the error of a cubic Hermite interpolant drops by
+    // a factor of 64 to 256 for a split into four, unless the sampled profile is itself only accurate to a lower
+    // precision
+    const double minreduction = 2.0;
+
+    // The signature, version and byte order mark of the cache files; the version should be incremented whenever the
+    // layout of the file or the tabulation algorithm changes
+    const char cachemagic[8] = {'S','p','h','e','C','o','w','T'};
+    const uint32_t cacheversion = 3;
+    const uint32_t cachebyteorder = 0x01020304;
+
+    // The radii in units of the scale radius at which the density and the mass of the wrapped model are part of the
+    // key of the cache file
+    const double keyradii[] = {1e-2, 1e-1, 1.0, 1e1, 1e2};
+
+    // The header of a cache file, followed by the key padded to a multiple of eight bytes, the nodes, the values and
+    // the slopes of all profiles
+    struct CacheHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteorder;
+        uint64_t keysize;
+        uint64_t numnodes;
+        double error;
+    };
+
+    // This function returns true if both values are nonzero and have the same sign, without forming their product,
+    // which underflows far out in the tails of the profiles
+    bool samesign(double a, double b)
+    {
+        return (a>0.0 && b>0.0) || (a<0.0 && b<0.0);
+    }
+
+    // This function returns the size of the key padded to a multiple of eight bytes
+    size_t padded(size_t size)
+    {
+        return (size+7)/8*8;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TabulatedModel::TabulatedModel(const Model* model, const GaussLegendre* gl, double tol, double xmin, double xmax)
+{
+    _model = model;
+    _gl = gl;
+    _reltol = model->relative_tolerance();
+    _Mtot = model->total_mass();
+    _Psi0 = model->central_potential();
+    tabulate(tol,xmin,xmax);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TabulatedModel::TabulatedModel(const Model* model, const GaussLegendre* gl, std::string filename, double tol, double xmin, double xmax)
+{
+    _model = model;
+    _gl = gl;
+    _reltol = model->relative_tolerance();
+    _Mtot = model->total_mass();
+    _Psi0 = model->central_potential();
+    std::string key = cache_key(tol,xmin,xmax);
+    if (load(filename,key)) return;
+    tabulate(tol,xmin,xmax);
+    save(filename,key);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TabulatedModel::~TabulatedModel()
+{
+#ifndef _WIN32
+    if (_mapping) munmap(_mapping,_mappingsize);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::tabulate(double tol, double xmin, double xmax)
+{
+    // Set up the initial grid, with two nodes at each breakpoint of the model that hold the limits of the profiles on
+    // either side of it. The grid thus consists of segments on which the profiles are smooth, separated by intervals
+    // of zero width that are never used for interpolation.
+
+    double rs = _model->scale_radius();
+    double x1 = log(xmin*rs);
+    double x2 = log(xmax*rs);
+    int numinit = static_cast<int>(ceil((x2-x1)/hinit));
+    std::vector<double> xv, xbv;
+    for (int j=0; j<=numinit; j++) xv.push_back(x1 + (x2-x1)*j/numinit);
+    for (double rbp : _model->breakpoints())
+        if (rbp>xmin*rs && rbp<xmax*rs) xbv.push_back(log(rbp));
+    xv.insert(xv.end(),xbv.begin(),xbv.end());
+    std::sort(xv.begin(),xv.end());
+    xv.erase(std::unique(xv.begin(),xv.end()),xv.end());
+    std::sort(xbv.begin(),xbv.end());
+
+    std::vector<double> rv;
+    for (double x : xv)
+    {
+        _xv.push_back(x);
+        if (std::binary_search(xbv.begin(),xbv.end(),x))
+        {
+            _xv.push_back(x);
+            rv.push_back(exp(x)*(1.0-bpoffset));
+            rv.push_back(exp(x)*(1.0+bpoffset));
+        }
+        else rv.push_back(exp(x));
+    }
+    size_t n = _xv.size();
+    std::vector<double> fv(NumProfiles*n);
+    sample(rv.data(),fv.data(),n);
+    _fv.resize(NumProfiles);
+    _gv.resize(NumProfiles);
+    for (int k=0; k<NumProfiles; k++) _fv[k].assign(fv.begin()+k*n, fv.begin()+(k+1)*n);
+
+    // Split the grid intervals until the interpolants agree with the model at all test points of all intervals. Each
+    // pass only tests the intervals that are new, or whose slopes may have changed because a neighbour was split.
+    // Intervals where splits no longer reduce the error, because the profiles of the model are noisy at that level,
+    // are not split any further, and the error that they reach is recorded instead.
+
+    typedef std::array<double,NumProfiles> Errors;
+    Errors unknown;
+    unknown.fill(std::numeric_limits<double>::infinity());
+    std::vector<bool> checked(n-1, false);
+    std::vector<Errors> parentq(n-1, unknown);
+    std::vector<Errors> grandq(n-1, unknown);
+    std::vector<double> errorv(n-1, 0.0);
+    while (true)
+    {
+        calculate_slopes();
+        publish();
+        std::vector<size_t> iv;
+        for (size_t i=0; i<checked.size(); i++) if (!checked[i] && _xv[i+1]>_xv[i]) iv.push_back(i);
+        if (iv.empty()) break;
+
+        size_t m = iv.size();
+        size_t mt = numtest*m;
+        std::vector<double> xm(mt), rm(mt), fm(NumProfiles*mt);
+        for (size_t j=0; j<m; j++)
+        {
+            for (int l=0; l<numtest; l++)
+            {
+                xm[numtest*j+l] = _xv[iv[j]] + (l+1.0)/(numtest+1.0)*(_xv[iv[j]+1]-_xv[iv[j]]);
+                rm[numtest*j+l] = exp(xm[numtest*j+l]);
+            }
+        }
+        sample(rm.data(),fm.data(),mt);
+
+        // The error of each profile is expressed in units of the tolerance, relative to the exact value or, where the
+        // profile changes sign in the interval, relative to its largest magnitude in the interval. The largest error
+        // over the test points of the interval is retained. Profiles that underflow to subnormal numbers in the
+        // interval carry too few digits to be tested.
+
+        std::vector<bool> split(checked.size(), false);
+        std::vector<Errors> qv(m);
+        for (size_t j=0; j<m; j++)
+        {
+            size_t i = iv[j];
+            errorv[i] = 0.0;
+            for (int k=0; k<NumProfiles; k++)
+            {
+                double fmin = min(fabs(_fv[k][i]),fabs(_fv[k][i+1]));
+                double fmax = max(fabs(_fv[k][i]),fabs(_fv[k][i+1]));
+                bool signchange = !samesign(_fv[k][i],_fv[k][i+1]);
+                for (int l=0; l<numtest; l++)
+                {
+                    double f = fm[k*mt+numtest*j+l];
+                    fmin = min(fmin, fabs(f));
+                    fmax = max(fmax, fabs(f));
+                    signchange = signchange || !samesign(f,_fv[k][i]);
+                }
+                qv[j][k] = 0.0;
+                if (fmin<std::numeric_limits<double>::min() && !signchange) continue;
+                if (fmax<std::numeric_limits<double>::min()) continue;
+                for (int l=0; l<numtest; l++)
+                {
+                    double f = fm[k*mt+numtest*j+l];
+                    double scale = signchange ? fmax : fabs(f);
+                    qv[j][k] = max(qv[j][k], fabs(interpolate(k,i,xm[numtest*j+l])-f) / (tol*scale));
+                }
+                if (qv[j][k]>1.0 && _xv[i+1]-_xv[i]>hmin && (qv[j][k]*minreduction<parentq[i][k]
+                        || qv[j][k]*minreduction*minreduction<grandq[i][k])) split[i] = true;
+                errorv[i] = max(errorv[i], qv[j][k]);
+            }
+        }
+
+        // Insert the test points of the split intervals as new nodes
+
+        std::vector<double> xnew;
+        std::vector<std::vector<double>> fnew(NumProfiles);
+        std::vector<bool> cnew;
+        std::vector<Errors> pnew;
+        std::vector<Errors> gnew;
+        std::vector<double> enew;
+        size_t j = 0;
+        for (size_t i=0; i<checked.size(); i++)
+        {
+            bool neighbour = (i>0 && split[i-1]) || (i+1<split.size() && split[i+1]);
+            xnew.push_back(_xv[i]);
+            for (int k=0; k<NumProfiles; k++) fnew[k].push_back(_fv[k][i]);
+            if (j<m && iv[j]==i)
+            {
+                if (split[i])
+                {
+                    for (int l=0; l<numtest; l++)
+                    {
+                        xnew.push_back(xm[numtest*j+l]);
+                        for (int k=0; k<NumProfiles; k++) fnew[k].push_back(fm[k*mt+numtest*j+l]);
+                    }
+                    for (int l=0; l<=numtest; l++)
+                    {
+                        cnew.push_back(false);
+                        pnew.push_back(qv[j]);
+                        gnew.push_back(parentq[i]);
+                        enew.push_back(0.0);
+                    }
+                }
+                else
+                {
+                    cnew.push_back(!neighbour);
+                    pnew.push_back(parentq[i]);
+                    gnew.push_back(grandq[i]);
+                    enew.push_back(errorv[i]);
+                }
+                j++;
+            }
+            else
+            {
+                cnew.push_back(checked[i] && !neighbour);
+                pnew.push_back(parentq[i]);
+                gnew.push_back(grandq[i]);
+                enew.push_back(errorv[i]);
+            }
+        }
+        xnew.push_back(_xv.back());
+        for (int k=0; k<NumProfiles; k++) fnew[k].push_back(_fv[k].back());
+        _xv.swap(xnew);
+        _fv.swap(fnew);
+        checked.swap(cnew);
+        parentq.swap(pnew);
+        grandq.swap(gnew);
+        errorv.swap(enew);
+    }
+    _error = tol * *std::max_element(errorv.begin(),errorv.end());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::publish()
+{
+    _n = _xv.size();
+    _x = _xv.data();
+    for (int k=0; k<NumProfiles; k++)
+    {
+        _f[k] = _fv[k].data();
+        _g[k] = _gv[k].data();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::string TabulatedModel::cache_key(double tol, double xmin, double xmax) const
+{
+    double rs = _model->scale_radius();
+    std::vector<double> parameters = _model->parameters();
+    std::vector<double> values = {tol, xmin, xmax, _model->relative_tolerance(),
+                                  static_cast<double>(_model->integrator()->num()),
+                                  static_cast<double>(parameters.size())};
+    values.insert(values.end(), parameters.begin(), parameters.end());
+    values.push_back(rs);
+    values.push_back(_Mtot);
+    values.push_back(_Psi0);
+    for (double x : keyradii)
+    {
+        values.push_back(_model->density(x*rs));
+        values.push_back(_model->mass(x*rs));
+    }
+    std::string key = typeid(*_model).name();
+    key.push_back('\0');
+    key.append(reinterpret_cast<const char*>(values.data()), values.size()*sizeof(double));
+    return key;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool TabulatedModel::load(const std::string& filename, const std::string& key)
+{
+    // Obtain the contents of the file, mapped read-only where memory mapping is available
+
+#ifdef _WIN32
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) return false;
+    std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const char* base = buffer.data();
+    size_t size = buffer.size();
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd<0) return false;
+    struct stat info;
+    if (fstat(fd,&info) || info.st_size<static_cast<off_t>(sizeof(CacheHeader)))
+    {
+        close(fd);
+        return false;
+    }
+    size_t size = info.st_size;
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping==MAP_FAILED) return false;
+    const char* base = static_cast<const char*>(mapping);
+#endif
+
+    // Verify the header, the key and the size of the file
+
+    CacheHeader header;
+    memset(&header, 0, sizeof(header));
+    if (size>=sizeof(header)) memcpy(&header, base, sizeof(header));
+    size_t n = header.numnodes;
+    size_t offset = sizeof(header) + padded(key.size());
+    if (memcmp(header.magic,cachemagic,sizeof(cachemagic)) || header.version!=cacheversion
+            || header.byteorder!=cachebyteorder || header.keysize!=key.size() || n<2
+            || size!=offset+(1+2*NumProfiles)*n*sizeof(double) || memcmp(base+sizeof(header),key.data(),key.size()))
+    {
+#ifndef _WIN32
+        munmap(mapping,size);
+#endif
+        return false;
+    }
+
+    // Point the table at the mapping or, without memory mapping, copy it into the vectors of the model
+
+#ifdef _WIN32
+    std::vector<double> data((1+2*NumProfiles)*n);
+    memcpy(data.data(), base+offset, data.size()*sizeof(double));
+    _xv.assign(data.begin(), data.begin()+n);
+    _fv.resize(NumProfiles);
+    _gv.resize(NumProfiles);
+    for (int k=0; k<NumProfiles; k++)
+    {
+        _fv[k].assign(data.begin()+(1+k)*n, data.begin()+(2+k)*n);
+        _gv[k].assign(data.begin()+(1+NumProfiles+k)*n, data.begin()+(2+NumProfiles+k)*n);
+    }
+    publish();
+#else
+    const double* data = reinterpret_cast<const double*>(base+offset);
+    _n = n;
+    _x = data;
+    for (int k=0; k<NumProfiles; k++)
+    {
+        _f[k] = data + (1+k)*n;
+        _g[k] = data + (1+NumProfiles+k)*n;
+    }
+    _mapping = mapping;
+#endif
+    _mappingsize = size;
+    _error = header.error;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::save(const std::string& filename, const std::string& key) const
+{
+    CacheHeader header;
+    memcpy(header.magic,cachemagic,sizeof(cachemagic));
+    header.version = cacheversion;
+    header.byteorder = cachebyteorder;
+    header.keysize = key.size();
+    header.numnodes = _n;
+    header.error = _error;
+
+    std::random_device random;
+    std::string tempname = filename + ".tmp" + std::to_string(random());
+    {
+        std::ofstream file(tempname, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(key.data(), key.size());
+        file.write(std::string(padded(key.size())-key.size(),'\0').data(), padded(key.size())-key.size());
+        file.write(reinterpret_cast<const char*>(_x), _n*sizeof(double));
+        for (int k=0; k<NumProfiles; k++) file.write(reinterpret_cast<const char*>(_f[k]), _n*sizeof(double));
+        for (int k=0; k<NumProfiles; k++) file.write(reinterpret_cast<const char*>(_g[k]), _n*sizeof(double));
+        if (!file)
+        {
+            file.close();
+            std::remove(tempname.c_str());
+            return;
+        }
+    }
+#ifdef _WIN32
+    std::remove(filename.c_str());
+#endif
+    if (std::rename(tempname.c_str(), filename.c_str())) std::remove(tempname.c_str());
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::sample(const double* r, double* f, size_t n) const
+{
+    _model->density(r, f+Rho*n, n);
+    _model->derivative_density(r, f+DRho*n, n);
+    _model->second_derivative_density(r, f+D2Rho*n, n);
+    _model->mass(r, f+Mass*n, n);
+    _model->potential(r, f+Psi*n, n);
+    _model->surface_density(r, f+Sigma*n, n);
+    _model->derivative_surface_density(r, f+DSigma*n, n);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::calculate_slopes()
+{
+    size_t n = _xv.size();
+    for (int k=0; k<NumProfiles; k++) _gv[k].resize(n);
+
+    // The slopes that follow from the other profiles
+
+    for (size_t i=0; i<n; i++)
+    {
+        double r = exp(_xv[i]);
+        _gv[Rho][i] = r * _fv[DRho][i];
+        _gv[DRho][i] = r * _fv[D2Rho][i];
+        _gv[Sigma][i] = r * _fv[DSigma][i];
+    }
+
+    // The slopes of the second derivative of the density, the mass, the potential and the derivative of the surface
+    // density are estimated from the parabola through the node and its neighbours, in the logarithm of the profile
+    // where that is smooth, and from the parabola through the end point and its two nearest nodes at the end points of
+    // each segment. The mass and the potential are not given the slopes that follow from the density and the mass,
+    // since these relations hold only to the precision of the quadratures of the wrapped model, which is much lower
+    // than that of the profiles themselves close to the centre and far out for some models.
+
+    for (int k : {D2Rho, Mass, Psi, DSigma})
+    {
+        const std::vector<double>& f = _fv[k];
+        for (size_t lo=0, hi=0; lo<n; lo=hi+1)
+        {
+            hi = lo;
+            while (hi+1<n && _xv[hi+1]>_xv[hi]) hi++;
+            for (size_t i=lo; i<=hi; i++)
+            {
+                if (hi-lo<2)
+                {
+                    bool logarithmic = samesign(f[lo],f[hi]);
+                    double s = (hi==lo) ? 0.0 : (logarithmic ? log(f[hi]/f[lo]) : f[hi]-f[lo]) / (_xv[hi]-_xv[lo]);
+                    _gv[k][i] = logarithmic ? f[i]*s : s;
+                    continue;
+                }
+                size_t a = min(max(i,lo+1),hi-1) - 1;
+                double h1 = _xv[a+1]-_xv[a];
+                double h2 = _xv[a+2]-_xv[a+1];
+                bool logarithmic = samesign(f[a],f[a+1]) && samesign(f[a+1],f[a+2]);
+                double s1 = (logarithmic ? log(f[a+1]/f[a]) : f[a+1]-f[a]) / h1;
+                double s2 = (logarithmic ? log(f[a+2]/f[a+1]) : f[a+2]-f[a+1]) / h2;
+                if (logarithmic && !(fabs(s2-s1) < maxlograte*0.5*(h1+h2)*min(fabs(s1),fabs(s2))))
+                {
+                    logarithmic = false;
+                    s1 = (f[a+1]-f[a]) / h1;
+                    s2 = (f[a+2]-f[a+1]) / h2;
+                }
+                double s;
+                if (i==a) s = s1 - h1*(s2-s1)/(h1+h2);
+                else if (i==a+1) s = (h2*s1 + h1*s2)/(h1+h2);
+                else s = s2 + h2*(s2-s1)/(h1+h2);
+                _gv[k][i] = logarithmic ? f[i]*s : s;
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::interpolate(int k, size_t i, double x) const
+{
+    double h = _x[i+1]-_x[i];
+    double t = (x-_x[i])/h;
+    double h00 = (1.0+2.0*t)*(1.0-t)*(1.0-t);
+    double h10 = t*(1.0-t)*(1.0-t);
+    double h01 = t*t*(3.0-2.0*t);
+    double h11 = t*t*(t-1.0);
+    double fa = _f[k][i];
+    double fb = _f[k][i+1];
+    double ga = _g[k][i];
+    double gb = _g[k][i+1];
+    if (samesign(fa,fb) && fabs(ga/fa-gb/fb) < maxlograte*h*min(fabs(ga/fa),fabs(gb/fb)))
+    {
+        double y = h00*log(fabs(fa)) + h10*h*ga/fa + h01*log(fabs(fb)) + h11*h*gb/fb;
+        return copysign(exp(y),fa);
+    }
+    return h00*fa + h10*h*ga + h01*fb + h11*h*gb;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::value(int k, double r) const
+{
+    double x = log(r);
+    if (!(x>=_x[0] && x<=_x[_n-1]))
+    {
+        switch (k)
+        {
+        case Rho: return _model->density(r);
+        case DRho: return _model->derivative_density(r);
+        case D2Rho: return _model->second_derivative_density(r);
+        case Mass: return _model->mass(r);
+        case Psi: return _model->potential(r);
+        case Sigma: return _model->surface_density(r);
+        default: return _model->derivative_surface_density(r);
+        }
+    }
+    size_t i = std::upper_bound(_x,_x+_n,x) - _x;
+    i = min(max(i,size_t(1)),_n-1) - 1;
+    return interpolate(k,i,x);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::scale_radius() const
+{
+    return _model->scale_radius();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> TabulatedModel::parameters() const
+{
+    return _model->parameters();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool TabulatedModel::exponential_tail(double& b, double& r0, double& m) const
+{
+    return _model->exponential_tail(b,r0,m);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> TabulatedModel::breakpoints() const
+{
+    return _model->breakpoints();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool TabulatedModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->outer_expansion(xt,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool TabulatedModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    return _model->inner_expansion(xs,p,alpha,av);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::total_mass() const
+{
+    return _Mtot;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::central_potential() const
+{
+    return _Psi0;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::density(double r) const
+{
+    return value(Rho,r);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = value(Rho,r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::derivative_density(double r) const
+{
+    return value(DRho,r);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = value(DRho,r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::second_derivative_density(double r) const
+{
+    return value(D2Rho,r);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::second_derivative_density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = value(D2Rho,r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::mass(double r) const
+{
+    return value(Mass,r);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::mass(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = value(Mass,r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::potential(double r) const
+{
+    return value(Psi,r);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::potential(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = value(Psi,r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::surface_density(double R) const
+{
+    return value(Sigma,R);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = value(Sigma,R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::derivative_surface_density(double R) const
+{
+    return value(DSigma,R);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void TabulatedModel::derivative_surface_density(const double* R, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = value(DSigma,R[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+size_t TabulatedModel::num_nodes() const
+{
+    return _n;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TabulatedModel::error_estimate() const
+{
+    return _error;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool TabulatedModel::from_cache() const
+{
+    return _mappingsize>0;
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,188 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef TABULATEDMODEL_HPP
+#define TABULATEDMODEL_HPP
+
+#include "Model.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+/** TabulatedModel is a subclass of the Model class that wraps any other model and serves its radial profiles from a table. The density \f$\rho(r)\f$, its first and second derivatives, the mass \f$M(r)\f$, the potential \f$\Psi(r)\f$, the surface density \f$\Sigma(R)\f$ and its derivative are sampled once, at construction, on an adaptive grid in \f$x = \ln r\f$, and are interpolated with cubic Hermite polynomials. Where a profile keeps the same sign over a grid interval and its logarithmic slope varies slowly compared to the slope itself, as for power laws and exponential tails, its logarithm is interpolated rather than the profile itself, such that power-law segments are reproduced exactly. Close to a zero or an extremum of a profile, the profile itself is interpolated. The slopes at the nodes follow from the exact relations \f$\rho' = {\text{d}}\rho/{\text{d}}r\f$, \f$\rho'' = {\text{d}}\rho'/{\text{d}}r\f$ and \f$\Sigma' = {\text{d}}\Sigma/{\text{d}}R\f$, and from the parabola through each node and its two neighbours for \f$\rho''\f$, \f$M\f$, \f$\Psi\f$ and \f$\Sigma'\f$. The relations \f${\text{d}}M/{\text{d}}r = 4\pi\,\rho\,r^2\f$ and \f${\text{d}}\Psi/{\text{d}}r = -M/r^2\f$ are not used, since they only hold to the precision of the quadratures of the wrapped model. Each breakpoint of the wrapped model is represented by two nodes, which hold the limits of the profiles on either side of it, such that no interpolant or slope straddles a breakpoint.
+
+    The grid is refined until the interpolated value of every profile at three test points in every grid interval, at a quarter, half and three quarters of the interval, agrees with the exact value to within the relative tolerance. The error is measured relative to the exact value or, where the profile changes sign in the interval, relative to its largest magnitude in the interval. The midpoint is where the error of a cubic Hermite polynomial with exact slopes peaks, while the other points catch the errors due to estimated slopes, which vanish at the midpoint. An interval that fails this test is split into four at its test points, such that no evaluation of the wrapped model is wasted. Intervals where successive splits no longer reduce the error, because the profiles of the wrapped model are themselves only accurate to a lower precision, are not split further, and neither are intervals narrower than a minimum width. The tolerance is therefore not a guaranteed bound: the function error_estimate() returns the largest relative error found at the test points of the final grid, which exceeds the tolerance where the splits stalled, and which is a close but not a rigorous estimate of the error in between the test points. Outside the tabulated range, all profiles are obtained from the wrapped model directly. All other properties of the model, such as the distribution function, the dispersions and the global properties, are calculated by the Model base class from the tabulated profiles, such that they can be evaluated orders of magnitude faster for models whose profiles are themselves numerical integrals, such as the subclasses of the SurfaceDensityModel class.
+
+    A table can be stored in a cache file, such that other processes that tabulate the same model can skip the tabulation. The file is a versioned binary file that starts with a key, which consists of the class name of the wrapped model, the parameters of the tabulation, the relative tolerance and the number of Gauss-Legendre nodes of the wrapped model, its parameters as returned by the function Model::parameters(), and the exact values of its total mass, central potential, density and mass at a few radii. The latter values also distinguish the quadrature with which its profiles are calculated, and models that do not report their parameters. If the key in the file matches, the file is memory-mapped read-only and the table is served directly from the mapping, such that many processes that use the same file share a single copy of the table in memory. Otherwise, the model is tabulated and the file is replaced. A file holds a single table: processes that cache different models under the same file name replace each other's tables and tabulate every time, so that each model should be given a file name of its own, for example one derived from its parameters. */
+
+class TabulatedModel : public Model
+{
+public:
+
+    /** Constructor of the TabulatedModel class. It reads in the wrapped model, which should remain alive and unchanged as long as the tabulated model is used, the Gauss-Legendre integrator for the integrals of the tabulated model, the relative tolerance of the interpolation, and the range of the table in units of the scale radius of the wrapped model. The integrals of the tabulated model use the same relative tolerance for adaptive integration as the wrapped model. The table, the total mass and the central potential are calculated at construction, and are not invalidated when the parameters or integrators of the wrapped model change. */
+    TabulatedModel(const Model* model, const GaussLegendre* gl, double tol = 1e-8, double xmin = 1e-4, double xmax = 1e4);
+
+    /** Constructor of the TabulatedModel class that uses a cache file. It reads in the same arguments as the constructor above, and the name of the cache file. If the file holds a table for the same wrapped model and tabulation parameters, the table is memory-mapped from the file; otherwise, the model is tabulated and the table is written to the file, replacing any table for another model. Failures to write the file are ignored, since the table remains valid in memory. */
+    TabulatedModel(const Model* model, const GaussLegendre* gl, std::string filename, double tol = 1e-8, double xmin = 1e-4, double xmax = 1e4);
+
+    /** Destructor of the TabulatedModel class. It unmaps the cache file, if the table was loaded from one. */
+    ~TabulatedModel();
+
+    /** The copy constructor is deleted, since the table may be a memory mapping that is owned by the model. */
+    TabulatedModel(const TabulatedModel&) = delete;
+
+    /** The assignment operator is deleted, since the table may be a memory mapping that is owned by the model. */
+    TabulatedModel& operator=(const TabulatedModel&) = delete;
+
+    /** This function returns the scale radius of the wrapped model. */
+    double scale_radius() const;
+
+    /** This function returns the parameters of the wrapped model. */
+    std::vector<double> parameters() const;
+
+    /** This function returns the stretched exponential tail of the wrapped model, if it has one. */
+    bool exponential_tail(double& b, double& r0, double& m) const;
+
+    /** This function returns the breakpoints of the wrapped model. Each of these radii is represented by two nodes of the grid, such that no grid interval straddles them. */
+    std::vector<double> breakpoints() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the wrapped model, if it has one. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the wrapped model, if it has one. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the total mass \f$M_{\text{tot}}\f$ of the wrapped model, which is calculated once at construction. */
+    double total_mass() const;
+
+    /** This function returns the central potential \f$\Psi_0\f$ of the wrapped model, which is calculated once at construction. */
+    double central_potential() const;
+
+    /** This function returns the interpolated density \f$\rho(r)\f$ at radius \f$r\f$. */
+    double density(double r) const;
+
+    /** This function stores the interpolated density \f$\rho(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the interpolated derivative of the density \f$\rho'(r)\f$ at radius \f$r\f$. */
+    double derivative_density(double r) const;
+
+    /** This function stores the interpolated derivative of the density \f$\rho'(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the interpolated second derivative of the density \f$\rho''(r)\f$ at radius \f$r\f$. */
+    double second_derivative_density(double r) const;
+
+    /** This function stores the interpolated second derivative of the density \f$\rho''(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void second_derivative_density(const double* r, double* out, size_t n) const;
+
+    /** This function returns the interpolated mass \f$M(r)\f$ at radius \f$r\f$. */
+    double mass(double r) const;
+
+    /** This function stores the interpolated mass \f$M(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void mass(const double* r, double* out, size_t n) const;
+
+    /** This function returns the interpolated potential \f$\Psi(r)\f$ at radius \f$r\f$. */
+    double potential(double r) const;
+
+    /** This function stores the interpolated potential \f$\Psi(r_i)\f$ at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void potential(const double* r, double* out, size_t n) const;
+
+    /** This function returns the interpolated surface density \f$\Sigma(R)\f$ at projected radius \f$R\f$. */
+    double surface_density(double R) const;
+
+    /** This function stores the interpolated surface density \f$\Sigma(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the interpolated derivative of the surface density \f$\Sigma'(R)\f$ at projected radius \f$R\f$. */
+    double derivative_surface_density(double R) const;
+
+    /** This function stores the interpolated derivative of the surface density \f$\Sigma'(R_i)\f$ at the \f$n\f$ projected radii \f$R_i\f$ in the array out. */
+    void derivative_surface_density(const double* R, double* out, size_t n) const;
+
+    /** This function returns the number of nodes of the grid. */
+    size_t num_nodes() const;
+
+    /** This function returns the largest relative error of the interpolated profiles at the test points of the final grid. It exceeds the tolerance given to the constructor where the splits of the grid stalled, typically because the profiles of the wrapped model are themselves not accurate to the tolerance, or because a profile is not smooth at a radius that is not a breakpoint of the wrapped model. */
+    double error_estimate() const;
+
+    /** This function returns true if the table was loaded from a cache file. */
+    bool from_cache() const;
+
+private:
+
+    /** The tabulated profiles. */
+    enum Profile { Rho, DRho, D2Rho, Mass, Psi, Sigma, DSigma, NumProfiles };
+
+    /** This function tabulates the wrapped model on an adaptive grid, with the tolerance and range given to the constructor. */
+    void tabulate(double tol, double xmin, double xmax);
+
+    /** This function points the table at the nodes, values and slopes held by the vectors of the model. */
+    void publish();
+
+    /** This function returns the key of the cache file for the given tabulation parameters: the class name of the wrapped model, followed by the tabulation parameters, the relative tolerance, the number of Gauss-Legendre nodes and the parameters of the wrapped model, and its identifying values. */
+    std::string cache_key(double tol, double xmin, double xmax) const;
+
+    /** This function maps the cache file into memory and points the table at it, if the file holds a table with the given key. It returns true on success. */
+    bool load(const std::string& filename, const std::string& key);
+
+    /** This function writes the table to the cache file with the given key. The file is written under a temporary name and then renamed, such that other processes never see a partial file. */
+    void save(const std::string& filename, const std::string& key) const;
+
+    /** This function evaluates all profiles of the wrapped model at the \f$n\f$ radii \f$r_i\f$, and stores profile \f$k\f$ at radius \f$r_i\f$ in f[k*n+i]. */
+    void sample(const double* r, double* f, size_t n) const;
+
+    /** This function calculates the slopes \f${\text{d}}f/{\text{d}}x\f$ of all profiles at all nodes of the grid. */
+    void calculate_slopes();
+
+    /** This function returns the Hermite interpolant of profile \f$k\f$ on grid interval \f$i\f$ at \f$x = \ln r\f$. */
+    double interpolate(int k, size_t i, double x) const;
+
+    /** This function returns profile \f$k\f$ at radius \f$r\f$, interpolated from the grid or, outside the tabulated range, obtained from the wrapped model. */
+    double value(int k, double r) const;
+
+    /** The wrapped model. */
+    const Model* _model;
+
+    /** The total mass of the wrapped model. */
+    double _Mtot;
+
+    /** The central potential of the wrapped model. */
+    double _Psi0;
+
+    /** The nodes \f$x_j = \ln r_j\f$ of the grid. */
+    std::vector<double> _xv;
+
+    /** The values of the profiles at the nodes, stored in _fv[k]. */
+    std::vector<std::vector<double>> _fv;
+
+    /** The slopes \f${\text{d}}f/{\text{d}}x\f$ of the profiles at the nodes, stored in _gv[k]. */
+    std::vector<std::vector<double>> _gv;
+
+    /** The number of nodes of the table. */
+    size_t _n = 0;
+
+    /** The nodes of the table, pointing either into _xv or into the cache file mapping. */
+    const double* _x = nullptr;
+
+    /** The values of profile \f$k\f$ at the nodes, pointing either into _fv[k] or into the cache file mapping. */
+    const double* _f[NumProfiles];
+
+    /** The slopes of profile \f$k\f$ at the nodes, pointing either into _gv[k] or into the cache file mapping. */
+    const double* _g[NumProfiles];
+
+    /** The largest relative error of the table at the test points. */
+    double _error = 0.0;
+
+    /** The memory mapping of the cache file, or a null pointer. */
+    void* _mapping = nullptr;
+
+    /** The size of the memory mapping of the cache file. */
+    size_t _mappingsize = 0;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,107 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#include "TanhSinh.hpp"
+
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The range [-tmax,tmax] of the trapezoidal rule; beyond it, the nodes are closer than 1e-16 to the end points
+    const double tmax = 3.2;
+
+    // The distance to the end point theta = pi/2 below which the integrand is extrapolated rather than evaluated
+    const double dmin = 1e-4;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TanhSinh::TanhSinh(double reltol, int maxlevel)
+{
+    _reltol = reltol;
+    _maxlevel = maxlevel;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TanhSinh::integrate_0_infty(std::function<double(double)> X, double rb) const
+{
+    return integrate_segment(X, 0.0, rb, false) + integrate_segment(X, 0.0, rb, true);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TanhSinh::integrate_0_r(std::function<double(double)> X, double r, double rb) const
+{
+    if (r<=rb)
+        return integrate_segment(X, 0.0, r, false);
+    else
+        return integrate_segment(X, 0.0, rb, false) + integrate_segment(X, asin(rb/r), r, false);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TanhSinh::integrate_r_infty(std::function<double(double)> X, double r, double rb) const
+{
+    double eps = 1e-4;
+    if (r/rb >= 1.0-eps)
+        return integrate_segment(X, 0.0, r, true);
+    else
+        return integrate_segment(X, asin(r/rb), r, true) + integrate_segment(X, 0.0, rb, true);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double TanhSinh::integrate_segment(const std::function<double(double)>& X, double a, double R, bool csc) const
+{
+    double halflength = 0.25*M_PI - 0.5*a;
+
+    // The integrand as a function of theta, including the Jacobian of the substitution, at a distance d from
+    // the upper end point pi/2 or from the lower end point a. Close to the upper end point, sin(theta) and
+    // cos(theta) are calculated from the distance d to avoid cancellation.
+
+    auto mapped = [&](double d, bool upper) -> double
+    {
+        double s = upper ? cos(d) : sin(a+d);
+        double c = upper ? sin(d) : cos(a+d);
+        if (csc) return X(R/s) * (R*c/(s*s));
+        else return X(R*s) * (R*c);
+    };
+    double d1 = min(dmin,0.5*halflength);
+    double X1 = mapped(d1, true);
+    double X2 = mapped(2.0*d1, true);
+
+    // The weighted integrand at the node x = tanh(pi/2 sinh t), with the weight dx/dt written in terms of
+    // e = exp(-pi |sinh t|) such that it does not overflow for large |t|
+
+    auto term = [&](double t) -> double
+    {
+        double e = exp(-M_PI*sinh(fabs(t)));
+        double d = 2.0*halflength*e/(1.0+e);
+        double w = 2.0*M_PI*halflength*cosh(t)*e/((1.0+e)*(1.0+e));
+        if (w==0.0) return 0.0;
+        if (t>0.0 && d<d1) return w*(X1 + (X1-X2)*(d1-d)/d1);
+        return w*mapped(d, t>0.0);
+    };
+
+    // Apply the trapezoidal rule with step h = 1, and halve the step until two successive estimates agree
+
+    double sum = term(0.0);
+    for (int k=1; k<=tmax; k++) sum += term(k) + term(-k);
+    double h = 1.0;
+    double result = h*sum;
+    for (int level=1; level<=_maxlevel; level++)
+    {
+        h *= 0.5;
+        for (int k=1; k*h<=tmax; k+=2) sum += term(k*h) + term(-k*h);
+        double previous = result;
+        result = h*sum;
+        if (fabs(result-previous) <= _reltol*fabs(result)) break;
+    }
+    return result;
+}
+
+//////////////////////////////////////////////////////////////////////
@@ -0,0 +1,49 @@
+/*//////////////////////////////////////////////////////////////////
+////     SpheCow -- Flexible dynamical models for galaxies      ////
+////                and dark matter haloes                      ////
+////     © Sterrenkundig Observatorium, Universiteit Gent       ////
+///////////////////////////////////////////////////////////////// */
+
+#ifndef TANHSINH_HPP
+#define TANHSINH_HPP
+
+#include "Basics.hpp"
+#include <functional>
+
+//////////////////////////////////////////////////////////////////////
+
+/** TanhSinh is the class that represents double-exponential or tanh-sinh integrators. A tanh-sinh integrator transforms an integral over the interval \f$[-1,1]\f$ by the substitution \f$x = \tanh(\tfrac{\pi}{2}\sinh t)\f$ into an integral over the real axis, \f[ \int_{-1}^1 f(x)\,{\text{d}}x = \int_{-\infty}^\infty f(x(t))\,\frac{\tfrac{\pi}{2}\cosh t}{\cosh^2(\tfrac{\pi}{2}\sinh t)}\,{\text{d}}t, \f] and approximates the latter by the trapezoidal rule with step \f$h\f$. Because the transformed integrand decays double-exponentially, the rule converges exponentially in the number of nodes even if \f$f(x)\f$ has integrable singularities at the end points. The step is halved until two successive estimates agree to within the relative tolerance; each refinement level reuses all integrand evaluations of the previous levels. For more background information, see <a href="https://doi.org/10.2977/prims/1195192451">Takahasi & Mori (1974)</a>.
+
+    The integration routines use the same interface and the same substitutions \f$u = r\sin\theta\f$ and \f$u = r\csc\theta\f$ as the GaussLegendre class, so that a tanh-sinh integrator can be used as an alternative backend for selected quantities of a model. All segments in \f$\theta\f$ end at \f$\theta=\pi/2\f$. Close to that end point, the radius \f$u\f$ approaches the lower or upper integration limit, and integrands with a kernel such as \f$(u^2-r^2)^{-1/2}\f$ can no longer be evaluated accurately in floating point arithmetic. Since the substitution turns such integrable singularities into a finite value at \f$\theta=\pi/2\f$, the integrand at nodes closer to that end point than \f$10^{-4}\f$ is extrapolated linearly from its values at distances \f$10^{-4}\f$ and \f$2\times10^{-4}\f$. */
+
+class TanhSinh
+{
+public:
+
+    /** Constructor for the TanhSinh class. It reads in the relative tolerance that determines when the refinement stops, and the maximum number of refinement levels. At level \f$k\f$, the step is \f$h = 2^{-k}\f$. */
+    TanhSinh(double reltol = 1e-10, int maxlevel = 8);
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,+\infty[\f$, using the same substitutions as the function GaussLegendre::integrate_0_infty(). */
+    double integrate_0_infty(std::function<double(double)> X, double rb) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[0,r]\f$, using the same substitutions as the function GaussLegendre::integrate_0_r(). */
+    double integrate_0_r(std::function<double(double)> X, double r, double rb) const;
+
+    /** This function returns an estimate of the integral of the function \f$X(u)\f$ over the interval \f$[r,+\infty[\f$, using the same substitutions as the function GaussLegendre::integrate_r_infty(). */
+    double integrate_r_infty(std::function<double(double)> X, double r, double rb) const;
+
+private:
+
+    /** This function returns the tanh-sinh estimate of the integral of the function \f$X(u)\f$ over the segment \f$[a,\pi/2]\f$ in \f$\theta\f$, with the substitution \f$u = R\csc\theta\f$ if csc is true, or \f$u = R\sin\theta\f$ otherwise. */
+    double integrate_segment(const std::function<double(double)>& X, double a, double R, bool csc) const;
+
+    /** The relative tolerance. */
+    double _reltol;
+
+    /** The maximum number of refinement levels. */
+    int _maxlevel;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+#endif
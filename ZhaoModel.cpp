@@ -9,6 +9,14 @@
 //////////////////////////////////////////////////////////////////////
 
 ZhaoModel::ZhaoModel(double Mtot, double rb, double alpha, double beta, double gamma, const GaussLegendre* gl)
+{
+    _gl = gl;
+    set_parameters(Mtot, rb, alpha, beta, gamma);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ZhaoModel::set_parameters(double Mtot, double rb, double alpha, double beta, double gamma)
 {
     _Mtot = Mtot;
     _rb = rb;
@@ -19,7 +27,14 @@ ZhaoModel::ZhaoModel(double Mtot, double rb, double alpha, double beta, double g
     double lg2 = lgamma((_beta-3.0)/_alpha);
     double lg3 = lgamma((3.0-_gamma)/_alpha);
     _rhoff = _alpha * exp(lg1-lg2-lg3) / (4.0*M_PI);
-    _gl = gl;
+    invalidate_invariants();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+std::vector<double> ZhaoModel::parameters() const
+{
+    return {_Mtot, _rb, _alpha, _beta, _gamma};
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -31,6 +46,28 @@ double ZhaoModel::scale_radius() const
 
 //////////////////////////////////////////////////////////////////////
 
+bool ZhaoModel::outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const
+{
+    xt = pow(10.0,1.0/_alpha);
+    p = _beta;
+    alpha = _alpha;
+    av = binomial_series(_Mtot/pow(_rb,3)*_rhoff, (_beta-_gamma)/_alpha);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool ZhaoModel::inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const
+{
+    xs = pow(10.0,-1.0/_alpha);
+    p = _gamma;
+    alpha = _alpha;
+    av = binomial_series(_Mtot/pow(_rb,3)*_rhoff, (_beta-_gamma)/_alpha);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double ZhaoModel::density(double r) const
 {
     double dimf = _Mtot/pow(_rb,3);
@@ -42,6 +79,13 @@ double ZhaoModel::density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void ZhaoModel::density(const double* r, double* out, size_t n) const
+{
+    for (size_t i=0; i<n; i++) out[i] = ZhaoModel::density(r[i]);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double ZhaoModel::derivative_density(double r) const
 {
     double dimf = _Mtot/pow(_rb,4);
@@ -70,6 +114,13 @@ double ZhaoModel::second_derivative_density(double r) const
 
 //////////////////////////////////////////////////////////////////////
 
+void ZhaoModel::mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const
+{
+    cumulative_mass_and_potential(rv,Mv,Psiv);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 double ZhaoModel::total_mass() const
 {
     return _Mtot;
@@ -20,11 +20,26 @@ public:
     /** Constructor of the ZhaoModel class. */
     ZhaoModel(double Mtot, double rb, double alpha, double beta, double gamma, const GaussLegendre* gl);
 
+    /** This function changes the parameters of the ZhaoModel object, which have the same meaning as in the constructor. */
+    void set_parameters(double Mtot, double rb, double alpha, double beta, double gamma);
+
+    /** This function returns the parameters of the ZhaoModel object, in the order of the function set_parameters(). */
+    std::vector<double> parameters() const;
+
     /** This function returns the break radius \f$r_{\text{b}}\f$ of the Zhao model. */
     double scale_radius() const;
+
+    /** This function returns the outer asymptotic expansion of the density of the Zhao model, which follows from the binomial series of \f$\rho(r) \propto x^{-\beta}\,(1+x^{-\alpha})^{(\gamma-\beta)/\alpha}\f$ in powers of \f$x^{-\alpha}\f$. */
+    bool outer_expansion(double& xt, double& p, double& alpha, std::vector<double>& av) const;
+
+    /** This function returns the inner asymptotic expansion of the density of the Zhao model, which follows from the binomial series of \f$\rho(r) \propto x^{-\gamma}\,(1+x^{\alpha})^{(\gamma-\beta)/\alpha}\f$ in powers of \f$x^{\alpha}\f$. */
+    bool inner_expansion(double& xs, double& p, double& alpha, std::vector<double>& av) const;
     
     /** This function returns the density \f$\rho(r)\f$ of the Zhao model at radius \f$r\f$. */
     double density(double r) const;
+
+    /** This function stores the density \f$\rho(r_i)\f$ of the Zhao model at the \f$n\f$ radii \f$r_i\f$ in the array out. */
+    void density(const double* r, double* out, size_t n) const;
     
     /** This function returns the derivative of the density \f$\rho'(r)\f$ of the Zhao model at radius \f$r\f$. */
     double derivative_density(double r) const;
@@ -32,6 +47,9 @@ public:
     /** This function returns the second derivative of the density \f$\rho''(r)\f$ of the Zhao model at radius \f$r\f$. */
     double second_derivative_density(double r) const;
 
+    /** This function calculates the mass \f$M(r_i)\f$ and the potential \f$\Psi(r_i)\f$ of the Zhao model at the radii \f$r_i\f$ in the vector rv, in a single cumulative sweep over the radii. */
+    void mass_and_potential_profiles(const std::vector<double>& rv, std::vector<double>& Mv, std::vector<double>& Psiv) const;
+
     /** This function returns the total mass \f$M_{\text{tot}}\f$ of the Zhao model. */
     double total_mass() const;
 